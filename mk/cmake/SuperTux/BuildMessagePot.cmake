@@ -13,7 +13,7 @@ if(GENERATE_MESSAGESPOT)
     add_custom_command(
       OUTPUT ${MESSAGES_POT_FILE}
       COMMAND ${XGETTEXT_EXECUTABLE}
-      ARGS --keyword=_ --language=C++ --output=${MESSAGES_POT_FILE} ${SUPERTUX_SOURCES_CXX}
+      ARGS --keyword=_ --keyword=_s --language=C++ --output=${MESSAGES_POT_FILE} ${SUPERTUX_SOURCES_CXX}
       DEPENDS ${SUPERTUX_SOURCES_CXX}
       WORKING_DIRECTORY ${CMAKE_CURRENT_SOURCE_DIR}
       COMMENT "Generating POT file ${MESSAGES_POT_FILE}"
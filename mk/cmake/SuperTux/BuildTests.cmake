@@ -1,11 +1,16 @@
 option(BUILD_TESTS "Build test cases" OFF)
+option(BUILD_BENCHMARKS "Build the benchmarks in tests/benchmark/ (requires BUILD_TESTS)" OFF)
 
 if(BUILD_TESTS)
   find_package(Threads REQUIRED)
   find_package(GTest REQUIRED)
 
-  # build SuperTux tests
+  # build SuperTux tests, the benchmarks are a separate binary
   file(GLOB_RECURSE TEST_SUPERTUX_SOURCES tests/*.cpp)
+  file(GLOB_RECURSE BENCHMARK_SUPERTUX_SOURCES tests/benchmark/*.cpp)
+  if(BENCHMARK_SUPERTUX_SOURCES)
+    list(REMOVE_ITEM TEST_SUPERTUX_SOURCES ${BENCHMARK_SUPERTUX_SOURCES})
+  endif()
   add_executable(test_supertux2 ${TEST_SUPERTUX_SOURCES})
   target_compile_options(test_supertux2 PRIVATE ${WARNINGS_CXX_FLAGS})
   target_link_libraries(test_supertux2
@@ -19,6 +24,16 @@ if(BUILD_TESTS)
     WORKING_DIRECTORY ${CMAKE_CURRENT_BINARY_DIR}
     COMMAND test_supertux2)
 
+  # not part of 'make test', run benchmark_supertux2 by hand
+  if(BUILD_BENCHMARKS)
+    add_executable(benchmark_supertux2 ${BENCHMARK_SUPERTUX_SOURCES})
+    target_compile_options(benchmark_supertux2 PRIVATE ${WARNINGS_CXX_FLAGS})
+    target_link_libraries(benchmark_supertux2
+      GTest::GTest GTest::Main
+      supertux2_lib
+      ${CMAKE_THREAD_LIBS_INIT})
+  endif()
+
   # Prepare coverage with gcov/lcov
   if(CMAKE_BUILD_TYPE STREQUAL "Debug")
     if(CMAKE_CXX_COMPILER_ID STREQUAL "GNU")
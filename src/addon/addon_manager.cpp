@@ -528,6 +528,7 @@ AddonManager::enable_addon(const AddonId& addon_id)
       if (addon.get_type() == Addon::LANGUAGEPACK)
       {
         PHYSFS_enumerate(addon.get_id().c_str(), add_to_dictionary_path, nullptr);
+        invalidate_translations();
       }
       addon.set_enabled(true);
     }
@@ -556,6 +557,7 @@ AddonManager::disable_addon(const AddonId& addon_id)
       if (addon.get_type() == Addon::LANGUAGEPACK)
       {
         PHYSFS_enumerate(addon.get_id().c_str(), remove_from_dictionary_path, nullptr);
+        invalidate_translations();
       }
       addon.set_enabled(false);
     }
@@ -21,6 +21,7 @@
 
 OpenALSoundSource::OpenALSoundSource() :
   m_source(),
+  m_buffer(),
   m_gain(1.0f),
   m_volume(1.0f)
 {
@@ -19,6 +19,7 @@
 
 #include <al.h>
 
+#include "audio/sound_buffer.hpp"
 #include "audio/sound_source.hpp"
 
 class OpenALSoundSource : public SoundSource
@@ -50,6 +51,11 @@ public:
 
 protected:
   ALuint m_source;
+
+  /** static buffer attached to the source, kept alive while the
+      source exists (unused by StreamSoundSource) */
+  SoundBufferPtr m_buffer;
+
   float m_gain;
   float m_volume;
 
@@ -0,0 +1,74 @@
+//  SuperTux
+//  Copyright (C) 2024 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef HEADER_SUPERTUX_AUDIO_SOUND_BUFFER_HPP
+#define HEADER_SUPERTUX_AUDIO_SOUND_BUFFER_HPP
+
+#include <memory>
+#include <vector>
+
+#include <al.h>
+
+#include "audio/sound_file.hpp"
+
+/** Decoded PCM samples of a sound effect, produced by the background
+    loader and uploaded into a SoundBuffer on the main thread */
+struct SoundData final
+{
+  ALenum format;
+  ALsizei rate;
+  std::vector<char> samples;
+
+  /** The opened file if it is too large to be buffered, so that
+      streaming it doesn't open it again */
+  std::unique_ptr<SoundFile> stream;
+};
+
+/** Owns an OpenAL buffer. Sources playing the buffer keep a reference
+    to it, so evicting it from the SoundManager cache never deletes a
+    buffer that is still attached to a source. */
+class SoundBuffer final
+{
+public:
+  SoundBuffer(ALuint buffer, size_t size) :
+    m_buffer(buffer),
+    m_size(size)
+  {}
+
+  ~SoundBuffer()
+  {
+    alDeleteBuffers(1, &m_buffer);
+  }
+
+  ALuint get() const { return m_buffer; }
+
+  /** size of the sample data in bytes */
+  size_t get_size() const { return m_size; }
+
+private:
+  ALuint m_buffer;
+  size_t m_size;
+
+private:
+  SoundBuffer(const SoundBuffer&) = delete;
+  SoundBuffer& operator=(const SoundBuffer&) = delete;
+};
+
+using SoundBufferPtr = std::shared_ptr<SoundBuffer>;
+
+#endif
+
+/* EOF */
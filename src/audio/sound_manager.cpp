@@ -18,6 +18,7 @@
 
 #include <SDL.h>
 #include <assert.h>
+#include <chrono>
 #include <iostream>
 #include <stdexcept>
 #include <sstream>
@@ -27,6 +28,8 @@
 #include "audio/sound_file.hpp"
 #include "audio/stream_sound_source.hpp"
 #include "util/log.hpp"
+#include "util/string_util.hpp"
+#include "util/thread_pool.hpp"
 
 SoundManager::SoundManager() :
   m_device(alcOpenDevice(nullptr)),
@@ -34,6 +37,11 @@ SoundManager::SoundManager() :
   m_sound_enabled(false),
   m_sound_volume(0),
   m_buffers(),
+  m_buffers_lru(),
+  m_pending_buffers(),
+  m_buffers_size(0),
+  m_buffer_cache_size(32 * 1024 * 1024),
+  m_loader(),
   m_sources(),
   m_update_list(),
   m_music_source(),
@@ -53,6 +61,8 @@ SoundManager::SoundManager() :
     m_sound_enabled = true;
     m_music_enabled = true;
 
+    m_loader = std::make_unique<ThreadPool>(1);
+
     set_listener_orientation(Vector(0.0f, 0.0f), Vector(0.0f, -1.0f));
   } catch(std::exception& e) {
     if (m_context != nullptr) {
@@ -70,12 +80,15 @@ SoundManager::SoundManager() :
 
 SoundManager::~SoundManager()
 {
+  if (m_loader) {
+    // don't bother decoding sounds that will never be played
+    m_loader->clear();
+    m_loader.reset();
+  }
+
   m_music_source.reset();
   m_sources.clear();
-
-  for (const auto& buffer : m_buffers) {
-    alDeleteBuffers(1, &buffer.second);
-  }
+  m_buffers.clear();
 
   if (m_context != nullptr) {
     alcDestroyContext(m_context);
@@ -87,63 +100,197 @@ SoundManager::~SoundManager()
   }
 }
 
-ALuint
-SoundManager::load_file_into_buffer(SoundFile& file)
+std::shared_ptr<SoundData>
+SoundManager::decode_sound_file(const std::string& filename)
+{
+  // Runs on the loader thread, so no logging and no OpenAL calls here.
+  // Errors reach the main thread through the future and are logged
+  // there, see process_loaded_buffers().
+  std::unique_ptr<SoundFile> file(load_sound_file(filename));
+
+  auto data = std::make_shared<SoundData>();
+
+  // large files are streamed instead, see intern_create_sound_source()
+  if (file->m_size >= MAX_BUFFERED_SOUND_SIZE)
+  {
+    data->stream = std::move(file);
+    return data;
+  }
+
+  data->format = get_sample_format(*file);
+  data->rate = static_cast<ALsizei>(file->m_rate);
+  data->samples.resize(file->m_size);
+  file->read(data->samples.data(), file->m_size);
+  return data;
+}
+
+SoundBufferPtr
+SoundManager::upload_sound_data(const SoundData& data)
 {
-  ALenum format = get_sample_format(file);
   ALuint buffer;
   alGenBuffers(1, &buffer);
   check_al_error("Couldn't create audio buffer: ");
-  std::unique_ptr<char[]> samples(new char[file.m_size]);
-  file.read(samples.get(), file.m_size);
-  log_debug << "buffer: " << buffer << "\n"
-            << "format: " << format << "\n"
-            << "samples: " << samples.get() << "\n"
-            << "file size: " << static_cast<ALsizei>(file.m_size) << "\n"
-            << "file rate: " << static_cast<ALsizei>(file.m_rate) << "\n";
-
-  alBufferData(buffer, format, samples.get(),
-               static_cast<ALsizei>(file.m_size),
-               static_cast<ALsizei>(file.m_rate));
+  auto sound_buffer = std::make_shared<SoundBuffer>(buffer, data.samples.size());
+
+  alBufferData(buffer, data.format, data.samples.data(),
+               static_cast<ALsizei>(data.samples.size()),
+               data.rate);
   check_al_error("Couldn't fill audio buffer: ");
 
-  return buffer;
+  return sound_buffer;
 }
 
-std::unique_ptr<OpenALSoundSource>
-SoundManager::intern_create_sound_source(const std::string& filename)
+SoundBufferPtr
+SoundManager::get_buffer(const std::string& filename, std::unique_ptr<SoundFile>* stream)
 {
-  assert(m_sound_enabled);
+  auto it = m_buffers.find(filename);
+  if (it == m_buffers.end()) {
+    // not preloaded, decode right away
+    std::shared_ptr<SoundData> data = decode_sound_file(filename);
+    if (data->stream) {
+      if (stream)
+        *stream = std::move(data->stream);
+      return {};
+    }
 
-  auto source = std::make_unique<OpenALSoundSource>();
-  source->set_volume(static_cast<float>(m_sound_volume) / 100.0f);
+    m_buffers_lru.push_front(filename);
+    CachedBuffer& entry = m_buffers[filename];
+    entry.lru = m_buffers_lru.begin();
+    try {
+      entry.buffer = upload_sound_data(*data);
+    } catch(...) {
+      m_buffers_lru.pop_front();
+      m_buffers.erase(filename);
+      throw;
+    }
+    m_buffers_size += entry.buffer->get_size();
+    log_debug << "Adding \"" << filename <<
+      "\" into the buffer, file size: " << entry.buffer->get_size() << std::endl;
 
-  ALuint buffer;
+    SoundBufferPtr buffer = entry.buffer;
+    evict_buffers();
+    return buffer;
+  }
 
-  // reuse an existing static sound buffer
-  auto it = m_buffers.find(filename);
-  if (it != m_buffers.end()) {
-    buffer = it->second;
-  } else {
-    // Load sound file
-    std::unique_ptr<SoundFile> file(load_sound_file(filename));
-
-    if (file->m_size < 100000) {
-      log_debug << "Adding \"" << filename <<
-        "\" into the buffer, file size: " << file->m_size << std::endl;
-      buffer = load_file_into_buffer(*file);
-      m_buffers.insert(std::make_pair(filename, buffer));
+  touch_buffer(it->second);
+  if (it->second.buffer)
+    return it->second.buffer;
+
+  log_debug << "Waiting for \"" << filename << "\" to finish loading" << std::endl;
+  SoundBufferPtr buffer = finish_buffer(it, stream);
+  evict_buffers();
+  return buffer;
+}
+
+SoundBufferPtr
+SoundManager::finish_buffer(std::unordered_map<std::string, CachedBuffer>::iterator it,
+                            std::unique_ptr<SoundFile>* stream)
+{
+  CachedBuffer& entry = it->second;
+  try {
+    std::shared_ptr<SoundData> data = entry.pending.get();
+    entry.pending = {};
+    if (data->stream) {
+      if (stream)
+        *stream = std::move(data->stream);
     } else {
-      log_debug << "Playing \"" << filename <<
-        "\" as StreamSoundSource, file size: " << file->m_size << std::endl;
-      auto stream_source = std::make_unique<StreamSoundSource>();
-      stream_source->set_sound_file(std::move(file));
-      stream_source->set_volume(static_cast<float>(m_sound_volume) / 100.0f);
-      return std::unique_ptr<OpenALSoundSource>(stream_source.release());
+      entry.buffer = upload_sound_data(*data);
+    }
+  } catch(...) {
+    m_buffers_lru.erase(entry.lru);
+    m_buffers.erase(it);
+    throw;
+  }
+
+  if (!entry.buffer) {
+    m_buffers_lru.erase(entry.lru);
+    m_buffers.erase(it);
+    return {};
+  }
+
+  m_buffers_size += entry.buffer->get_size();
+  log_debug << "Adding \"" << it->first <<
+    "\" into the buffer, file size: " << entry.buffer->get_size() << std::endl;
+  return entry.buffer;
+}
+
+void
+SoundManager::process_loaded_buffers()
+{
+  for (auto name = m_pending_buffers.begin(); name != m_pending_buffers.end(); ) {
+    auto it = m_buffers.find(*name);
+    if (it != m_buffers.end() && !it->second.buffer) {
+      if (it->second.pending.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+        ++name;
+        continue;
+      }
+
+      try {
+        finish_buffer(it);
+      } catch(std::exception& e) {
+        log_warning << "Error while preloading sound file: " << e.what() << std::endl;
+      }
     }
+    name = m_pending_buffers.erase(name);
   }
 
-  alSourcei(source->m_source, AL_BUFFER, buffer);
+  evict_buffers();
+}
+
+void
+SoundManager::touch_buffer(CachedBuffer& entry)
+{
+  m_buffers_lru.splice(m_buffers_lru.begin(), m_buffers_lru, entry.lru);
+}
+
+void
+SoundManager::evict_buffers()
+{
+  // Buffers still attached to a source stay alive through the source's
+  // reference, they are only dropped from the cache here
+  auto name = m_buffers_lru.end();
+  while (m_buffers_size > m_buffer_cache_size && name != m_buffers_lru.begin()) {
+    --name;
+    auto it = m_buffers.find(*name);
+    assert(it != m_buffers.end());
+    if (!it->second.buffer)
+      continue; // still loading
+
+    m_buffers_size -= it->second.buffer->get_size();
+    log_debug << "Evicting \"" << *name << "\" from the buffer, "
+              << m_buffers_size << " of " << m_buffer_cache_size << " bytes in use" << std::endl;
+    m_buffers.erase(it);
+    name = m_buffers_lru.erase(name);
+  }
+}
+
+void
+SoundManager::set_buffer_cache_size(size_t bytes)
+{
+  m_buffer_cache_size = bytes;
+  evict_buffers();
+}
+
+std::unique_ptr<OpenALSoundSource>
+SoundManager::intern_create_sound_source(const std::string& filename)
+{
+  assert(m_sound_enabled);
+
+  std::unique_ptr<SoundFile> stream;
+  SoundBufferPtr buffer = get_buffer(filename, &stream);
+  if (!buffer) {
+    log_debug << "Playing \"" << filename << "\" as StreamSoundSource" << std::endl;
+    auto stream_source = std::make_unique<StreamSoundSource>();
+    // the file is only opened again if a finished preload closed it
+    stream_source->set_sound_file(stream ? std::move(stream) : load_sound_file(filename));
+    stream_source->set_volume(static_cast<float>(m_sound_volume) / 100.0f);
+    return std::unique_ptr<OpenALSoundSource>(stream_source.release());
+  }
+
+  auto source = std::make_unique<OpenALSoundSource>();
+  source->set_volume(static_cast<float>(m_sound_volume) / 100.0f);
+  alSourcei(source->m_source, AL_BUFFER, buffer->get());
+  source->m_buffer = std::move(buffer);
   return source;
 }
 
@@ -164,23 +311,34 @@ SoundManager::create_sound_source(const std::string& filename)
 void
 SoundManager::preload(const std::string& filename)
 {
-  if (!m_sound_enabled)
+  // music is always streamed, and reading the .music file logs
+  if (!m_sound_enabled || StringUtil::has_suffix(filename, ".music"))
     return;
 
   auto it = m_buffers.find(filename);
-  // already loaded?
-  if (it != m_buffers.end())
+  // already loaded or loading?
+  if (it != m_buffers.end()) {
+    touch_buffer(it->second);
     return;
-  try {
-    std::unique_ptr<SoundFile> file (load_sound_file(filename));
-    // only keep small files
-    if (file->m_size >= 100000)
-      return;
+  }
 
-    ALuint buffer = load_file_into_buffer(*file);
-    m_buffers.insert(std::make_pair(filename, buffer));
-  } catch(std::exception& e) {
-    log_warning << "Error while preloading sound file: " << e.what() << std::endl;
+  auto task = std::make_shared<std::packaged_task<std::shared_ptr<SoundData> ()> >(
+    [filename] { return decode_sound_file(filename); });
+
+  m_buffers_lru.push_front(filename);
+  CachedBuffer& entry = m_buffers[filename];
+  entry.pending = task->get_future().share();
+  entry.lru = m_buffers_lru.begin();
+  m_pending_buffers.push_back(filename);
+
+  m_loader->post([task] { (*task)(); });
+}
+
+void
+SoundManager::preload(const std::vector<std::string>& filenames)
+{
+  for (const auto& filename : filenames) {
+    preload(filename);
   }
 }
 
@@ -438,6 +596,9 @@ SoundManager::set_listener_orientation(const Vector& at, const Vector& up)
 void
 SoundManager::update()
 {
+  if (!m_pending_buffers.empty())
+    process_loaded_buffers();
+
   static Uint32 lasttime = SDL_GetTicks();
   Uint32 now = SDL_GetTicks();
 
@@ -17,14 +17,17 @@
 #ifndef HEADER_SUPERTUX_AUDIO_SOUND_MANAGER_HPP
 #define HEADER_SUPERTUX_AUDIO_SOUND_MANAGER_HPP
 
-#include <map>
+#include <future>
+#include <list>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include <al.h>
 #include <alc.h>
 
+#include "audio/sound_buffer.hpp"
 #include "math/vector.hpp"
 #include "util/currenton.hpp"
 
@@ -32,14 +35,21 @@ class SoundFile;
 class SoundSource;
 class StreamSoundSource;
 class OpenALSoundSource;
+class ThreadPool;
 
 class SoundManager final : public Currenton<SoundManager>
 {
   friend class OpenALSoundSource;
   friend class StreamSoundSource;
 
+public:
+  /** Sound files with more decoded sample data than this are streamed
+      instead of being kept in a static buffer */
+  static const size_t MAX_BUFFERED_SOUND_SIZE = 100000;
+
 private:
-  static ALuint load_file_into_buffer(SoundFile& file);
+  static std::shared_ptr<SoundData> decode_sound_file(const std::string& filename);
+  static SoundBufferPtr upload_sound_data(const SoundData& data);
   static ALenum get_sample_format(const SoundFile& file);
 
   static void print_openal_version();
@@ -70,9 +80,17 @@ public:
       when it finished playing) */
   void manage_source(std::unique_ptr<SoundSource> source);
 
-  /** preloads a sound, so that you don't get a lag later when playing it */
+  /** preloads a sound, so that you don't get a lag later when playing
+      it, the file is decoded in the background */
   void preload(const std::string& name);
 
+  /** preloads a list of sounds, e.g. all sounds referenced by a level */
+  void preload(const std::vector<std::string>& names);
+
+  /** Limits the amount of sample data held in static buffers, least
+      recently used sounds are evicted once the budget is exceeded */
+  void set_buffer_cache_size(size_t bytes);
+
   void set_listener_position(const Vector& position);
   void set_listener_velocity(const Vector& velocity);
   void set_listener_orientation(const Vector& at, const Vector& up);
@@ -103,10 +121,37 @@ public:
   /** Unsubscribe from updates for stream_sound_source. */
   void remove_from_update(StreamSoundSource* sss);
 
+private:
+  struct CachedBuffer
+  {
+    /** nullptr while the file is still being decoded */
+    SoundBufferPtr buffer;
+    std::shared_future<std::shared_ptr<SoundData> > pending;
+    std::list<std::string>::iterator lru;
+  };
+
 private:
   /** creates a new sound source, might throw exceptions, never returns nullptr */
   std::unique_ptr<OpenALSoundSource> intern_create_sound_source(const std::string& filename);
 
+  /** Returns the static buffer for the given file, waits for the
+      background loader if the file is still being decoded. Returns
+      nullptr if the file is too large and has to be streamed, the
+      already opened file is then moved into @a stream. */
+  SoundBufferPtr get_buffer(const std::string& filename, std::unique_ptr<SoundFile>* stream = nullptr);
+
+  /** Uploads the decoded data of a pending cache entry, removes the
+      entry again if decoding failed or the file has to be streamed,
+      see get_buffer() for @a stream */
+  SoundBufferPtr finish_buffer(std::unordered_map<std::string, CachedBuffer>::iterator it,
+                               std::unique_ptr<SoundFile>* stream = nullptr);
+
+  /** Uploads all buffers the background loader has finished */
+  void process_loaded_buffers();
+
+  void touch_buffer(CachedBuffer& entry);
+  void evict_buffers();
+
   void check_alc_error(const char* message) const;
 
 private:
@@ -115,7 +160,18 @@ private:
   bool m_sound_enabled;
   int m_sound_volume;
 
-  std::map<std::string, ALuint> m_buffers;
+  std::unordered_map<std::string, CachedBuffer> m_buffers;
+
+  /** most recently used files at the front */
+  std::list<std::string> m_buffers_lru;
+
+  /** files queued on the background loader */
+  std::vector<std::string> m_pending_buffers;
+
+  size_t m_buffers_size;
+  size_t m_buffer_cache_size;
+  std::unique_ptr<ThreadPool> m_loader;
+
   std::vector<std::unique_ptr<OpenALSoundSource> > m_sources;
 
   std::vector<StreamSoundSource*> m_update_list;
@@ -218,29 +218,26 @@ Crusher::update(float dt_sec)
 
   //because this game's physics are so broken, we have to create faux collisions with bricks
 
-  for (auto& brick : Sector::get().get_objects_by_type<Brick>())
+  Rectf brickbox = get_bbox().grown(-1);
+  brickbox.set_bottom(m_sideways ? get_bbox().get_bottom() - 1.f :
+    m_flip == NO_FLIP ? get_bbox().get_bottom() + 9.f : get_bbox().get_bottom() - 1.f);
+  brickbox.set_top(m_sideways ? get_bbox().get_top() + 1.f :
+    m_flip != NO_FLIP ? get_bbox().get_top() - 9.f : get_bbox().get_top() + 1.f);
+  brickbox.set_left((m_sideways && m_physic.get_velocity_x() < 0.f) ?
+    get_bbox().get_left() - 9.f : get_bbox().get_left() + 1.f);
+  brickbox.set_right((m_sideways && m_physic.get_velocity_x() > 0.f) ?
+    get_bbox().get_right() + 9.f : get_bbox().get_right() - 1.f);
+
+  for (auto* brick : Sector::get().query_rect<Brick>(brickbox))
   {
-    Rectf brickbox = get_bbox().grown(-1);
-    brickbox.set_bottom(m_sideways ? get_bbox().get_bottom() - 1.f :
-      m_flip == NO_FLIP ? get_bbox().get_bottom() + 9.f : get_bbox().get_bottom() - 1.f);
-    brickbox.set_top(m_sideways ? get_bbox().get_top() + 1.f :
-      m_flip != NO_FLIP ? get_bbox().get_top() - 9.f : get_bbox().get_top() + 1.f);
-    brickbox.set_left((m_sideways && m_physic.get_velocity_x() < 0.f) ?
-      get_bbox().get_left() - 9.f : get_bbox().get_left() + 1.f);
-    brickbox.set_right((m_sideways && m_physic.get_velocity_x() > 0.f) ?
-      get_bbox().get_right() + 9.f : get_bbox().get_right() - 1.f);
-
-    if (brickbox.contains(brick.get_bbox()))
+    if (brick->get_class_name() != "heavy-brick")
     {
-      if (brick.get_class_name() != "heavy-brick")
-      {
-        brick.break_for_crusher(this);
-      }
-      else
-      {
-        if (is_big()) {
-          brick.break_for_crusher(this);
-        }
+      brick->break_for_crusher(this);
+    }
+    else
+    {
+      if (is_big()) {
+        brick->break_for_crusher(this);
       }
     }
   }
@@ -83,10 +83,9 @@ Totem::active_update(float dt_sec)
     }
 
     // jump a bit if we find a suitable totem
-    for (auto& obj : Sector::get().get_objects_by_type<MovingObject>()) {
-      auto t = dynamic_cast<Totem*>(&obj);
-      if (!t) continue;
-
+    // only totems about 128 pixels to the left on the same height qualify
+    const Rectf jump_area(m_col.m_bbox.p1() - Vector(131.0f, 3.0f), Sizef(6.0f, 6.0f));
+    for (auto* t : Sector::get().query_rect<Totem>(jump_area)) {
       // skip if we are not approaching each other
       if (!((m_dir == Direction::LEFT) && (t->m_dir == Direction::RIGHT))) continue;
 
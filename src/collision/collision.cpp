@@ -17,6 +17,7 @@
 #include "collision/collision.hpp"
 
 #include <algorithm>
+#include <array>
 
 #include "math/aatriangle.hpp"
 #include "math/rectf.hpp"
@@ -59,81 +60,86 @@ inline void makePlane(const Vector& p1, const Vector& p2, Vector& n, float& c)
   c /= nval;
 }
 
-}
-
-bool rectangle_aatriangle(Constraints* constraints, const Rectf& rect,
-                          const AATriangle& triangle)
-{
-  bool dummy;
-  return rectangle_aatriangle(constraints, rect, triangle, dummy);
-}
-
-bool rectangle_aatriangle(Constraints* constraints, const Rectf& rect,
-                          const AATriangle& triangle,
-                          bool& hits_rectangle_bottom)
+/** Returns the part of @a bbox covered by the deformed triangle */
+Rectf get_deformed_area(const Rectf& bbox, int dir)
 {
-  if (!intersects(rect, triangle.bbox))
-    return false;
-
-  Vector normal(0.0f, 0.0f);
-  float c = 0.0;
-  Vector p1(0.0f, 0.0f);
   Rectf area;
-  switch (triangle.dir & AATriangle::DEFORM_MASK) {
+  switch (dir & AATriangle::DEFORM_MASK) {
     case 0:
-      area.set_p1(triangle.bbox.p1());
-      area.set_p2(triangle.bbox.p2());
+      area.set_p1(bbox.p1());
+      area.set_p2(bbox.p2());
       break;
     case AATriangle::DEFORM_BOTTOM:
-      area.set_p1(Vector(triangle.bbox.get_left(), triangle.bbox.get_top() + triangle.bbox.get_height()/2));
-      area.set_p2(triangle.bbox.p2());
+      area.set_p1(Vector(bbox.get_left(), bbox.get_top() + bbox.get_height()/2));
+      area.set_p2(bbox.p2());
       break;
     case AATriangle::DEFORM_TOP:
-      area.set_p1(triangle.bbox.p1());
-      area.set_p2(Vector(triangle.bbox.get_right(), triangle.bbox.get_top() + triangle.bbox.get_height()/2));
+      area.set_p1(bbox.p1());
+      area.set_p2(Vector(bbox.get_right(), bbox.get_top() + bbox.get_height()/2));
       break;
     case AATriangle::DEFORM_LEFT:
-      area.set_p1(triangle.bbox.p1());
-      area.set_p2(Vector(triangle.bbox.get_left() + triangle.bbox.get_width()/2, triangle.bbox.get_bottom()));
+      area.set_p1(bbox.p1());
+      area.set_p2(Vector(bbox.get_left() + bbox.get_width()/2, bbox.get_bottom()));
       break;
     case AATriangle::DEFORM_RIGHT:
-      area.set_p1(Vector(triangle.bbox.get_left() + triangle.bbox.get_width()/2, triangle.bbox.get_top()));
-      area.set_p2(triangle.bbox.p2());
+      area.set_p1(Vector(bbox.get_left() + bbox.get_width()/2, bbox.get_top()));
+      area.set_p2(bbox.p2());
       break;
     default:
       assert(false);
   }
+  return area;
+}
 
-  switch (triangle.dir & AATriangle::DIRECTION_MASK) {
+void make_slope_plane(const Rectf& area, int dir, Vector& normal, float& c)
+{
+  switch (dir & AATriangle::DIRECTION_MASK) {
     case AATriangle::SOUTHWEST:
-      p1 = Vector(rect.get_left(), rect.get_bottom());
       makePlane(area.p1(), area.p2(), normal, c);
       break;
     case AATriangle::NORTHEAST:
-      p1 = Vector(rect.get_right(), rect.get_top());
       makePlane(area.p2(), area.p1(), normal, c);
       break;
     case AATriangle::SOUTHEAST:
-      p1 = rect.p2();
       makePlane(Vector(area.get_left(), area.get_bottom()),
                 Vector(area.get_right(), area.get_top()), normal, c);
       break;
     case AATriangle::NORTHWEST:
-      p1 = rect.p1();
       makePlane(Vector(area.get_right(), area.get_top()),
                 Vector(area.get_left(), area.get_bottom()), normal, c);
       break;
     default:
       assert(false);
   }
+}
 
+/** Returns the corner of @a rect that gets pushed out of the slope */
+Vector get_slope_point(const Rectf& rect, int dir)
+{
+  switch (dir & AATriangle::DIRECTION_MASK) {
+    case AATriangle::SOUTHWEST:
+      return Vector(rect.get_left(), rect.get_bottom());
+    case AATriangle::NORTHEAST:
+      return Vector(rect.get_right(), rect.get_top());
+    case AATriangle::SOUTHEAST:
+      return rect.p2();
+    case AATriangle::NORTHWEST:
+    default:
+      return rect.p1();
+  }
+}
+
+bool rectangle_plane(Constraints* constraints, const Rectf& rect,
+                     const Rectf& area, const Vector& normal, float c,
+                     const Vector& p1, bool& hits_rectangle_bottom)
+{
   float n_p1 = -glm::dot(normal, p1);
   float depth = n_p1 - c;
   if (depth < 0)
     return false;
 
 #if 0
-  std::cout << "R: " << rect << " Tri: " << triangle << "\n";
+  std::cout << "R: " << rect << " Area: " << area << "\n";
   std::cout << "Norm: " << normal << " Depth: " << depth << "\n";
 #endif
 
@@ -166,6 +172,69 @@ bool rectangle_aatriangle(Constraints* constraints, const Rectf& rect,
   return true;
 }
 
+} // namespace
+
+bool rectangle_aatriangle(Constraints* constraints, const Rectf& rect,
+                          const AATriangle& triangle)
+{
+  bool dummy;
+  return rectangle_aatriangle(constraints, rect, triangle, dummy);
+}
+
+bool rectangle_aatriangle(Constraints* constraints, const Rectf& rect,
+                          const AATriangle& triangle,
+                          bool& hits_rectangle_bottom)
+{
+  if (!intersects(rect, triangle.bbox))
+    return false;
+
+  const Rectf area = get_deformed_area(triangle.bbox, triangle.dir);
+  Vector normal(0.0f, 0.0f);
+  float c = 0.0;
+  make_slope_plane(area, triangle.dir, normal, c);
+
+  return rectangle_plane(constraints, rect, area, normal, c,
+                         get_slope_point(rect, triangle.dir), hits_rectangle_bottom);
+}
+
+const SlopePlane& get_slope_plane(int dir)
+{
+  // 4 directions for each of the 5 deform variants
+  static const std::array<SlopePlane, 20> planes = [] {
+    std::array<SlopePlane, 20> result;
+    const Rectf tile(0.0f, 0.0f, 32.0f, 32.0f);
+    for (int deform = 0; deform < 5; ++deform) {
+      for (int direction = 0; direction < 4; ++direction) {
+        SlopePlane& plane = result[deform * 4 + direction];
+        const int plane_dir = (deform << 4) | direction;
+        plane.area = get_deformed_area(tile, plane_dir);
+        make_slope_plane(plane.area, plane_dir, plane.normal, plane.c);
+      }
+    }
+    return result;
+  }();
+
+  const int index = ((dir & AATriangle::DEFORM_MASK) >> 4) * 4 + (dir & AATriangle::DIRECTION_MASK);
+  assert(index < static_cast<int>(planes.size()));
+  return planes[index];
+}
+
+bool rectangle_slope(Constraints* constraints, const Rectf& rect,
+                     const Rectf& tile_bbox, int dir,
+                     bool& hits_rectangle_bottom)
+{
+  if (!intersects(rect, tile_bbox))
+    return false;
+
+  // move the plane from the origin to the tile
+  const SlopePlane& plane = get_slope_plane(dir);
+  const Vector offset = tile_bbox.p1();
+
+  return rectangle_plane(constraints, rect, plane.area.moved(offset), plane.normal,
+                         plane.c - glm::dot(plane.normal, offset),
+                         get_slope_point(rect, dir), hits_rectangle_bottom);
+}
+
 void set_rectangle_rectangle_constraints(Constraints* constraints, const Rectf& r1, const Rectf& r2)
 {
   float itop = r1.get_bottom() - r2.get_top();
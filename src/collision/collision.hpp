@@ -22,8 +22,8 @@
 
 #include "collision/collision_hit.hpp"
 #include "math/fwd.hpp"
+#include "math/rectf.hpp"
 
-class Rectf;
 class AATriangle;
 
 namespace collision {
@@ -115,6 +115,35 @@ bool rectangle_aatriangle(Constraints* constraints, const Rectf& rect,
                           const AATriangle& triangle,
                           bool& hits_rectangle_bottom);
 
+/** The plane of a slope in a 32x32 tile at the origin, normalized
+    once per AATriangle direction instead of for every collision */
+class SlopePlane final
+{
+public:
+  SlopePlane() :
+    area(),
+    normal(0.0f, 0.0f),
+    c(0.0f)
+  {
+  }
+
+  /** Part of the tile covered by the deformed triangle */
+  Rectf area;
+  Vector normal;
+  float c;
+};
+
+/** Returns the precomputed plane of the given AATriangle direction
+    including its deform flags */
+const SlopePlane& get_slope_plane(int dir);
+
+/** Same as rectangle_aatriangle() for a slope in the 32x32 tile
+ * @a tile_bbox, using the precomputed plane of @a dir.
+ */
+bool rectangle_slope(Constraints* constraints, const Rectf& rect,
+                     const Rectf& tile_bbox, int dir,
+                     bool& hits_rectangle_bottom);
+
 void set_rectangle_rectangle_constraints(Constraints* constraints, const Rectf& r1, const Rectf& r2);
 
 bool line_intersects_line(const Vector& line1_start, const Vector& line1_end, const Vector& line2_start, const Vector& line2_end);
@@ -28,7 +28,9 @@ CollisionObject::CollisionObject(CollisionGroup group, CollisionListener& listen
   m_movement(0.0f, 0.0f),
   m_dest(),
   m_objects_hit_bottom(),
-  m_ground_movement_manager(nullptr)
+  m_ground_movement_manager(nullptr),
+  m_spatial_cells(),
+  m_spatial_query(0)
 {
 }
 
@@ -24,6 +24,7 @@
 
 #include "collision/collision_group.hpp"
 #include "collision/collision_hit.hpp"
+#include "collision/spatial_hash.hpp"
 #include "math/rectf.hpp"
 
 class CollisionListener;
@@ -33,6 +34,7 @@ class GameObject;
 class CollisionObject
 {
   friend class CollisionSystem;
+  friend class SpatialHash;
 
 public:
   CollisionObject(CollisionGroup group, CollisionListener& parent);
@@ -161,6 +163,12 @@ private:
 
   std::shared_ptr<CollisionGroundMovementManager> m_ground_movement_manager;
 
+  /** Cells of the SpatialHash this object is filed under */
+  SpatialHashCells m_spatial_cells;
+
+  /** Last SpatialHash query that returned this object */
+  uint32_t m_spatial_query;
+
 private:
   CollisionObject(const CollisionObject&) = delete;
   CollisionObject& operator=(const CollisionObject&) = delete;
@@ -39,6 +39,7 @@ const float MAX_SPEED = 16.0f;
 CollisionSystem::CollisionSystem(Sector& sector) :
   m_sector(sector),
   m_objects(),
+  m_spatial_hash(),
   m_ground_movement_manager(new CollisionGroundMovementManager)
 {
 }
@@ -48,6 +49,7 @@ CollisionSystem::add(CollisionObject* object)
 {
   object->set_ground_movement_manager(m_ground_movement_manager);
   m_objects.push_back(object);
+  m_spatial_hash.insert(*object);
 }
 
 void
@@ -56,6 +58,7 @@ CollisionSystem::remove(CollisionObject* object)
   m_objects.erase(
     std::find(m_objects.begin(), m_objects.end(),
               object));
+  m_spatial_hash.remove(*object);
   
   // FIXME: this is a patch. A better way of fixing this is coming.
   for (auto* collision_object : m_objects) {
@@ -200,52 +203,48 @@ CollisionSystem::collision_tilemap(collision::Constraints* constraints,
   {
     // test with all tiles in this rectangle
     const Rect test_tiles = solids->get_tiles_overlapping(Rectf(x1, y1, x2, y2));
+    const bool flipped = (solids->get_flip() & VERTICAL_FLIP) != 0;
 
     bool hits_bottom = false;
 
     for (int x = test_tiles.left; x < test_tiles.right; ++x)
     {
+      const uint16_t* column = solids->get_collision_column(x);
       for (int y = test_tiles.top; y < test_tiles.bottom; ++y)
       {
-        const Tile& tile = solids->get_tile(x, y);
+        const uint16_t flags = column[y];
 
         // skip non-solid tiles
-        if (tile.is_solid())
+        if (!(flags & Tile::SOLID))
+          continue;
+
+        const Rectf tile_bbox = solids->get_tile_bbox(x, y);
+
+        /* If the tile is a unisolid tile, the solid flag above didn't do
+        * a thorough check. Calculate the position and (relative)
+        * movement of the object and determine whether or not the tile is
+        * solid with regard to those parameters. */
+        if (flags & Tile::UNISOLID)
         {
-          Rectf tile_bbox = solids->get_tile_bbox(x, y);
-          bool is_relatively_solid = true;
-
-          /* If the tile is a unisolid tile, the "is_solid()" function above
-          * didn't do a thorough check. Calculate the position and (relative)
-          * movement of the object and determine whether or not the tile is
-          * solid with regard to those parameters. */
-          if (tile.is_unisolid ())
-          {
-            Vector relative_movement = movement
-              - solids->get_movement(/* actual = */ true);
-
-            if (!tile.is_solid (tile_bbox, object.get_bbox(), relative_movement))
-              is_relatively_solid = false;
-          }
-
-          if (is_relatively_solid)
-          {
-            if (tile.is_slope ()) { // slope tile
-              AATriangle triangle;
-              int slope_data = tile.get_data();
-              if (solids->get_flip() & VERTICAL_FLIP)
-                slope_data = AATriangle::vertical_flip(slope_data);
-              triangle = AATriangle(tile_bbox, slope_data);
-
-              bool triangle_hits_bottom = false;
-              collision::rectangle_aatriangle(constraints, dest, triangle, triangle_hits_bottom);
-              hits_bottom |= triangle_hits_bottom;
-            } else { // normal rectangular tile
-              collision::Constraints new_constraints = check_collisions(movement, dest, tile_bbox, nullptr, nullptr);
-              hits_bottom |= new_constraints.hit.bottom;
-              constraints->merge_constraints(new_constraints);
-            }
-          }
+          const Vector relative_movement = movement
+            - solids->get_movement(/* actual = */ true);
+
+          if (!solids->get_tile(x, y).is_solid(tile_bbox, object.get_bbox(), relative_movement))
+            continue;
+        }
+
+        if (flags & Tile::SLOPE) { // slope tile
+          int slope_data = flags >> 8;
+          if (flipped)
+            slope_data = AATriangle::vertical_flip(slope_data);
+
+          bool triangle_hits_bottom = false;
+          collision::rectangle_slope(constraints, dest, tile_bbox, slope_data, triangle_hits_bottom);
+          hits_bottom |= triangle_hits_bottom;
+        } else { // normal rectangular tile
+          collision::Constraints new_constraints = check_collisions(movement, dest, tile_bbox, nullptr, nullptr);
+          hits_bottom |= new_constraints.hit.bottom;
+          constraints->merge_constraints(new_constraints);
         }
       }
     }
@@ -615,6 +614,7 @@ CollisionSystem::update()
   for (auto* object : m_objects) {
     object->m_bbox = object->m_dest;
     object->m_movement = Vector(0, 0);
+    m_spatial_hash.update(*object);
   }
 }
 
@@ -735,17 +735,32 @@ CollisionSystem::free_line_of_sight(const Vector& line_start, const Vector& line
 }
 
 std::vector<CollisionObject*>
-CollisionSystem::get_nearby_objects (const Vector& center, float max_distance) const
+CollisionSystem::get_nearby_objects (const Vector& center, float max_distance)
 {
   std::vector<CollisionObject*> ret;
+  query_radius(center, max_distance, ret);
+  return ret;
+}
 
-  for (const auto& object : m_objects) {
-    float distance = object->get_bbox().distance(center);
-    if (distance <= max_distance)
-      ret.push_back(object);
-  }
+void
+CollisionSystem::query_rect(const Rectf& rect, std::vector<CollisionObject*>& result)
+{
+  m_spatial_hash.query(rect, result);
+}
 
-  return ret;
+void
+CollisionSystem::query_radius(const Vector& center, float radius, std::vector<CollisionObject*>& result)
+{
+  // an object whose center is within the radius overlaps the square around it
+  const size_t first = result.size();
+  const Vector extent(radius + 1.0f, radius + 1.0f);
+  m_spatial_hash.query(Rectf(center - extent, center + extent), result);
+
+  result.erase(std::remove_if(result.begin() + first, result.end(),
+                              [&center, radius](const CollisionObject* object) {
+                                return object->get_bbox().distance(center) > radius;
+                              }),
+               result.end());
 }
 
 /* EOF */
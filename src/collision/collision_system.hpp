@@ -23,6 +23,7 @@
 #include <stdint.h>
 
 #include "collision/collision.hpp"
+#include "collision/spatial_hash.hpp"
 #include "supertux/tile.hpp"
 #include "math/fwd.hpp"
 
@@ -58,7 +59,15 @@ public:
   bool is_free_of_movingstatics(const Rectf& rect, const CollisionObject* ignore_object) const;
   bool free_line_of_sight(const Vector& line_start, const Vector& line_end, bool ignore_objects, const CollisionObject* ignore_object) const;
 
-  std::vector<CollisionObject*> get_nearby_objects(const Vector& center, float max_distance) const;
+  std::vector<CollisionObject*> get_nearby_objects(const Vector& center, float max_distance);
+
+  /** Appends the objects whose bbox overlaps @a rect to @a result.
+      Objects are found at their position after the last update(),
+      positions set in between are only picked up by the next one. */
+  void query_rect(const Rectf& rect, std::vector<CollisionObject*>& result);
+
+  /** Appends the objects whose center is within @a radius of @a center */
+  void query_radius(const Vector& center, float radius, std::vector<CollisionObject*>& result);
 
 private:
   /** Does collision detection of an object against all other static
@@ -88,6 +97,8 @@ private:
 
   std::vector<CollisionObject*>  m_objects;
 
+  SpatialHash m_spatial_hash;
+
   std::shared_ptr<CollisionGroundMovementManager> m_ground_movement_manager;
 
 private:
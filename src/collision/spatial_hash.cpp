@@ -0,0 +1,185 @@
+//  SuperTux
+//  Copyright (C) 2024 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "collision/spatial_hash.hpp"
+
+#include <algorithm>
+#include <assert.h>
+#include <cmath>
+
+#include "collision/collision_object.hpp"
+#include "math/rectf.hpp"
+#include "math/util.hpp"
+
+namespace {
+
+/** Objects covering more cells than this go to the list of large objects */
+const int MAX_OBJECT_CELLS = 64;
+
+/** Keeps cell coordinates of far out or infinite rectangles in range */
+const float MAX_CELL_COORD = 1 << 30;
+
+int to_cell(float coord, float cell_size)
+{
+  return static_cast<int>(math::clamp(std::floor(coord / cell_size), -MAX_CELL_COORD, MAX_CELL_COORD));
+}
+
+} // namespace
+
+SpatialHash::SpatialHash(float cell_size) :
+  m_cell_size(cell_size),
+  m_cells(),
+  m_large_objects(),
+  m_query(0)
+{
+}
+
+void
+SpatialHash::insert(CollisionObject& object)
+{
+  const SpatialHashCells cells = get_cells(object.get_bbox());
+  add_to_cells(object, cells);
+  object.m_spatial_cells = cells;
+}
+
+void
+SpatialHash::remove(CollisionObject& object)
+{
+  remove_from_cells(object, object.m_spatial_cells);
+  object.m_spatial_cells = SpatialHashCells();
+}
+
+void
+SpatialHash::update(CollisionObject& object)
+{
+  const SpatialHashCells cells = get_cells(object.get_bbox());
+  if (cells == object.m_spatial_cells || (cells.large && object.m_spatial_cells.large))
+    return;
+
+  remove_from_cells(object, object.m_spatial_cells);
+  add_to_cells(object, cells);
+  object.m_spatial_cells = cells;
+}
+
+void
+SpatialHash::query(const Rectf& rect, std::vector<CollisionObject*>& result)
+{
+  m_query += 1;
+
+  const SpatialHashCells cells = get_cells(rect);
+  const uint64_t count = static_cast<uint64_t>(cells.right - cells.left + 1) *
+                         static_cast<uint64_t>(cells.bottom - cells.top + 1);
+
+  if (count > m_cells.size())
+  {
+    // a large area, visiting the occupied cells is cheaper than
+    // looking up every cell in the area
+    for (const auto& cell : m_cells)
+    {
+      const int x = static_cast<int32_t>(cell.first >> 32);
+      const int y = static_cast<int32_t>(cell.first & 0xffffffff);
+      if (x >= cells.left && x <= cells.right && y >= cells.top && y <= cells.bottom)
+        collect(cell.second, rect, result);
+    }
+  }
+  else
+  {
+    for (int y = cells.top; y <= cells.bottom; ++y)
+    {
+      for (int x = cells.left; x <= cells.right; ++x)
+      {
+        auto it = m_cells.find(get_key(x, y));
+        if (it != m_cells.end())
+          collect(it->second, rect, result);
+      }
+    }
+  }
+
+  collect(m_large_objects, rect, result);
+}
+
+SpatialHashCells
+SpatialHash::get_cells(const Rectf& rect) const
+{
+  SpatialHashCells cells;
+  cells.left = to_cell(rect.get_left(), m_cell_size);
+  cells.top = to_cell(rect.get_top(), m_cell_size);
+  cells.right = std::max(cells.left, to_cell(rect.get_right(), m_cell_size));
+  cells.bottom = std::max(cells.top, to_cell(rect.get_bottom(), m_cell_size));
+  cells.large = (static_cast<int64_t>(cells.right - cells.left + 1) *
+                 static_cast<int64_t>(cells.bottom - cells.top + 1)) > MAX_OBJECT_CELLS;
+  return cells;
+}
+
+void
+SpatialHash::add_to_cells(CollisionObject& object, const SpatialHashCells& cells)
+{
+  if (cells.large)
+  {
+    m_large_objects.push_back(&object);
+    return;
+  }
+
+  for (int y = cells.top; y <= cells.bottom; ++y)
+  {
+    for (int x = cells.left; x <= cells.right; ++x)
+    {
+      m_cells[get_key(x, y)].push_back(&object);
+    }
+  }
+}
+
+void
+SpatialHash::remove_from_cells(CollisionObject& object, const SpatialHashCells& cells)
+{
+  auto remove_from = [&object](std::vector<CollisionObject*>& objects) {
+    auto it = std::find(objects.begin(), objects.end(), &object);
+    assert(it != objects.end());
+    *it = objects.back();
+    objects.pop_back();
+  };
+
+  if (cells.large)
+  {
+    remove_from(m_large_objects);
+    return;
+  }
+
+  for (int y = cells.top; y <= cells.bottom; ++y)
+  {
+    for (int x = cells.left; x <= cells.right; ++x)
+    {
+      // emptied cells are kept, objects tend to come back to them
+      remove_from(m_cells[get_key(x, y)]);
+    }
+  }
+}
+
+void
+SpatialHash::collect(const std::vector<CollisionObject*>& objects, const Rectf& rect,
+                     std::vector<CollisionObject*>& result)
+{
+  for (auto* object : objects)
+  {
+    if (object->m_spatial_query != m_query && rect.contains(object->get_bbox()))
+    {
+      object->m_spatial_query = m_query;
+      result.push_back(object);
+    }
+  }
+}
+
+/* EOF */
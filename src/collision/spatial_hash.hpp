@@ -0,0 +1,99 @@
+//  SuperTux
+//  Copyright (C) 2024 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef HEADER_SUPERTUX_COLLISION_SPATIAL_HASH_HPP
+#define HEADER_SUPERTUX_COLLISION_SPATIAL_HASH_HPP
+
+#include <stdint.h>
+#include <unordered_map>
+#include <vector>
+
+class CollisionObject;
+class Rectf;
+
+/** Range of grid cells covered by an object, both ends inclusive */
+struct SpatialHashCells
+{
+  SpatialHashCells() : left(0), top(0), right(-1), bottom(-1), large(false) {}
+
+  bool operator==(const SpatialHashCells& other) const
+  {
+    return left == other.left && top == other.top &&
+           right == other.right && bottom == other.bottom &&
+           large == other.large;
+  }
+
+  bool operator!=(const SpatialHashCells& other) const { return !(*this == other); }
+
+  int left;
+  int top;
+  int right;
+  int bottom;
+
+  /** The object covers too many cells and is kept in a separate list */
+  bool large;
+};
+
+/** Files the bounding boxes of CollisionObjects into a uniform grid,
+    so that objects within a rectangle can be found without looking at
+    every object of the sector. The grid doesn't follow the objects on
+    its own, update() has to be called after they moved. */
+class SpatialHash final
+{
+public:
+  SpatialHash(float cell_size = 128.0f);
+
+  void insert(CollisionObject& object);
+  void remove(CollisionObject& object);
+
+  /** Refile @a object under the cells its bbox covers now, which is
+      a no-op as long as it stays within the same cells */
+  void update(CollisionObject& object);
+
+  /** Append the objects whose bbox overlaps @a rect to @a result */
+  void query(const Rectf& rect, std::vector<CollisionObject*>& result);
+
+private:
+  SpatialHashCells get_cells(const Rectf& rect) const;
+  void add_to_cells(CollisionObject& object, const SpatialHashCells& cells);
+  void remove_from_cells(CollisionObject& object, const SpatialHashCells& cells);
+  void collect(const std::vector<CollisionObject*>& objects, const Rectf& rect,
+               std::vector<CollisionObject*>& result);
+
+  static uint64_t get_key(int x, int y)
+  {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32) | static_cast<uint32_t>(y);
+  }
+
+private:
+  float m_cell_size;
+
+  std::unordered_map<uint64_t, std::vector<CollisionObject*> > m_cells;
+
+  /** Objects spanning more than a handful of cells, checked by every query */
+  std::vector<CollisionObject*> m_large_objects;
+
+  /** Incremented on each query to skip objects seen in another cell */
+  uint32_t m_query;
+
+private:
+  SpatialHash(const SpatialHash&) = delete;
+  SpatialHash& operator=(const SpatialHash&) = delete;
+};
+
+#endif
+
+/* EOF */
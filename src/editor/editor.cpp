@@ -65,6 +65,8 @@
 #include "util/file_system.hpp"
 #include "util/reader_document.hpp"
 #include "util/reader_mapping.hpp"
+#include "util/save_queue.hpp"
+#include "util/writer.hpp"
 #include "video/compositor.hpp"
 #include "video/drawing_context.hpp"
 #include "video/surface.hpp"
@@ -73,6 +75,18 @@
 
 bool Editor::s_resaving_in_progress = false;
 
+namespace {
+
+void log_autosave_error(const std::string& error)
+{
+  if (!error.empty())
+  {
+    log_warning << "Couldn't autosave: " << error << std::endl;
+  }
+}
+
+} // namespace
+
 bool
 Editor::is_active()
 {
@@ -188,7 +202,8 @@ Editor::update(float dt_sec, const Controller& controller)
       m_autosave_levelfile = FileSystem::join(directory, backup_filename);
       try
       {
-        m_level->save(m_autosave_levelfile);
+        SaveQueue::save_file(m_autosave_levelfile, [this](Writer& writer) { m_level->save(writer); },
+                             log_autosave_error);
       }
       catch(const std::exception& e)
       {
@@ -273,6 +288,12 @@ Editor::remove_autosave_file()
   // Clear the auto-save file
   if (!m_autosave_levelfile.empty())
   {
+    // Wait for a queued up autosave, so that it doesn't bring the file back
+    if (SaveQueue::current())
+    {
+      SaveQueue::current()->flush();
+    }
+
     // Try to remove the test level using the PhysFS file system
     if (physfsutil::remove(m_autosave_levelfile) != 0)
     {
@@ -337,15 +358,22 @@ Editor::test_level(const boost::optional<std::pair<std::string, Vector>>& test_p
   }
 
   m_autosave_levelfile = FileSystem::join(directory, backup_filename);
-  m_level->save(m_autosave_levelfile);
   m_time_since_last_save = 0.f;
 
   if (!m_level->is_worldmap())
   {
-    GameManager::current()->start_level(*current_world, backup_filename, test_pos);
+    // The level is played straight from memory, the autosave is only
+    // written in the background
+    std::ostringstream out;
+    m_level->save(out);
+    std::string level_data = out.str();
+    SaveQueue::save_file(m_autosave_levelfile, level_data, log_autosave_error);
+    GameManager::current()->start_level(*current_world, backup_filename, test_pos, std::move(level_data));
   }
   else
   {
+    // WorldMap reads the worldmap file on its own
+    m_level->save(m_autosave_levelfile);
     GameManager::current()->start_worldmap(*current_world, "", m_autosave_levelfile);
   }
 
@@ -474,6 +502,7 @@ Editor::delete_current_sector()
   for (auto i = m_level->m_sectors.begin(); i != m_level->m_sectors.end(); ++i) {
     if ( i->get() == get_sector() ) {
       m_level->m_sectors.erase(i);
+      record_level();
       break;
     }
   }
@@ -871,13 +900,30 @@ Editor::check_save_prerequisites(const std::function<void ()>& callback) const
 
 }
 
+void
+Editor::record_object(GameObject& object)
+{
+  if (m_sector) {
+    m_undo_manager->record_object(*m_sector, object);
+  }
+}
+
+void
+Editor::record_level()
+{
+  m_undo_manager->record_level();
+}
+
 void
 Editor::undo()
 {
   log_info << "attempting undo" << std::endl;
-  auto level = m_undo_manager->undo();
-  if (level) {
-    set_level(std::move(level), false);
+  std::unique_ptr<Level> level;
+  if (m_level && m_undo_manager->undo(*m_level, level)) {
+    // Tile edits are applied in place, everything else needs a reload
+    if (level) {
+      set_level(std::move(level), false);
+    }
     m_ignore_sector_change = true;
   } else {
     log_info << "undo failed" << std::endl;
@@ -888,9 +934,12 @@ void
 Editor::redo()
 {
   log_info << "attempting redo" << std::endl;
-  auto level = m_undo_manager->redo();
-  if (level) {
-    set_level(std::move(level), false);
+  std::unique_ptr<Level> level;
+  if (m_level && m_undo_manager->redo(*m_level, level)) {
+    // Tile edits are applied in place, everything else needs a reload
+    if (level) {
+      set_level(std::move(level), false);
+    }
     m_ignore_sector_change = true;
   } else {
     log_info << "redo failed" << std::endl;
@@ -152,6 +152,12 @@ public:
 
   Sector* get_sector() { return m_sector; }
 
+  /** Tells the undo history which object of the current sector an
+      edit added, changed or is about to remove */
+  void record_object(GameObject& object);
+  /** Tells the undo history that an edit touched the whole level */
+  void record_level();
+
   void undo();
   void redo();
 
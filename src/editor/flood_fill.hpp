@@ -0,0 +1,111 @@
+//  SuperTux
+//  Copyright (C) 2024 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef HEADER_SUPERTUX_EDITOR_FLOOD_FILL_HPP
+#define HEADER_SUPERTUX_EDITOR_FLOOD_FILL_HPP
+
+#include <algorithm>
+#include <vector>
+
+#include "math/rect.hpp"
+
+/** Scanline flood fill on a width x height grid. Starting at (x, y),
+    which is always filled, it walks the 4-connected region of cells
+    for which can_fill(x, y) returns true and calls
+    fill_span(y, left, right) once for every horizontal run of them,
+    'right' being exclusive. can_fill() is never called for cells
+    that are already filled, so fill_span() may change what it
+    returns for them. Returns the bounding box of all filled cells,
+    which is empty if the start is outside of the grid. */
+template<typename CanFill, typename FillSpan>
+Rect flood_fill(int width, int height, int x, int y, CanFill can_fill, FillSpan fill_span)
+{
+  if (x < 0 || y < 0 || x >= width || y >= height)
+    return Rect();
+
+  std::vector<bool> visited(static_cast<size_t>(width) * static_cast<size_t>(height), false);
+  auto fillable = [&visited, &can_fill, width](int cx, int cy) {
+    return !visited[cy * width + cx] && can_fill(cx, cy);
+  };
+
+  Rect bbox(x, y, x + 1, y + 1);
+
+  struct Seed { int x; int y; };
+  std::vector<Seed> seeds;
+  seeds.push_back({ x, y });
+
+  // Only the first seed is filled without asking can_fill()
+  bool first = true;
+  while (!seeds.empty())
+  {
+    const Seed seed = seeds.back();
+    seeds.pop_back();
+
+    if (visited[seed.y * width + seed.x])
+      continue;
+    if (!first && !can_fill(seed.x, seed.y))
+      continue;
+    first = false;
+
+    int left = seed.x;
+    while (left > 0 && fillable(left - 1, seed.y))
+      left -= 1;
+
+    int right = seed.x + 1;
+    while (right < width && fillable(right, seed.y))
+      right += 1;
+
+    for (int i = left; i < right; ++i)
+      visited[seed.y * width + i] = true;
+
+    fill_span(seed.y, left, right);
+
+    bbox.left = std::min(bbox.left, left);
+    bbox.right = std::max(bbox.right, right);
+    bbox.top = std::min(bbox.top, seed.y);
+    bbox.bottom = std::max(bbox.bottom, seed.y + 1);
+
+    // Queue one seed for every run of fillable cells above and below
+    for (int ny = seed.y - 1; ny <= seed.y + 1; ny += 2)
+    {
+      if (ny < 0 || ny >= height)
+        continue;
+
+      bool in_run = false;
+      for (int i = left; i < right; ++i)
+      {
+        if (fillable(i, ny))
+        {
+          if (!in_run)
+          {
+            seeds.push_back({ i, ny });
+            in_run = true;
+          }
+        }
+        else
+        {
+          in_run = false;
+        }
+      }
+    }
+  }
+
+  return bbox;
+}
+
+#endif
+
+/* EOF */
@@ -56,6 +56,7 @@ ObjectMenu::menu_action(MenuItem& item)
       m_editor.delete_markers();
       m_editor.m_reactivate_request = true;
       MenuManager::instance().pop_menu();
+      m_editor.record_object(*m_object);
       m_object->remove_me();
       break;
 
@@ -85,6 +86,7 @@ ObjectMenu::on_back_action()
   BIND_SECTOR(*m_editor.get_sector());
 
   m_object->after_editor_set();
+  m_editor.record_object(*m_object);
 
   m_editor.m_reactivate_request = true;
   if (!dynamic_cast<MovingObject*>(m_object)) {
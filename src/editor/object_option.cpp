@@ -522,7 +522,10 @@ TilesObjectOption::save(Writer& write) const
 {
   write.write("width", m_tilemap->get_width());
   write.write("height", m_tilemap->get_height());
-  write.write("tiles", m_tilemap->get_tiles(), m_tilemap->get_width());
+  if (write.get_tiles_placeholder())
+    write.write("tiles-placeholder", true);
+  else
+    write.write("tiles", m_tilemap->get_tiles(), m_tilemap->get_width());
 }
 
 std::string
@@ -21,6 +21,7 @@
 #include "util/writer.hpp"
 
 #include "editor/editor.hpp"
+#include "editor/flood_fill.hpp"
 #include "editor/node_marker.hpp"
 #include "editor/object_menu.hpp"
 #include "editor/object_info.hpp"
@@ -432,95 +433,60 @@ EditorOverlayWidget::fill()
     return;
   }
 
+  const int start_x = static_cast<int>(m_hovered_tile.x);
+  const int start_y = static_cast<int>(m_hovered_tile.y);
+  if (m_hovered_tile.x < 0 || m_hovered_tile.y < 0 ||
+      start_x >= tilemap->get_width() || start_y >= tilemap->get_height()) {
+    return;
+  }
+
   // The tile that is going to be replaced:
-  Uint32 replace_tile = tilemap->get_tile_id(static_cast<int>(m_hovered_tile.x), static_cast<int>(m_hovered_tile.y));
+  Uint32 replace_tile = tilemap->get_tile_id(start_x, start_y);
 
   if (replace_tile == tiles->pos(0, 0)) {
     // Replacing by the same tiles shouldn't do anything.
     return;
   }
 
-  std::vector<Vector> pos_stack;
-  pos_stack.clear();
-  pos_stack.push_back(m_hovered_tile);
-
-  // Passing recursively trough all tiles to be replaced...
-  while (pos_stack.size()) {
-
-    if (pos_stack.size() > 1000000) {
-      log_warning << "More than 1'000'000 tiles in stack to fill, STOP" << std::endl;
-      return;
-    }
-
-    Vector pos = pos_stack[pos_stack.size() - 1];
-    Vector tpos = pos - m_hovered_tile;
-
-    // Tests for being inside tilemap:
-    if ( pos.x < 0 ||
-         pos.y < 0 ||
-         pos.x >= static_cast<float>(tilemap->get_width()) ||
-         pos.y >= static_cast<float>(tilemap->get_height()))
-    {
-      pos_stack.pop_back();
-      continue;
-    }
-
-    // Autotile will happen later, so that directional filling works properly
-    input_tile(pos, tiles->pos(static_cast<int>(tpos.x), static_cast<int>(tpos.y)));
-
-    Vector pos_(0.0f, 0.0f);
-
-    // Going left...
-    pos_ = pos + Vector(-1, 0);
-    if (pos_.x >= 0) {
-      if (check_tiles_for_fill(replace_tile,
-          tilemap->get_tile_id(static_cast<int>(pos_.x), static_cast<int>(pos_.y)),
-          tiles->pos(static_cast<int>(tpos.x - 1), static_cast<int>(tpos.y)))) {
-        pos_stack.push_back( pos_ );
-        continue;
-      }
-    }
-
-    // Going right...
-    pos_ = pos + Vector(1, 0);
-    if (pos_.x < static_cast<float>(tilemap->get_width())) {
-      if (check_tiles_for_fill(replace_tile,
-          tilemap->get_tile_id(static_cast<int>(pos_.x), static_cast<int>(pos_.y)),
-          tiles->pos(static_cast<int>(tpos.x + 1), static_cast<int>(tpos.y)))) {
-        pos_stack.push_back( pos_ );
-        continue;
+  std::vector<uint32_t> span;
+  std::vector<Rect> spans;
+  const Rect filled = flood_fill(tilemap->get_width(), tilemap->get_height(), start_x, start_y,
+    [&](int x, int y) {
+      return check_tiles_for_fill(replace_tile, tilemap->get_tile_id(x, y),
+                                  tiles->pos(x - start_x, y - start_y));
+    },
+    [&](int y, int left, int right) {
+      span.resize(right - left);
+      for (int x = left; x < right; ++x) {
+        span[x - left] = tiles->pos(x - start_x, y - start_y);
       }
-    }
+      tilemap->change_span(left, y, span);
+      spans.push_back(Rect(left, y, right, y + 1));
+    });
 
-    // Going up...
-    pos_ = pos + Vector(0, -1);
-    if (pos_.y >= 0) {
-      if (check_tiles_for_fill(replace_tile,
-          tilemap->get_tile_id(static_cast<int>(pos_.x), static_cast<int>(pos_.y)),
-          tiles->pos(static_cast<int>(tpos.x), static_cast<int>(tpos.y - 1)))) {
-        pos_stack.push_back( pos_ );
-        continue;
+  // Autotile happens after all tiles are placed, so that directional
+  // filling works properly (because of borders; see snow tileset).
+  // Every filled tile and its neighbours are autotiled once.
+  if (g_config->editor_autotile_mode) {
+    const Rect area(std::max(filled.left - 1, 0), std::max(filled.top - 1, 0),
+                    std::min(filled.right + 1, tilemap->get_width()),
+                    std::min(filled.bottom + 1, tilemap->get_height()));
+    std::vector<bool> pending(area.get_width() * area.get_height(), false);
+    for (const auto& rect : spans) {
+      for (int y = std::max(rect.top - 1, area.top); y < std::min(rect.bottom + 1, area.bottom); ++y) {
+        for (int x = std::max(rect.left - 1, area.left); x < std::min(rect.right + 1, area.right); ++x) {
+          pending[(y - area.top) * area.get_width() + (x - area.left)] = true;
+        }
       }
     }
 
-    // Going down...
-    pos_ = pos + Vector(0, 1);
-    if (pos_.y < static_cast<float>(tilemap->get_height())) {
-      if (check_tiles_for_fill(replace_tile,
-          tilemap->get_tile_id(static_cast<int>(pos_.x), static_cast<int>(pos_.y)),
-          tiles->pos(static_cast<int>(tpos.x), static_cast<int>(tpos.y + 1)))) {
-        pos_stack.push_back( pos_ );
-        continue;
+    for (int y = area.top; y < area.bottom; ++y) {
+      for (int x = area.left; x < area.right; ++x) {
+        if (pending[(y - area.top) * area.get_width() + (x - area.left)]) {
+          tilemap->autotile(x, y, tiles->pos(x - start_x, y - start_y));
+        }
       }
     }
-
-    // Autotile happens after directional detection (because of borders; see snow tileset)
-    if (g_config->editor_autotile_mode) {
-      input_autotile(pos, tiles->pos(static_cast<int>(tpos.x), static_cast<int>(tpos.y)));
-    }
-
-    // When tiles on each side are already filled or occupied by another tiles, it ends.
-    pos_stack.pop_back();
   }
 }
 
@@ -702,6 +668,7 @@ EditorOverlayWidget::clone_object()
 
       m_dragged_object = dynamic_cast<MovingObject*>(&game_object);
       m_dragged_object->after_editor_set();
+      m_editor.record_object(game_object);
     }
   }
   else
@@ -719,6 +686,26 @@ EditorOverlayWidget::show_object_menu(GameObject& object)
   MenuManager::instance().push_menu(std::move(menu));
 }
 
+void
+EditorOverlayWidget::record_edit(GameObject& object)
+{
+  if (!dynamic_cast<MarkerObject*>(&object)) {
+    m_editor.record_object(object);
+    return;
+  }
+
+  // Markers edit the path or the size of the selected object
+  if (m_edited_path) {
+    m_editor.record_object(*m_edited_path);
+  }
+  if (m_selected_object) {
+    m_editor.record_object(*m_selected_object);
+  }
+  if (!m_edited_path && !m_selected_object) {
+    m_editor.record_level();
+  }
+}
+
 void
 EditorOverlayWidget::move_object()
 {
@@ -753,6 +740,7 @@ EditorOverlayWidget::move_object()
     //}
 
     m_dragged_object->move_to(new_pos);
+    record_edit(*m_dragged_object);
   }
 }
 
@@ -763,6 +751,7 @@ EditorOverlayWidget::rubber_object()
     delete_markers();
   }
   if (m_dragged_object) {
+    record_edit(*m_dragged_object);
     m_dragged_object->editor_delete();
   }
   m_last_node_marker = nullptr;
@@ -776,6 +765,7 @@ EditorOverlayWidget::rubber_rect()
   for (auto& moving_object : m_editor.get_sector()->get_objects_by_type<MovingObject>()) {
     Rectf bbox = moving_object.get_bbox();
     if (dr.contains(bbox)) {
+      record_edit(moving_object);
       moving_object.editor_delete();
     }
   }
@@ -814,6 +804,7 @@ EditorOverlayWidget::add_path_node()
   //last_node_marker = dynamic_cast<NodeMarker*>(marker.get());
   update_node_iterators();
   new_marker.update_node_times();
+  m_editor.record_object(*m_edited_path);
   m_editor.get_sector()->flush_game_objects();
 
   // This will ensure that we will hover NodeMarkers in priority before BezierMarkers
@@ -861,7 +852,8 @@ EditorOverlayWidget::put_object()
       wo->move_to(wo->get_pos() / 32.0f);
     }
 
-    m_editor.get_sector()->add_object(std::move(object));
+    GameObject& game_object = m_editor.get_sector()->add_object(std::move(object));
+    m_editor.record_object(game_object);
   }
 }
 
@@ -93,6 +93,9 @@ private:
   void clone_object();
   void hover_object();
   void show_object_menu(GameObject& object);
+  /** Tells the undo history about an edit of object, or of the object
+      a marker belongs to */
+  void record_edit(GameObject& object);
   void select_object();
   void add_path_node();
 
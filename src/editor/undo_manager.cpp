@@ -16,125 +16,864 @@
 
 #include "editor/undo_manager.hpp"
 
+#include <algorithm>
 #include <sstream>
-#include <iostream>
+#include <unordered_map>
+#include <unordered_set>
 
 #include "editor/editor.hpp"
+#include "object/tilemap.hpp"
+#include "supertux/d_scope.hpp"
 #include "supertux/level.hpp"
 #include "supertux/level_parser.hpp"
+#include "supertux/sector.hpp"
 #include "util/log.hpp"
 #include "util/reader_mapping.hpp"
+#include "util/writer.hpp"
+
+namespace {
+
+/** What TilesObjectOption writes instead of the tiles while saving the state */
+const std::string TILES_PLACEHOLDER = "(tiles-placeholder #t)";
+
+/** What Sector::save() writes instead of the objects while saving the skeleton */
+const std::string OBJECTS_PLACEHOLDER = "(objects-placeholder #t)";
+
+void compress_rect(const std::vector<uint32_t>& tiles, int width, const Rect& rect,
+                   std::vector<uint32_t>& out)
+{
+  for (int y = rect.top; y < rect.bottom; ++y)
+  {
+    for (int x = rect.left; x < rect.right; ++x)
+    {
+      const uint32_t tile = tiles[y * width + x];
+      if (!out.empty() && out.back() == tile)
+      {
+        out[out.size() - 2] += 1;
+      }
+      else
+      {
+        out.push_back(1);
+        out.push_back(tile);
+      }
+    }
+  }
+}
+
+/** Calls func(x, y, tile) for every tile in rect */
+template<typename F>
+void decompress_rect(const std::vector<uint32_t>& data, const Rect& rect, F func)
+{
+  int x = rect.left;
+  int y = rect.top;
+  for (size_t i = 0; i + 1 < data.size(); i += 2)
+  {
+    for (uint32_t n = 0; n < data[i]; ++n)
+    {
+      func(x, y, data[i + 1]);
+      x += 1;
+      if (x >= rect.right)
+      {
+        x = rect.left;
+        y += 1;
+      }
+    }
+  }
+}
+
+/** Replaces the n-th placeholder in text with what write(out, n) writes */
+template<typename F>
+std::string replace_placeholders(const std::string& text, const std::string& placeholder, F write)
+{
+  std::ostringstream out;
+  size_t index = 0;
+  size_t pos = 0;
+  for (size_t next = text.find(placeholder);
+       next != std::string::npos;
+       next = text.find(placeholder, pos))
+  {
+    out.write(text.data() + pos, next - pos);
+    write(out, index);
+    index += 1;
+    pos = next + placeholder.size();
+  }
+  out.write(text.data() + pos, text.size() - pos);
+  return out.str();
+}
+
+} // namespace
 
 UndoManager::UndoManager() :
   m_max_snapshots(100),
+  m_checkpoint_interval(20),
   m_index_pos(),
-  m_undo_stack(),
-  m_redo_stack()
+  m_steps(),
+  m_position(0),
+  m_steps_since_checkpoint(0),
+  m_state(),
+  m_base(),
+  m_binding(),
+  m_bound(false),
+  m_records(),
+  m_record_level(false)
 {
 }
 
 void
-UndoManager::try_snapshot(Level& level)
+UndoManager::record_object(Sector& sector, const GameObject& object)
+{
+  const UID uid = object.get_uid();
+  for (const auto& record : m_records)
+  {
+    if (record.sector == &sector && record.uid == uid)
+      return;
+  }
+  m_records.push_back({ &sector, uid });
+}
+
+std::vector<GameObject*>
+UndoManager::get_saved_objects(Sector& sector)
+{
+  std::vector<GameObject*> result;
+  for (const auto& object : sector.get_objects())
+  {
+    if (object->is_valid() && object->is_saveable())
+    {
+      result.push_back(object.get());
+    }
+  }
+  return result;
+}
+
+std::vector<TileMap*>
+UndoManager::get_tilemaps(Level& level)
+{
+  // Same order in which the sectors hold them
+  std::vector<TileMap*> result;
+  for (size_t i = 0; i < level.get_sector_count(); ++i)
+  {
+    for (const auto& object : get_saved_objects(*level.get_sector(i)))
+    {
+      auto tilemap = dynamic_cast<TileMap*>(object);
+      if (tilemap)
+      {
+        result.push_back(tilemap);
+      }
+    }
+  }
+  return result;
+}
+
+std::string
+UndoManager::save_skeleton(Level& level)
 {
   std::ostringstream out;
-  level.save(out);
-  std::string level_snapshot = out.str();
+  {
+    Writer writer(out);
+    writer.set_objects_placeholder(true);
+    level.save(writer);
+  }
+  return out.str();
+}
+
+std::string
+UndoManager::save_object(Sector& sector, GameObject& object)
+{
+  BIND_SECTOR(sector);
 
-  if (m_undo_stack.empty())
+  std::ostringstream out;
   {
-    push_undo_stack(std::move(level_snapshot));
+    Writer writer(out);
+    writer.set_tiles_placeholder(true);
+    writer.start_list(object.get_class_name());
+    object.save(writer);
+    writer.end_list(object.get_class_name());
   }
-  else if (level_snapshot == m_undo_stack.back())
+  return out.str();
+}
+
+std::vector<UndoManager::TileLayer>
+UndoManager::save_layers(const std::vector<TileMap*>& tilemaps)
+{
+  std::vector<TileLayer> layers;
+  for (const auto& tilemap : tilemaps)
+  {
+    layers.push_back({ tilemap->get_width(), tilemap->get_height(), tilemap->get_tiles() });
+  }
+  return layers;
+}
+
+std::unique_ptr<UndoManager::TextPatch>
+UndoManager::make_text_patch(const std::string& old_text, const std::string& new_text)
+{
+  const size_t max = std::min(old_text.size(), new_text.size());
+
+  size_t prefix = 0;
+  while (prefix < max && old_text[prefix] == new_text[prefix])
+    prefix += 1;
+
+  // Start the patch at the beginning of a line
+  if (prefix > 0)
+  {
+    const size_t newline = old_text.rfind('\n', prefix - 1);
+    prefix = (newline == std::string::npos) ? 0 : newline + 1;
+  }
+
+  size_t suffix = 0;
+  while (suffix < max - prefix &&
+         old_text[old_text.size() - 1 - suffix] == new_text[new_text.size() - 1 - suffix])
+    suffix += 1;
+
+  // End the patch at the end of a line
+  while (suffix > 0 && old_text[old_text.size() - 1 - suffix] != '\n')
+    suffix -= 1;
+
+  auto patch = std::make_unique<TextPatch>();
+  patch->offset = prefix;
+  patch->old_text = old_text.substr(prefix, old_text.size() - prefix - suffix);
+  patch->new_text = new_text.substr(prefix, new_text.size() - prefix - suffix);
+  return patch;
+}
+
+bool
+UndoManager::bind(Level& level)
+{
+  if (level.get_sector_count() != m_state->sectors.size())
+    return false;
+
+  Binding binding;
+  binding.level = &level;
+  for (size_t i = 0; i < level.get_sector_count(); ++i)
+  {
+    Sector& sector = *level.get_sector(i);
+    const std::vector<GameObject*> objects = get_saved_objects(sector);
+    const SectorObjects& saved = m_state->sectors[i];
+    if (objects.size() != saved.size())
+      return false;
+
+    std::vector<UID> uids;
+    for (size_t j = 0; j < objects.size(); ++j)
+    {
+      // Saved objects start with "(<class name>\n"
+      const std::string& class_name = objects[j]->get_class_name();
+      if (saved[j].compare(1, class_name.size(), class_name) != 0)
+        return false;
+
+      uids.push_back(objects[j]->get_uid());
+    }
+    binding.sectors.push_back(&sector);
+    binding.objects.push_back(std::move(uids));
+  }
+
+  const std::vector<TileMap*> tilemaps = get_tilemaps(level);
+  if (tilemaps.size() != m_state->layers.size())
+    return false;
+
+  for (size_t i = 0; i < tilemaps.size(); ++i)
+  {
+    if (tilemaps[i]->get_width() != m_state->layers[i].width ||
+        tilemaps[i]->get_height() != m_state->layers[i].height)
+      return false;
+
+    binding.layers.push_back(tilemaps[i]->get_uid());
+  }
+
+  // A freshly loaded level reports all of its tiles as changed
+  for (const auto& tilemap : tilemaps)
+  {
+    tilemap->take_changed_tiles();
+  }
+
+  m_binding = std::move(binding);
+  m_bound = true;
+  return true;
+}
+
+bool
+UndoManager::is_bound(const std::vector<TileMap*>& tilemaps) const
+{
+  if (tilemaps.size() != m_binding.layers.size())
+    return false;
+
+  for (size_t i = 0; i < tilemaps.size(); ++i)
+  {
+    if (tilemaps[i]->get_uid() != m_binding.layers[i] ||
+        tilemaps[i]->get_width() != m_state->layers[i].width ||
+        tilemaps[i]->get_height() != m_state->layers[i].height)
+      return false;
+  }
+  return true;
+}
+
+void
+UndoManager::try_snapshot(Level& level)
+{
+  if (!m_state)
+  {
+    // The first snapshot only fills the state, there is nothing to undo yet
+    m_state.reset(new LevelState);
+    Step step;
+    snapshot_level(level, step);
+    m_base.reset(new LevelState(*m_state));
+    m_records.clear();
+    m_record_level = false;
+    m_index_pos += 1;
+    return;
+  }
+
+  if ((!m_bound || m_binding.level != &level) && !bind(level))
+  {
+    m_record_level = true;
+  }
+
+  if (!m_record_level)
+  {
+    // Objects added by the edits are only in the sector after a flush
+    for (const auto& sector : m_binding.sectors)
+    {
+      if (std::any_of(m_records.begin(), m_records.end(),
+                      [&sector](const Record& record) { return record.sector == sector; }))
+      {
+        sector->flush_game_objects();
+      }
+    }
+  }
+
+  std::vector<TileMap*> tilemaps = get_tilemaps(level);
+  if (!is_bound(tilemaps))
+  {
+    // Tilemaps were added, removed or resized
+    m_record_level = true;
+  }
+
+  auto step = std::make_unique<Step>();
+  if (m_record_level)
+  {
+    snapshot_level(level, *step);
+  }
+  else
+  {
+    for (size_t i = 0; i < m_binding.sectors.size(); ++i)
+    {
+      std::vector<UID> recorded;
+      for (const auto& record : m_records)
+      {
+        if (record.sector == m_binding.sectors[i])
+          recorded.push_back(record.uid);
+      }
+
+      if (!recorded.empty())
+      {
+        snapshot_sector(i, *m_binding.sectors[i], recorded, *step);
+      }
+    }
+    snapshot_tiles(tilemaps, false, *step);
+  }
+
+  m_records.clear();
+  m_record_level = false;
+
+  if (step->tile_patches.empty() && !step->needs_reload())
   {
     log_debug << "skipping snapshot as nothing has changed" << std::endl;
+    return;
+  }
+
+  push_step(std::move(step));
+}
+
+void
+UndoManager::snapshot_level(Level& level, Step& step)
+{
+  std::string skeleton = save_skeleton(level);
+  if (skeleton != m_state->skeleton)
+  {
+    step.text_patch = make_text_patch(m_state->skeleton, skeleton);
+    m_state->skeleton = std::move(skeleton);
   }
-  else // level_snapshot changed
+
+  Binding binding;
+  binding.level = &level;
+  std::vector<SectorObjects> sectors;
+  for (size_t i = 0; i < level.get_sector_count(); ++i)
   {
-    push_undo_stack(std::move(level_snapshot));
+    Sector& sector = *level.get_sector(i);
+    sector.flush_game_objects();
+
+    SectorObjects objects;
+    std::vector<UID> uids;
+    for (const auto& object : get_saved_objects(sector))
+    {
+      objects.push_back(save_object(sector, *object));
+      uids.push_back(object->get_uid());
+    }
+    sectors.push_back(std::move(objects));
+    binding.sectors.push_back(&sector);
+    binding.objects.push_back(std::move(uids));
   }
+
+  if (sectors.size() == m_state->sectors.size())
+  {
+    for (size_t i = 0; i < sectors.size(); ++i)
+    {
+      replace_sector_objects(i, std::move(sectors[i]), step);
+    }
+  }
+  else
+  {
+    step.old_sectors.reset(new std::vector<SectorObjects>(std::move(m_state->sectors)));
+    m_state->sectors = std::move(sectors);
+    step.new_sectors.reset(new std::vector<SectorObjects>(m_state->sectors));
+  }
+
+  m_binding = std::move(binding);
+  m_bound = true;
+
+  snapshot_tiles(get_tilemaps(level), true, step);
 }
 
 void
-UndoManager::debug_print(const char* action)
+UndoManager::snapshot_sector(size_t index, Sector& sector, const std::vector<UID>& recorded, Step& step)
 {
-#if 0
-  std::cout << action << std::endl;
-  std::cout << "undo_stack: ";
-  for(size_t i = 0; i < m_undo_stack.size(); ++i) {
-    std::cout << static_cast<const void*>(m_undo_stack[i].data()) << " ";
+  const std::vector<GameObject*> objects = get_saved_objects(sector);
+  SectorObjects& saved = m_state->sectors[index];
+  std::vector<UID>& uids = m_binding.objects[index];
+
+  std::unordered_map<UID, size_t> live;
+  for (size_t i = 0; i < objects.size(); ++i)
+  {
+    live[objects[i]->get_uid()] = i;
   }
-  std::cout << std::endl;
 
-  std::cout << "redo_stack: ";
-  for(size_t i = 0; i < m_redo_stack.size(); ++i) {
-    std::cout << static_cast<const void*>(m_redo_stack[i].data()) << " ";
+  // Removed objects, from the back so the indices of the patches stay valid
+  for (size_t i = uids.size(); i > 0; --i)
+  {
+    if (live.find(uids[i - 1]) == live.end())
+    {
+      step.object_patches.push_back({ index, i - 1, { saved[i - 1] }, {} });
+      saved.erase(saved.begin() + (i - 1));
+      uids.erase(uids.begin() + (i - 1));
+    }
+  }
+
+  // Added objects, the sector keeps the order of the others
+  const std::unordered_set<UID> known(uids.begin(), uids.end());
+  std::unordered_set<UID> added;
+  size_t pos = 0;
+  for (const auto& object : objects)
+  {
+    const UID uid = object->get_uid();
+    if (pos < uids.size() && uids[pos] == uid)
+    {
+      pos += 1;
+    }
+    else if (known.find(uid) == known.end())
+    {
+      std::string text = save_object(sector, *object);
+      step.object_patches.push_back({ index, pos, {}, { text } });
+      saved.insert(saved.begin() + pos, std::move(text));
+      uids.insert(uids.begin() + pos, uid);
+      added.insert(uid);
+      pos += 1;
+    }
+    else
+    {
+      // Objects were reordered, which the editor doesn't do, so
+      // don't bother with finding the moved ones
+      SectorObjects texts;
+      uids.clear();
+      for (const auto& obj : objects)
+      {
+        texts.push_back(save_object(sector, *obj));
+        uids.push_back(obj->get_uid());
+      }
+      replace_sector_objects(index, std::move(texts), step);
+      return;
+    }
+  }
+
+  // Changed objects, saved and uids now match the order of objects
+  for (const auto& uid : recorded)
+  {
+    auto it = live.find(uid);
+    if (it == live.end() || added.find(uid) != added.end())
+      continue;
+
+    const size_t i = it->second;
+    std::string text = save_object(sector, *objects[i]);
+    if (text != saved[i])
+    {
+      step.object_patches.push_back({ index, i, { saved[i] }, { text } });
+      saved[i] = std::move(text);
+    }
   }
-  std::cout << std::endl;
-  std::cout << std::endl;
-#endif
 }
 
 void
-UndoManager::push_undo_stack(std::string&& level_snapshot)
+UndoManager::replace_sector_objects(size_t index, SectorObjects objects, Step& step)
+{
+  SectorObjects& saved = m_state->sectors[index];
+  const size_t max = std::min(saved.size(), objects.size());
+
+  size_t prefix = 0;
+  while (prefix < max && saved[prefix] == objects[prefix])
+    prefix += 1;
+
+  size_t suffix = 0;
+  while (suffix < max - prefix &&
+         saved[saved.size() - 1 - suffix] == objects[objects.size() - 1 - suffix])
+    suffix += 1;
+
+  if (prefix + suffix == saved.size() && saved.size() == objects.size())
+    return;
+
+  ObjectPatch patch;
+  patch.sector = index;
+  patch.index = prefix;
+  patch.old_objects.assign(saved.begin() + prefix, saved.begin() + (saved.size() - suffix));
+  patch.new_objects.assign(objects.begin() + prefix, objects.begin() + (objects.size() - suffix));
+  step.object_patches.push_back(std::move(patch));
+
+  saved = std::move(objects);
+}
+
+void
+UndoManager::snapshot_tiles(const std::vector<TileMap*>& tilemaps, bool whole, Step& step)
+{
+  bool same_layout = (tilemaps.size() == m_state->layers.size());
+  for (size_t i = 0; same_layout && i < tilemaps.size(); ++i)
+  {
+    same_layout = (tilemaps[i]->get_width() == m_state->layers[i].width &&
+                   tilemaps[i]->get_height() == m_state->layers[i].height);
+  }
+
+  m_binding.layers.clear();
+  for (const auto& tilemap : tilemaps)
+  {
+    m_binding.layers.push_back(tilemap->get_uid());
+  }
+
+  if (!same_layout)
+  {
+    for (const auto& tilemap : tilemaps)
+    {
+      tilemap->take_changed_tiles();
+    }
+    step.old_layers.reset(new std::vector<TileLayer>(std::move(m_state->layers)));
+    m_state->layers = save_layers(tilemaps);
+    step.new_layers.reset(new std::vector<TileLayer>(m_state->layers));
+    return;
+  }
+
+  for (size_t i = 0; i < tilemaps.size(); ++i)
+  {
+    TileLayer& layer = m_state->layers[i];
+    const Rect changed = tilemaps[i]->take_changed_tiles();
+    const Rect area = whole ? Rect(0, 0, layer.width, layer.height) :
+      Rect(std::max(changed.left, 0), std::max(changed.top, 0),
+           std::min(changed.right, layer.width), std::min(changed.bottom, layer.height));
+    if (area.empty())
+      continue;
+
+    const std::vector<uint32_t>& tiles = tilemaps[i]->get_tiles();
+    Rect rect(area.right, area.bottom, area.left, area.top);
+    for (int y = area.top; y < area.bottom; ++y)
+    {
+      for (int x = area.left; x < area.right; ++x)
+      {
+        if (tiles[y * layer.width + x] != layer.tiles[y * layer.width + x])
+        {
+          rect.left = std::min(rect.left, x);
+          rect.top = std::min(rect.top, y);
+          rect.right = std::max(rect.right, x + 1);
+          rect.bottom = std::max(rect.bottom, y + 1);
+        }
+      }
+    }
+    if (rect.empty())
+      continue;
+
+    TilePatch patch;
+    patch.layer = i;
+    patch.rect = rect;
+    compress_rect(layer.tiles, layer.width, rect, patch.old_tiles);
+    compress_rect(tiles, layer.width, rect, patch.new_tiles);
+    step.tile_patches.push_back(std::move(patch));
+
+    for (int y = rect.top; y < rect.bottom; ++y)
+    {
+      std::copy(tiles.begin() + (y * layer.width + rect.left),
+                tiles.begin() + (y * layer.width + rect.right),
+                layer.tiles.begin() + (y * layer.width + rect.left));
+    }
+  }
+}
+
+void
+UndoManager::push_step(std::unique_ptr<Step> step)
 {
   log_info << "doing snapshot" << std::endl;
 
-  m_redo_stack.clear();
-  m_undo_stack.push_back(std::move(level_snapshot));
+  // A new change makes the redo steps obsolete
+  m_steps.resize(m_position);
+
+  m_steps_since_checkpoint += 1;
+  if (m_steps_since_checkpoint >= m_checkpoint_interval)
+  {
+    step->checkpoint.reset(new LevelState(*m_state));
+    m_steps_since_checkpoint = 0;
+  }
+
+  m_steps.push_back(std::move(step));
+  m_position += 1;
   m_index_pos += 1;
 
   cleanup();
-
-  debug_print("snapshot");
 }
 
 void
 UndoManager::cleanup()
 {
-  while (m_undo_stack.size() > m_max_snapshots) {
-    m_undo_stack.erase(m_undo_stack.end() - m_max_snapshots,
-                       m_undo_stack.end());
+  while (m_steps.size() > m_max_snapshots && m_position > 0)
+  {
+    // Move the base past the dropped step, so the oldest remaining
+    // step can still be undone
+    const Step& step = *m_steps.front();
+    if (step.checkpoint)
+    {
+      m_base.reset(new LevelState(*step.checkpoint));
+    }
+    else if (m_base && !apply_step(*m_base, step, false))
+    {
+      log_warning << "undo: history is inconsistent, the oldest step can't be undone" << std::endl;
+      m_base.reset();
+    }
+
+    m_steps.erase(m_steps.begin());
+    m_position -= 1;
+  }
+}
+
+bool
+UndoManager::apply_step(LevelState& state, const Step& step, bool reverse) const
+{
+  if (step.text_patch)
+  {
+    const std::string& from = reverse ? step.text_patch->new_text : step.text_patch->old_text;
+    const std::string& to = reverse ? step.text_patch->old_text : step.text_patch->new_text;
+    if (state.skeleton.compare(step.text_patch->offset, from.size(), from) != 0)
+      return false;
+
+    state.skeleton.replace(step.text_patch->offset, from.size(), to);
+  }
+
+  if (step.old_sectors)
+  {
+    state.sectors = reverse ? *step.old_sectors : *step.new_sectors;
+  }
+
+  for (size_t n = 0; n < step.object_patches.size(); ++n)
+  {
+    const ObjectPatch& patch = step.object_patches[reverse ? step.object_patches.size() - 1 - n : n];
+    if (patch.sector >= state.sectors.size())
+      return false;
+
+    SectorObjects& objects = state.sectors[patch.sector];
+    const SectorObjects& from = reverse ? patch.new_objects : patch.old_objects;
+    const SectorObjects& to = reverse ? patch.old_objects : patch.new_objects;
+    if (patch.index + from.size() > objects.size() ||
+        !std::equal(from.begin(), from.end(), objects.begin() + patch.index))
+      return false;
+
+    objects.erase(objects.begin() + patch.index, objects.begin() + (patch.index + from.size()));
+    objects.insert(objects.begin() + patch.index, to.begin(), to.end());
+  }
+
+  if (step.old_layers)
+  {
+    state.layers = reverse ? *step.old_layers : *step.new_layers;
+  }
+
+  for (const auto& patch : step.tile_patches)
+  {
+    if (patch.layer >= state.layers.size())
+      return false;
+
+    TileLayer& layer = state.layers[patch.layer];
+    decompress_rect(reverse ? patch.old_tiles : patch.new_tiles, patch.rect,
+                    [&layer](int x, int y, uint32_t tile) {
+                      layer.tiles[y * layer.width + x] = tile;
+                    });
+  }
+
+  return true;
+}
+
+bool
+UndoManager::restore_checkpoint(size_t position)
+{
+  // Replay the steps from the closest checkpoint before position, or
+  // from the base if there is none
+  const LevelState* start = m_base.get();
+  size_t first = 0;
+  for (size_t i = position; i > 0; --i)
+  {
+    if (m_steps[i - 1]->checkpoint)
+    {
+      start = m_steps[i - 1]->checkpoint.get();
+      first = i;
+      break;
+    }
+  }
+
+  if (!start)
+    return false;
+
+  auto state = std::make_unique<LevelState>(*start);
+  for (size_t j = first; j < position; ++j)
+  {
+    if (!apply_step(*state, *m_steps[j], false))
+      return false;
+  }
+  m_state = std::move(state);
+  return true;
+}
+
+void
+UndoManager::apply_tile_patches(Level& level, const Step& step, bool reverse) const
+{
+  std::vector<TileMap*> tilemaps = get_tilemaps(level);
+  for (const auto& patch : step.tile_patches)
+  {
+    if (patch.layer >= tilemaps.size())
+    {
+      log_warning << "undo: tilemap " << patch.layer << " doesn't exist" << std::endl;
+      continue;
+    }
+
+    TileMap& tilemap = *tilemaps[patch.layer];
+    decompress_rect(reverse ? patch.old_tiles : patch.new_tiles, patch.rect,
+                    [&tilemap](int x, int y, uint32_t tile) {
+                      tilemap.change(x, y, tile);
+                    });
+  }
+
+  // The state has these tiles already
+  for (const auto& tilemap : tilemaps)
+  {
+    tilemap->take_changed_tiles();
   }
 }
 
 std::unique_ptr<Level>
-UndoManager::undo()
+UndoManager::create_level(bool worldmap) const
 {
-  if (m_undo_stack.size() < 2) return {};
+  // Put the objects back into the sectors, then the tiles into the tilemaps
+  const std::string objects = replace_placeholders(
+    m_state->skeleton, OBJECTS_PLACEHOLDER,
+    [this](std::ostream& out, size_t sector) {
+      if (sector < m_state->sectors.size())
+      {
+        for (const auto& object : m_state->sectors[sector])
+        {
+          out << object;
+        }
+      }
+    });
 
-  m_redo_stack.push_back(std::move(m_undo_stack.back()));
-  m_undo_stack.pop_back();
+  const std::string text = replace_placeholders(
+    objects, TILES_PLACEHOLDER,
+    [this](std::ostream& out, size_t layer) {
+      if (layer < m_state->layers.size())
+      {
+        Writer writer(out);
+        writer.write("tiles", m_state->layers[layer].tiles, m_state->layers[layer].width);
+      }
+    });
 
-  std::istringstream in(m_undo_stack.back());
+  std::istringstream in(text);
   ReaderMapping::s_translations_enabled = false;
-  auto level = LevelParser::from_stream(in, "<undo_stack>", Editor::current()->get_level()->is_worldmap(), true);
+  auto level = LevelParser::from_stream(in, "<undo_stack>", worldmap, true);
   ReaderMapping::s_translations_enabled = true;
+  return level;
+}
+
+bool
+UndoManager::undo(Level& level, std::unique_ptr<Level>& new_level)
+{
+  // Edits that haven't been recorded yet are undone first
+  try_snapshot(level);
+
+  if (m_position == 0) return false;
 
+  const Step& step = *m_steps[m_position - 1];
+  bool reload = step.needs_reload();
+  if (!apply_step(*m_state, step, true))
+  {
+    if (!restore_checkpoint(m_position - 1))
+    {
+      log_warning << "undo: history is inconsistent, discarding it" << std::endl;
+      m_steps.clear();
+      m_position = 0;
+      m_state.reset();
+      m_base.reset();
+      m_bound = false;
+      try_snapshot(level);
+      return false;
+    }
+    reload = true;
+  }
+
+  m_position -= 1;
   m_index_pos -= 1;
 
-  debug_print("undo");
+  if (reload)
+  {
+    new_level = create_level(level.is_worldmap());
+    m_bound = false;
+    m_records.clear();
+  }
+  else
+  {
+    apply_tile_patches(level, step, true);
+  }
 
-  return level;
+  return true;
 }
 
-std::unique_ptr<Level>
-UndoManager::redo()
+bool
+UndoManager::redo(Level& level, std::unique_ptr<Level>& new_level)
 {
-  if (m_redo_stack.empty()) return {};
+  if (m_position >= m_steps.size()) return false;
 
-  m_undo_stack.push_back(std::move(m_redo_stack.back()));
-  m_redo_stack.pop_back();
+  const Step& step = *m_steps[m_position];
+  bool reload = step.needs_reload();
+  if (!apply_step(*m_state, step, false))
+  {
+    if (!restore_checkpoint(m_position + 1))
+    {
+      log_warning << "redo: history is inconsistent, discarding the redo steps" << std::endl;
+      m_steps.resize(m_position);
+      return false;
+    }
+    reload = true;
+  }
 
+  m_position += 1;
   m_index_pos += 1;
 
-  std::istringstream in(m_undo_stack.back());
-  ReaderMapping::s_translations_enabled = false;
-  auto level = LevelParser::from_stream(in, "<redo_stack>", Editor::current()->get_level()->is_worldmap(), true);
-  ReaderMapping::s_translations_enabled = true;
-
-  debug_print("redo");
+  if (reload)
+  {
+    new_level = create_level(level.is_worldmap());
+    m_bound = false;
+    m_records.clear();
+  }
+  else
+  {
+    apply_tile_patches(level, step, false);
+  }
 
-  return level;
+  return true;
 }
 
 /* EOF */
@@ -17,22 +17,129 @@
 #ifndef HEADER_SUPERTUX_EDITOR_UNDO_MANAGER_HPP
 #define HEADER_SUPERTUX_EDITOR_UNDO_MANAGER_HPP
 
-#include <vector>
-#include <string>
 #include <memory>
+#include <stdint.h>
+#include <string>
+#include <vector>
 
+#include "math/rect.hpp"
+#include "util/uid.hpp"
+
+class GameObject;
 class Level;
+class Sector;
+class TileMap;
 
+/** Keeps the editing history of a level as a list of deltas. The
+    editor reports which objects an edit touched with record_object(),
+    tilemaps keep track of their changed tiles themselves, so a
+    snapshot only saves the touched objects and compares the changed
+    tiles. Full copies of the level state are only kept as periodic
+    checkpoints and as the base of the oldest step. */
 class UndoManager
 {
 private:
+  struct TileLayer
+  {
+    int width;
+    int height;
+    std::vector<uint32_t> tiles;
+  };
+
+  /** The saved objects of a sector, in the order of the sector */
+  typedef std::vector<std::string> SectorObjects;
+
+  struct LevelState
+  {
+    /** The level as saved by Level::save(), with the objects of each
+        sector replaced by a placeholder */
+    std::string skeleton;
+    std::vector<SectorObjects> sectors;
+    /** The tiles of all tilemaps, in the order of the sectors */
+    std::vector<TileLayer> layers;
+  };
+
+  struct TilePatch
+  {
+    size_t layer;
+    Rect rect;
+    /** run-length encoded as (count, tile) pairs */
+    std::vector<uint32_t> old_tiles;
+    std::vector<uint32_t> new_tiles;
+  };
+
+  struct TextPatch
+  {
+    size_t offset;
+    std::string old_text;
+    std::string new_text;
+  };
+
+  /** Replaces old_objects at 'index' of a sector with new_objects,
+      either of them is empty when objects were added or removed */
+  struct ObjectPatch
+  {
+    size_t sector;
+    size_t index;
+    SectorObjects old_objects;
+    SectorObjects new_objects;
+  };
+
+  struct Step
+  {
+    std::vector<TilePatch> tile_patches;
+    /** Applied in order, and in reverse order when undoing */
+    std::vector<ObjectPatch> object_patches;
+    std::unique_ptr<TextPatch> text_patch;
+    /** Set when sectors were added or removed */
+    std::unique_ptr<std::vector<SectorObjects> > old_sectors;
+    std::unique_ptr<std::vector<SectorObjects> > new_sectors;
+    /** Set when tilemaps were added, removed or resized */
+    std::unique_ptr<std::vector<TileLayer> > old_layers;
+    std::unique_ptr<std::vector<TileLayer> > new_layers;
+    /** The state after this step, kept every few steps */
+    std::unique_ptr<LevelState> checkpoint;
+
+    bool needs_reload() const
+    {
+      return text_patch || !object_patches.empty() || old_sectors || old_layers;
+    }
+  };
+
+  /** Ties the entries of m_state to the objects of the edited level */
+  struct Binding
+  {
+    const Level* level;
+    std::vector<Sector*> sectors;
+    std::vector<std::vector<UID> > objects;
+    std::vector<UID> layers;
+  };
+
+  struct Record
+  {
+    Sector* sector;
+    UID uid;
+  };
+
 public:
   UndoManager();
 
+  /** Marks an object of 'sector' that was added, changed or is about
+      to be removed, the next snapshot saves it again */
+  void record_object(Sector& sector, const GameObject& object);
+
+  /** Makes the next snapshot save the whole level, for edits that
+      aren't tied to single objects, like level and sector settings or
+      adding and removing sectors */
+  void record_level() { m_record_level = true; }
+
   void try_snapshot(Level& level);
 
-  std::unique_ptr<Level> undo();
-  std::unique_ptr<Level> redo();
+  /** Reverts the last change, returns false if there is nothing to
+      undo. Tile edits are applied to 'level' directly, for anything
+      else a new level is created and returned in 'new_level'. */
+  bool undo(Level& level, std::unique_ptr<Level>& new_level);
+  bool redo(Level& level, std::unique_ptr<Level>& new_level);
 
   bool has_unsaved_changes() const
   {
@@ -45,15 +152,51 @@ public:
   }
 
 private:
-  void push_undo_stack(std::string&& level_snapshot);
+  static std::vector<GameObject*> get_saved_objects(Sector& sector);
+  static std::vector<TileMap*> get_tilemaps(Level& level);
+  static std::string save_skeleton(Level& level);
+  static std::string save_object(Sector& sector, GameObject& object);
+  static std::vector<TileLayer> save_layers(const std::vector<TileMap*>& tilemaps);
+
+  /** Creates a patch of whole lines that turns old_text into new_text */
+  static std::unique_ptr<TextPatch> make_text_patch(const std::string& old_text, const std::string& new_text);
+
+  /** Ties m_state to 'level' if it matches, as after a reload */
+  bool bind(Level& level);
+  bool is_bound(const std::vector<TileMap*>& tilemaps) const;
+
+  void snapshot_level(Level& level, Step& step);
+  void snapshot_sector(size_t index, Sector& sector, const std::vector<UID>& recorded, Step& step);
+  /** Replaces all objects of a sector, keeping the unchanged ones at
+      the beginning and the end */
+  void replace_sector_objects(size_t index, SectorObjects objects, Step& step);
+  void snapshot_tiles(const std::vector<TileMap*>& tilemaps, bool whole, Step& step);
+
+  void push_step(std::unique_ptr<Step> step);
   void cleanup();
-  void debug_print(const char* action);
+
+  bool apply_step(LevelState& state, const Step& step, bool reverse) const;
+  bool restore_checkpoint(size_t position);
+  void apply_tile_patches(Level& level, const Step& step, bool reverse) const;
+  std::unique_ptr<Level> create_level(bool worldmap) const;
 
 private:
   size_t m_max_snapshots;
+  size_t m_checkpoint_interval;
   int m_index_pos;
-  std::vector<std::string> m_undo_stack;
-  std::vector<std::string> m_redo_stack;
+  std::vector<std::unique_ptr<Step> > m_steps;
+  /** Number of steps in m_steps that are applied, the others can be redone */
+  size_t m_position;
+  size_t m_steps_since_checkpoint;
+  /** The state of the level after the last applied step */
+  std::unique_ptr<LevelState> m_state;
+  /** The state before the first step in m_steps */
+  std::unique_ptr<LevelState> m_base;
+  Binding m_binding;
+  /** Cleared whenever a new level was created from m_state */
+  bool m_bound;
+  std::vector<Record> m_records;
+  bool m_record_level;
 
 private:
   UndoManager(const UndoManager&) = delete;
@@ -23,10 +23,10 @@
 #include "video/renderer.hpp"
 
 void
-draw_tile(Canvas& canvas, const TileSet& tileset, uint32_t id, const Vector& pos,
+draw_tile(Canvas& canvas, TileSet& tileset, uint32_t id, const Vector& pos,
           int z_pos, const Color& color)
 {
-  const Tile& tile = tileset.get(id);
+  const Tile& tile = tileset.resolve(id);
   tile.draw(canvas, pos, z_pos, color);
 }
 
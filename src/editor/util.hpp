@@ -26,7 +26,7 @@ class Canvas;
 class TileSet;
 
 void
-draw_tile(Canvas& canvas, const TileSet& tileset, uint32_t id, const Vector& pos,
+draw_tile(Canvas& canvas, TileSet& tileset, uint32_t id, const Vector& pos,
           int z_pos, const Color& color = Color(1, 1, 1));
 
 #endif
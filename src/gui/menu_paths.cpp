@@ -32,6 +32,7 @@ auto on_select = [](std::string path, PathObject& target, std::string path_ref)
       auto* into = Editor::current()->get_sector()->get_object_by_name<PathGameObject>(path_ref);
       if (from && into) {
         from->copy_into(*into);
+        Editor::current()->record_object(*into);
         MenuManager::instance().pop_menu();
       } else {
         log_warning << "Could not copy path, misses " << (from ? "" : "'from'")
@@ -147,14 +147,14 @@ Notification::draw(DrawingContext& context)
 
   if (m_mouse_over_sym1)
   {
-    context.color().draw_text(Resources::normal_font, _("Do not show again"),
+    context.color().draw_text(Resources::normal_font, _s("Do not show again"),
                                 Vector(m_mouse_pos.x,
                                        m_mouse_pos.y + 20.0f),
                                 ALIGN_RIGHT, LAYER_GUI + 1, Color::CYAN);
   }
   else if (m_mouse_over_sym2)
   {
-    context.color().draw_text(Resources::normal_font, _("Close"),
+    context.color().draw_text(Resources::normal_font, _s("Close"),
                                 Vector(m_mouse_pos.x,
                                        m_mouse_pos.y + 20.0f),
                                 ALIGN_RIGHT, LAYER_GUI + 1, Color::CYAN);
@@ -15,6 +15,9 @@
 //  along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 #include "math/bezier.hpp"
+
+#include <algorithm>
+
 #include "util/log.hpp"
 #include "video/color.hpp"
 #include "video/drawing_context.hpp"
@@ -123,4 +126,63 @@ Bezier::draw_curve(DrawingContext& context, const Vector& p1, const Vector& p2,
   }
 }
 
+BezierLengthTable::BezierLengthTable() :
+  m_p1(0.0f, 0.0f),
+  m_p2(0.0f, 0.0f),
+  m_p3(0.0f, 0.0f),
+  m_p4(0.0f, 0.0f),
+  m_points(),
+  m_lengths()
+{
+}
+
+void
+BezierLengthTable::build(const Vector& p1, const Vector& p2, const Vector& p3,
+                         const Vector& p4, int steps)
+{
+  m_p1 = p1;
+  m_p2 = p2;
+  m_p3 = p3;
+  m_p4 = p4;
+
+  m_points.resize(steps + 1);
+  m_lengths.resize(steps + 1);
+
+  const float fsteps = static_cast<float>(steps);
+  m_points[0] = p1;
+  m_lengths[0] = 0.0f;
+  for (int i = 1; i <= steps; i++)
+  {
+    m_points[i] = Bezier::get_point(p1, p2, p3, p4, static_cast<float>(i) / fsteps);
+    m_lengths[i] = m_lengths[i - 1] + glm::length(m_points[i] - m_points[i - 1]);
+  }
+}
+
+bool
+BezierLengthTable::matches(const Vector& p1, const Vector& p2, const Vector& p3,
+                           const Vector& p4) const
+{
+  return !m_points.empty() && p1 == m_p1 && p2 == m_p2 && p3 == m_p3 && p4 == m_p4;
+}
+
+Vector
+BezierLengthTable::get_point_by_length(float t) const
+{
+  const float length = get_length() * t;
+  if (length <= 0.0f)
+    return m_p1;
+
+  // first sample past the wanted length
+  auto it = std::lower_bound(m_lengths.begin(), m_lengths.end(), length);
+  if (it == m_lengths.end())
+    return m_p4;
+
+  const size_t i = static_cast<size_t>(it - m_lengths.begin());
+  const float step = m_lengths[i] - m_lengths[i - 1];
+  if (step <= 0.0f)
+    return m_points[i];
+
+  return m_points[i - 1] + (m_points[i] - m_points[i - 1]) * ((length - m_lengths[i - 1]) / step);
+}
+
 /* EOF */
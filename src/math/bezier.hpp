@@ -17,6 +17,8 @@
 #ifndef HEADER_SUPERTUX_MATH_BEZIER_HPP
 #define HEADER_SUPERTUX_MATH_BEZIER_HPP
 
+#include <vector>
+
 #include <math/vector.hpp>
 
 class Color;
@@ -43,6 +45,33 @@ private:
   Bezier& operator=(const Bezier&) = delete;
 };
 
+/** The sampled arc length of a single bezier curve, so that
+    get_point_by_length() is a binary search instead of sampling the
+    curve twice for every call */
+class BezierLengthTable final
+{
+public:
+  BezierLengthTable();
+
+  /** Samples the curve like Bezier::get_length() */
+  void build(const Vector& p1, const Vector& p2, const Vector& p3, const Vector& p4, int steps = 100);
+
+  /** Whether the table was built from the given curve */
+  bool matches(const Vector& p1, const Vector& p2, const Vector& p3, const Vector& p4) const;
+
+  float get_length() const { return m_lengths.empty() ? 0.0f : m_lengths.back(); }
+
+  /** Same as Bezier::get_point_by_length() */
+  Vector get_point_by_length(float t) const;
+
+private:
+  Vector m_p1, m_p2, m_p3, m_p4;
+
+  /** The sampled points and the curve length up to each of them */
+  std::vector<Vector> m_points;
+  std::vector<float> m_lengths;
+};
+
 #endif
 
 /* EOF */
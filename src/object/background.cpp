@@ -29,6 +29,7 @@
 #include "util/writer.hpp"
 #include "video/drawing_context.hpp"
 #include "video/surface.hpp"
+#include "video/surface_batch.hpp"
 
 Background::Background() :
   ExposedObject<Background, scripting::Background>(this),
@@ -309,6 +310,11 @@ Background::draw_image(DrawingContext& context, const Vector& pos_)
   }
   else
   {
+    // all repetitions of an image go into a single request
+    SurfaceBatch batch(m_image, m_color);
+    SurfaceBatch batch_top(m_image_top ? m_image_top : m_image, m_color);
+    SurfaceBatch batch_bottom(m_image_bottom ? m_image_bottom : m_image, m_color);
+
     switch (m_alignment)
     {
       case LEFT_ALIGNMENT:
@@ -316,7 +322,7 @@ Background::draw_image(DrawingContext& context, const Vector& pos_)
         {
           Vector p(pos_.x - parallax_image_size.width / 2.0f,
                    pos_.y + static_cast<float>(y) * img_h - img_h_2);
-          canvas.draw_surface(m_image, p, 0.f, m_color, m_blend, m_layer);
+          batch.draw(p);
         }
         break;
 
@@ -325,7 +331,7 @@ Background::draw_image(DrawingContext& context, const Vector& pos_)
         {
           Vector p(pos_.x + parallax_image_size.width / 2.0f - img_w,
                    pos_.y + static_cast<float>(y) * img_h - img_h_2);
-          canvas.draw_surface(m_image, p, 0.f, m_color, m_blend, m_layer);
+          batch.draw(p);
         }
         break;
 
@@ -334,7 +340,7 @@ Background::draw_image(DrawingContext& context, const Vector& pos_)
         {
           Vector p(pos_.x + static_cast<float>(x) * img_w - img_w_2,
                    pos_.y - parallax_image_size.height / 2.0f);
-          canvas.draw_surface(m_image, p, 0.f, m_color, m_blend, m_layer);
+          batch.draw(p);
         }
         break;
 
@@ -343,7 +349,7 @@ Background::draw_image(DrawingContext& context, const Vector& pos_)
         {
           Vector p(pos_.x + static_cast<float>(x) * img_w - img_w_2,
                    pos_.y - img_h + parallax_image_size.height / 2.0f);
-          canvas.draw_surface(m_image, p, 0.f, m_color, m_blend, m_layer);
+          batch.draw(p);
         }
         break;
 
@@ -356,19 +362,28 @@ Background::draw_image(DrawingContext& context, const Vector& pos_)
 
             if (m_image_top && (y < 0))
             {
-              canvas.draw_surface(m_image_top, p, 0.f, m_color, m_blend, m_layer);
+              batch_top.draw(p);
             }
             else if (m_image_bottom && (y > 0))
             {
-              canvas.draw_surface(m_image_bottom, p, 0.f, m_color, m_blend, m_layer);
+              batch_bottom.draw(p);
             }
             else
             {
-              canvas.draw_surface(m_image, p, 0.f, m_color, m_blend, m_layer);
+              batch.draw(p);
             }
           }
         break;
     }
+
+    for (const auto* it : { &batch_top, &batch, &batch_bottom })
+    {
+      if (!it->get_srcrects().empty())
+      {
+        canvas.draw_surface_batch(it->get_surface(), it->get_srcrects(), it->get_dstrects(),
+                                  it->get_color(), m_layer, m_blend);
+      }
+    }
   }
   context.set_flip(context.get_flip() ^ m_flip);
 }
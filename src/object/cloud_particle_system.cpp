@@ -270,8 +270,8 @@ void CloudParticleSystem::draw(DrawingContext& context)
     auto& batch = it.second;
     // FIXME: What is the colour used for?
     // RESOLVED : That's the tint and the alpha
-    context.color().draw_surface_batch(surface, batch.move_srcrects(),
-      batch.move_dstrects(), batch.move_angles(), batch.get_color(), z_pos);
+    context.color().draw_surface_batch(surface, batch.get_srcrects(),
+      batch.get_dstrects(), batch.get_angles(), batch.get_color(), z_pos);
   }
 
   context.pop_transform();
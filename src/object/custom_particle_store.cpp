@@ -0,0 +1,248 @@
+//  SuperTux
+//  Copyright (C) 2024 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "object/custom_particle_store.hpp"
+
+namespace {
+
+template<typename T>
+void compact(std::vector<T>& values, const std::vector<size_t>& survivors)
+{
+  for (size_t i = 0; i < survivors.size(); ++i)
+  {
+    values[i] = values[survivors[i]];
+  }
+  values.resize(survivors.size());
+}
+
+} // namespace
+
+CustomParticleStore::CustomParticleStore() :
+  pos_x(),
+  pos_y(),
+  speed_x(),
+  speed_y(),
+  acc_x(),
+  acc_y(),
+  friction_x(),
+  friction_y(),
+  feather_factor(),
+  angle(),
+  angle_speed(),
+  angle_acc(),
+  angle_decc(),
+  lifetime(),
+  birth_time(),
+  death_time(),
+  total_birth(),
+  total_death(),
+  scale(),
+  alpha(),
+  mobile(),
+  move(),
+  texture(),
+  birth_mode(),
+  death_mode(),
+  birth_easing(),
+  death_easing(),
+  rotation_mode(),
+  collision_mode(),
+  offscreen_mode(),
+  flags()
+{
+}
+
+void
+CustomParticleStore::reserve(size_t count)
+{
+  pos_x.reserve(count);
+  pos_y.reserve(count);
+  speed_x.reserve(count);
+  speed_y.reserve(count);
+  acc_x.reserve(count);
+  acc_y.reserve(count);
+  friction_x.reserve(count);
+  friction_y.reserve(count);
+  feather_factor.reserve(count);
+  angle.reserve(count);
+  angle_speed.reserve(count);
+  angle_acc.reserve(count);
+  angle_decc.reserve(count);
+  lifetime.reserve(count);
+  birth_time.reserve(count);
+  death_time.reserve(count);
+  total_birth.reserve(count);
+  total_death.reserve(count);
+  scale.reserve(count);
+  alpha.reserve(count);
+  mobile.reserve(count);
+  move.reserve(count);
+  texture.reserve(count);
+  birth_mode.reserve(count);
+  death_mode.reserve(count);
+  birth_easing.reserve(count);
+  death_easing.reserve(count);
+  rotation_mode.reserve(count);
+  collision_mode.reserve(count);
+  offscreen_mode.reserve(count);
+  flags.reserve(count);
+}
+
+void
+CustomParticleStore::resize(size_t count)
+{
+  pos_x.resize(count, 0.0f);
+  pos_y.resize(count, 0.0f);
+  speed_x.resize(count, 0.0f);
+  speed_y.resize(count, 0.0f);
+  acc_x.resize(count, 0.0f);
+  acc_y.resize(count, 0.0f);
+  friction_x.resize(count, 0.0f);
+  friction_y.resize(count, 0.0f);
+  feather_factor.resize(count, 0.0f);
+  angle.resize(count, 0.0f);
+  angle_speed.resize(count, 0.0f);
+  angle_acc.resize(count, 0.0f);
+  angle_decc.resize(count, 0.0f);
+  lifetime.resize(count, 0.0f);
+  birth_time.resize(count, 0.0f);
+  death_time.resize(count, 0.0f);
+  total_birth.resize(count, 0.0f);
+  total_death.resize(count, 0.0f);
+  scale.resize(count, 1.0f);
+  alpha.resize(count, 1.0f);
+  mobile.resize(count, 1.0f);
+  move.resize(count, 1.0f);
+  texture.resize(count, 0);
+  birth_mode.resize(count, 0);
+  death_mode.resize(count, 0);
+  birth_easing.resize(count, EaseNone);
+  death_easing.resize(count, EaseNone);
+  rotation_mode.resize(count, 0);
+  collision_mode.resize(count, 0);
+  offscreen_mode.resize(count, 0);
+  flags.resize(count, 0);
+}
+
+size_t
+CustomParticleStore::add()
+{
+  size_t index = size();
+  resize(index + 1);
+  return index;
+}
+
+void
+CustomParticleStore::remove_dead()
+{
+  std::vector<size_t> survivors;
+  survivors.reserve(size());
+  for (size_t i = 0; i < size(); ++i)
+  {
+    if (!has_flag(i, READY_FOR_DELETION))
+      survivors.push_back(i);
+  }
+
+  if (survivors.size() == size())
+    return;
+
+  compact(pos_x, survivors);
+  compact(pos_y, survivors);
+  compact(speed_x, survivors);
+  compact(speed_y, survivors);
+  compact(acc_x, survivors);
+  compact(acc_y, survivors);
+  compact(friction_x, survivors);
+  compact(friction_y, survivors);
+  compact(feather_factor, survivors);
+  compact(angle, survivors);
+  compact(angle_speed, survivors);
+  compact(angle_acc, survivors);
+  compact(angle_decc, survivors);
+  compact(lifetime, survivors);
+  compact(birth_time, survivors);
+  compact(death_time, survivors);
+  compact(total_birth, survivors);
+  compact(total_death, survivors);
+  compact(scale, survivors);
+  compact(alpha, survivors);
+  compact(mobile, survivors);
+  compact(move, survivors);
+  compact(texture, survivors);
+  compact(birth_mode, survivors);
+  compact(death_mode, survivors);
+  compact(birth_easing, survivors);
+  compact(death_easing, survivors);
+  compact(rotation_mode, survivors);
+  compact(collision_mode, survivors);
+  compact(offscreen_mode, survivors);
+  compact(flags, survivors);
+}
+
+// The kernels below are kept free of branches and function calls, so
+// that they get auto-vectorized.
+
+void
+CustomParticleStore::integrate_lifetime(float dt_sec)
+{
+  const size_t count = size();
+  float* life = lifetime.data();
+  for (size_t i = 0; i < count; ++i)
+  {
+    const float remaining = life[i] - dt_sec;
+    life[i] = remaining < 0.0f ? 0.0f : remaining;
+  }
+}
+
+void
+CustomParticleStore::integrate_speed(float dt_sec)
+{
+  const size_t count = size();
+  float* sx = speed_x.data();
+  float* sy = speed_y.data();
+  const float* ax = acc_x.data();
+  const float* ay = acc_y.data();
+  const float* fx = friction_x.data();
+  const float* fy = friction_y.data();
+  const float* m = mobile.data();
+  for (size_t i = 0; i < count; ++i)
+  {
+    const float dt = dt_sec * m[i];
+    sx[i] = (sx[i] + ax[i] * dt) * (1.0f - fx[i] * dt);
+    sy[i] = (sy[i] + ay[i] * dt) * (1.0f - fy[i] * dt);
+  }
+}
+
+void
+CustomParticleStore::integrate_position(float dt_sec)
+{
+  const size_t count = size();
+  float* px = pos_x.data();
+  float* py = pos_y.data();
+  const float* sx = speed_x.data();
+  const float* sy = speed_y.data();
+  const float* m = mobile.data();
+  float* mv = move.data();
+  for (size_t i = 0; i < count; ++i)
+  {
+    const float dt = dt_sec * mv[i];
+    px[i] += sx[i] * dt;
+    py[i] += sy[i] * dt;
+    mv[i] = m[i];
+  }
+}
+
+/* EOF */
@@ -0,0 +1,129 @@
+//  SuperTux
+//  Copyright (C) 2024 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef HEADER_SUPERTUX_OBJECT_CUSTOM_PARTICLE_STORE_HPP
+#define HEADER_SUPERTUX_OBJECT_CUSTOM_PARTICLE_STORE_HPP
+
+#include <stdint.h>
+#include <vector>
+
+#include "math/easing.hpp"
+
+/** Holds the particles of a CustomParticleSystem as a structure of
+    arrays. Every particle is an index into the arrays below, the
+    integration kernels walk contiguous float arrays so that the
+    compiler can vectorize them.
+
+    The mode arrays store the (private) enums of CustomParticleSystem
+    as plain bytes. */
+class CustomParticleStore final
+{
+public:
+  enum Flags : uint8_t {
+    HAS_BEEN_ON_SCREEN = 1 << 0,
+    HAS_BEEN_IN_LIFE_ZONE = 1 << 1,
+    LAST_LIFE_ZONE_REQUIRED_INSTAKILL = 1 << 2,
+    READY_FOR_DELETION = 1 << 3
+  };
+
+public:
+  CustomParticleStore();
+
+  size_t size() const { return pos_x.size(); }
+  bool empty() const { return pos_x.empty(); }
+
+  void clear() { resize(0); }
+  void reserve(size_t count);
+
+  /** Appends a particle with all values zeroed, except for scale,
+      alpha and the movement masks which are 1 */
+  size_t add();
+
+  /** Removes all particles flagged READY_FOR_DELETION, the remaining
+      particles keep their order */
+  void remove_dead();
+
+  bool is_stuck(size_t i) const { return mobile[i] == 0.0f; }
+  void set_stuck(size_t i) { mobile[i] = 0.0f; move[i] = 0.0f; }
+
+  bool has_flag(size_t i, uint8_t flag) const { return (flags[i] & flag) != 0; }
+  void set_flag(size_t i, uint8_t flag) { flags[i] = static_cast<uint8_t>(flags[i] | flag); }
+  void unset_flag(size_t i, uint8_t flag) { flags[i] = static_cast<uint8_t>(flags[i] & ~flag); }
+
+  /** Counts down the lifetime of all particles, clamped at zero */
+  void integrate_lifetime(float dt_sec);
+
+  /** Applies acceleration and friction to all particles that aren't stuck */
+  void integrate_speed(float dt_sec);
+
+  /** Moves all particles whose 'move' mask is set, resets the mask of
+      all particles that aren't stuck for the next frame */
+  void integrate_position(float dt_sec);
+
+private:
+  void resize(size_t count);
+
+public:
+  std::vector<float> pos_x;
+  std::vector<float> pos_y;
+  std::vector<float> speed_x;
+  std::vector<float> speed_y;
+  std::vector<float> acc_x;
+  std::vector<float> acc_y;
+  std::vector<float> friction_x;
+  std::vector<float> friction_y;
+  std::vector<float> feather_factor;
+
+  std::vector<float> angle;
+  std::vector<float> angle_speed;
+  std::vector<float> angle_acc;
+  std::vector<float> angle_decc;
+
+  std::vector<float> lifetime;
+  std::vector<float> birth_time;
+  std::vector<float> death_time;
+  std::vector<float> total_birth;
+  std::vector<float> total_death;
+
+  std::vector<float> scale;
+  /** multiplied with the alpha of the sprite properties when fading */
+  std::vector<float> alpha;
+
+  /** 0 for particles that got stuck forever, 1 otherwise */
+  std::vector<float> mobile;
+  /** 0 for particles that are held back by a collision this frame */
+  std::vector<float> move;
+
+  /** index into CustomParticleSystem::m_textures */
+  std::vector<uint16_t> texture;
+
+  std::vector<uint8_t> birth_mode;
+  std::vector<uint8_t> death_mode;
+  std::vector<EasingMode> birth_easing;
+  std::vector<EasingMode> death_easing;
+  std::vector<uint8_t> rotation_mode;
+  std::vector<uint8_t> collision_mode;
+  std::vector<uint8_t> offscreen_mode;
+  std::vector<uint8_t> flags;
+
+private:
+  CustomParticleStore(const CustomParticleStore&) = delete;
+  CustomParticleStore& operator=(const CustomParticleStore&) = delete;
+};
+
+#endif
+
+/* EOF */
@@ -18,6 +18,7 @@
 
 #include <assert.h>
 #include <math.h>
+#include <map>
 
 #include "collision/collision.hpp"
 #include "editor/particle_editor.hpp"
@@ -393,6 +394,13 @@ CustomParticleSystem::reinit_textures()
   {
     texture_sum_odds += texture.likeliness;
   }
+
+  // Textures may have been removed in the particle editor
+  for (auto& texture : custom_particles.texture)
+  {
+    if (texture >= m_textures.size())
+      texture = 0;
+  }
 }
 
 void
@@ -558,267 +566,82 @@ CustomParticleSystem::update(float dt_sec)
     }
   }
 
-  // Update existing particles
-  for (auto& it : custom_particles) {
-    auto particle = dynamic_cast<CustomParticle*>(it.get());
-    assert(particle);
-
-    if (particle->birth_time > dt_sec) {
-      switch(particle->birth_mode) {
-      case FadeMode::Shrink:
-        particle->scale = static_cast<float>(
-                          getEasingByName(particle->birth_easing)(
-                            static_cast<double>(
-                              1.f - (particle->birth_time / particle->total_birth)
-                            )
-                          ));
-        break;
-      case FadeMode::Fade:
-        particle->props = SpriteProperties(particle->original_props,
-                                           1.f - (particle->birth_time /
-                                                  particle->total_birth));
-        break;
-      default:
-        break;
-      }
-      particle->birth_time -= dt_sec;
-    } else if (particle->birth_time > 0.f) {
-      particle->birth_time = 0.f;
-      switch(particle->birth_mode) {
-      case FadeMode::Shrink:
-        particle->scale = 1.f;
-        break;
-      case FadeMode::Fade:
-        particle->props = particle->original_props;
-        break;
-      default:
-        break;
-      }
-    }
+  const std::vector<ParticleZone::ZoneDetails> zones = get_zones();
+  const Rectf screen(Vector(get_abs_x(), get_abs_y()),
+                     Sizef(static_cast<float>(SCREEN_WIDTH), static_cast<float>(SCREEN_HEIGHT)));
+  const bool collide = Sector::current() != nullptr;
 
-    particle->lifetime -= dt_sec;
-    if (particle->lifetime < 0.f) {
-      particle->lifetime = 0.f;
-    }
+  auto& particles = custom_particles;
 
-    if (particle->birth_time <= 0.f && particle->lifetime <= 0.f) {
-      if (particle->death_time > dt_sec) {
-        switch(particle->death_mode) {
+  // Update existing particles
+  for (size_t i = 0; i < particles.size(); ++i) {
+    update_fading(i, dt_sec);
+  }
+  particles.integrate_lifetime(dt_sec);
+
+  for (size_t i = 0; i < particles.size(); ++i) {
+    if (particles.birth_time[i] <= 0.f && particles.lifetime[i] <= 0.f) {
+      if (particles.death_time[i] > dt_sec) {
+        switch(static_cast<FadeMode>(particles.death_mode[i])) {
         case FadeMode::Shrink:
-          particle->scale = 1.f - static_cast<float>(
-                            getEasingByName(particle->death_easing)(
-                              static_cast<double>(
-                                1.f - (particle->death_time / particle->total_death)
-                              )
-                            ));
+          particles.scale[i] = 1.f - static_cast<float>(
+                               getEasingByName(particles.death_easing[i])(
+                                 static_cast<double>(
+                                   1.f - (particles.death_time[i] / particles.total_death[i])
+                                 )
+                               ));
           break;
         case FadeMode::Fade:
-          particle->props = SpriteProperties(particle->original_props,
-                                                   (particle->death_time /
-                                                    particle->total_death));
+          particles.alpha[i] = particles.death_time[i] / particles.total_death[i];
           break;
         default:
           break;
         }
-        particle->death_time -= dt_sec;
+        particles.death_time[i] -= dt_sec;
       } else {
-        particle->death_time = 0.f;
-        switch(particle->death_mode) {
+        particles.death_time[i] = 0.f;
+        switch(static_cast<FadeMode>(particles.death_mode[i])) {
         case FadeMode::Shrink:
-          particle->scale = 0.f;
+          particles.scale[i] = 0.f;
           break;
         case FadeMode::Fade:
-          particle->props = SpriteProperties(particle->original_props, 0.f);
+          particles.alpha[i] = 0.f;
           break;
         default:
           break;
         }
-        particle->ready_for_deletion = true;
+        particles.set_flag(i, CustomParticleStore::READY_FOR_DELETION);
       }
     }
 
-    float abs_x = get_abs_x();
-    float abs_y = get_abs_y();
-
-    if (!particle->has_been_on_screen) {
-      if (particle->pos.y <= static_cast<float>(SCREEN_HEIGHT) + abs_y
-          && particle->pos.y >= abs_y
-          && particle->pos.x <= static_cast<float>(SCREEN_WIDTH) + abs_x
-          && particle->pos.x >= abs_x) {
-        particle->has_been_on_screen = true;
-      }
-    }
+    update_zones(i, zones, screen);
 
-    switch(particle->offscreen_mode) {
-    case OffscreenMode::Always:
-      if (particle->pos.y > static_cast<float>(SCREEN_HEIGHT) + abs_y
-          || particle->pos.y < abs_y
-          || particle->pos.x > static_cast<float>(SCREEN_WIDTH) + abs_x
-          || particle->pos.x < abs_x) {
-        particle->ready_for_deletion = true;
-      }
-      break;
-    case OffscreenMode::OnlyOnExit:
-      if ((particle->pos.y > static_cast<float>(SCREEN_HEIGHT) + abs_y
-          || particle->pos.y < abs_y
-          || particle->pos.x > static_cast<float>(SCREEN_WIDTH) + abs_x
-          || particle->pos.x < abs_x)
-          && particle->has_been_on_screen) {
-        particle->ready_for_deletion = true;
-      }
-      break;
-    case OffscreenMode::Never:
-      break;
+    // drawn even for a feather factor of 0, so the sequence of
+    // graphicsRandom stays the same for everything drawn after it
+    if (!particles.is_stuck(i)) {
+      const float feather = particles.feather_factor[i];
+      particles.speed_x[i] += graphicsRandom.randf(-feather, feather) * dt_sec * 1000.f;
+      particles.speed_y[i] += graphicsRandom.randf(-feather, feather) * dt_sec * 1000.f;
     }
+  }
 
-    bool is_in_life_zone = false;
-    for (auto& zone : get_zones()) {
-      if (zone.get_rect().contains(particle->pos) && zone.get_particle_name() == m_name) {
-        switch(zone.get_type()) {
-        case ParticleZone::ParticleZoneType::Killer:
-          particle->lifetime = 0.f;
-          particle->birth_time = 0.f;
-          break;
-
-        case ParticleZone::ParticleZoneType::Destroyer:
-          particle->ready_for_deletion = true;
-          break;
-
-        case ParticleZone::ParticleZoneType::LifeClear:
-          particle->last_life_zone_required_instakill = true;
-          particle->has_been_in_life_zone = true;
-          is_in_life_zone = true;
-          break;
-
-        case ParticleZone::ParticleZoneType::Life:
-          particle->last_life_zone_required_instakill = false;
-          particle->has_been_in_life_zone = true;
-          is_in_life_zone = true;
-          break;
-
-          // Nothing to do; there's a warning if I don't put that here
-        case ParticleZone::ParticleZoneType::Spawn:
-          break;
-        }
-      }
-    } // For each ParticleZone object
-
-    if (!is_in_life_zone && particle->has_been_in_life_zone) {
-      if (particle->last_life_zone_required_instakill) {
-        particle->ready_for_deletion = true;
-      } else {
-        particle->lifetime = 0.f;
-        particle->birth_time = 0.f;
-      }
-    }
+  particles.integrate_speed(dt_sec);
 
-    if (!particle->stuck) {
-      particle->speedX += graphicsRandom.randf(-particle->feather_factor,
-                                      particle->feather_factor) * dt_sec * 1000.f;
-      particle->speedY += graphicsRandom.randf(-particle->feather_factor,
-                                      particle->feather_factor) * dt_sec * 1000.f;
-      particle->speedX += particle->accX * dt_sec;
-      particle->speedY += particle->accY * dt_sec;
-      particle->speedX *= 1.f - particle->frictionX * dt_sec;
-      particle->speedY *= 1.f - particle->frictionY * dt_sec;
-
-      if (Sector::current() && collision(particle,
-                    Vector(particle->speedX,particle->speedY) * dt_sec) > 0) {
-        switch(particle->collision_mode) {
-        case CollisionMode::Ignore:
-          particle->pos.x += particle->speedX * dt_sec;
-          particle->pos.y += particle->speedY * dt_sec;
-          break;
-        case CollisionMode::Stick:
-          // Just don't move
-          break;
-        case CollisionMode::StickForever:
-          particle->stuck = true;
-          break;
-        case CollisionMode::BounceHeavy:
-        case CollisionMode::BounceLight:
-          {
-            auto c = get_collision(particle, Vector(particle->speedX, particle->speedY) * dt_sec);
-
-            float speed_angle = atanf(-particle->speedY / particle->speedX);
-            float face_angle = atanf(c.slope_normal.y / c.slope_normal.x);
-            if (c.slope_normal.x == 0.f && c.slope_normal.y == 0.f) {
-              auto cX = get_collision(particle, Vector(particle->speedX, 0) * dt_sec);
-              if (cX.left != cX.right)
-                particle->speedX *= -1;
-              auto cY = get_collision(particle, Vector(0, particle->speedY) * dt_sec);
-              if (cY.top != cY.bottom)
-                particle->speedY *= -1;
-            } else {
-              float dest_angle = face_angle * 2.f - speed_angle; // Reflect the angle around face_angle
-              float dX = cosf(dest_angle),
-                    dY = sinf(dest_angle);
-
-              float true_speed = static_cast<float>(sqrt(pow(particle->speedY, 2)
-                                                      + pow(particle->speedX, 2)));
-
-              particle->speedX = dX * true_speed;
-              particle->speedY = dY * true_speed;
-            }
-
-            switch(particle->collision_mode) {
-              case CollisionMode::BounceHeavy:
-                particle->speedX *= .2f;
-                particle->speedY *= .2f;
-                break;
-              case CollisionMode::BounceLight:
-                particle->speedX *= .7f;
-                particle->speedY *= .7f;
-                break;
-              default:
-                assert(false);
-            }
-
-            particle->pos.x += particle->speedX * dt_sec;
-            particle->pos.y += particle->speedY * dt_sec;
-          }
-          break;
-        case CollisionMode::Destroy:
-          particle->ready_for_deletion = true;
-          break;
-        case CollisionMode::FadeOut:
-          particle->lifetime = 0.f;
-          break;
-        }
-      } else {
-        particle->pos.x += particle->speedX * dt_sec;
-        particle->pos.y += particle->speedY * dt_sec;
-      }
+  for (size_t i = 0; i < particles.size(); ++i) {
+    if (particles.is_stuck(i))
+      continue;
 
-      switch(particle->angle_mode) {
-      case RotationMode::Facing:
-        particle->angle = atanf(particle->speedY / particle->speedX) * 180.f / math::PI;
-        break;
-      case RotationMode::Wiggling:
-        particle->angle += graphicsRandom.randf(-particle->angle_speed / 2.f,
-                                            particle->angle_speed / 2.f) * dt_sec;
-        break;
-      case RotationMode::Fixed:
-      default:
-        particle->angle_speed += particle->angle_acc * dt_sec;
-        particle->angle_speed *= 1.f - particle->angle_decc * dt_sec;
-        particle->angle += particle->angle_speed * dt_sec;
-      }
+    if (collide &&
+        static_cast<CollisionMode>(particles.collision_mode[i]) != CollisionMode::Ignore) {
+      update_collision(i, dt_sec);
     }
+    update_rotation(i, dt_sec);
+  }
 
-  } // For each particle
-
+  particles.integrate_position(dt_sec);
 
   // Clear dead particles
-  // Scroll through the vector backwards, because removing an element affects
-  //   the index of all elements after it (prevents buggy behavior)
-  for (int i = static_cast<int>(custom_particles.size()) - 1; i >= 0; --i) {
-    auto particle = dynamic_cast<CustomParticle*>(custom_particles.at(i).get());
-
-    if (particle->ready_for_deletion) {
-      custom_particles.erase(custom_particles.begin()+i);
-    }
-  }
+  particles.remove_dead();
 
   // Add necessary particles
   float remaining = dt_sec + time_last_remaining;
@@ -827,16 +650,16 @@ CustomParticleSystem::update(float dt_sec)
     int real_max = m_max_amount;
     if (!m_cover_screen) {
       int i = 0;
-      for (auto& zone : get_zones()) {
-        if (zone.get_type() == ParticleZone::ParticleZoneType::Spawn && zone.get_particle_name() == m_name) {
+      for (const auto& zone : zones) {
+        if (zone.get_type() == ParticleZone::ParticleZoneType::Spawn) {
           i++;
         }
       }
       real_max *= i;
     }
-    while (remaining > m_delay && int(custom_particles.size()) < real_max)
+    while (remaining > m_delay && int(particles.size()) < real_max)
     {
-      spawn_particles(remaining);
+      spawn_particles(remaining, zones);
       remaining -= m_delay;
     }
   }
@@ -850,6 +673,210 @@ CustomParticleSystem::update(float dt_sec)
 
 }
 
+void
+CustomParticleSystem::update_fading(size_t i, float dt_sec)
+{
+  auto& particles = custom_particles;
+
+  if (particles.birth_time[i] > dt_sec) {
+    switch(static_cast<FadeMode>(particles.birth_mode[i])) {
+    case FadeMode::Shrink:
+      particles.scale[i] = static_cast<float>(
+                           getEasingByName(particles.birth_easing[i])(
+                             static_cast<double>(
+                               1.f - (particles.birth_time[i] / particles.total_birth[i])
+                             )
+                           ));
+      break;
+    case FadeMode::Fade:
+      particles.alpha[i] = 1.f - (particles.birth_time[i] / particles.total_birth[i]);
+      break;
+    default:
+      break;
+    }
+    particles.birth_time[i] -= dt_sec;
+  } else if (particles.birth_time[i] > 0.f) {
+    particles.birth_time[i] = 0.f;
+    switch(static_cast<FadeMode>(particles.birth_mode[i])) {
+    case FadeMode::Shrink:
+      particles.scale[i] = 1.f;
+      break;
+    case FadeMode::Fade:
+      particles.alpha[i] = 1.f;
+      break;
+    default:
+      break;
+    }
+  }
+}
+
+void
+CustomParticleSystem::update_zones(size_t i, const std::vector<ParticleZone::ZoneDetails>& zones,
+                                   const Rectf& screen)
+{
+  auto& particles = custom_particles;
+  const Vector pos(particles.pos_x[i], particles.pos_y[i]);
+
+  const bool on_screen = pos.y <= screen.get_bottom()
+                      && pos.y >= screen.get_top()
+                      && pos.x <= screen.get_right()
+                      && pos.x >= screen.get_left();
+
+  if (on_screen) {
+    particles.set_flag(i, CustomParticleStore::HAS_BEEN_ON_SCREEN);
+  }
+
+  switch(static_cast<OffscreenMode>(particles.offscreen_mode[i])) {
+  case OffscreenMode::Always:
+    if (!on_screen) {
+      particles.set_flag(i, CustomParticleStore::READY_FOR_DELETION);
+    }
+    break;
+  case OffscreenMode::OnlyOnExit:
+    if (!on_screen && particles.has_flag(i, CustomParticleStore::HAS_BEEN_ON_SCREEN)) {
+      particles.set_flag(i, CustomParticleStore::READY_FOR_DELETION);
+    }
+    break;
+  case OffscreenMode::Never:
+    break;
+  }
+
+  bool is_in_life_zone = false;
+  for (const auto& zone : zones) {
+    if (zone.get_rect().contains(pos)) {
+      switch(zone.get_type()) {
+      case ParticleZone::ParticleZoneType::Killer:
+        particles.lifetime[i] = 0.f;
+        particles.birth_time[i] = 0.f;
+        break;
+
+      case ParticleZone::ParticleZoneType::Destroyer:
+        particles.set_flag(i, CustomParticleStore::READY_FOR_DELETION);
+        break;
+
+      case ParticleZone::ParticleZoneType::LifeClear:
+        particles.set_flag(i, CustomParticleStore::LAST_LIFE_ZONE_REQUIRED_INSTAKILL);
+        particles.set_flag(i, CustomParticleStore::HAS_BEEN_IN_LIFE_ZONE);
+        is_in_life_zone = true;
+        break;
+
+      case ParticleZone::ParticleZoneType::Life:
+        particles.unset_flag(i, CustomParticleStore::LAST_LIFE_ZONE_REQUIRED_INSTAKILL);
+        particles.set_flag(i, CustomParticleStore::HAS_BEEN_IN_LIFE_ZONE);
+        is_in_life_zone = true;
+        break;
+
+        // Nothing to do; there's a warning if I don't put that here
+      case ParticleZone::ParticleZoneType::Spawn:
+        break;
+      }
+    }
+  } // For each ParticleZone object
+
+  if (!is_in_life_zone && particles.has_flag(i, CustomParticleStore::HAS_BEEN_IN_LIFE_ZONE)) {
+    if (particles.has_flag(i, CustomParticleStore::LAST_LIFE_ZONE_REQUIRED_INSTAKILL)) {
+      particles.set_flag(i, CustomParticleStore::READY_FOR_DELETION);
+    } else {
+      particles.lifetime[i] = 0.f;
+      particles.birth_time[i] = 0.f;
+    }
+  }
+}
+
+void
+CustomParticleSystem::update_collision(size_t i, float dt_sec)
+{
+  auto& particles = custom_particles;
+  const SpriteProperties& props = get_particle_props(i);
+  const Vector pos(particles.pos_x[i], particles.pos_y[i]);
+  float& speed_x = particles.speed_x[i];
+  float& speed_y = particles.speed_y[i];
+
+  if (get_collision_type(props, pos, Vector(speed_x, speed_y) * dt_sec) <= 0)
+    return;
+
+  switch(static_cast<CollisionMode>(particles.collision_mode[i])) {
+  case CollisionMode::Ignore:
+    break;
+  case CollisionMode::Stick:
+    // Just don't move
+    particles.move[i] = 0.f;
+    break;
+  case CollisionMode::StickForever:
+    particles.set_stuck(i);
+    break;
+  case CollisionMode::BounceHeavy:
+  case CollisionMode::BounceLight:
+    {
+      auto c = get_collision(props, pos, Vector(speed_x, speed_y) * dt_sec);
+
+      float speed_angle = atanf(-speed_y / speed_x);
+      float face_angle = atanf(c.slope_normal.y / c.slope_normal.x);
+      if (c.slope_normal.x == 0.f && c.slope_normal.y == 0.f) {
+        auto cX = get_collision(props, pos, Vector(speed_x, 0) * dt_sec);
+        if (cX.left != cX.right)
+          speed_x *= -1;
+        auto cY = get_collision(props, pos, Vector(0, speed_y) * dt_sec);
+        if (cY.top != cY.bottom)
+          speed_y *= -1;
+      } else {
+        float dest_angle = face_angle * 2.f - speed_angle; // Reflect the angle around face_angle
+        float dX = cosf(dest_angle),
+              dY = sinf(dest_angle);
+
+        float true_speed = static_cast<float>(sqrt(pow(speed_y, 2)
+                                                + pow(speed_x, 2)));
+
+        speed_x = dX * true_speed;
+        speed_y = dY * true_speed;
+      }
+
+      switch(static_cast<CollisionMode>(particles.collision_mode[i])) {
+        case CollisionMode::BounceHeavy:
+          speed_x *= .2f;
+          speed_y *= .2f;
+          break;
+        case CollisionMode::BounceLight:
+          speed_x *= .7f;
+          speed_y *= .7f;
+          break;
+        default:
+          assert(false);
+      }
+    }
+    break;
+  case CollisionMode::Destroy:
+    particles.set_flag(i, CustomParticleStore::READY_FOR_DELETION);
+    particles.move[i] = 0.f;
+    break;
+  case CollisionMode::FadeOut:
+    particles.lifetime[i] = 0.f;
+    particles.move[i] = 0.f;
+    break;
+  }
+}
+
+void
+CustomParticleSystem::update_rotation(size_t i, float dt_sec)
+{
+  auto& particles = custom_particles;
+
+  switch(static_cast<RotationMode>(particles.rotation_mode[i])) {
+  case RotationMode::Facing:
+    particles.angle[i] = atanf(particles.speed_y[i] / particles.speed_x[i]) * 180.f / math::PI;
+    break;
+  case RotationMode::Wiggling:
+    particles.angle[i] += graphicsRandom.randf(-particles.angle_speed[i] / 2.f,
+                                               particles.angle_speed[i] / 2.f) * dt_sec;
+    break;
+  case RotationMode::Fixed:
+  default:
+    particles.angle_speed[i] += particles.angle_acc[i] * dt_sec;
+    particles.angle_speed[i] *= 1.f - particles.angle_decc[i] * dt_sec;
+    particles.angle[i] += particles.angle_speed[i] * dt_sec;
+  }
+}
+
 void
 CustomParticleSystem::draw(DrawingContext& context)
 {
@@ -858,54 +885,36 @@ CustomParticleSystem::draw(DrawingContext& context)
 
   context.push_transform();
 
-  std::unordered_map<SpriteProperties*, SurfaceBatch> batches;
-  for (const auto& particle : custom_particles) {
-    auto it = batches.find(&(particle->props));
+  const auto& particles = custom_particles;
+
+  // Particles share a batch if they use the same texture and are at the
+  // same point of fading in or out
+  std::map<std::pair<uint16_t, float>, SurfaceBatch> batches;
+  for (size_t i = 0; i < particles.size(); ++i) {
+    const SpriteProperties& props = get_particle_props(i);
+    const auto key = std::make_pair(particles.texture[i], particles.alpha[i]);
+
+    auto it = batches.find(key);
     if (it == batches.end()) {
-      const auto& batch_it = batches.emplace(&(particle->props),
-        SurfaceBatch(particle->props.texture, particle->props.color));
-      batch_it.first->second.draw(Rectf(Vector(
-                                               particle->pos.x - particle->scale
-                                                 * static_cast<float>(
-                                                 particle->props.texture->get_width()
-                                               ) * particle->props.scale.x / 2,
-                                               particle->pos.y - particle->scale
-                                                 * static_cast<float>(
-                                                 particle->props.texture->get_height()
-                                               ) * particle->props.scale.y / 2
-                                        ),
-                                        Vector(
-                                               particle->pos.x + particle->scale
-                                                 * static_cast<float>(
-                                                 particle->props.texture->get_width()
-                                               ) * particle->props.scale.x / 2,
-                                               particle->pos.y + particle->scale
-                                                 * static_cast<float>(
-                                                 particle->props.texture->get_height()
-                                               ) * particle->props.scale.y / 2
-                                        )
-                                 ), particle->angle);
-    } else {
-      it->second.draw(Rectf(particle->pos,
-                                        Vector(
-                                               particle->pos.x + particle->scale
-                                                 * static_cast<float>(
-                                                 particle->texture->get_width()
-                                               ) * particle->props.scale.x,
-                                               particle->pos.y + particle->scale
-                                                 * static_cast<float>(
-                                                 particle->texture->get_height()
-                                               ) * particle->props.scale.y
-                                        )
-                                 ), particle->angle);
+      it = batches.emplace(key, SurfaceBatch(props.texture,
+                                             Color(props.color.red, props.color.green, props.color.blue,
+                                                   props.color.alpha * particles.alpha[i]))).first;
     }
+
+    const float half_width = particles.scale[i] * static_cast<float>(props.texture->get_width())
+                             * props.scale.x / 2;
+    const float half_height = particles.scale[i] * static_cast<float>(props.texture->get_height())
+                              * props.scale.y / 2;
+    it->second.draw(Rectf(particles.pos_x[i] - half_width, particles.pos_y[i] - half_height,
+                          particles.pos_x[i] + half_width, particles.pos_y[i] + half_height),
+                    particles.angle[i]);
   }
 
   for(auto& it : batches) {
-    auto& surface = it.first->texture;
+    const auto& surface = m_textures[it.first.first].texture;
     auto& batch = it.second;
-    context.color().draw_surface_batch(surface, batch.move_srcrects(),
-      batch.move_dstrects(), batch.move_angles(), it.first->color, z_pos);
+    context.color().draw_surface_batch(surface, batch.get_srcrects(),
+      batch.get_dstrects(), batch.get_angles(), batch.get_color(), z_pos);
   }
 
   context.pop_transform();
@@ -914,29 +923,26 @@ CustomParticleSystem::draw(DrawingContext& context)
 // Duplicated from ParticleSystem_Interactive because I intend to bring edits
 // sometime in the future, for even more flexibility with particles. (Semphris)
 int
-CustomParticleSystem::collision(Particle* object, const Vector& movement)
+CustomParticleSystem::get_collision_type(const SpriteProperties& props, const Vector& pos, const Vector& movement) const
 {
   using namespace collision;
 
-  CustomParticle* particle = dynamic_cast<CustomParticle*>(object);
-  assert(particle);
-
   // calculate rectangle where the object will move
   float x1, x2;
   float y1, y2;
 
-  x1 = object->pos.x - particle->props.hb_scale.x * static_cast<float>(particle->props.texture->get_width()) / 2
-          + particle->props.hb_offset.x * static_cast<float>(particle->props.texture->get_width());
-  x2 = x1 + particle->props.hb_scale.x * static_cast<float>(particle->props.texture->get_width()) + movement.x;
+  x1 = pos.x - props.hb_scale.x * static_cast<float>(props.texture->get_width()) / 2
+          + props.hb_offset.x * static_cast<float>(props.texture->get_width());
+  x2 = x1 + props.hb_scale.x * static_cast<float>(props.texture->get_width()) + movement.x;
   if (x2 < x1) {
     float temp_x = x1;
     x1 = x2;
     x2 = temp_x;
   }
 
-  y1 = object->pos.y - particle->props.hb_scale.y * static_cast<float>(particle->props.texture->get_height()) / 2
-          + particle->props.hb_offset.y * static_cast<float>(particle->props.texture->get_height());
-  y2 = y1 + particle->props.hb_scale.y * static_cast<float>(particle->props.texture->get_height()) + movement.y;
+  y1 = pos.y - props.hb_scale.y * static_cast<float>(props.texture->get_height()) / 2
+          + props.hb_offset.y * static_cast<float>(props.texture->get_height());
+  y2 = y1 + props.hb_scale.y * static_cast<float>(props.texture->get_height()) + movement.y;
   if (y2 < y1) {
     float temp_y = y1;
     y1 = y2;
@@ -1003,27 +1009,24 @@ CustomParticleSystem::collision(Particle* object, const Vector& movement)
 }
 
 CollisionHit
-CustomParticleSystem::get_collision(Particle* object, const Vector& movement)
+CustomParticleSystem::get_collision(const SpriteProperties& props, const Vector& pos, const Vector& movement) const
 {
   using namespace collision;
 
-  CustomParticle* particle = dynamic_cast<CustomParticle*>(object);
-  assert(particle);
-
   // calculate rectangle where the object will move
   float x1, x2;
   float y1, y2;
 
-  x1 = object->pos.x - particle->props.scale.x * static_cast<float>(particle->props.texture->get_width()) / 2;
-  x2 = x1 + particle->props.scale.x * static_cast<float>(particle->props.texture->get_width()) + movement.x;
+  x1 = pos.x - props.scale.x * static_cast<float>(props.texture->get_width()) / 2;
+  x2 = x1 + props.scale.x * static_cast<float>(props.texture->get_width()) + movement.x;
   if (x2 < x1) {
     float temp_x = x1;
     x1 = x2;
     x2 = temp_x;
   }
 
-  y1 = object->pos.y - particle->props.scale.y * static_cast<float>(particle->props.texture->get_height()) / 2;
-  y2 = y1 + particle->props.scale.y * static_cast<float>(particle->props.texture->get_height()) + movement.y;
+  y1 = pos.y - props.scale.y * static_cast<float>(props.texture->get_height()) / 2;
+  y2 = y1 + props.scale.y * static_cast<float>(props.texture->get_height()) + movement.y;
   if (y2 < y1) {
     float temp_y = y1;
     y1 = y2;
@@ -1071,19 +1074,19 @@ CustomParticleSystem::get_collision(Particle* object, const Vector& movement)
 // =============================================================================
 // LOCAL
 
-CustomParticleSystem::SpriteProperties
+size_t
 CustomParticleSystem::get_random_texture()
 {
   float val = graphicsRandom.randf(texture_sum_odds);
-  for (auto texture : m_textures)
+  for (size_t i = 0; i < m_textures.size(); ++i)
   {
-    val -= texture.likeliness;
+    val -= m_textures[i].likeliness;
     if (val <= 0)
     {
-      return texture;
+      return i;
     }
   }
-  return m_textures.at(0);
+  return 0;
 }
 
 std::vector<ParticleZone::ZoneDetails>
@@ -1096,7 +1099,9 @@ CustomParticleSystem::get_zones()
 
     // In game or in level editor
     for (auto& zone : GameSession::current()->get_current_sector().get_objects_by_type<ParticleZone>()) {
-      list.push_back(zone.get_details());
+      if (zone.get_particle_name() == m_name) {
+        list.push_back(zone.get_details());
+      }
     }
 
   } else {
@@ -1134,81 +1139,78 @@ CustomParticleSystem::get_abs_y()
 void
 CustomParticleSystem::add_particle(float lifetime, float x, float y)
 {
-  auto particle = std::make_unique<CustomParticle>();
-  particle->original_props = get_random_texture();
-  particle->props = particle->original_props;
-
-  particle->pos.x = x;
-  particle->pos.y = y;
+  auto& particles = custom_particles;
+  const size_t i = particles.add();
+  particles.pos_x[i] = x;
+  particles.pos_y[i] = y;
+  particles.texture[i] = static_cast<uint16_t>(get_random_texture());
 
   float life_elapsed = lifetime;
   float birth_delta = m_particle_birth_time_variation / 2;
-  particle->total_birth = m_particle_birth_time + graphicsRandom.randf(-birth_delta, birth_delta);
-  particle->birth_time = particle->total_birth - life_elapsed;
-  if (particle->birth_time < 0.f) {
-    life_elapsed = -particle->birth_time;
-    particle->birth_time = 0.f;
+  particles.total_birth[i] = m_particle_birth_time + graphicsRandom.randf(-birth_delta, birth_delta);
+  particles.birth_time[i] = particles.total_birth[i] - life_elapsed;
+  if (particles.birth_time[i] < 0.f) {
+    life_elapsed = -particles.birth_time[i];
+    particles.birth_time[i] = 0.f;
   } else {
     life_elapsed = 0.f;
   }
   float life_delta = m_particle_lifetime_variation / 2;
-  particle->lifetime = m_particle_lifetime - life_elapsed + graphicsRandom.randf(-life_delta, life_delta);
-  if (particle->lifetime < 0.f) {
-    life_elapsed = -particle->lifetime;
-    particle->lifetime = 0.f;
+  particles.lifetime[i] = m_particle_lifetime - life_elapsed + graphicsRandom.randf(-life_delta, life_delta);
+  if (particles.lifetime[i] < 0.f) {
+    life_elapsed = -particles.lifetime[i];
+    particles.lifetime[i] = 0.f;
   } else {
     life_elapsed = 0.f;
   }
   float death_delta = m_particle_death_time_variation / 2;
-  particle->total_death = m_particle_death_time + graphicsRandom.randf(-death_delta, death_delta);
-  particle->death_time = particle->total_death - life_elapsed;
+  particles.total_death[i] = m_particle_death_time + graphicsRandom.randf(-death_delta, death_delta);
+  particles.death_time[i] = particles.total_death[i] - life_elapsed;
 
-  particle->birth_mode = m_particle_birth_mode;
-  particle->death_mode = m_particle_death_mode;
+  particles.birth_mode[i] = static_cast<uint8_t>(m_particle_birth_mode);
+  particles.death_mode[i] = static_cast<uint8_t>(m_particle_death_mode);
 
-  particle->birth_easing = m_particle_birth_easing;
-  particle->death_easing = m_particle_death_easing;
+  particles.birth_easing[i] = m_particle_birth_easing;
+  particles.death_easing[i] = m_particle_death_easing;
 
-  switch(particle->birth_mode) {
+  switch(m_particle_birth_mode) {
   case FadeMode::Shrink:
-    particle->scale = 0.f;
+    particles.scale[i] = 0.f;
     break;
   default:
     break;
   }
 
   float speedx_delta = m_particle_speed_variation_x / 2;
-  particle->speedX = m_particle_speed_x + graphicsRandom.randf(-speedx_delta, speedx_delta);
+  particles.speed_x[i] = m_particle_speed_x + graphicsRandom.randf(-speedx_delta, speedx_delta);
   float speedy_delta = m_particle_speed_variation_y / 2;
-  particle->speedY = m_particle_speed_y + graphicsRandom.randf(-speedy_delta, speedy_delta);
-  particle->accX = m_particle_acceleration_x;
-  particle->accY = m_particle_acceleration_y;
-  particle->frictionX = m_particle_friction_x;
-  particle->frictionY = m_particle_friction_y;
+  particles.speed_y[i] = m_particle_speed_y + graphicsRandom.randf(-speedy_delta, speedy_delta);
+  particles.acc_x[i] = m_particle_acceleration_x;
+  particles.acc_y[i] = m_particle_acceleration_y;
+  particles.friction_x[i] = m_particle_friction_x;
+  particles.friction_y[i] = m_particle_friction_y;
 
-  particle->feather_factor = m_particle_feather_factor;
+  particles.feather_factor[i] = m_particle_feather_factor;
 
   float angle_delta = m_particle_rotation_variation / 2;
-  particle->angle = m_particle_rotation + graphicsRandom.randf(-angle_delta, angle_delta);
+  particles.angle[i] = m_particle_rotation + graphicsRandom.randf(-angle_delta, angle_delta);
   float angle_speed_delta = m_particle_rotation_speed_variation / 2;
-  particle->angle_speed = m_particle_rotation_speed + graphicsRandom.randf(-angle_speed_delta, angle_speed_delta);
-  particle->angle_acc = m_particle_rotation_acceleration;
-  particle->angle_decc = m_particle_rotation_decceleration;
-  particle->angle_mode = m_particle_rotation_mode;
-
-  particle->collision_mode = m_particle_collision_mode;
+  particles.angle_speed[i] = m_particle_rotation_speed + graphicsRandom.randf(-angle_speed_delta, angle_speed_delta);
+  particles.angle_acc[i] = m_particle_rotation_acceleration;
+  particles.angle_decc[i] = m_particle_rotation_decceleration;
+  particles.rotation_mode[i] = static_cast<uint8_t>(m_particle_rotation_mode);
 
-  particle->offscreen_mode = m_particle_offscreen_mode;
+  particles.collision_mode[i] = static_cast<uint8_t>(m_particle_collision_mode);
 
-  custom_particles.push_back(std::move(particle));
+  particles.offscreen_mode[i] = static_cast<uint8_t>(m_particle_offscreen_mode);
 }
 
 void
-CustomParticleSystem::spawn_particles(float lifetime)
+CustomParticleSystem::spawn_particles(float lifetime, const std::vector<ParticleZone::ZoneDetails>& zones)
 {
   if (!m_cover_screen) {
-    for (auto& zone : get_zones()) {
-      if (zone.get_type() == ParticleZone::ParticleZoneType::Spawn && zone.get_particle_name() == m_name) {
+    for (const auto& zone : zones) {
+      if (zone.get_type() == ParticleZone::ParticleZoneType::Spawn) {
         Rectf rect = zone.get_rect();
         add_particle(lifetime,
                      graphicsRandom.randf(rect.get_width()) + rect.get_left(),
@@ -19,6 +19,7 @@
 
 #include "math/easing.hpp"
 #include "math/vector.hpp"
+#include "object/custom_particle_store.hpp"
 #include "object/particlesystem_interactive.hpp"
 #include "object/particle_zone.hpp"
 #include "scripting/custom_particles.hpp"
@@ -61,10 +62,6 @@ public:
   }
 
   //void fade_amount(int new_amount, float fade_time);
-protected:
-  virtual int collision(Particle* particle, const Vector& movement) override;
-  CollisionHit get_collision(Particle* particle, const Vector& movement);
-
 private:
   struct ease_request
   {
@@ -76,10 +73,21 @@ private:
     easing func;
   };
 
+  class SpriteProperties;
+
   // Local
   void add_particle(float lifetime, float x, float y);
-  void spawn_particles(float lifetime);
+  void spawn_particles(float lifetime, const std::vector<ParticleZone::ZoneDetails>& zones);
+
+  void update_fading(size_t i, float dt_sec);
+  void update_zones(size_t i, const std::vector<ParticleZone::ZoneDetails>& zones, const Rectf& screen);
+  void update_collision(size_t i, float dt_sec);
+  void update_rotation(size_t i, float dt_sec);
+
+  int get_collision_type(const SpriteProperties& props, const Vector& pos, const Vector& movement) const;
+  CollisionHit get_collision(const SpriteProperties& props, const Vector& pos, const Vector& movement) const;
 
+  /** Returns the zones that affect this particle system */
   std::vector<ParticleZone::ZoneDetails> get_zones();
 
   float get_abs_x();
@@ -179,66 +187,13 @@ private:
     }
   };
 
-  SpriteProperties get_random_texture();
+  /** Returns an index into m_textures, weighted by likeliness */
+  size_t get_random_texture();
 
-  class CustomParticle : public Particle
-  {
-  public:
-    SpriteProperties original_props, props;
-    float lifetime, birth_time, death_time,
-          total_birth, total_death;
-    FadeMode birth_mode, death_mode;
-    EasingMode birth_easing, death_easing;
-    bool ready_for_deletion;
-    float speedX, speedY,
-          accX, accY,
-          frictionX, frictionY;
-    float feather_factor;
-    float angle_speed, angle_acc,
-          angle_decc;
-    RotationMode angle_mode;
-    CollisionMode collision_mode;
-    OffscreenMode offscreen_mode;
-    bool has_been_on_screen;
-    bool has_been_in_life_zone;
-    bool last_life_zone_required_instakill;
-    bool stuck;
-
-    CustomParticle() :
-      original_props(),
-      props(),
-      lifetime(),
-      birth_time(),
-      death_time(),
-      total_birth(),
-      total_death(),
-      birth_mode(),
-      death_mode(),
-      birth_easing(),
-      death_easing(),
-      ready_for_deletion(false),
-      speedX(),
-      speedY(),
-      accX(),
-      accY(),
-      frictionX(),
-      frictionY(),
-      feather_factor(),
-      angle_speed(),
-      angle_acc(),
-      angle_decc(),
-      angle_mode(),
-      collision_mode(),
-      offscreen_mode(),
-      has_been_on_screen(),
-      has_been_in_life_zone(false),
-      last_life_zone_required_instakill(false),
-      stuck(false)
-    {}
-  };
+  const SpriteProperties& get_particle_props(size_t i) const { return m_textures[custom_particles.texture[i]]; }
 
   std::vector<SpriteProperties> m_textures;
-  std::vector<std::unique_ptr<CustomParticle> > custom_particles;
+  CustomParticleStore custom_particles;
 
   std::string m_particle_main_texture;
   int m_max_amount;
@@ -82,8 +82,8 @@ ParticleSystem_Interactive::draw(DrawingContext& context)
     auto& surface = it.first;
     auto& batch = it.second;
     // FIXME: What is the colour used for?
-    context.color().draw_surface_batch(surface, batch.move_srcrects(),
-      batch.move_dstrects(), batch.move_angles(), Color::WHITE, z_pos);
+    context.color().draw_surface_batch(surface, batch.get_srcrects(),
+      batch.get_dstrects(), batch.get_angles(), Color::WHITE, z_pos);
   }
 
   context.pop_transform();
@@ -59,14 +59,16 @@ walk_mode_to_string(WalkMode walk_mode)
 Path::Path() :
   m_nodes(),
   m_mode(WalkMode::CIRCULAR),
-  m_adapt_speed()
+  m_adapt_speed(),
+  m_length_tables()
 {
 }
 
 Path::Path(const Vector& pos) :
   m_nodes(),
   m_mode(),
-  m_adapt_speed()
+  m_adapt_speed(),
+  m_length_tables()
 {
   Node first_node;
   first_node.position = pos;
@@ -234,6 +236,36 @@ Path::edit_path()
   }
 }
 
+Vector
+Path::get_point_by_length(size_t node, const Vector& p1, const Vector& p2,
+                          const Vector& p3, const Vector& p4, float t) const
+{
+  if (node >= m_nodes.size())
+    return Bezier::get_point_by_length(p1, p2, p3, p4, t);
+
+  const Node& current = m_nodes[node];
+  const Node& next = m_nodes[(node + 1) % m_nodes.size()];
+
+  bool reverse;
+  if (p1 == current.position && p2 == current.bezier_after &&
+      p3 == next.bezier_before && p4 == next.position)
+    reverse = false;
+  else if (p4 == current.position && p3 == current.bezier_after &&
+           p2 == next.bezier_before && p1 == next.position)
+    reverse = true;
+  else
+    return Bezier::get_point_by_length(p1, p2, p3, p4, t);
+
+  if (m_length_tables.size() != m_nodes.size())
+    m_length_tables.resize(m_nodes.size());
+
+  BezierLengthTable& table = m_length_tables[node];
+  if (!table.matches(current.position, current.bezier_after, next.bezier_before, next.position))
+    table.build(current.position, current.bezier_after, next.bezier_before, next.position);
+
+  return table.get_point_by_length(reverse ? 1.0f - t : t);
+}
+
 bool
 Path::is_valid() const
 {
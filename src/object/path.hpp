@@ -23,6 +23,7 @@
 #include <string>
 #include <vector>
 
+#include "math/bezier.hpp"
 #include "math/vector.hpp"
 #include "math/easing.hpp"
 #include "util/gettext.hpp"
@@ -96,6 +97,13 @@ public:
 
   const std::vector<Node>& get_nodes() const { return m_nodes; }
 
+  /** Same as Bezier::get_point_by_length(), but looks the point up in
+      a cached length table when the curve is the one from node
+      \a node to the following node, walked in either direction. The
+      table is rebuilt when the nodes have been edited. */
+  Vector get_point_by_length(size_t node, const Vector& p1, const Vector& p2,
+                             const Vector& p3, const Vector& p4, float t) const;
+
 public:
   std::vector<Node> m_nodes;
 
@@ -107,6 +115,10 @@ public:
 
   void on_flip(float height);
 
+private:
+  /** Length tables of the curves from each node to the next one */
+  mutable std::vector<BezierLengthTable> m_length_tables;
+
 private:
   Path(const Path&) = delete;
   Path& operator=(const Path&) = delete;
@@ -127,9 +127,11 @@ PathWalker::get_pos(const Sizef& object_size, const Handle& handle) const
          p3 = m_walking_speed > 0 ? next_node->bezier_before : next_node->bezier_after,
          p4 = next_node->position;
 
+  // walking backwards runs the curve that starts at the next node
   Vector position = path->m_adapt_speed ?
                           Bezier::get_point(p1, p2, p3, p4, progress) :
-                          Bezier::get_point_by_length(p1, p2, p3, p4, progress);
+                          path->get_point_by_length(m_walking_speed > 0 ? m_current_node_nr : m_next_node_nr,
+                                                    p1, p2, p3, p4, progress);
 
   return handle.get_pos(object_size, position);
 }
@@ -737,10 +737,10 @@ Player::update(float dt_sec)
     sidebrickbox.set_left(get_bbox().get_left() + (m_dir == Direction::LEFT ? -12.f : 1.f));
     sidebrickbox.set_right(get_bbox().get_right() + (m_dir == Direction::RIGHT ? 12.f : -1.f));
 
-    for (auto& brick : Sector::get().get_objects_by_type<Brick>()) {
-      if (sidebrickbox.contains(brick.get_bbox()) && (m_stone || (m_sliding && brick.get_class_name() != "heavy-brick")) &&
+    for (auto* brick : Sector::get().query_rect<Brick>(sidebrickbox)) {
+      if ((m_stone || (m_sliding && brick->get_class_name() != "heavy-brick")) &&
         std::abs(m_physic.get_velocity_x()) >= 150.f) {
-        brick.try_break(this, is_big());
+        brick->try_break(this, is_big());
       }
     }
   }
@@ -749,14 +749,14 @@ Player::update(float dt_sec)
   {
     Rectf downbox = get_bbox().grown(-1.f);
     downbox.set_bottom(get_bbox().get_bottom() + 16.f);
-    for (auto& brick : Sector::get().get_objects_by_type<Brick>()) {
-      if (downbox.contains(brick.get_bbox()) && brick.get_class_name() != "heavy-brick") {
-        brick.try_break(this, is_big());
+    for (auto* brick : Sector::get().query_rect<Brick>(downbox)) {
+      if (brick->get_class_name() != "heavy-brick") {
+        brick->try_break(this, is_big());
       }
     }
-    for (auto& badguy : Sector::get().get_objects_by_type<BadGuy>()) {
-      if (downbox.contains(badguy.get_bbox()) && badguy.is_snipable()) {
-        badguy.kill_fall();
+    for (auto* badguy : Sector::get().query_rect<BadGuy>(downbox)) {
+      if (badguy->is_snipable()) {
+        badguy->kill_fall();
       }
     }
   }
@@ -1626,22 +1626,22 @@ Player::try_grab()
                    m_col.m_bbox.get_top() + 16.f + (std::sin(m_swimming_angle) * 48.f));
     }
 
-    for (auto& moving_object : Sector::get().get_objects_by_type<MovingObject>())
+    for (auto* moving_object : Sector::get().query_rect(Rectf(pos, Sizef(1.0f, 1.0f))))
     {
-      Portable* portable = dynamic_cast<Portable*>(&moving_object);
+      Portable* portable = dynamic_cast<Portable*>(moving_object);
       if (portable && portable->is_portable())
       {
         // make sure the Portable isn't currently non-solid
-        if (moving_object.get_group() == COLGROUP_DISABLED) continue;
+        if (moving_object->get_group() == COLGROUP_DISABLED) continue;
 
         // check if we are within reach
-        if (moving_object.get_bbox().contains(pos))
+        if (moving_object->get_bbox().contains(pos))
         {
           if (m_climbing)
             stop_climbing(*m_climbing);
           m_grabbed_object = portable;
 
-          moving_object.add_remove_listener(m_grabbed_object_remove_listener.get());
+          moving_object->add_remove_listener(m_grabbed_object_remove_listener.get());
 
           position_grabbed_object();
           return true;
@@ -16,6 +16,7 @@
 
 #include "object/tilemap.hpp"
 
+#include <map>
 #include <tuple>
 
 #include "editor/editor.hpp"
@@ -36,12 +37,14 @@
 #include "video/surface.hpp"
 #include "worldmap/worldmap.hpp"
 
-TileMap::TileMap(const TileSet *new_tileset) :
+TileMap::TileMap(TileSet *new_tileset) :
   ExposedObject<TileMap, scripting::TileMap>(this),
   PathObject(),
   m_editor_active(true),
   m_tileset(new_tileset),
   m_tiles(),
+  m_collision_flags(),
+  m_changed_tiles(),
   m_real_solid(false),
   m_effective_solid(false),
   m_speed_x(1),
@@ -70,13 +73,15 @@ TileMap::TileMap(const TileSet *new_tileset) :
 {
 }
 
-TileMap::TileMap(const TileSet *tileset_, const ReaderMapping& reader) :
+TileMap::TileMap(TileSet *tileset_, const ReaderMapping& reader) :
   GameObject(reader),
   ExposedObject<TileMap, scripting::TileMap>(this),
   PathObject(),
   m_editor_active(true),
   m_tileset(tileset_),
   m_tiles(),
+  m_collision_flags(),
+  m_changed_tiles(),
   m_real_solid(false),
   m_effective_solid(false),
   m_speed_x(1),
@@ -175,19 +180,18 @@ TileMap::TileMap(const TileSet *tileset_, const ReaderMapping& reader) :
 
   bool empty = true;
 
-  // make sure all tiles used on the tilemap are loaded and tilemap isn't empty
   for (const auto& tile : m_tiles) {
     if (tile != 0) {
       empty = false;
     }
-
-    m_tileset->get(tile);
   }
 
   if (empty)
   {
     log_info << "Tilemap '" << get_name() << "', z-pos '" << m_z_pos << "' is empty." << std::endl;
   }
+
+  tiles_changed();
 }
 
 void
@@ -448,9 +452,13 @@ TileMap::draw(DrawingContext& context)
   Vector pos(0.0f, 0.0f);
   int tx, ty;
 
-  std::unordered_map<SurfacePtr,
-                     std::tuple<std::vector<Rectf>,
-                                std::vector<Rectf>>> batches;
+  // Tiles cut from the same image share its texture, so they are
+  // batched by texture rather than by surface
+  using BatchKey = std::tuple<const Texture*, const Texture*, Flip>;
+  std::map<BatchKey,
+           std::tuple<SurfacePtr,
+                      std::vector<Rectf>,
+                      std::vector<Rectf>>> batches;
 
   for (pos.x = start.x, tx = t_draw_rect.left; tx < t_draw_rect.right; pos.x += 32, ++tx) {
     for (pos.y = start.y, ty = t_draw_rect.top; ty < t_draw_rect.bottom; pos.y += 32, ++ty) {
@@ -459,7 +467,9 @@ TileMap::draw(DrawingContext& context)
       assert (index < (m_width * m_height));
 
       if (m_tiles[index] == 0) continue;
-      const Tile& tile = m_tileset->get(m_tiles[index]);
+      // Images are loaded when a tile first comes into view, the level
+      // parser has them decoded in the background beforehand
+      const Tile& tile = m_tileset->resolve(m_tiles[index]);
 
       if (g_debug.show_collision_rects) {
         tile.draw_debug(context.color(), pos, LAYER_FOREGROUND1);
@@ -467,10 +477,16 @@ TileMap::draw(DrawingContext& context)
 
       const SurfacePtr& surface = Editor::is_active() ? tile.get_current_editor_surface() : tile.get_current_surface();
       if (surface) {
-        std::get<0>(batches[surface]).emplace_back(surface->get_region());
-        std::get<1>(batches[surface]).emplace_back(pos,
-                                                   Sizef(static_cast<float>(surface->get_width()),
-                                                         static_cast<float>(surface->get_height())));
+        auto& batch = batches[BatchKey(surface->get_texture().get(),
+                                       surface->get_displacement_texture().get(),
+                                       surface->get_flip())];
+        if (!std::get<0>(batch)) {
+          std::get<0>(batch) = surface;
+        }
+        std::get<1>(batch).emplace_back(surface->get_texture_rect());
+        std::get<2>(batch).emplace_back(pos,
+                                        Sizef(static_cast<float>(surface->get_width()),
+                                              static_cast<float>(surface->get_height())));
       }
     }
   }
@@ -479,13 +495,11 @@ TileMap::draw(DrawingContext& context)
 
   for (auto& it : batches)
   {
-    const SurfacePtr& surface = it.first;
-    if (surface) {
-      canvas.draw_surface_batch(surface,
-                                std::move(std::get<0>(it.second)),
-                                std::move(std::get<1>(it.second)),
-                                m_current_tint, m_z_pos);
-    }
+    const SurfacePtr& surface = std::get<0>(it.second);
+    canvas.draw_surface_batch(surface,
+                              std::get<1>(it.second),
+                              std::get<2>(it.second),
+                              m_current_tint, m_z_pos);
   }
 
   context.pop_transform();
@@ -539,9 +553,7 @@ TileMap::set(int newwidth, int newheight, const std::vector<unsigned int>&newt,
   m_real_solid  = newsolid;
   update_effective_solid ();
 
-  // make sure all tiles are loaded
-  for (const auto& tile : m_tiles)
-    m_tileset->get(tile);
+  tiles_changed();
 }
 
 void
@@ -590,6 +602,8 @@ TileMap::resize(int new_width, int new_height, int fill_id,
     apply_offset_x(fill_id, xoffset);
   if (!offset_finished_y)
     apply_offset_y(fill_id, yoffset);
+
+  tiles_changed();
 }
 
 void TileMap::resize(const Size& newsize, const Size& resize_offset) {
@@ -679,6 +693,7 @@ TileMap::change(int x, int y, uint32_t newtile)
 {
   assert(x >= 0 && x < m_width && y >= 0 && y < m_height);
   m_tiles[y*m_width + x] = newtile;
+  tiles_changed(x, y);
 }
 
 void
@@ -688,6 +703,15 @@ TileMap::change_at(const Vector& pos, uint32_t newtile)
   change(int(xy.x), int(xy.y), newtile);
 }
 
+void
+TileMap::change_span(int x, int y, const std::vector<uint32_t>& tiles)
+{
+  assert(x >= 0 && x + static_cast<int>(tiles.size()) <= m_width && y >= 0 && y < m_height);
+  std::copy(tiles.begin(), tiles.end(), m_tiles.begin() + (y * m_width + x));
+  for (int i = 0; i < static_cast<int>(tiles.size()); ++i)
+    tiles_changed(x + i, y);
+}
+
 void
 TileMap::change_all(uint32_t oldtile, uint32_t newtile)
 {
@@ -747,6 +771,7 @@ TileMap::autotile(int x, int y, uint32_t tile)
     x, y);
 
   m_tiles[y*m_width + x] = realtile;
+  tiles_changed(x, y);
 }
 
 void
@@ -798,6 +823,7 @@ TileMap::autotile_corner(int x, int y, uint32_t tile, AutotileCornerOperation op
     x, y);
 
   m_tiles[y*m_width + x] = realtile;
+  tiles_changed(x, y);
 }
 
 bool
@@ -835,6 +861,7 @@ TileMap::autotile_erase(const Vector& pos, const Vector& corner_pos)
   {
     int x = static_cast<int>(pos.x), y = static_cast<int>(pos.y);
     m_tiles[y*m_width + x] = 0;
+    tiles_changed(x, y);
 
     if (x - 1 >= 0 && y - 1 >= 0 && !is_corner(m_tiles[(y-1)*m_width + x-1])) {
       if (m_tiles[y*m_width + x] == 0)
@@ -952,9 +979,50 @@ TileMap::update_effective_solid()
 }
 
 void
-TileMap::set_tileset(const TileSet* new_tileset)
+TileMap::set_tileset(TileSet* new_tileset)
 {
   m_tileset = new_tileset;
+  tiles_changed();
+}
+
+Rect
+TileMap::take_changed_tiles()
+{
+  Rect rect = m_changed_tiles;
+  m_changed_tiles = Rect();
+  return rect;
+}
+
+void
+TileMap::tiles_changed()
+{
+  m_changed_tiles = Rect(0, 0, m_width, m_height);
+  m_collision_flags.resize(m_tiles.size());
+  for (int x = 0; x < m_width; ++x)
+  {
+    for (int y = 0; y < m_height; ++y)
+    {
+      m_collision_flags[x * m_height + y] = m_tileset->get_collision_flags(m_tiles[y * m_width + x]);
+    }
+  }
+}
+
+void
+TileMap::tiles_changed(int x, int y)
+{
+  if (m_changed_tiles.empty())
+  {
+    m_changed_tiles = Rect(x, y, x + 1, y + 1);
+  }
+  else
+  {
+    m_changed_tiles.left = std::min(m_changed_tiles.left, x);
+    m_changed_tiles.top = std::min(m_changed_tiles.top, y);
+    m_changed_tiles.right = std::max(m_changed_tiles.right, x + 1);
+    m_changed_tiles.bottom = std::max(m_changed_tiles.bottom, y + 1);
+  }
+
+  m_collision_flags[x * m_height + y] = m_tileset->get_collision_flags(m_tiles[y * m_width + x]);
 }
 
 /* EOF */
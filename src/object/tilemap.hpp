@@ -46,8 +46,8 @@ class TileMap final :
   public PathObject
 {
 public:
-  TileMap(const TileSet *tileset);
-  TileMap(const TileSet *tileset, const ReaderMapping& reader);
+  TileMap(TileSet *tileset);
+  TileMap(TileSet *tileset, const ReaderMapping& reader);
   ~TileMap() override;
 
   virtual void finish_construction() override;
@@ -155,10 +155,20 @@ public:
   uint32_t get_tile_id(int x, int y) const;
   uint32_t get_tile_id_at(const Vector& pos) const;
 
+  /** Returns the collision flags (see TileSet::get_collision_flags())
+      of the tiles in column x. They are stored column by column, so
+      the collision sweep, which walks down each column, reads
+      contiguous memory. */
+  const uint16_t* get_collision_column(int x) const
+  { return m_collision_flags.data() + x * m_height; }
+
   void change(int x, int y, uint32_t newtile);
 
   void change_at(const Vector& pos, uint32_t newtile);
 
+  /** Replaces tiles.size() tiles of row y, starting at column x */
+  void change_span(int x, int y, const std::vector<uint32_t>& tiles);
+
   /** changes all tiles with the given ID */
   void change_all(uint32_t oldtile, uint32_t newtile);
 
@@ -207,12 +217,21 @@ public:
       target alpha. */
   float get_alpha() const;
 
-  void set_tileset(const TileSet* new_tileset);
+  void set_tileset(TileSet* new_tileset);
 
   const std::vector<uint32_t>& get_tiles() const { return m_tiles; }
 
+  /** Returns the area of the tiles that changed since the last call
+      and resets it, used by the UndoManager to only look at the
+      edited tiles */
+  Rect take_changed_tiles();
+
 private:
   void update_effective_solid();
+  /** Updates the collision flags of the changed tiles, their images
+      are resolved once they get drawn */
+  void tiles_changed();
+  void tiles_changed(int x, int y);
   void float_channel(float target, float &current, float remaining_time, float dt_sec);
 
   bool is_corner(uint32_t tile);
@@ -224,11 +243,17 @@ public:
   bool m_editor_active;
 
 private:
-  const TileSet* m_tileset;
+  TileSet* m_tileset;
 
   typedef std::vector<uint32_t> Tiles;
   Tiles m_tiles;
 
+  /** Collision flags of m_tiles, column-major */
+  std::vector<uint16_t> m_collision_flags;
+
+  /** Tiles changed since the last take_changed_tiles() */
+  Rect m_changed_tiles;
+
   /* read solid: In *general*, is this a solid layer? effective solid:
      is the layer *currently* solid? A generally solid layer may be
      not solid when its alpha is low. See `is_solid' above. */
@@ -17,6 +17,8 @@
 #ifndef HEADER_SUPERTUX_SCRIPTING_ANCHOR_POINTS_HPP
 #define HEADER_SUPERTUX_SCRIPTING_ANCHOR_POINTS_HPP
 
+#include "math/anchor_point.hpp"
+
 namespace scripting {
 
 #ifdef DOXYGEN_SCRIPTING
@@ -28,16 +30,15 @@ class AnchorPoints
 public:
 #endif
 
-// TODO get these from the definitions in anchor.h (needs miniswig update)
-static const int ANCHOR_TOP_LEFT     = 0; /**< Top-left anchor point. */
-static const int ANCHOR_TOP          = 1; /**< Top anchor point. */
-static const int ANCHOR_TOP_RIGHT    = 2; /**< Top-right anchor point. */
-static const int ANCHOR_LEFT         = 3; /**< Left anchor point. */
-static const int ANCHOR_MIDDLE       = 4; /**< Middle anchor point. */
-static const int ANCHOR_RIGHT        = 5; /**< Right anchor point. */
-static const int ANCHOR_BOTTOM_LEFT  = 6; /**< Bottom-left anchor point. */
-static const int ANCHOR_BOTTOM       = 7; /**< Bottom anchor point. */
-static const int ANCHOR_BOTTOM_RIGHT = 8; /**< Bottom-right anchor point. */
+static const int ANCHOR_TOP_LEFT     = ::ANCHOR_TOP_LEFT; /**< Top-left anchor point. */
+static const int ANCHOR_TOP          = ::ANCHOR_TOP; /**< Top anchor point. */
+static const int ANCHOR_TOP_RIGHT    = ::ANCHOR_TOP_RIGHT; /**< Top-right anchor point. */
+static const int ANCHOR_LEFT         = ::ANCHOR_LEFT; /**< Left anchor point. */
+static const int ANCHOR_MIDDLE       = ::ANCHOR_MIDDLE; /**< Middle anchor point. */
+static const int ANCHOR_RIGHT        = ::ANCHOR_RIGHT; /**< Right anchor point. */
+static const int ANCHOR_BOTTOM_LEFT  = ::ANCHOR_BOTTOM_LEFT; /**< Bottom-left anchor point. */
+static const int ANCHOR_BOTTOM       = ::ANCHOR_BOTTOM; /**< Bottom anchor point. */
+static const int ANCHOR_BOTTOM_RIGHT = ::ANCHOR_BOTTOM_RIGHT; /**< Bottom-right anchor point. */
 
 #ifdef DOXYGEN_SCRIPTING
 }
@@ -20,9 +20,6 @@
 #ifndef SCRIPTING_API
 #include <squirrel.h>
 #include <string>
-
-#define __suspend
-#define __custom(x)
 #endif
 
 namespace scripting {
@@ -40,7 +37,7 @@ public:
  * Displays the value of an argument. This is useful for inspecting tables.
  * @param ANY $object
  */
-SQInteger display(HSQUIRRELVM vm) __custom("t.");
+SQInteger display(HSQUIRRELVM vm);
 
 /**
  * Displays the contents of the current stack.
@@ -50,7 +47,7 @@ void print_stacktrace(HSQUIRRELVM vm);
 /**
  * Returns the currently running thread.
  */
-SQInteger get_current_thread(HSQUIRRELVM vm) __custom("t");
+SQInteger get_current_thread(HSQUIRRELVM vm);
 
 /**
  * Returns whether the game is in christmas mode.
@@ -99,12 +96,12 @@ bool check_cutscene();
  * Suspends the script execution for a specified number of seconds.
  * @param float $seconds
  */
-void wait(HSQUIRRELVM vm, float seconds) __suspend;
+void wait(HSQUIRRELVM vm, float seconds);
 
 /**
  * Suspends the script execution until the current screen has been changed.
  */
-void wait_for_screenswitch(HSQUIRRELVM vm) __suspend;
+void wait_for_screenswitch(HSQUIRRELVM vm);
 
 /**
  * Exits the currently running screen (for example, force exits from worldmap or scrolling text).
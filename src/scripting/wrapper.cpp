@@ -1,16114 +1,685 @@
-/**
- * WARNING: This file is automatically generated from:
- *  'src/scripting/wrapper.interface.hpp'
- * DO NOT CHANGE
- */
+//  SuperTux
+//  Copyright (C) 2024 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 #include "scripting/wrapper.hpp"
 
-#include <assert.h>
-#include <limits>
-#include <sstream>
-#include <squirrel.h>
-
 #include "scripting/wrapper.interface.hpp"
-
-#include "squirrel/squirrel_error.hpp"
+#include "squirrel/squirrel_binding.hpp"
 
 namespace scripting {
-namespace wrapper {
-
-static SQInteger AmbientSound_release_hook(SQUserPointer ptr, SQInteger )
-{
-  scripting::AmbientSound* _this = reinterpret_cast<scripting::AmbientSound*> (ptr);
-  delete _this;
-  return 0;
-}
-
-static SQInteger AmbientSound_set_pos_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_pos' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::AmbientSound* _this = reinterpret_cast<scripting::AmbientSound*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_pos(arg0, arg1);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_pos'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger AmbientSound_get_pos_x_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_pos_x' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::AmbientSound* _this = reinterpret_cast<scripting::AmbientSound*> (data);
-
-
-  try {
-    float return_value = _this->get_pos_x();
-
-    sq_pushfloat(vm, return_value);
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_pos_x'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger AmbientSound_get_pos_y_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_pos_y' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::AmbientSound* _this = reinterpret_cast<scripting::AmbientSound*> (data);
-
-
-  try {
-    float return_value = _this->get_pos_y();
-
-    sq_pushfloat(vm, return_value);
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_pos_y'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Background_release_hook(SQUserPointer ptr, SQInteger )
-{
-  scripting::Background* _this = reinterpret_cast<scripting::Background*> (ptr);
-  delete _this;
-  return 0;
-}
-
-static SQInteger Background_set_image_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_image' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Background* _this = reinterpret_cast<scripting::Background*> (data);
-
-  const SQChar* arg0;
-  if(SQ_FAILED(sq_getstring(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a string"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_image(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_image'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Background_set_images_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_images' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Background* _this = reinterpret_cast<scripting::Background*> (data);
-
-  const SQChar* arg0;
-  if(SQ_FAILED(sq_getstring(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a string"));
-    return SQ_ERROR;
-  }
-  const SQChar* arg1;
-  if(SQ_FAILED(sq_getstring(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a string"));
-    return SQ_ERROR;
-  }
-  const SQChar* arg2;
-  if(SQ_FAILED(sq_getstring(vm, 4, &arg2))) {
-    sq_throwerror(vm, _SC("Argument 3 not a string"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_images(arg0, arg1, arg2);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_images'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Background_set_speed_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_speed' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Background* _this = reinterpret_cast<scripting::Background*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_speed(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_speed'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Background_get_color_red_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_color_red' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Background* _this = reinterpret_cast<scripting::Background*> (data);
-
-
-  try {
-    float return_value = _this->get_color_red();
-
-    sq_pushfloat(vm, return_value);
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_color_red'"));
-    return SQ_ERROR;
-  }
-
-}
 
-static SQInteger Background_get_color_green_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_color_green' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Background* _this = reinterpret_cast<scripting::Background*> (data);
-
-
-  try {
-    float return_value = _this->get_color_green();
-
-    sq_pushfloat(vm, return_value);
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_color_green'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Background_get_color_blue_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_color_blue' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Background* _this = reinterpret_cast<scripting::Background*> (data);
-
-
-  try {
-    float return_value = _this->get_color_blue();
-
-    sq_pushfloat(vm, return_value);
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_color_blue'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Background_get_color_alpha_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_color_alpha' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Background* _this = reinterpret_cast<scripting::Background*> (data);
-
-
-  try {
-    float return_value = _this->get_color_alpha();
-
-    sq_pushfloat(vm, return_value);
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_color_alpha'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Background_set_color_wrapper(HSQUIRRELVM vm)
+void create_squirrel_instance(HSQUIRRELVM v, scripting::AmbientSound* object, bool setup_releasehook)
 {
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_color' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Background* _this = reinterpret_cast<scripting::Background*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg2;
-  if(SQ_FAILED(sq_getfloat(vm, 4, &arg2))) {
-    sq_throwerror(vm, _SC("Argument 3 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg3;
-  if(SQ_FAILED(sq_getfloat(vm, 5, &arg3))) {
-    sq_throwerror(vm, _SC("Argument 4 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_color(arg0, arg1, arg2, arg3);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_color'"));
-    return SQ_ERROR;
-  }
-
+  squirrel::create_instance(v, object, "AmbientSound", setup_releasehook);
 }
 
-static SQInteger Background_fade_color_wrapper(HSQUIRRELVM vm)
+void create_squirrel_instance(HSQUIRRELVM v, scripting::Background* object, bool setup_releasehook)
 {
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'fade_color' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Background* _this = reinterpret_cast<scripting::Background*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg2;
-  if(SQ_FAILED(sq_getfloat(vm, 4, &arg2))) {
-    sq_throwerror(vm, _SC("Argument 3 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg3;
-  if(SQ_FAILED(sq_getfloat(vm, 5, &arg3))) {
-    sq_throwerror(vm, _SC("Argument 4 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg4;
-  if(SQ_FAILED(sq_getfloat(vm, 6, &arg4))) {
-    sq_throwerror(vm, _SC("Argument 5 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->fade_color(arg0, arg1, arg2, arg3, arg4);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'fade_color'"));
-    return SQ_ERROR;
-  }
-
+  squirrel::create_instance(v, object, "Background", setup_releasehook);
 }
 
-static SQInteger BadGuy_release_hook(SQUserPointer ptr, SQInteger )
+void create_squirrel_instance(HSQUIRRELVM v, scripting::BadGuy* object, bool setup_releasehook)
 {
-  scripting::BadGuy* _this = reinterpret_cast<scripting::BadGuy*> (ptr);
-  delete _this;
-  return 0;
+  squirrel::create_instance(v, object, "BadGuy", setup_releasehook);
 }
 
-static SQInteger BadGuy_kill_wrapper(HSQUIRRELVM vm)
+void create_squirrel_instance(HSQUIRRELVM v, scripting::Camera* object, bool setup_releasehook)
 {
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'kill' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::BadGuy* _this = reinterpret_cast<scripting::BadGuy*> (data);
-
-
-  try {
-    _this->kill();
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'kill'"));
-    return SQ_ERROR;
-  }
-
+  squirrel::create_instance(v, object, "Camera", setup_releasehook);
 }
 
-static SQInteger BadGuy_ignite_wrapper(HSQUIRRELVM vm)
+void create_squirrel_instance(HSQUIRRELVM v, scripting::Candle* object, bool setup_releasehook)
 {
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'ignite' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::BadGuy* _this = reinterpret_cast<scripting::BadGuy*> (data);
-
-
-  try {
-    _this->ignite();
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'ignite'"));
-    return SQ_ERROR;
-  }
-
+  squirrel::create_instance(v, object, "Candle", setup_releasehook);
 }
 
-static SQInteger BadGuy_set_action_wrapper(HSQUIRRELVM vm)
+void create_squirrel_instance(HSQUIRRELVM v, scripting::Clouds* object, bool setup_releasehook)
 {
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_action' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::BadGuy* _this = reinterpret_cast<scripting::BadGuy*> (data);
-
-  const SQChar* arg0;
-  if(SQ_FAILED(sq_getstring(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a string"));
-    return SQ_ERROR;
-  }
-  SQInteger arg1;
-  if(SQ_FAILED(sq_getinteger(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not an integer"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_action(arg0, static_cast<int> (arg1));
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_action'"));
-    return SQ_ERROR;
-  }
-
+  squirrel::create_instance(v, object, "Clouds", setup_releasehook);
 }
 
-static SQInteger BadGuy_set_sprite_wrapper(HSQUIRRELVM vm)
+void create_squirrel_instance(HSQUIRRELVM v, scripting::CustomParticles* object, bool setup_releasehook)
 {
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_sprite' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::BadGuy* _this = reinterpret_cast<scripting::BadGuy*> (data);
-
-  const SQChar* arg0;
-  if(SQ_FAILED(sq_getstring(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a string"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_sprite(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_sprite'"));
-    return SQ_ERROR;
-  }
-
+  squirrel::create_instance(v, object, "CustomParticles", setup_releasehook);
 }
 
-static SQInteger Camera_release_hook(SQUserPointer ptr, SQInteger )
+void create_squirrel_instance(HSQUIRRELVM v, scripting::Decal* object, bool setup_releasehook)
 {
-  scripting::Camera* _this = reinterpret_cast<scripting::Camera*> (ptr);
-  delete _this;
-  return 0;
+  squirrel::create_instance(v, object, "Decal", setup_releasehook);
 }
 
-static SQInteger Camera_reload_config_wrapper(HSQUIRRELVM vm)
+void create_squirrel_instance(HSQUIRRELVM v, scripting::Dispenser* object, bool setup_releasehook)
 {
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'reload_config' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Camera* _this = reinterpret_cast<scripting::Camera*> (data);
-
-
-  try {
-    _this->reload_config();
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'reload_config'"));
-    return SQ_ERROR;
-  }
-
+  squirrel::create_instance(v, object, "Dispenser", setup_releasehook);
 }
 
-static SQInteger Camera_shake_wrapper(HSQUIRRELVM vm)
+void create_squirrel_instance(HSQUIRRELVM v, scripting::DisplayEffect* object, bool setup_releasehook)
 {
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'shake' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Camera* _this = reinterpret_cast<scripting::Camera*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg2;
-  if(SQ_FAILED(sq_getfloat(vm, 4, &arg2))) {
-    sq_throwerror(vm, _SC("Argument 3 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->shake(arg0, arg1, arg2);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'shake'"));
-    return SQ_ERROR;
-  }
-
+  squirrel::create_instance(v, object, "DisplayEffect", setup_releasehook);
 }
 
-static SQInteger Camera_set_pos_wrapper(HSQUIRRELVM vm)
+void create_squirrel_instance(HSQUIRRELVM v, scripting::FloatingImage* object, bool setup_releasehook)
 {
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_pos' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Camera* _this = reinterpret_cast<scripting::Camera*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_pos(arg0, arg1);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_pos'"));
-    return SQ_ERROR;
-  }
-
+  squirrel::create_instance(v, object, "FloatingImage", setup_releasehook);
 }
 
-static SQInteger Camera_move_wrapper(HSQUIRRELVM vm)
+void create_squirrel_instance(HSQUIRRELVM v, scripting::GameObjectManager* object, bool setup_releasehook)
 {
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'move' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Camera* _this = reinterpret_cast<scripting::Camera*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->move(arg0, arg1);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'move'"));
-    return SQ_ERROR;
-  }
-
+  squirrel::create_instance(v, object, "GameObjectManager", setup_releasehook);
 }
 
-static SQInteger Camera_set_mode_wrapper(HSQUIRRELVM vm)
+void create_squirrel_instance(HSQUIRRELVM v, scripting::Gradient* object, bool setup_releasehook)
 {
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_mode' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Camera* _this = reinterpret_cast<scripting::Camera*> (data);
-
-  const SQChar* arg0;
-  if(SQ_FAILED(sq_getstring(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a string"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_mode(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_mode'"));
-    return SQ_ERROR;
-  }
-
+  squirrel::create_instance(v, object, "Gradient", setup_releasehook);
 }
 
-static SQInteger Camera_scroll_to_wrapper(HSQUIRRELVM vm)
+void create_squirrel_instance(HSQUIRRELVM v, scripting::LevelTime* object, bool setup_releasehook)
 {
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'scroll_to' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Camera* _this = reinterpret_cast<scripting::Camera*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg2;
-  if(SQ_FAILED(sq_getfloat(vm, 4, &arg2))) {
-    sq_throwerror(vm, _SC("Argument 3 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->scroll_to(arg0, arg1, arg2);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'scroll_to'"));
-    return SQ_ERROR;
-  }
-
+  squirrel::create_instance(v, object, "LevelTime", setup_releasehook);
 }
 
-static SQInteger Camera_get_current_scale_wrapper(HSQUIRRELVM vm)
+void create_squirrel_instance(HSQUIRRELVM v, scripting::LitObject* object, bool setup_releasehook)
 {
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_current_scale' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Camera* _this = reinterpret_cast<scripting::Camera*> (data);
-
-
-  try {
-    float return_value = _this->get_current_scale();
-
-    sq_pushfloat(vm, return_value);
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_current_scale'"));
-    return SQ_ERROR;
-  }
-
+  squirrel::create_instance(v, object, "LitObject", setup_releasehook);
 }
 
-static SQInteger Camera_get_target_scale_wrapper(HSQUIRRELVM vm)
+void create_squirrel_instance(HSQUIRRELVM v, scripting::ParticleSystem* object, bool setup_releasehook)
 {
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_target_scale' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Camera* _this = reinterpret_cast<scripting::Camera*> (data);
-
-
-  try {
-    float return_value = _this->get_target_scale();
-
-    sq_pushfloat(vm, return_value);
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_target_scale'"));
-    return SQ_ERROR;
-  }
-
+  squirrel::create_instance(v, object, "ParticleSystem", setup_releasehook);
 }
 
-static SQInteger Camera_set_scale_wrapper(HSQUIRRELVM vm)
+void create_squirrel_instance(HSQUIRRELVM v, scripting::Platform* object, bool setup_releasehook)
 {
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_scale' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Camera* _this = reinterpret_cast<scripting::Camera*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_scale(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_scale'"));
-    return SQ_ERROR;
-  }
-
+  squirrel::create_instance(v, object, "Platform", setup_releasehook);
 }
 
-static SQInteger Camera_scale_wrapper(HSQUIRRELVM vm)
+void create_squirrel_instance(HSQUIRRELVM v, scripting::Player* object, bool setup_releasehook)
 {
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'scale' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Camera* _this = reinterpret_cast<scripting::Camera*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->scale(arg0, arg1);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'scale'"));
-    return SQ_ERROR;
-  }
-
+  squirrel::create_instance(v, object, "Player", setup_releasehook);
 }
 
-static SQInteger Camera_ease_scale_wrapper(HSQUIRRELVM vm)
+void create_squirrel_instance(HSQUIRRELVM v, scripting::Rain* object, bool setup_releasehook)
 {
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'ease_scale' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Camera* _this = reinterpret_cast<scripting::Camera*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-  const SQChar* arg2;
-  if(SQ_FAILED(sq_getstring(vm, 4, &arg2))) {
-    sq_throwerror(vm, _SC("Argument 3 not a string"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->ease_scale(arg0, arg1, arg2);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'ease_scale'"));
-    return SQ_ERROR;
-  }
-
+  squirrel::create_instance(v, object, "Rain", setup_releasehook);
 }
 
-static SQInteger Camera_get_screen_width_wrapper(HSQUIRRELVM vm)
+void create_squirrel_instance(HSQUIRRELVM v, scripting::Rock* object, bool setup_releasehook)
 {
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_screen_width' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Camera* _this = reinterpret_cast<scripting::Camera*> (data);
-
-
-  try {
-    int return_value = _this->get_screen_width();
-
-    sq_pushinteger(vm, return_value);
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_screen_width'"));
-    return SQ_ERROR;
-  }
-
+  squirrel::create_instance(v, object, "Rock", setup_releasehook);
 }
 
-static SQInteger Camera_get_screen_height_wrapper(HSQUIRRELVM vm)
+void create_squirrel_instance(HSQUIRRELVM v, scripting::ScriptedObject* object, bool setup_releasehook)
 {
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_screen_height' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Camera* _this = reinterpret_cast<scripting::Camera*> (data);
-
-
-  try {
-    int return_value = _this->get_screen_height();
-
-    sq_pushinteger(vm, return_value);
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_screen_height'"));
-    return SQ_ERROR;
-  }
-
+  squirrel::create_instance(v, object, "ScriptedObject", setup_releasehook);
 }
 
-static SQInteger Camera_get_x_wrapper(HSQUIRRELVM vm)
+void create_squirrel_instance(HSQUIRRELVM v, scripting::Sector* object, bool setup_releasehook)
 {
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_x' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Camera* _this = reinterpret_cast<scripting::Camera*> (data);
-
-
-  try {
-    float return_value = _this->get_x();
-
-    sq_pushfloat(vm, return_value);
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_x'"));
-    return SQ_ERROR;
-  }
-
+  squirrel::create_instance(v, object, "Sector", setup_releasehook);
 }
 
-static SQInteger Camera_get_y_wrapper(HSQUIRRELVM vm)
+void create_squirrel_instance(HSQUIRRELVM v, scripting::Spotlight* object, bool setup_releasehook)
 {
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_y' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Camera* _this = reinterpret_cast<scripting::Camera*> (data);
-
-
-  try {
-    float return_value = _this->get_y();
-
-    sq_pushfloat(vm, return_value);
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_y'"));
-    return SQ_ERROR;
-  }
-
+  squirrel::create_instance(v, object, "Spotlight", setup_releasehook);
 }
 
-static SQInteger Candle_release_hook(SQUserPointer ptr, SQInteger )
+void create_squirrel_instance(HSQUIRRELVM v, scripting::Text* object, bool setup_releasehook)
 {
-  scripting::Candle* _this = reinterpret_cast<scripting::Candle*> (ptr);
-  delete _this;
-  return 0;
+  squirrel::create_instance(v, object, "Text", setup_releasehook);
 }
 
-static SQInteger Candle_get_burning_wrapper(HSQUIRRELVM vm)
+void create_squirrel_instance(HSQUIRRELVM v, scripting::TextArray* object, bool setup_releasehook)
 {
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_burning' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Candle* _this = reinterpret_cast<scripting::Candle*> (data);
-
-
-  try {
-    bool return_value = _this->get_burning();
-
-    sq_pushbool(vm, return_value);
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_burning'"));
-    return SQ_ERROR;
-  }
-
+  squirrel::create_instance(v, object, "TextArray", setup_releasehook);
 }
 
-static SQInteger Candle_set_burning_wrapper(HSQUIRRELVM vm)
+void create_squirrel_instance(HSQUIRRELVM v, scripting::Thunderstorm* object, bool setup_releasehook)
 {
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_burning' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Candle* _this = reinterpret_cast<scripting::Candle*> (data);
-
-  SQBool arg0;
-  if(SQ_FAILED(sq_getbool(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a bool"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_burning(arg0 == SQTrue);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_burning'"));
-    return SQ_ERROR;
-  }
-
+  squirrel::create_instance(v, object, "Thunderstorm", setup_releasehook);
 }
 
-static SQInteger Clouds_release_hook(SQUserPointer ptr, SQInteger )
+void create_squirrel_instance(HSQUIRRELVM v, scripting::TileMap* object, bool setup_releasehook)
 {
-  scripting::Clouds* _this = reinterpret_cast<scripting::Clouds*> (ptr);
-  delete _this;
-  return 0;
+  squirrel::create_instance(v, object, "TileMap", setup_releasehook);
 }
 
-static SQInteger Clouds_set_enabled_wrapper(HSQUIRRELVM vm)
+void create_squirrel_instance(HSQUIRRELVM v, scripting::Torch* object, bool setup_releasehook)
 {
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_enabled' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Clouds* _this = reinterpret_cast<scripting::Clouds*> (data);
-
-  SQBool arg0;
-  if(SQ_FAILED(sq_getbool(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a bool"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_enabled(arg0 == SQTrue);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_enabled'"));
-    return SQ_ERROR;
-  }
-
+  squirrel::create_instance(v, object, "Torch", setup_releasehook);
 }
 
-static SQInteger Clouds_get_enabled_wrapper(HSQUIRRELVM vm)
+void create_squirrel_instance(HSQUIRRELVM v, scripting::WillOWisp* object, bool setup_releasehook)
 {
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_enabled' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Clouds* _this = reinterpret_cast<scripting::Clouds*> (data);
-
-
-  try {
-    bool return_value = _this->get_enabled();
-
-    sq_pushbool(vm, return_value);
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_enabled'"));
-    return SQ_ERROR;
-  }
-
+  squirrel::create_instance(v, object, "WillOWisp", setup_releasehook);
 }
 
-static SQInteger Clouds_fade_speed_wrapper(HSQUIRRELVM vm)
+void create_squirrel_instance(HSQUIRRELVM v, scripting::Wind* object, bool setup_releasehook)
 {
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'fade_speed' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Clouds* _this = reinterpret_cast<scripting::Clouds*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->fade_speed(arg0, arg1);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'fade_speed'"));
-    return SQ_ERROR;
-  }
-
+  squirrel::create_instance(v, object, "Wind", setup_releasehook);
 }
 
-static SQInteger Clouds_fade_amount_wrapper(HSQUIRRELVM vm)
+void create_squirrel_instance(HSQUIRRELVM v, scripting::WorldMap* object, bool setup_releasehook)
 {
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'fade_amount' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Clouds* _this = reinterpret_cast<scripting::Clouds*> (data);
-
-  SQInteger arg0;
-  if(SQ_FAILED(sq_getinteger(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not an integer"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg2;
-  if(SQ_FAILED(sq_getfloat(vm, 4, &arg2))) {
-    sq_throwerror(vm, _SC("Argument 3 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->fade_amount(static_cast<int> (arg0), arg1, arg2);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'fade_amount'"));
-    return SQ_ERROR;
-  }
-
+  squirrel::create_instance(v, object, "WorldMap", setup_releasehook);
 }
 
-static SQInteger Clouds_set_amount_wrapper(HSQUIRRELVM vm)
+void register_supertux_wrapper(HSQUIRRELVM v)
 {
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_amount' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Clouds* _this = reinterpret_cast<scripting::Clouds*> (data);
-
-  SQInteger arg0;
-  if(SQ_FAILED(sq_getinteger(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not an integer"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_amount(static_cast<int> (arg0), arg1);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_amount'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_release_hook(SQUserPointer ptr, SQInteger )
-{
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (ptr);
-  delete _this;
-  return 0;
-}
-
-static SQInteger CustomParticles_set_enabled_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_enabled' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-  SQBool arg0;
-  if(SQ_FAILED(sq_getbool(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a bool"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_enabled(arg0 == SQTrue);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_enabled'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_get_enabled_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_enabled' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-
-  try {
-    bool return_value = _this->get_enabled();
-
-    sq_pushbool(vm, return_value);
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_enabled'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_clear_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'clear' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-
-  try {
-    _this->clear();
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'clear'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_spawn_particles_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'spawn_particles' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-  SQInteger arg0;
-  if(SQ_FAILED(sq_getinteger(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not an integer"));
-    return SQ_ERROR;
-  }
-  SQBool arg1;
-  if(SQ_FAILED(sq_getbool(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a bool"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->spawn_particles(static_cast<int> (arg0), arg1 == SQTrue);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'spawn_particles'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_get_max_amount_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_max_amount' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-
-  try {
-    int return_value = _this->get_max_amount();
-
-    sq_pushinteger(vm, return_value);
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_max_amount'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_set_max_amount_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_max_amount' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-  SQInteger arg0;
-  if(SQ_FAILED(sq_getinteger(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not an integer"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_max_amount(static_cast<int> (arg0));
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_max_amount'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_get_birth_mode_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_birth_mode' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-
-  try {
-    std::string return_value = _this->get_birth_mode();
-
-    assert(return_value.size() < static_cast<size_t>(std::numeric_limits<SQInteger>::max()));
-    sq_pushstring(vm, return_value.c_str(), static_cast<SQInteger>(return_value.size()));
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_birth_mode'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_set_birth_mode_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_birth_mode' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-  const SQChar* arg0;
-  if(SQ_FAILED(sq_getstring(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a string"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_birth_mode(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_birth_mode'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_get_death_mode_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_death_mode' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-
-  try {
-    std::string return_value = _this->get_death_mode();
-
-    assert(return_value.size() < static_cast<size_t>(std::numeric_limits<SQInteger>::max()));
-    sq_pushstring(vm, return_value.c_str(), static_cast<SQInteger>(return_value.size()));
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_death_mode'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_set_death_mode_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_death_mode' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-  const SQChar* arg0;
-  if(SQ_FAILED(sq_getstring(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a string"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_death_mode(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_death_mode'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_get_rotation_mode_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_rotation_mode' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-
-  try {
-    std::string return_value = _this->get_rotation_mode();
-
-    assert(return_value.size() < static_cast<size_t>(std::numeric_limits<SQInteger>::max()));
-    sq_pushstring(vm, return_value.c_str(), static_cast<SQInteger>(return_value.size()));
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_rotation_mode'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_set_rotation_mode_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_rotation_mode' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-  const SQChar* arg0;
-  if(SQ_FAILED(sq_getstring(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a string"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_rotation_mode(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_rotation_mode'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_get_collision_mode_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_collision_mode' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-
-  try {
-    std::string return_value = _this->get_collision_mode();
-
-    assert(return_value.size() < static_cast<size_t>(std::numeric_limits<SQInteger>::max()));
-    sq_pushstring(vm, return_value.c_str(), static_cast<SQInteger>(return_value.size()));
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_collision_mode'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_set_collision_mode_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_collision_mode' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-  const SQChar* arg0;
-  if(SQ_FAILED(sq_getstring(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a string"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_collision_mode(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_collision_mode'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_get_offscreen_mode_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_offscreen_mode' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-
-  try {
-    std::string return_value = _this->get_offscreen_mode();
-
-    assert(return_value.size() < static_cast<size_t>(std::numeric_limits<SQInteger>::max()));
-    sq_pushstring(vm, return_value.c_str(), static_cast<SQInteger>(return_value.size()));
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_offscreen_mode'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_set_offscreen_mode_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_offscreen_mode' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-  const SQChar* arg0;
-  if(SQ_FAILED(sq_getstring(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a string"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_offscreen_mode(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_offscreen_mode'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_get_cover_screen_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_cover_screen' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-
-  try {
-    bool return_value = _this->get_cover_screen();
-
-    sq_pushbool(vm, return_value);
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_cover_screen'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_set_cover_screen_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_cover_screen' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-  SQBool arg0;
-  if(SQ_FAILED(sq_getbool(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a bool"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_cover_screen(arg0 == SQTrue);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_cover_screen'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_get_delay_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_delay' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-
-  try {
-    float return_value = _this->get_delay();
-
-    sq_pushfloat(vm, return_value);
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_delay'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_set_delay_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_delay' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_delay(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_delay'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_fade_delay_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'fade_delay' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->fade_delay(arg0, arg1);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'fade_delay'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_ease_delay_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'ease_delay' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-  const SQChar* arg2;
-  if(SQ_FAILED(sq_getstring(vm, 4, &arg2))) {
-    sq_throwerror(vm, _SC("Argument 3 not a string"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->ease_delay(arg0, arg1, arg2);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'ease_delay'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_get_lifetime_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_lifetime' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-
-  try {
-    float return_value = _this->get_lifetime();
-
-    sq_pushfloat(vm, return_value);
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_lifetime'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_set_lifetime_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_lifetime' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_lifetime(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_lifetime'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_fade_lifetime_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'fade_lifetime' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->fade_lifetime(arg0, arg1);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'fade_lifetime'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_ease_lifetime_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'ease_lifetime' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-  const SQChar* arg2;
-  if(SQ_FAILED(sq_getstring(vm, 4, &arg2))) {
-    sq_throwerror(vm, _SC("Argument 3 not a string"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->ease_lifetime(arg0, arg1, arg2);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'ease_lifetime'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_get_lifetime_variation_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_lifetime_variation' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-
-  try {
-    float return_value = _this->get_lifetime_variation();
-
-    sq_pushfloat(vm, return_value);
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_lifetime_variation'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_set_lifetime_variation_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_lifetime_variation' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_lifetime_variation(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_lifetime_variation'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_fade_lifetime_variation_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'fade_lifetime_variation' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->fade_lifetime_variation(arg0, arg1);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'fade_lifetime_variation'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_ease_lifetime_variation_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'ease_lifetime_variation' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-  const SQChar* arg2;
-  if(SQ_FAILED(sq_getstring(vm, 4, &arg2))) {
-    sq_throwerror(vm, _SC("Argument 3 not a string"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->ease_lifetime_variation(arg0, arg1, arg2);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'ease_lifetime_variation'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_get_birth_time_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_birth_time' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-
-  try {
-    float return_value = _this->get_birth_time();
-
-    sq_pushfloat(vm, return_value);
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_birth_time'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_set_birth_time_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_birth_time' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_birth_time(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_birth_time'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_fade_birth_time_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'fade_birth_time' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->fade_birth_time(arg0, arg1);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'fade_birth_time'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_ease_birth_time_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'ease_birth_time' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-  const SQChar* arg2;
-  if(SQ_FAILED(sq_getstring(vm, 4, &arg2))) {
-    sq_throwerror(vm, _SC("Argument 3 not a string"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->ease_birth_time(arg0, arg1, arg2);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'ease_birth_time'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_get_birth_time_variation_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_birth_time_variation' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-
-  try {
-    float return_value = _this->get_birth_time_variation();
-
-    sq_pushfloat(vm, return_value);
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_birth_time_variation'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_set_birth_time_variation_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_birth_time_variation' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_birth_time_variation(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_birth_time_variation'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_fade_birth_time_variation_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'fade_birth_time_variation' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->fade_birth_time_variation(arg0, arg1);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'fade_birth_time_variation'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_ease_birth_time_variation_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'ease_birth_time_variation' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-  const SQChar* arg2;
-  if(SQ_FAILED(sq_getstring(vm, 4, &arg2))) {
-    sq_throwerror(vm, _SC("Argument 3 not a string"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->ease_birth_time_variation(arg0, arg1, arg2);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'ease_birth_time_variation'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_get_death_time_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_death_time' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-
-  try {
-    float return_value = _this->get_death_time();
-
-    sq_pushfloat(vm, return_value);
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_death_time'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_set_death_time_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_death_time' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_death_time(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_death_time'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_fade_death_time_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'fade_death_time' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->fade_death_time(arg0, arg1);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'fade_death_time'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_ease_death_time_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'ease_death_time' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-  const SQChar* arg2;
-  if(SQ_FAILED(sq_getstring(vm, 4, &arg2))) {
-    sq_throwerror(vm, _SC("Argument 3 not a string"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->ease_death_time(arg0, arg1, arg2);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'ease_death_time'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_get_death_time_variation_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_death_time_variation' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-
-  try {
-    float return_value = _this->get_death_time_variation();
-
-    sq_pushfloat(vm, return_value);
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_death_time_variation'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_set_death_time_variation_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_death_time_variation' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_death_time_variation(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_death_time_variation'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_fade_death_time_variation_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'fade_death_time_variation' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->fade_death_time_variation(arg0, arg1);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'fade_death_time_variation'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_ease_death_time_variation_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'ease_death_time_variation' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-  const SQChar* arg2;
-  if(SQ_FAILED(sq_getstring(vm, 4, &arg2))) {
-    sq_throwerror(vm, _SC("Argument 3 not a string"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->ease_death_time_variation(arg0, arg1, arg2);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'ease_death_time_variation'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_get_speed_x_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_speed_x' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-
-  try {
-    float return_value = _this->get_speed_x();
-
-    sq_pushfloat(vm, return_value);
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_speed_x'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_set_speed_x_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_speed_x' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_speed_x(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_speed_x'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_fade_speed_x_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'fade_speed_x' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->fade_speed_x(arg0, arg1);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'fade_speed_x'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_ease_speed_x_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'ease_speed_x' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-  const SQChar* arg2;
-  if(SQ_FAILED(sq_getstring(vm, 4, &arg2))) {
-    sq_throwerror(vm, _SC("Argument 3 not a string"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->ease_speed_x(arg0, arg1, arg2);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'ease_speed_x'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_get_speed_y_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_speed_y' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-
-  try {
-    float return_value = _this->get_speed_y();
-
-    sq_pushfloat(vm, return_value);
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_speed_y'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_set_speed_y_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_speed_y' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_speed_y(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_speed_y'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_fade_speed_y_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'fade_speed_y' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->fade_speed_y(arg0, arg1);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'fade_speed_y'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_ease_speed_y_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'ease_speed_y' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-  const SQChar* arg2;
-  if(SQ_FAILED(sq_getstring(vm, 4, &arg2))) {
-    sq_throwerror(vm, _SC("Argument 3 not a string"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->ease_speed_y(arg0, arg1, arg2);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'ease_speed_y'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_get_speed_variation_x_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_speed_variation_x' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-
-  try {
-    float return_value = _this->get_speed_variation_x();
-
-    sq_pushfloat(vm, return_value);
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_speed_variation_x'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_set_speed_variation_x_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_speed_variation_x' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_speed_variation_x(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_speed_variation_x'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_fade_speed_variation_x_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'fade_speed_variation_x' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->fade_speed_variation_x(arg0, arg1);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'fade_speed_variation_x'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_ease_speed_variation_x_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'ease_speed_variation_x' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-  const SQChar* arg2;
-  if(SQ_FAILED(sq_getstring(vm, 4, &arg2))) {
-    sq_throwerror(vm, _SC("Argument 3 not a string"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->ease_speed_variation_x(arg0, arg1, arg2);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'ease_speed_variation_x'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_get_speed_variation_y_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_speed_variation_y' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-
-  try {
-    float return_value = _this->get_speed_variation_y();
-
-    sq_pushfloat(vm, return_value);
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_speed_variation_y'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_set_speed_variation_y_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_speed_variation_y' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_speed_variation_y(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_speed_variation_y'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_fade_speed_variation_y_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'fade_speed_variation_y' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->fade_speed_variation_y(arg0, arg1);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'fade_speed_variation_y'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_ease_speed_variation_y_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'ease_speed_variation_y' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-  const SQChar* arg2;
-  if(SQ_FAILED(sq_getstring(vm, 4, &arg2))) {
-    sq_throwerror(vm, _SC("Argument 3 not a string"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->ease_speed_variation_y(arg0, arg1, arg2);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'ease_speed_variation_y'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_get_acceleration_x_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_acceleration_x' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-
-  try {
-    float return_value = _this->get_acceleration_x();
-
-    sq_pushfloat(vm, return_value);
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_acceleration_x'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_set_acceleration_x_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_acceleration_x' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_acceleration_x(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_acceleration_x'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_fade_acceleration_x_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'fade_acceleration_x' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->fade_acceleration_x(arg0, arg1);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'fade_acceleration_x'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_ease_acceleration_x_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'ease_acceleration_x' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-  const SQChar* arg2;
-  if(SQ_FAILED(sq_getstring(vm, 4, &arg2))) {
-    sq_throwerror(vm, _SC("Argument 3 not a string"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->ease_acceleration_x(arg0, arg1, arg2);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'ease_acceleration_x'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_get_acceleration_y_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_acceleration_y' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-
-  try {
-    float return_value = _this->get_acceleration_y();
-
-    sq_pushfloat(vm, return_value);
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_acceleration_y'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_set_acceleration_y_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_acceleration_y' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_acceleration_y(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_acceleration_y'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_fade_acceleration_y_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'fade_acceleration_y' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->fade_acceleration_y(arg0, arg1);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'fade_acceleration_y'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_ease_acceleration_y_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'ease_acceleration_y' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-  const SQChar* arg2;
-  if(SQ_FAILED(sq_getstring(vm, 4, &arg2))) {
-    sq_throwerror(vm, _SC("Argument 3 not a string"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->ease_acceleration_y(arg0, arg1, arg2);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'ease_acceleration_y'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_get_friction_x_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_friction_x' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-
-  try {
-    float return_value = _this->get_friction_x();
-
-    sq_pushfloat(vm, return_value);
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_friction_x'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_set_friction_x_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_friction_x' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_friction_x(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_friction_x'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_fade_friction_x_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'fade_friction_x' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->fade_friction_x(arg0, arg1);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'fade_friction_x'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_ease_friction_x_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'ease_friction_x' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-  const SQChar* arg2;
-  if(SQ_FAILED(sq_getstring(vm, 4, &arg2))) {
-    sq_throwerror(vm, _SC("Argument 3 not a string"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->ease_friction_x(arg0, arg1, arg2);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'ease_friction_x'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_get_friction_y_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_friction_y' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-
-  try {
-    float return_value = _this->get_friction_y();
-
-    sq_pushfloat(vm, return_value);
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_friction_y'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_set_friction_y_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_friction_y' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_friction_y(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_friction_y'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_fade_friction_y_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'fade_friction_y' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->fade_friction_y(arg0, arg1);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'fade_friction_y'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_ease_friction_y_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'ease_friction_y' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-  const SQChar* arg2;
-  if(SQ_FAILED(sq_getstring(vm, 4, &arg2))) {
-    sq_throwerror(vm, _SC("Argument 3 not a string"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->ease_friction_y(arg0, arg1, arg2);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'ease_friction_y'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_get_feather_factor_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_feather_factor' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-
-  try {
-    float return_value = _this->get_feather_factor();
-
-    sq_pushfloat(vm, return_value);
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_feather_factor'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_set_feather_factor_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_feather_factor' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_feather_factor(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_feather_factor'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_fade_feather_factor_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'fade_feather_factor' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->fade_feather_factor(arg0, arg1);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'fade_feather_factor'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_ease_feather_factor_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'ease_feather_factor' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-  const SQChar* arg2;
-  if(SQ_FAILED(sq_getstring(vm, 4, &arg2))) {
-    sq_throwerror(vm, _SC("Argument 3 not a string"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->ease_feather_factor(arg0, arg1, arg2);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'ease_feather_factor'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_get_rotation_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_rotation' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-
-  try {
-    float return_value = _this->get_rotation();
-
-    sq_pushfloat(vm, return_value);
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_rotation'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_set_rotation_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_rotation' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_rotation(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_rotation'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_fade_rotation_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'fade_rotation' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->fade_rotation(arg0, arg1);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'fade_rotation'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_ease_rotation_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'ease_rotation' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-  const SQChar* arg2;
-  if(SQ_FAILED(sq_getstring(vm, 4, &arg2))) {
-    sq_throwerror(vm, _SC("Argument 3 not a string"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->ease_rotation(arg0, arg1, arg2);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'ease_rotation'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_get_rotation_variation_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_rotation_variation' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-
-  try {
-    float return_value = _this->get_rotation_variation();
-
-    sq_pushfloat(vm, return_value);
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_rotation_variation'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_set_rotation_variation_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_rotation_variation' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_rotation_variation(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_rotation_variation'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_fade_rotation_variation_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'fade_rotation_variation' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->fade_rotation_variation(arg0, arg1);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'fade_rotation_variation'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_ease_rotation_variation_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'ease_rotation_variation' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-  const SQChar* arg2;
-  if(SQ_FAILED(sq_getstring(vm, 4, &arg2))) {
-    sq_throwerror(vm, _SC("Argument 3 not a string"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->ease_rotation_variation(arg0, arg1, arg2);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'ease_rotation_variation'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_get_rotation_speed_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_rotation_speed' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-
-  try {
-    float return_value = _this->get_rotation_speed();
-
-    sq_pushfloat(vm, return_value);
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_rotation_speed'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_set_rotation_speed_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_rotation_speed' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_rotation_speed(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_rotation_speed'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_fade_rotation_speed_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'fade_rotation_speed' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->fade_rotation_speed(arg0, arg1);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'fade_rotation_speed'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_ease_rotation_speed_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'ease_rotation_speed' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-  const SQChar* arg2;
-  if(SQ_FAILED(sq_getstring(vm, 4, &arg2))) {
-    sq_throwerror(vm, _SC("Argument 3 not a string"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->ease_rotation_speed(arg0, arg1, arg2);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'ease_rotation_speed'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_get_rotation_speed_variation_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_rotation_speed_variation' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-
-  try {
-    float return_value = _this->get_rotation_speed_variation();
-
-    sq_pushfloat(vm, return_value);
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_rotation_speed_variation'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_set_rotation_speed_variation_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_rotation_speed_variation' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_rotation_speed_variation(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_rotation_speed_variation'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_fade_rotation_speed_variation_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'fade_rotation_speed_variation' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->fade_rotation_speed_variation(arg0, arg1);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'fade_rotation_speed_variation'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_ease_rotation_speed_variation_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'ease_rotation_speed_variation' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-  const SQChar* arg2;
-  if(SQ_FAILED(sq_getstring(vm, 4, &arg2))) {
-    sq_throwerror(vm, _SC("Argument 3 not a string"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->ease_rotation_speed_variation(arg0, arg1, arg2);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'ease_rotation_speed_variation'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_get_rotation_acceleration_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_rotation_acceleration' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-
-  try {
-    float return_value = _this->get_rotation_acceleration();
-
-    sq_pushfloat(vm, return_value);
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_rotation_acceleration'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_set_rotation_acceleration_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_rotation_acceleration' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_rotation_acceleration(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_rotation_acceleration'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_fade_rotation_acceleration_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'fade_rotation_acceleration' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->fade_rotation_acceleration(arg0, arg1);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'fade_rotation_acceleration'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_ease_rotation_acceleration_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'ease_rotation_acceleration' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-  const SQChar* arg2;
-  if(SQ_FAILED(sq_getstring(vm, 4, &arg2))) {
-    sq_throwerror(vm, _SC("Argument 3 not a string"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->ease_rotation_acceleration(arg0, arg1, arg2);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'ease_rotation_acceleration'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_get_rotation_decceleration_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_rotation_decceleration' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-
-  try {
-    float return_value = _this->get_rotation_decceleration();
-
-    sq_pushfloat(vm, return_value);
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_rotation_decceleration'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_set_rotation_decceleration_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_rotation_decceleration' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_rotation_decceleration(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_rotation_decceleration'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_fade_rotation_decceleration_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'fade_rotation_decceleration' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->fade_rotation_decceleration(arg0, arg1);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'fade_rotation_decceleration'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger CustomParticles_ease_rotation_decceleration_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'ease_rotation_decceleration' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::CustomParticles* _this = reinterpret_cast<scripting::CustomParticles*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-  const SQChar* arg2;
-  if(SQ_FAILED(sq_getstring(vm, 4, &arg2))) {
-    sq_throwerror(vm, _SC("Argument 3 not a string"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->ease_rotation_decceleration(arg0, arg1, arg2);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'ease_rotation_decceleration'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Decal_release_hook(SQUserPointer ptr, SQInteger )
-{
-  scripting::Decal* _this = reinterpret_cast<scripting::Decal*> (ptr);
-  delete _this;
-  return 0;
-}
-
-static SQInteger Decal_fade_sprite_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'fade_sprite' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Decal* _this = reinterpret_cast<scripting::Decal*> (data);
-
-  const SQChar* arg0;
-  if(SQ_FAILED(sq_getstring(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a string"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->fade_sprite(arg0, arg1);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'fade_sprite'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Decal_change_sprite_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'change_sprite' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Decal* _this = reinterpret_cast<scripting::Decal*> (data);
-
-  const SQChar* arg0;
-  if(SQ_FAILED(sq_getstring(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a string"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->change_sprite(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'change_sprite'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Decal_fade_in_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'fade_in' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Decal* _this = reinterpret_cast<scripting::Decal*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->fade_in(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'fade_in'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Decal_fade_out_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'fade_out' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Decal* _this = reinterpret_cast<scripting::Decal*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->fade_out(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'fade_out'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Dispenser_release_hook(SQUserPointer ptr, SQInteger )
-{
-  scripting::Dispenser* _this = reinterpret_cast<scripting::Dispenser*> (ptr);
-  delete _this;
-  return 0;
-}
-
-static SQInteger Dispenser_activate_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'activate' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Dispenser* _this = reinterpret_cast<scripting::Dispenser*> (data);
-
-
-  try {
-    _this->activate();
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'activate'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Dispenser_deactivate_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'deactivate' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Dispenser* _this = reinterpret_cast<scripting::Dispenser*> (data);
-
-
-  try {
-    _this->deactivate();
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'deactivate'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger DisplayEffect_release_hook(SQUserPointer ptr, SQInteger )
-{
-  scripting::DisplayEffect* _this = reinterpret_cast<scripting::DisplayEffect*> (ptr);
-  delete _this;
-  return 0;
-}
-
-static SQInteger DisplayEffect_fade_out_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'fade_out' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::DisplayEffect* _this = reinterpret_cast<scripting::DisplayEffect*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->fade_out(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'fade_out'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger DisplayEffect_fade_in_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'fade_in' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::DisplayEffect* _this = reinterpret_cast<scripting::DisplayEffect*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->fade_in(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'fade_in'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger DisplayEffect_set_black_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_black' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::DisplayEffect* _this = reinterpret_cast<scripting::DisplayEffect*> (data);
-
-  SQBool arg0;
-  if(SQ_FAILED(sq_getbool(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a bool"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_black(arg0 == SQTrue);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_black'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger DisplayEffect_is_black_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'is_black' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::DisplayEffect* _this = reinterpret_cast<scripting::DisplayEffect*> (data);
-
-
-  try {
-    bool return_value = _this->is_black();
-
-    sq_pushbool(vm, return_value);
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'is_black'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger DisplayEffect_sixteen_to_nine_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'sixteen_to_nine' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::DisplayEffect* _this = reinterpret_cast<scripting::DisplayEffect*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->sixteen_to_nine(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'sixteen_to_nine'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger DisplayEffect_four_to_three_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'four_to_three' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::DisplayEffect* _this = reinterpret_cast<scripting::DisplayEffect*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->four_to_three(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'four_to_three'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger FloatingImage_release_hook(SQUserPointer ptr, SQInteger )
-{
-  scripting::FloatingImage* _this = reinterpret_cast<scripting::FloatingImage*> (ptr);
-  delete _this;
-  return 0;
-}
-
-static SQInteger FloatingImage_constructor_wrapper(HSQUIRRELVM vm)
-{
-  const SQChar* arg0;
-  if(SQ_FAILED(sq_getstring(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a string"));
-    return SQ_ERROR;
-  }
-
-  try {
-    auto _this = new scripting::FloatingImage(arg0);
-  if(SQ_FAILED(sq_setinstanceup(vm, 1, _this))) {
-    sq_throwerror(vm, _SC("Couldn't setup instance of 'FloatingImage' class"));
-    return SQ_ERROR;
-  }
-  sq_setreleasehook(vm, 1, FloatingImage_release_hook);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'constructor'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger FloatingImage_set_layer_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_layer' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::FloatingImage* _this = reinterpret_cast<scripting::FloatingImage*> (data);
-
-  SQInteger arg0;
-  if(SQ_FAILED(sq_getinteger(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not an integer"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_layer(static_cast<int> (arg0));
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_layer'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger FloatingImage_get_layer_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_layer' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::FloatingImage* _this = reinterpret_cast<scripting::FloatingImage*> (data);
-
-
-  try {
-    int return_value = _this->get_layer();
-
-    sq_pushinteger(vm, return_value);
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_layer'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger FloatingImage_set_pos_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_pos' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::FloatingImage* _this = reinterpret_cast<scripting::FloatingImage*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_pos(arg0, arg1);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_pos'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger FloatingImage_get_pos_x_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_pos_x' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::FloatingImage* _this = reinterpret_cast<scripting::FloatingImage*> (data);
-
-
-  try {
-    float return_value = _this->get_pos_x();
-
-    sq_pushfloat(vm, return_value);
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_pos_x'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger FloatingImage_get_pos_y_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_pos_y' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::FloatingImage* _this = reinterpret_cast<scripting::FloatingImage*> (data);
-
-
-  try {
-    float return_value = _this->get_pos_y();
-
-    sq_pushfloat(vm, return_value);
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_pos_y'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger FloatingImage_set_anchor_point_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_anchor_point' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::FloatingImage* _this = reinterpret_cast<scripting::FloatingImage*> (data);
-
-  SQInteger arg0;
-  if(SQ_FAILED(sq_getinteger(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not an integer"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_anchor_point(static_cast<int> (arg0));
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_anchor_point'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger FloatingImage_get_anchor_point_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_anchor_point' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::FloatingImage* _this = reinterpret_cast<scripting::FloatingImage*> (data);
-
-
-  try {
-    int return_value = _this->get_anchor_point();
-
-    sq_pushinteger(vm, return_value);
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_anchor_point'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger FloatingImage_set_visible_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_visible' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::FloatingImage* _this = reinterpret_cast<scripting::FloatingImage*> (data);
-
-  SQBool arg0;
-  if(SQ_FAILED(sq_getbool(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a bool"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_visible(arg0 == SQTrue);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_visible'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger FloatingImage_get_visible_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_visible' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::FloatingImage* _this = reinterpret_cast<scripting::FloatingImage*> (data);
-
-
-  try {
-    bool return_value = _this->get_visible();
-
-    sq_pushbool(vm, return_value);
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_visible'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger FloatingImage_set_action_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_action' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::FloatingImage* _this = reinterpret_cast<scripting::FloatingImage*> (data);
-
-  const SQChar* arg0;
-  if(SQ_FAILED(sq_getstring(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a string"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_action(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_action'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger FloatingImage_get_action_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_action' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::FloatingImage* _this = reinterpret_cast<scripting::FloatingImage*> (data);
-
-
-  try {
-    std::string return_value = _this->get_action();
-
-    assert(return_value.size() < static_cast<size_t>(std::numeric_limits<SQInteger>::max()));
-    sq_pushstring(vm, return_value.c_str(), static_cast<SQInteger>(return_value.size()));
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_action'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger FloatingImage_fade_in_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'fade_in' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::FloatingImage* _this = reinterpret_cast<scripting::FloatingImage*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->fade_in(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'fade_in'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger FloatingImage_fade_out_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'fade_out' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::FloatingImage* _this = reinterpret_cast<scripting::FloatingImage*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->fade_out(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'fade_out'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger GameObjectManager_release_hook(SQUserPointer ptr, SQInteger )
-{
-  scripting::GameObjectManager* _this = reinterpret_cast<scripting::GameObjectManager*> (ptr);
-  delete _this;
-  return 0;
-}
-
-static SQInteger GameObjectManager_set_ambient_light_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_ambient_light' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::GameObjectManager* _this = reinterpret_cast<scripting::GameObjectManager*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg2;
-  if(SQ_FAILED(sq_getfloat(vm, 4, &arg2))) {
-    sq_throwerror(vm, _SC("Argument 3 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_ambient_light(arg0, arg1, arg2);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_ambient_light'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger GameObjectManager_fade_to_ambient_light_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'fade_to_ambient_light' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::GameObjectManager* _this = reinterpret_cast<scripting::GameObjectManager*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg2;
-  if(SQ_FAILED(sq_getfloat(vm, 4, &arg2))) {
-    sq_throwerror(vm, _SC("Argument 3 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg3;
-  if(SQ_FAILED(sq_getfloat(vm, 5, &arg3))) {
-    sq_throwerror(vm, _SC("Argument 4 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->fade_to_ambient_light(arg0, arg1, arg2, arg3);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'fade_to_ambient_light'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger GameObjectManager_get_ambient_red_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_ambient_red' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::GameObjectManager* _this = reinterpret_cast<scripting::GameObjectManager*> (data);
-
-
-  try {
-    float return_value = _this->get_ambient_red();
-
-    sq_pushfloat(vm, return_value);
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_ambient_red'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger GameObjectManager_get_ambient_green_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_ambient_green' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::GameObjectManager* _this = reinterpret_cast<scripting::GameObjectManager*> (data);
-
-
-  try {
-    float return_value = _this->get_ambient_green();
-
-    sq_pushfloat(vm, return_value);
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_ambient_green'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger GameObjectManager_get_ambient_blue_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_ambient_blue' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::GameObjectManager* _this = reinterpret_cast<scripting::GameObjectManager*> (data);
-
-
-  try {
-    float return_value = _this->get_ambient_blue();
-
-    sq_pushfloat(vm, return_value);
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_ambient_blue'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger GameObjectManager_set_music_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_music' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::GameObjectManager* _this = reinterpret_cast<scripting::GameObjectManager*> (data);
-
-  const SQChar* arg0;
-  if(SQ_FAILED(sq_getstring(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a string"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_music(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_music'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Gradient_release_hook(SQUserPointer ptr, SQInteger )
-{
-  scripting::Gradient* _this = reinterpret_cast<scripting::Gradient*> (ptr);
-  delete _this;
-  return 0;
-}
-
-static SQInteger Gradient_set_direction_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_direction' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Gradient* _this = reinterpret_cast<scripting::Gradient*> (data);
-
-  const SQChar* arg0;
-  if(SQ_FAILED(sq_getstring(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a string"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_direction(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_direction'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Gradient_get_direction_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_direction' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Gradient* _this = reinterpret_cast<scripting::Gradient*> (data);
-
-
-  try {
-    std::string return_value = _this->get_direction();
-
-    assert(return_value.size() < static_cast<size_t>(std::numeric_limits<SQInteger>::max()));
-    sq_pushstring(vm, return_value.c_str(), static_cast<SQInteger>(return_value.size()));
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_direction'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Gradient_set_color1_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_color1' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Gradient* _this = reinterpret_cast<scripting::Gradient*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg2;
-  if(SQ_FAILED(sq_getfloat(vm, 4, &arg2))) {
-    sq_throwerror(vm, _SC("Argument 3 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_color1(arg0, arg1, arg2);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_color1'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Gradient_set_color2_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_color2' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Gradient* _this = reinterpret_cast<scripting::Gradient*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg2;
-  if(SQ_FAILED(sq_getfloat(vm, 4, &arg2))) {
-    sq_throwerror(vm, _SC("Argument 3 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_color2(arg0, arg1, arg2);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_color2'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Gradient_set_colors_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_colors' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Gradient* _this = reinterpret_cast<scripting::Gradient*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg2;
-  if(SQ_FAILED(sq_getfloat(vm, 4, &arg2))) {
-    sq_throwerror(vm, _SC("Argument 3 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg3;
-  if(SQ_FAILED(sq_getfloat(vm, 5, &arg3))) {
-    sq_throwerror(vm, _SC("Argument 4 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg4;
-  if(SQ_FAILED(sq_getfloat(vm, 6, &arg4))) {
-    sq_throwerror(vm, _SC("Argument 5 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg5;
-  if(SQ_FAILED(sq_getfloat(vm, 7, &arg5))) {
-    sq_throwerror(vm, _SC("Argument 6 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_colors(arg0, arg1, arg2, arg3, arg4, arg5);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_colors'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Gradient_fade_color1_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'fade_color1' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Gradient* _this = reinterpret_cast<scripting::Gradient*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg2;
-  if(SQ_FAILED(sq_getfloat(vm, 4, &arg2))) {
-    sq_throwerror(vm, _SC("Argument 3 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg3;
-  if(SQ_FAILED(sq_getfloat(vm, 5, &arg3))) {
-    sq_throwerror(vm, _SC("Argument 4 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->fade_color1(arg0, arg1, arg2, arg3);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'fade_color1'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Gradient_fade_color2_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'fade_color2' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Gradient* _this = reinterpret_cast<scripting::Gradient*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg2;
-  if(SQ_FAILED(sq_getfloat(vm, 4, &arg2))) {
-    sq_throwerror(vm, _SC("Argument 3 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg3;
-  if(SQ_FAILED(sq_getfloat(vm, 5, &arg3))) {
-    sq_throwerror(vm, _SC("Argument 4 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->fade_color2(arg0, arg1, arg2, arg3);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'fade_color2'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Gradient_fade_colors_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'fade_colors' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Gradient* _this = reinterpret_cast<scripting::Gradient*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg2;
-  if(SQ_FAILED(sq_getfloat(vm, 4, &arg2))) {
-    sq_throwerror(vm, _SC("Argument 3 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg3;
-  if(SQ_FAILED(sq_getfloat(vm, 5, &arg3))) {
-    sq_throwerror(vm, _SC("Argument 4 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg4;
-  if(SQ_FAILED(sq_getfloat(vm, 6, &arg4))) {
-    sq_throwerror(vm, _SC("Argument 5 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg5;
-  if(SQ_FAILED(sq_getfloat(vm, 7, &arg5))) {
-    sq_throwerror(vm, _SC("Argument 6 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg6;
-  if(SQ_FAILED(sq_getfloat(vm, 8, &arg6))) {
-    sq_throwerror(vm, _SC("Argument 7 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->fade_colors(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'fade_colors'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Gradient_swap_colors_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'swap_colors' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Gradient* _this = reinterpret_cast<scripting::Gradient*> (data);
-
-
-  try {
-    _this->swap_colors();
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'swap_colors'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger LevelTime_release_hook(SQUserPointer ptr, SQInteger )
-{
-  scripting::LevelTime* _this = reinterpret_cast<scripting::LevelTime*> (ptr);
-  delete _this;
-  return 0;
-}
-
-static SQInteger LevelTime_start_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'start' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::LevelTime* _this = reinterpret_cast<scripting::LevelTime*> (data);
-
-
-  try {
-    _this->start();
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'start'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger LevelTime_stop_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'stop' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::LevelTime* _this = reinterpret_cast<scripting::LevelTime*> (data);
-
-
-  try {
-    _this->stop();
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'stop'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger LevelTime_get_time_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_time' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::LevelTime* _this = reinterpret_cast<scripting::LevelTime*> (data);
-
-
-  try {
-    float return_value = _this->get_time();
-
-    sq_pushfloat(vm, return_value);
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_time'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger LevelTime_set_time_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_time' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::LevelTime* _this = reinterpret_cast<scripting::LevelTime*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_time(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_time'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger LitObject_release_hook(SQUserPointer ptr, SQInteger )
-{
-  scripting::LitObject* _this = reinterpret_cast<scripting::LitObject*> (ptr);
-  delete _this;
-  return 0;
-}
-
-static SQInteger LitObject_get_action_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_action' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::LitObject* _this = reinterpret_cast<scripting::LitObject*> (data);
-
-
-  try {
-    std::string return_value = _this->get_action();
-
-    assert(return_value.size() < static_cast<size_t>(std::numeric_limits<SQInteger>::max()));
-    sq_pushstring(vm, return_value.c_str(), static_cast<SQInteger>(return_value.size()));
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_action'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger LitObject_set_action_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_action' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::LitObject* _this = reinterpret_cast<scripting::LitObject*> (data);
-
-  const SQChar* arg0;
-  if(SQ_FAILED(sq_getstring(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a string"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_action(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_action'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger LitObject_get_light_action_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_light_action' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::LitObject* _this = reinterpret_cast<scripting::LitObject*> (data);
-
-
-  try {
-    std::string return_value = _this->get_light_action();
-
-    assert(return_value.size() < static_cast<size_t>(std::numeric_limits<SQInteger>::max()));
-    sq_pushstring(vm, return_value.c_str(), static_cast<SQInteger>(return_value.size()));
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_light_action'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger LitObject_set_light_action_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_light_action' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::LitObject* _this = reinterpret_cast<scripting::LitObject*> (data);
-
-  const SQChar* arg0;
-  if(SQ_FAILED(sq_getstring(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a string"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_light_action(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_light_action'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger ParticleSystem_release_hook(SQUserPointer ptr, SQInteger )
-{
-  scripting::ParticleSystem* _this = reinterpret_cast<scripting::ParticleSystem*> (ptr);
-  delete _this;
-  return 0;
-}
-
-static SQInteger ParticleSystem_set_enabled_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_enabled' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::ParticleSystem* _this = reinterpret_cast<scripting::ParticleSystem*> (data);
-
-  SQBool arg0;
-  if(SQ_FAILED(sq_getbool(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a bool"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_enabled(arg0 == SQTrue);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_enabled'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger ParticleSystem_get_enabled_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_enabled' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::ParticleSystem* _this = reinterpret_cast<scripting::ParticleSystem*> (data);
-
-
-  try {
-    bool return_value = _this->get_enabled();
-
-    sq_pushbool(vm, return_value);
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_enabled'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Platform_release_hook(SQUserPointer ptr, SQInteger )
-{
-  scripting::Platform* _this = reinterpret_cast<scripting::Platform*> (ptr);
-  delete _this;
-  return 0;
-}
-
-static SQInteger Platform_goto_node_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'goto_node' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Platform* _this = reinterpret_cast<scripting::Platform*> (data);
-
-  SQInteger arg0;
-  if(SQ_FAILED(sq_getinteger(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not an integer"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->goto_node(static_cast<int> (arg0));
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'goto_node'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Platform_set_node_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_node' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Platform* _this = reinterpret_cast<scripting::Platform*> (data);
-
-  SQInteger arg0;
-  if(SQ_FAILED(sq_getinteger(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not an integer"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_node(static_cast<int> (arg0));
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_node'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Platform_start_moving_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'start_moving' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Platform* _this = reinterpret_cast<scripting::Platform*> (data);
-
-
-  try {
-    _this->start_moving();
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'start_moving'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Platform_stop_moving_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'stop_moving' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Platform* _this = reinterpret_cast<scripting::Platform*> (data);
-
-
-  try {
-    _this->stop_moving();
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'stop_moving'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Platform_get_action_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_action' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Platform* _this = reinterpret_cast<scripting::Platform*> (data);
-
-
-  try {
-    std::string return_value = _this->get_action();
-
-    assert(return_value.size() < static_cast<size_t>(std::numeric_limits<SQInteger>::max()));
-    sq_pushstring(vm, return_value.c_str(), static_cast<SQInteger>(return_value.size()));
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_action'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Platform_set_action_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_action' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Platform* _this = reinterpret_cast<scripting::Platform*> (data);
-
-  const SQChar* arg0;
-  if(SQ_FAILED(sq_getstring(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a string"));
-    return SQ_ERROR;
-  }
-  SQInteger arg1;
-  if(SQ_FAILED(sq_getinteger(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not an integer"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_action(arg0, static_cast<int> (arg1));
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_action'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Player_release_hook(SQUserPointer ptr, SQInteger )
-{
-  scripting::Player* _this = reinterpret_cast<scripting::Player*> (ptr);
-  delete _this;
-  return 0;
-}
-
-static SQInteger Player_add_bonus_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'add_bonus' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Player* _this = reinterpret_cast<scripting::Player*> (data);
-
-  const SQChar* arg0;
-  if(SQ_FAILED(sq_getstring(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a string"));
-    return SQ_ERROR;
-  }
-
-  try {
-    bool return_value = _this->add_bonus(arg0);
-
-    sq_pushbool(vm, return_value);
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'add_bonus'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Player_set_bonus_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_bonus' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Player* _this = reinterpret_cast<scripting::Player*> (data);
-
-  const SQChar* arg0;
-  if(SQ_FAILED(sq_getstring(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a string"));
-    return SQ_ERROR;
-  }
-
-  try {
-    bool return_value = _this->set_bonus(arg0);
-
-    sq_pushbool(vm, return_value);
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_bonus'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Player_get_bonus_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_bonus' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Player* _this = reinterpret_cast<scripting::Player*> (data);
-
-
-  try {
-    std::string return_value = _this->get_bonus();
-
-    assert(return_value.size() < static_cast<size_t>(std::numeric_limits<SQInteger>::max()));
-    sq_pushstring(vm, return_value.c_str(), static_cast<SQInteger>(return_value.size()));
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_bonus'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Player_add_coins_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'add_coins' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Player* _this = reinterpret_cast<scripting::Player*> (data);
-
-  SQInteger arg0;
-  if(SQ_FAILED(sq_getinteger(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not an integer"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->add_coins(static_cast<int> (arg0));
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'add_coins'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Player_get_coins_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_coins' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Player* _this = reinterpret_cast<scripting::Player*> (data);
-
-
-  try {
-    int return_value = _this->get_coins();
-
-    sq_pushinteger(vm, return_value);
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_coins'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Player_make_invincible_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'make_invincible' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Player* _this = reinterpret_cast<scripting::Player*> (data);
-
-
-  try {
-    _this->make_invincible();
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'make_invincible'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Player_deactivate_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'deactivate' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Player* _this = reinterpret_cast<scripting::Player*> (data);
-
-
-  try {
-    _this->deactivate();
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'deactivate'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Player_activate_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'activate' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Player* _this = reinterpret_cast<scripting::Player*> (data);
-
-
-  try {
-    _this->activate();
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'activate'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Player_walk_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'walk' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Player* _this = reinterpret_cast<scripting::Player*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->walk(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'walk'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Player_set_dir_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_dir' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Player* _this = reinterpret_cast<scripting::Player*> (data);
-
-  SQBool arg0;
-  if(SQ_FAILED(sq_getbool(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a bool"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_dir(arg0 == SQTrue);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_dir'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Player_set_visible_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_visible' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Player* _this = reinterpret_cast<scripting::Player*> (data);
-
-  SQBool arg0;
-  if(SQ_FAILED(sq_getbool(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a bool"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_visible(arg0 == SQTrue);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_visible'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Player_get_visible_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_visible' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Player* _this = reinterpret_cast<scripting::Player*> (data);
-
-
-  try {
-    bool return_value = _this->get_visible();
-
-    sq_pushbool(vm, return_value);
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_visible'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Player_kill_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'kill' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Player* _this = reinterpret_cast<scripting::Player*> (data);
-
-  SQBool arg0;
-  if(SQ_FAILED(sq_getbool(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a bool"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->kill(arg0 == SQTrue);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'kill'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Player_set_ghost_mode_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_ghost_mode' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Player* _this = reinterpret_cast<scripting::Player*> (data);
-
-  SQBool arg0;
-  if(SQ_FAILED(sq_getbool(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a bool"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_ghost_mode(arg0 == SQTrue);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_ghost_mode'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Player_get_ghost_mode_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_ghost_mode' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Player* _this = reinterpret_cast<scripting::Player*> (data);
-
-
-  try {
-    bool return_value = _this->get_ghost_mode();
-
-    sq_pushbool(vm, return_value);
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_ghost_mode'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Player_kick_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'kick' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Player* _this = reinterpret_cast<scripting::Player*> (data);
-
-
-  try {
-    _this->kick();
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'kick'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Player_do_cheer_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'do_cheer' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Player* _this = reinterpret_cast<scripting::Player*> (data);
-
-
-  try {
-    _this->do_cheer();
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'do_cheer'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Player_do_duck_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'do_duck' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Player* _this = reinterpret_cast<scripting::Player*> (data);
-
-
-  try {
-    _this->do_duck();
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'do_duck'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Player_do_standup_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'do_standup' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Player* _this = reinterpret_cast<scripting::Player*> (data);
-
-
-  try {
-    _this->do_standup();
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'do_standup'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Player_do_backflip_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'do_backflip' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Player* _this = reinterpret_cast<scripting::Player*> (data);
-
-
-  try {
-    _this->do_backflip();
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'do_backflip'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Player_do_jump_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'do_jump' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Player* _this = reinterpret_cast<scripting::Player*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->do_jump(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'do_jump'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Player_trigger_sequence_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'trigger_sequence' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Player* _this = reinterpret_cast<scripting::Player*> (data);
-
-  const SQChar* arg0;
-  if(SQ_FAILED(sq_getstring(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a string"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->trigger_sequence(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'trigger_sequence'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Player_use_scripting_controller_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'use_scripting_controller' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Player* _this = reinterpret_cast<scripting::Player*> (data);
-
-  SQBool arg0;
-  if(SQ_FAILED(sq_getbool(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a bool"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->use_scripting_controller(arg0 == SQTrue);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'use_scripting_controller'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Player_do_scripting_controller_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'do_scripting_controller' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Player* _this = reinterpret_cast<scripting::Player*> (data);
-
-  const SQChar* arg0;
-  if(SQ_FAILED(sq_getstring(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a string"));
-    return SQ_ERROR;
-  }
-  SQBool arg1;
-  if(SQ_FAILED(sq_getbool(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a bool"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->do_scripting_controller(arg0, arg1 == SQTrue);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'do_scripting_controller'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Player_has_grabbed_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'has_grabbed' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Player* _this = reinterpret_cast<scripting::Player*> (data);
-
-  const SQChar* arg0;
-  if(SQ_FAILED(sq_getstring(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a string"));
-    return SQ_ERROR;
-  }
-
-  try {
-    bool return_value = _this->has_grabbed(arg0);
-
-    sq_pushbool(vm, return_value);
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'has_grabbed'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Player_get_velocity_x_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_velocity_x' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Player* _this = reinterpret_cast<scripting::Player*> (data);
-
-
-  try {
-    float return_value = _this->get_velocity_x();
-
-    sq_pushfloat(vm, return_value);
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_velocity_x'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Player_get_velocity_y_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_velocity_y' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Player* _this = reinterpret_cast<scripting::Player*> (data);
-
-
-  try {
-    float return_value = _this->get_velocity_y();
-
-    sq_pushfloat(vm, return_value);
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_velocity_y'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Player_get_x_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_x' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Player* _this = reinterpret_cast<scripting::Player*> (data);
-
-
-  try {
-    float return_value = _this->get_x();
-
-    sq_pushfloat(vm, return_value);
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_x'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Player_get_y_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_y' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Player* _this = reinterpret_cast<scripting::Player*> (data);
-
-
-  try {
-    float return_value = _this->get_y();
-
-    sq_pushfloat(vm, return_value);
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_y'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Player_set_pos_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_pos' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Player* _this = reinterpret_cast<scripting::Player*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_pos(arg0, arg1);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_pos'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Player_get_action_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_action' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Player* _this = reinterpret_cast<scripting::Player*> (data);
-
-
-  try {
-    std::string return_value = _this->get_action();
-
-    assert(return_value.size() < static_cast<size_t>(std::numeric_limits<SQInteger>::max()));
-    sq_pushstring(vm, return_value.c_str(), static_cast<SQInteger>(return_value.size()));
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_action'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Rain_release_hook(SQUserPointer ptr, SQInteger )
-{
-  scripting::Rain* _this = reinterpret_cast<scripting::Rain*> (ptr);
-  delete _this;
-  return 0;
-}
-
-static SQInteger Rain_set_enabled_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_enabled' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Rain* _this = reinterpret_cast<scripting::Rain*> (data);
-
-  SQBool arg0;
-  if(SQ_FAILED(sq_getbool(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a bool"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_enabled(arg0 == SQTrue);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_enabled'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Rain_get_enabled_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_enabled' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Rain* _this = reinterpret_cast<scripting::Rain*> (data);
-
-
-  try {
-    bool return_value = _this->get_enabled();
-
-    sq_pushbool(vm, return_value);
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_enabled'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Rain_fade_speed_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'fade_speed' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Rain* _this = reinterpret_cast<scripting::Rain*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->fade_speed(arg0, arg1);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'fade_speed'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Rain_fade_amount_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'fade_amount' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Rain* _this = reinterpret_cast<scripting::Rain*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->fade_amount(arg0, arg1);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'fade_amount'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Rain_fade_angle_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'fade_angle' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Rain* _this = reinterpret_cast<scripting::Rain*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-  const SQChar* arg2;
-  if(SQ_FAILED(sq_getstring(vm, 4, &arg2))) {
-    sq_throwerror(vm, _SC("Argument 3 not a string"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->fade_angle(arg0, arg1, arg2);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'fade_angle'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Rock_release_hook(SQUserPointer ptr, SQInteger )
-{
-  scripting::Rock* _this = reinterpret_cast<scripting::Rock*> (ptr);
-  delete _this;
-  return 0;
-}
-
-static SQInteger ScriptedObject_release_hook(SQUserPointer ptr, SQInteger )
-{
-  scripting::ScriptedObject* _this = reinterpret_cast<scripting::ScriptedObject*> (ptr);
-  delete _this;
-  return 0;
-}
-
-static SQInteger ScriptedObject_set_action_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_action' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::ScriptedObject* _this = reinterpret_cast<scripting::ScriptedObject*> (data);
-
-  const SQChar* arg0;
-  if(SQ_FAILED(sq_getstring(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a string"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_action(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_action'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger ScriptedObject_get_action_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_action' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::ScriptedObject* _this = reinterpret_cast<scripting::ScriptedObject*> (data);
-
-
-  try {
-    std::string return_value = _this->get_action();
-
-    assert(return_value.size() < static_cast<size_t>(std::numeric_limits<SQInteger>::max()));
-    sq_pushstring(vm, return_value.c_str(), static_cast<SQInteger>(return_value.size()));
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_action'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger ScriptedObject_get_name_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_name' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::ScriptedObject* _this = reinterpret_cast<scripting::ScriptedObject*> (data);
-
-
-  try {
-    std::string return_value = _this->get_name();
-
-    assert(return_value.size() < static_cast<size_t>(std::numeric_limits<SQInteger>::max()));
-    sq_pushstring(vm, return_value.c_str(), static_cast<SQInteger>(return_value.size()));
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_name'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger ScriptedObject_move_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'move' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::ScriptedObject* _this = reinterpret_cast<scripting::ScriptedObject*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->move(arg0, arg1);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'move'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger ScriptedObject_set_pos_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_pos' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::ScriptedObject* _this = reinterpret_cast<scripting::ScriptedObject*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_pos(arg0, arg1);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_pos'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger ScriptedObject_get_pos_x_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_pos_x' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::ScriptedObject* _this = reinterpret_cast<scripting::ScriptedObject*> (data);
-
-
-  try {
-    float return_value = _this->get_pos_x();
-
-    sq_pushfloat(vm, return_value);
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_pos_x'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger ScriptedObject_get_pos_y_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_pos_y' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::ScriptedObject* _this = reinterpret_cast<scripting::ScriptedObject*> (data);
-
-
-  try {
-    float return_value = _this->get_pos_y();
-
-    sq_pushfloat(vm, return_value);
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_pos_y'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger ScriptedObject_set_velocity_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_velocity' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::ScriptedObject* _this = reinterpret_cast<scripting::ScriptedObject*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_velocity(arg0, arg1);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_velocity'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger ScriptedObject_get_velocity_x_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_velocity_x' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::ScriptedObject* _this = reinterpret_cast<scripting::ScriptedObject*> (data);
-
-
-  try {
-    float return_value = _this->get_velocity_x();
-
-    sq_pushfloat(vm, return_value);
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_velocity_x'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger ScriptedObject_get_velocity_y_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_velocity_y' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::ScriptedObject* _this = reinterpret_cast<scripting::ScriptedObject*> (data);
-
-
-  try {
-    float return_value = _this->get_velocity_y();
-
-    sq_pushfloat(vm, return_value);
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_velocity_y'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger ScriptedObject_enable_gravity_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'enable_gravity' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::ScriptedObject* _this = reinterpret_cast<scripting::ScriptedObject*> (data);
-
-  SQBool arg0;
-  if(SQ_FAILED(sq_getbool(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a bool"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->enable_gravity(arg0 == SQTrue);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'enable_gravity'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger ScriptedObject_gravity_enabled_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'gravity_enabled' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::ScriptedObject* _this = reinterpret_cast<scripting::ScriptedObject*> (data);
-
-
-  try {
-    bool return_value = _this->gravity_enabled();
-
-    sq_pushbool(vm, return_value);
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'gravity_enabled'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger ScriptedObject_set_visible_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_visible' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::ScriptedObject* _this = reinterpret_cast<scripting::ScriptedObject*> (data);
-
-  SQBool arg0;
-  if(SQ_FAILED(sq_getbool(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a bool"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_visible(arg0 == SQTrue);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_visible'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger ScriptedObject_is_visible_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'is_visible' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::ScriptedObject* _this = reinterpret_cast<scripting::ScriptedObject*> (data);
-
-
-  try {
-    bool return_value = _this->is_visible();
-
-    sq_pushbool(vm, return_value);
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'is_visible'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger ScriptedObject_set_solid_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_solid' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::ScriptedObject* _this = reinterpret_cast<scripting::ScriptedObject*> (data);
-
-  SQBool arg0;
-  if(SQ_FAILED(sq_getbool(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a bool"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_solid(arg0 == SQTrue);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_solid'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger ScriptedObject_is_solid_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'is_solid' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::ScriptedObject* _this = reinterpret_cast<scripting::ScriptedObject*> (data);
-
-
-  try {
-    bool return_value = _this->is_solid();
-
-    sq_pushbool(vm, return_value);
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'is_solid'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Sector_release_hook(SQUserPointer ptr, SQInteger )
-{
-  scripting::Sector* _this = reinterpret_cast<scripting::Sector*> (ptr);
-  delete _this;
-  return 0;
-}
-
-static SQInteger Sector_set_gravity_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_gravity' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Sector* _this = reinterpret_cast<scripting::Sector*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_gravity(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_gravity'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Spotlight_release_hook(SQUserPointer ptr, SQInteger )
-{
-  scripting::Spotlight* _this = reinterpret_cast<scripting::Spotlight*> (ptr);
-  delete _this;
-  return 0;
-}
-
-static SQInteger Spotlight_set_enabled_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_enabled' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Spotlight* _this = reinterpret_cast<scripting::Spotlight*> (data);
-
-  SQBool arg0;
-  if(SQ_FAILED(sq_getbool(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a bool"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_enabled(arg0 == SQTrue);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_enabled'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Spotlight_is_enabled_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'is_enabled' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Spotlight* _this = reinterpret_cast<scripting::Spotlight*> (data);
-
-
-  try {
-    bool return_value = _this->is_enabled();
-
-    sq_pushbool(vm, return_value);
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'is_enabled'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Spotlight_set_direction_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_direction' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Spotlight* _this = reinterpret_cast<scripting::Spotlight*> (data);
-
-  const SQChar* arg0;
-  if(SQ_FAILED(sq_getstring(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a string"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_direction(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_direction'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Spotlight_set_angle_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_angle' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Spotlight* _this = reinterpret_cast<scripting::Spotlight*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_angle(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_angle'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Spotlight_fade_angle_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'fade_angle' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Spotlight* _this = reinterpret_cast<scripting::Spotlight*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->fade_angle(arg0, arg1);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'fade_angle'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Spotlight_ease_angle_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'ease_angle' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Spotlight* _this = reinterpret_cast<scripting::Spotlight*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-  const SQChar* arg2;
-  if(SQ_FAILED(sq_getstring(vm, 4, &arg2))) {
-    sq_throwerror(vm, _SC("Argument 3 not a string"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->ease_angle(arg0, arg1, arg2);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'ease_angle'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Spotlight_set_speed_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_speed' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Spotlight* _this = reinterpret_cast<scripting::Spotlight*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_speed(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_speed'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Spotlight_fade_speed_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'fade_speed' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Spotlight* _this = reinterpret_cast<scripting::Spotlight*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->fade_speed(arg0, arg1);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'fade_speed'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Spotlight_ease_speed_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'ease_speed' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Spotlight* _this = reinterpret_cast<scripting::Spotlight*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-  const SQChar* arg2;
-  if(SQ_FAILED(sq_getstring(vm, 4, &arg2))) {
-    sq_throwerror(vm, _SC("Argument 3 not a string"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->ease_speed(arg0, arg1, arg2);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'ease_speed'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Spotlight_set_color_rgba_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_color_rgba' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Spotlight* _this = reinterpret_cast<scripting::Spotlight*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg2;
-  if(SQ_FAILED(sq_getfloat(vm, 4, &arg2))) {
-    sq_throwerror(vm, _SC("Argument 3 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg3;
-  if(SQ_FAILED(sq_getfloat(vm, 5, &arg3))) {
-    sq_throwerror(vm, _SC("Argument 4 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_color_rgba(arg0, arg1, arg2, arg3);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_color_rgba'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Spotlight_fade_color_rgba_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'fade_color_rgba' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Spotlight* _this = reinterpret_cast<scripting::Spotlight*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg2;
-  if(SQ_FAILED(sq_getfloat(vm, 4, &arg2))) {
-    sq_throwerror(vm, _SC("Argument 3 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg3;
-  if(SQ_FAILED(sq_getfloat(vm, 5, &arg3))) {
-    sq_throwerror(vm, _SC("Argument 4 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg4;
-  if(SQ_FAILED(sq_getfloat(vm, 6, &arg4))) {
-    sq_throwerror(vm, _SC("Argument 5 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->fade_color_rgba(arg0, arg1, arg2, arg3, arg4);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'fade_color_rgba'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Spotlight_ease_color_rgba_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'ease_color_rgba' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Spotlight* _this = reinterpret_cast<scripting::Spotlight*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg2;
-  if(SQ_FAILED(sq_getfloat(vm, 4, &arg2))) {
-    sq_throwerror(vm, _SC("Argument 3 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg3;
-  if(SQ_FAILED(sq_getfloat(vm, 5, &arg3))) {
-    sq_throwerror(vm, _SC("Argument 4 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg4;
-  if(SQ_FAILED(sq_getfloat(vm, 6, &arg4))) {
-    sq_throwerror(vm, _SC("Argument 5 not a float"));
-    return SQ_ERROR;
-  }
-  const SQChar* arg5;
-  if(SQ_FAILED(sq_getstring(vm, 7, &arg5))) {
-    sq_throwerror(vm, _SC("Argument 6 not a string"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->ease_color_rgba(arg0, arg1, arg2, arg3, arg4, arg5);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'ease_color_rgba'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Text_release_hook(SQUserPointer ptr, SQInteger )
-{
-  scripting::Text* _this = reinterpret_cast<scripting::Text*> (ptr);
-  delete _this;
-  return 0;
-}
-
-static SQInteger Text_set_text_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_text' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Text* _this = reinterpret_cast<scripting::Text*> (data);
-
-  const SQChar* arg0;
-  if(SQ_FAILED(sq_getstring(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a string"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_text(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_text'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Text_set_font_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_font' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Text* _this = reinterpret_cast<scripting::Text*> (data);
-
-  const SQChar* arg0;
-  if(SQ_FAILED(sq_getstring(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a string"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_font(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_font'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Text_fade_in_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'fade_in' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Text* _this = reinterpret_cast<scripting::Text*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->fade_in(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'fade_in'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Text_fade_out_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'fade_out' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Text* _this = reinterpret_cast<scripting::Text*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->fade_out(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'fade_out'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Text_grow_in_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'grow_in' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Text* _this = reinterpret_cast<scripting::Text*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->grow_in(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'grow_in'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Text_grow_out_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'grow_out' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Text* _this = reinterpret_cast<scripting::Text*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->grow_out(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'grow_out'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Text_set_visible_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_visible' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Text* _this = reinterpret_cast<scripting::Text*> (data);
-
-  SQBool arg0;
-  if(SQ_FAILED(sq_getbool(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a bool"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_visible(arg0 == SQTrue);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_visible'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Text_set_centered_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_centered' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Text* _this = reinterpret_cast<scripting::Text*> (data);
-
-  SQBool arg0;
-  if(SQ_FAILED(sq_getbool(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a bool"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_centered(arg0 == SQTrue);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_centered'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Text_set_pos_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_pos' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Text* _this = reinterpret_cast<scripting::Text*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_pos(arg0, arg1);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_pos'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Text_get_pos_x_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_pos_x' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Text* _this = reinterpret_cast<scripting::Text*> (data);
-
-
-  try {
-    float return_value = _this->get_pos_x();
-
-    sq_pushfloat(vm, return_value);
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_pos_x'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Text_get_pos_y_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_pos_y' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Text* _this = reinterpret_cast<scripting::Text*> (data);
-
-
-  try {
-    float return_value = _this->get_pos_y();
-
-    sq_pushfloat(vm, return_value);
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_pos_y'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Text_set_anchor_point_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_anchor_point' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Text* _this = reinterpret_cast<scripting::Text*> (data);
-
-  SQInteger arg0;
-  if(SQ_FAILED(sq_getinteger(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not an integer"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_anchor_point(static_cast<int> (arg0));
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_anchor_point'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Text_get_anchor_point_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_anchor_point' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Text* _this = reinterpret_cast<scripting::Text*> (data);
-
-
-  try {
-    int return_value = _this->get_anchor_point();
-
-    sq_pushinteger(vm, return_value);
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_anchor_point'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Text_set_anchor_offset_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_anchor_offset' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Text* _this = reinterpret_cast<scripting::Text*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_anchor_offset(arg0, arg1);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_anchor_offset'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Text_set_front_fill_color_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_front_fill_color' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Text* _this = reinterpret_cast<scripting::Text*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg2;
-  if(SQ_FAILED(sq_getfloat(vm, 4, &arg2))) {
-    sq_throwerror(vm, _SC("Argument 3 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg3;
-  if(SQ_FAILED(sq_getfloat(vm, 5, &arg3))) {
-    sq_throwerror(vm, _SC("Argument 4 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_front_fill_color(arg0, arg1, arg2, arg3);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_front_fill_color'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Text_set_back_fill_color_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_back_fill_color' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Text* _this = reinterpret_cast<scripting::Text*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg2;
-  if(SQ_FAILED(sq_getfloat(vm, 4, &arg2))) {
-    sq_throwerror(vm, _SC("Argument 3 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg3;
-  if(SQ_FAILED(sq_getfloat(vm, 5, &arg3))) {
-    sq_throwerror(vm, _SC("Argument 4 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_back_fill_color(arg0, arg1, arg2, arg3);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_back_fill_color'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Text_set_text_color_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_text_color' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Text* _this = reinterpret_cast<scripting::Text*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg2;
-  if(SQ_FAILED(sq_getfloat(vm, 4, &arg2))) {
-    sq_throwerror(vm, _SC("Argument 3 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg3;
-  if(SQ_FAILED(sq_getfloat(vm, 5, &arg3))) {
-    sq_throwerror(vm, _SC("Argument 4 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_text_color(arg0, arg1, arg2, arg3);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_text_color'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Text_set_roundness_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_roundness' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Text* _this = reinterpret_cast<scripting::Text*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_roundness(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_roundness'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger TextArray_release_hook(SQUserPointer ptr, SQInteger )
-{
-  scripting::TextArray* _this = reinterpret_cast<scripting::TextArray*> (ptr);
-  delete _this;
-  return 0;
-}
-
-static SQInteger TextArray_clear_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'clear' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::TextArray* _this = reinterpret_cast<scripting::TextArray*> (data);
-
-
-  try {
-    _this->clear();
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'clear'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger TextArray_add_text_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'add_text' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::TextArray* _this = reinterpret_cast<scripting::TextArray*> (data);
-
-  const SQChar* arg0;
-  if(SQ_FAILED(sq_getstring(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a string"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->add_text(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'add_text'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger TextArray_add_text_duration_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'add_text_duration' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::TextArray* _this = reinterpret_cast<scripting::TextArray*> (data);
-
-  const SQChar* arg0;
-  if(SQ_FAILED(sq_getstring(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a string"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->add_text_duration(arg0, arg1);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'add_text_duration'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger TextArray_set_text_index_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_text_index' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::TextArray* _this = reinterpret_cast<scripting::TextArray*> (data);
-
-  SQInteger arg0;
-  if(SQ_FAILED(sq_getinteger(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not an integer"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_text_index(static_cast<int> (arg0));
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_text_index'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger TextArray_set_keep_visible_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_keep_visible' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::TextArray* _this = reinterpret_cast<scripting::TextArray*> (data);
-
-  SQBool arg0;
-  if(SQ_FAILED(sq_getbool(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a bool"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_keep_visible(arg0 == SQTrue);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_keep_visible'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger TextArray_set_fade_transition_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_fade_transition' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::TextArray* _this = reinterpret_cast<scripting::TextArray*> (data);
-
-  SQBool arg0;
-  if(SQ_FAILED(sq_getbool(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a bool"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_fade_transition(arg0 == SQTrue);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_fade_transition'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger TextArray_set_fade_time_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_fade_time' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::TextArray* _this = reinterpret_cast<scripting::TextArray*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_fade_time(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_fade_time'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger TextArray_set_done_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_done' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::TextArray* _this = reinterpret_cast<scripting::TextArray*> (data);
-
-  SQBool arg0;
-  if(SQ_FAILED(sq_getbool(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a bool"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_done(arg0 == SQTrue);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_done'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger TextArray_set_auto_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_auto' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::TextArray* _this = reinterpret_cast<scripting::TextArray*> (data);
-
-  SQBool arg0;
-  if(SQ_FAILED(sq_getbool(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a bool"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_auto(arg0 == SQTrue);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_auto'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger TextArray_next_text_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'next_text' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::TextArray* _this = reinterpret_cast<scripting::TextArray*> (data);
-
-
-  try {
-    _this->next_text();
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'next_text'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger TextArray_prev_text_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'prev_text' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::TextArray* _this = reinterpret_cast<scripting::TextArray*> (data);
-
-
-  try {
-    _this->prev_text();
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'prev_text'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger TextArray_set_text_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_text' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::TextArray* _this = reinterpret_cast<scripting::TextArray*> (data);
-
-  const SQChar* arg0;
-  if(SQ_FAILED(sq_getstring(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a string"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_text(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_text'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger TextArray_set_font_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_font' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::TextArray* _this = reinterpret_cast<scripting::TextArray*> (data);
-
-  const SQChar* arg0;
-  if(SQ_FAILED(sq_getstring(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a string"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_font(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_font'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger TextArray_fade_in_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'fade_in' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::TextArray* _this = reinterpret_cast<scripting::TextArray*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->fade_in(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'fade_in'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger TextArray_fade_out_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'fade_out' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::TextArray* _this = reinterpret_cast<scripting::TextArray*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->fade_out(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'fade_out'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger TextArray_grow_in_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'grow_in' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::TextArray* _this = reinterpret_cast<scripting::TextArray*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->grow_in(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'grow_in'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger TextArray_grow_out_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'grow_out' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::TextArray* _this = reinterpret_cast<scripting::TextArray*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->grow_out(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'grow_out'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger TextArray_set_visible_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_visible' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::TextArray* _this = reinterpret_cast<scripting::TextArray*> (data);
-
-  SQBool arg0;
-  if(SQ_FAILED(sq_getbool(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a bool"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_visible(arg0 == SQTrue);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_visible'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger TextArray_set_centered_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_centered' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::TextArray* _this = reinterpret_cast<scripting::TextArray*> (data);
-
-  SQBool arg0;
-  if(SQ_FAILED(sq_getbool(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a bool"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_centered(arg0 == SQTrue);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_centered'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger TextArray_set_pos_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_pos' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::TextArray* _this = reinterpret_cast<scripting::TextArray*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_pos(arg0, arg1);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_pos'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger TextArray_get_pos_x_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_pos_x' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::TextArray* _this = reinterpret_cast<scripting::TextArray*> (data);
-
-
-  try {
-    float return_value = _this->get_pos_x();
-
-    sq_pushfloat(vm, return_value);
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_pos_x'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger TextArray_get_pos_y_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_pos_y' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::TextArray* _this = reinterpret_cast<scripting::TextArray*> (data);
-
-
-  try {
-    float return_value = _this->get_pos_y();
-
-    sq_pushfloat(vm, return_value);
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_pos_y'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger TextArray_set_anchor_point_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_anchor_point' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::TextArray* _this = reinterpret_cast<scripting::TextArray*> (data);
-
-  SQInteger arg0;
-  if(SQ_FAILED(sq_getinteger(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not an integer"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_anchor_point(static_cast<int> (arg0));
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_anchor_point'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger TextArray_get_anchor_point_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_anchor_point' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::TextArray* _this = reinterpret_cast<scripting::TextArray*> (data);
-
-
-  try {
-    int return_value = _this->get_anchor_point();
-
-    sq_pushinteger(vm, return_value);
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_anchor_point'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger TextArray_set_anchor_offset_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_anchor_offset' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::TextArray* _this = reinterpret_cast<scripting::TextArray*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_anchor_offset(arg0, arg1);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_anchor_offset'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger TextArray_set_front_fill_color_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_front_fill_color' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::TextArray* _this = reinterpret_cast<scripting::TextArray*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg2;
-  if(SQ_FAILED(sq_getfloat(vm, 4, &arg2))) {
-    sq_throwerror(vm, _SC("Argument 3 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg3;
-  if(SQ_FAILED(sq_getfloat(vm, 5, &arg3))) {
-    sq_throwerror(vm, _SC("Argument 4 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_front_fill_color(arg0, arg1, arg2, arg3);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_front_fill_color'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger TextArray_set_back_fill_color_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_back_fill_color' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::TextArray* _this = reinterpret_cast<scripting::TextArray*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg2;
-  if(SQ_FAILED(sq_getfloat(vm, 4, &arg2))) {
-    sq_throwerror(vm, _SC("Argument 3 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg3;
-  if(SQ_FAILED(sq_getfloat(vm, 5, &arg3))) {
-    sq_throwerror(vm, _SC("Argument 4 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_back_fill_color(arg0, arg1, arg2, arg3);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_back_fill_color'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger TextArray_set_text_color_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_text_color' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::TextArray* _this = reinterpret_cast<scripting::TextArray*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg2;
-  if(SQ_FAILED(sq_getfloat(vm, 4, &arg2))) {
-    sq_throwerror(vm, _SC("Argument 3 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg3;
-  if(SQ_FAILED(sq_getfloat(vm, 5, &arg3))) {
-    sq_throwerror(vm, _SC("Argument 4 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_text_color(arg0, arg1, arg2, arg3);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_text_color'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger TextArray_set_roundness_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_roundness' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::TextArray* _this = reinterpret_cast<scripting::TextArray*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_roundness(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_roundness'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Thunderstorm_release_hook(SQUserPointer ptr, SQInteger )
-{
-  scripting::Thunderstorm* _this = reinterpret_cast<scripting::Thunderstorm*> (ptr);
-  delete _this;
-  return 0;
-}
-
-static SQInteger Thunderstorm_start_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'start' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Thunderstorm* _this = reinterpret_cast<scripting::Thunderstorm*> (data);
-
-
-  try {
-    _this->start();
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'start'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Thunderstorm_stop_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'stop' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Thunderstorm* _this = reinterpret_cast<scripting::Thunderstorm*> (data);
-
-
-  try {
-    _this->stop();
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'stop'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Thunderstorm_thunder_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'thunder' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Thunderstorm* _this = reinterpret_cast<scripting::Thunderstorm*> (data);
-
-
-  try {
-    _this->thunder();
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'thunder'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Thunderstorm_lightning_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'lightning' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Thunderstorm* _this = reinterpret_cast<scripting::Thunderstorm*> (data);
-
-
-  try {
-    _this->lightning();
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'lightning'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Thunderstorm_flash_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'flash' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Thunderstorm* _this = reinterpret_cast<scripting::Thunderstorm*> (data);
-
-
-  try {
-    _this->flash();
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'flash'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Thunderstorm_electrify_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'electrify' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Thunderstorm* _this = reinterpret_cast<scripting::Thunderstorm*> (data);
-
-
-  try {
-    _this->electrify();
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'electrify'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger TileMap_release_hook(SQUserPointer ptr, SQInteger )
-{
-  scripting::TileMap* _this = reinterpret_cast<scripting::TileMap*> (ptr);
-  delete _this;
-  return 0;
-}
-
-static SQInteger TileMap_goto_node_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'goto_node' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::TileMap* _this = reinterpret_cast<scripting::TileMap*> (data);
-
-  SQInteger arg0;
-  if(SQ_FAILED(sq_getinteger(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not an integer"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->goto_node(static_cast<int> (arg0));
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'goto_node'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger TileMap_set_node_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_node' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::TileMap* _this = reinterpret_cast<scripting::TileMap*> (data);
-
-  SQInteger arg0;
-  if(SQ_FAILED(sq_getinteger(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not an integer"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_node(static_cast<int> (arg0));
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_node'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger TileMap_start_moving_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'start_moving' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::TileMap* _this = reinterpret_cast<scripting::TileMap*> (data);
-
-
-  try {
-    _this->start_moving();
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'start_moving'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger TileMap_stop_moving_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'stop_moving' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::TileMap* _this = reinterpret_cast<scripting::TileMap*> (data);
-
-
-  try {
-    _this->stop_moving();
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'stop_moving'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger TileMap_get_tile_id_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_tile_id' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::TileMap* _this = reinterpret_cast<scripting::TileMap*> (data);
-
-  SQInteger arg0;
-  if(SQ_FAILED(sq_getinteger(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not an integer"));
-    return SQ_ERROR;
-  }
-  SQInteger arg1;
-  if(SQ_FAILED(sq_getinteger(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not an integer"));
-    return SQ_ERROR;
-  }
-
-  try {
-    int return_value = _this->get_tile_id(static_cast<int> (arg0), static_cast<int> (arg1));
-
-    sq_pushinteger(vm, return_value);
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_tile_id'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger TileMap_get_tile_id_at_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_tile_id_at' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::TileMap* _this = reinterpret_cast<scripting::TileMap*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    int return_value = _this->get_tile_id_at(arg0, arg1);
-
-    sq_pushinteger(vm, return_value);
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_tile_id_at'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger TileMap_change_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'change' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::TileMap* _this = reinterpret_cast<scripting::TileMap*> (data);
-
-  SQInteger arg0;
-  if(SQ_FAILED(sq_getinteger(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not an integer"));
-    return SQ_ERROR;
-  }
-  SQInteger arg1;
-  if(SQ_FAILED(sq_getinteger(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not an integer"));
-    return SQ_ERROR;
-  }
-  SQInteger arg2;
-  if(SQ_FAILED(sq_getinteger(vm, 4, &arg2))) {
-    sq_throwerror(vm, _SC("Argument 3 not an integer"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->change(static_cast<int> (arg0), static_cast<int> (arg1), static_cast<int> (arg2));
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'change'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger TileMap_change_at_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'change_at' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::TileMap* _this = reinterpret_cast<scripting::TileMap*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-  SQInteger arg2;
-  if(SQ_FAILED(sq_getinteger(vm, 4, &arg2))) {
-    sq_throwerror(vm, _SC("Argument 3 not an integer"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->change_at(arg0, arg1, static_cast<int> (arg2));
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'change_at'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger TileMap_fade_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'fade' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::TileMap* _this = reinterpret_cast<scripting::TileMap*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->fade(arg0, arg1);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'fade'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger TileMap_tint_fade_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'tint_fade' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::TileMap* _this = reinterpret_cast<scripting::TileMap*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg2;
-  if(SQ_FAILED(sq_getfloat(vm, 4, &arg2))) {
-    sq_throwerror(vm, _SC("Argument 3 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg3;
-  if(SQ_FAILED(sq_getfloat(vm, 5, &arg3))) {
-    sq_throwerror(vm, _SC("Argument 4 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg4;
-  if(SQ_FAILED(sq_getfloat(vm, 6, &arg4))) {
-    sq_throwerror(vm, _SC("Argument 5 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->tint_fade(arg0, arg1, arg2, arg3, arg4);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'tint_fade'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger TileMap_set_alpha_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_alpha' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::TileMap* _this = reinterpret_cast<scripting::TileMap*> (data);
-
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_alpha(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_alpha'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger TileMap_get_alpha_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_alpha' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::TileMap* _this = reinterpret_cast<scripting::TileMap*> (data);
-
-
-  try {
-    float return_value = _this->get_alpha();
-
-    sq_pushfloat(vm, return_value);
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_alpha'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger TileMap_set_solid_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_solid' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::TileMap* _this = reinterpret_cast<scripting::TileMap*> (data);
-
-  SQBool arg0;
-  if(SQ_FAILED(sq_getbool(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a bool"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_solid(arg0 == SQTrue);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_solid'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Torch_release_hook(SQUserPointer ptr, SQInteger )
-{
-  scripting::Torch* _this = reinterpret_cast<scripting::Torch*> (ptr);
-  delete _this;
-  return 0;
-}
-
-static SQInteger Torch_get_burning_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_burning' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Torch* _this = reinterpret_cast<scripting::Torch*> (data);
-
-
-  try {
-    bool return_value = _this->get_burning();
-
-    sq_pushbool(vm, return_value);
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_burning'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Torch_set_burning_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_burning' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Torch* _this = reinterpret_cast<scripting::Torch*> (data);
-
-  SQBool arg0;
-  if(SQ_FAILED(sq_getbool(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a bool"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_burning(arg0 == SQTrue);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_burning'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger WillOWisp_release_hook(SQUserPointer ptr, SQInteger )
-{
-  scripting::WillOWisp* _this = reinterpret_cast<scripting::WillOWisp*> (ptr);
-  delete _this;
-  return 0;
-}
-
-static SQInteger WillOWisp_goto_node_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'goto_node' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::WillOWisp* _this = reinterpret_cast<scripting::WillOWisp*> (data);
-
-  SQInteger arg0;
-  if(SQ_FAILED(sq_getinteger(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not an integer"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->goto_node(static_cast<int> (arg0));
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'goto_node'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger WillOWisp_set_state_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'set_state' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::WillOWisp* _this = reinterpret_cast<scripting::WillOWisp*> (data);
-
-  const SQChar* arg0;
-  if(SQ_FAILED(sq_getstring(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a string"));
-    return SQ_ERROR;
-  }
-
-  try {
-    _this->set_state(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_state'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger WillOWisp_start_moving_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'start_moving' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::WillOWisp* _this = reinterpret_cast<scripting::WillOWisp*> (data);
-
-
-  try {
-    _this->start_moving();
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'start_moving'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger WillOWisp_stop_moving_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'stop_moving' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::WillOWisp* _this = reinterpret_cast<scripting::WillOWisp*> (data);
-
-
-  try {
-    _this->stop_moving();
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'stop_moving'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Wind_release_hook(SQUserPointer ptr, SQInteger )
-{
-  scripting::Wind* _this = reinterpret_cast<scripting::Wind*> (ptr);
-  delete _this;
-  return 0;
-}
-
-static SQInteger Wind_start_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'start' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Wind* _this = reinterpret_cast<scripting::Wind*> (data);
-
-
-  try {
-    _this->start();
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'start'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Wind_stop_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'stop' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::Wind* _this = reinterpret_cast<scripting::Wind*> (data);
-
-
-  try {
-    _this->stop();
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'stop'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger WorldMap_release_hook(SQUserPointer ptr, SQInteger )
-{
-  scripting::WorldMap* _this = reinterpret_cast<scripting::WorldMap*> (ptr);
-  delete _this;
-  return 0;
-}
-
-static SQInteger WorldMap_get_tux_x_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_tux_x' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::WorldMap* _this = reinterpret_cast<scripting::WorldMap*> (data);
-
-
-  try {
-    float return_value = _this->get_tux_x();
-
-    sq_pushfloat(vm, return_value);
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_tux_x'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger WorldMap_get_tux_y_wrapper(HSQUIRRELVM vm)
-{
-  SQUserPointer data;
-  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
-    sq_throwerror(vm, _SC("'get_tux_y' called without instance"));
-    return SQ_ERROR;
-  }
-  scripting::WorldMap* _this = reinterpret_cast<scripting::WorldMap*> (data);
-
-
-  try {
-    float return_value = _this->get_tux_y();
-
-    sq_pushfloat(vm, return_value);
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_tux_y'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger display_wrapper(HSQUIRRELVM vm)
-{
-  return scripting::display(vm);
-}
-
-static SQInteger print_stacktrace_wrapper(HSQUIRRELVM vm)
-{
-  HSQUIRRELVM arg0 = vm;
-
-  try {
-    scripting::print_stacktrace(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'print_stacktrace'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger get_current_thread_wrapper(HSQUIRRELVM vm)
-{
-  return scripting::get_current_thread(vm);
-}
-
-static SQInteger is_christmas_wrapper(HSQUIRRELVM vm)
-{
-
-  try {
-    bool return_value = scripting::is_christmas();
-
-    sq_pushbool(vm, return_value);
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'is_christmas'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger display_text_file_wrapper(HSQUIRRELVM vm)
-{
-  const SQChar* arg0;
-  if(SQ_FAILED(sq_getstring(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a string"));
-    return SQ_ERROR;
-  }
-
-  try {
-    scripting::display_text_file(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'display_text_file'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger load_worldmap_wrapper(HSQUIRRELVM vm)
-{
-  const SQChar* arg0;
-  if(SQ_FAILED(sq_getstring(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a string"));
-    return SQ_ERROR;
-  }
-
-  try {
-    scripting::load_worldmap(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'load_worldmap'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger set_next_worldmap_wrapper(HSQUIRRELVM vm)
-{
-  const SQChar* arg0;
-  if(SQ_FAILED(sq_getstring(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a string"));
-    return SQ_ERROR;
-  }
-  const SQChar* arg1;
-  if(SQ_FAILED(sq_getstring(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a string"));
-    return SQ_ERROR;
-  }
-
-  try {
-    scripting::set_next_worldmap(arg0, arg1);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_next_worldmap'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger load_level_wrapper(HSQUIRRELVM vm)
-{
-  const SQChar* arg0;
-  if(SQ_FAILED(sq_getstring(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a string"));
-    return SQ_ERROR;
-  }
-
-  try {
-    scripting::load_level(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'load_level'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger start_cutscene_wrapper(HSQUIRRELVM vm)
-{
-  (void) vm;
-
-  try {
-    scripting::start_cutscene();
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'start_cutscene'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger end_cutscene_wrapper(HSQUIRRELVM vm)
-{
-  (void) vm;
-
-  try {
-    scripting::end_cutscene();
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'end_cutscene'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger check_cutscene_wrapper(HSQUIRRELVM vm)
-{
-
-  try {
-    bool return_value = scripting::check_cutscene();
-
-    sq_pushbool(vm, return_value);
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'check_cutscene'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger wait_wrapper(HSQUIRRELVM vm)
-{
-  HSQUIRRELVM arg0 = vm;
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    scripting::wait(arg0, arg1);
-
-    return sq_suspendvm(vm);
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'wait'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger wait_for_screenswitch_wrapper(HSQUIRRELVM vm)
-{
-  HSQUIRRELVM arg0 = vm;
-
-  try {
-    scripting::wait_for_screenswitch(arg0);
-
-    return sq_suspendvm(vm);
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'wait_for_screenswitch'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger exit_screen_wrapper(HSQUIRRELVM vm)
-{
-  (void) vm;
-
-  try {
-    scripting::exit_screen();
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'exit_screen'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger translate_wrapper(HSQUIRRELVM vm)
-{
-  const SQChar* arg0;
-  if(SQ_FAILED(sq_getstring(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a string"));
-    return SQ_ERROR;
-  }
-
-  try {
-    std::string return_value = scripting::translate(arg0);
-
-    assert(return_value.size() < static_cast<size_t>(std::numeric_limits<SQInteger>::max()));
-    sq_pushstring(vm, return_value.c_str(), static_cast<SQInteger>(return_value.size()));
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'translate'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger __wrapper(HSQUIRRELVM vm)
-{
-  const SQChar* arg0;
-  if(SQ_FAILED(sq_getstring(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a string"));
-    return SQ_ERROR;
-  }
-
-  try {
-    std::string return_value = scripting::_(arg0);
-
-    assert(return_value.size() < static_cast<size_t>(std::numeric_limits<SQInteger>::max()));
-    sq_pushstring(vm, return_value.c_str(), static_cast<SQInteger>(return_value.size()));
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function '_'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger translate_plural_wrapper(HSQUIRRELVM vm)
-{
-  const SQChar* arg0;
-  if(SQ_FAILED(sq_getstring(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a string"));
-    return SQ_ERROR;
-  }
-  const SQChar* arg1;
-  if(SQ_FAILED(sq_getstring(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a string"));
-    return SQ_ERROR;
-  }
-  SQInteger arg2;
-  if(SQ_FAILED(sq_getinteger(vm, 4, &arg2))) {
-    sq_throwerror(vm, _SC("Argument 3 not an integer"));
-    return SQ_ERROR;
-  }
-
-  try {
-    std::string return_value = scripting::translate_plural(arg0, arg1, static_cast<int> (arg2));
-
-    assert(return_value.size() < static_cast<size_t>(std::numeric_limits<SQInteger>::max()));
-    sq_pushstring(vm, return_value.c_str(), static_cast<SQInteger>(return_value.size()));
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'translate_plural'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger ___wrapper(HSQUIRRELVM vm)
-{
-  const SQChar* arg0;
-  if(SQ_FAILED(sq_getstring(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a string"));
-    return SQ_ERROR;
-  }
-  const SQChar* arg1;
-  if(SQ_FAILED(sq_getstring(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a string"));
-    return SQ_ERROR;
-  }
-  SQInteger arg2;
-  if(SQ_FAILED(sq_getinteger(vm, 4, &arg2))) {
-    sq_throwerror(vm, _SC("Argument 3 not an integer"));
-    return SQ_ERROR;
-  }
-
-  try {
-    std::string return_value = scripting::__(arg0, arg1, static_cast<int> (arg2));
-
-    assert(return_value.size() < static_cast<size_t>(std::numeric_limits<SQInteger>::max()));
-    sq_pushstring(vm, return_value.c_str(), static_cast<SQInteger>(return_value.size()));
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function '__'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger import_wrapper(HSQUIRRELVM vm)
-{
-  HSQUIRRELVM arg0 = vm;
-  const SQChar* arg1;
-  if(SQ_FAILED(sq_getstring(vm, 2, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 1 not a string"));
-    return SQ_ERROR;
-  }
-
-  try {
-    scripting::import(arg0, arg1);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'import'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger save_state_wrapper(HSQUIRRELVM vm)
-{
-  (void) vm;
-
-  try {
-    scripting::save_state();
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'save_state'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger load_state_wrapper(HSQUIRRELVM vm)
-{
-  (void) vm;
-
-  try {
-    scripting::load_state();
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'load_state'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger debug_collrects_wrapper(HSQUIRRELVM vm)
-{
-  SQBool arg0;
-  if(SQ_FAILED(sq_getbool(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a bool"));
-    return SQ_ERROR;
-  }
-
-  try {
-    scripting::debug_collrects(arg0 == SQTrue);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'debug_collrects'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger debug_show_fps_wrapper(HSQUIRRELVM vm)
-{
-  SQBool arg0;
-  if(SQ_FAILED(sq_getbool(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a bool"));
-    return SQ_ERROR;
-  }
-
-  try {
-    scripting::debug_show_fps(arg0 == SQTrue);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'debug_show_fps'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger debug_draw_solids_only_wrapper(HSQUIRRELVM vm)
-{
-  SQBool arg0;
-  if(SQ_FAILED(sq_getbool(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a bool"));
-    return SQ_ERROR;
-  }
-
-  try {
-    scripting::debug_draw_solids_only(arg0 == SQTrue);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'debug_draw_solids_only'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger debug_draw_editor_images_wrapper(HSQUIRRELVM vm)
-{
-  SQBool arg0;
-  if(SQ_FAILED(sq_getbool(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a bool"));
-    return SQ_ERROR;
-  }
-
-  try {
-    scripting::debug_draw_editor_images(arg0 == SQTrue);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'debug_draw_editor_images'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger debug_worldmap_ghost_wrapper(HSQUIRRELVM vm)
-{
-  SQBool arg0;
-  if(SQ_FAILED(sq_getbool(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a bool"));
-    return SQ_ERROR;
-  }
-
-  try {
-    scripting::debug_worldmap_ghost(arg0 == SQTrue);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'debug_worldmap_ghost'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger play_music_wrapper(HSQUIRRELVM vm)
-{
-  const SQChar* arg0;
-  if(SQ_FAILED(sq_getstring(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a string"));
-    return SQ_ERROR;
-  }
-
-  try {
-    scripting::play_music(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'play_music'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger fade_in_music_wrapper(HSQUIRRELVM vm)
-{
-  const SQChar* arg0;
-  if(SQ_FAILED(sq_getstring(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a string"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    scripting::fade_in_music(arg0, arg1);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'fade_in_music'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger stop_music_wrapper(HSQUIRRELVM vm)
-{
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    scripting::stop_music(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'stop_music'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger resume_music_wrapper(HSQUIRRELVM vm)
-{
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    scripting::resume_music(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'resume_music'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger pause_music_wrapper(HSQUIRRELVM vm)
-{
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    scripting::pause_music(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'pause_music'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger play_sound_wrapper(HSQUIRRELVM vm)
-{
-  const SQChar* arg0;
-  if(SQ_FAILED(sq_getstring(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a string"));
-    return SQ_ERROR;
-  }
-
-  try {
-    scripting::play_sound(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'play_sound'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger set_game_speed_wrapper(HSQUIRRELVM vm)
-{
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    scripting::set_game_speed(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_game_speed'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger grease_wrapper(HSQUIRRELVM vm)
-{
-  (void) vm;
-
-  try {
-    scripting::grease();
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'grease'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger invincible_wrapper(HSQUIRRELVM vm)
-{
-  (void) vm;
-
-  try {
-    scripting::invincible();
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'invincible'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger ghost_wrapper(HSQUIRRELVM vm)
-{
-  (void) vm;
-
-  try {
-    scripting::ghost();
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'ghost'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger mortal_wrapper(HSQUIRRELVM vm)
-{
-  (void) vm;
-
-  try {
-    scripting::mortal();
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'mortal'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger restart_wrapper(HSQUIRRELVM vm)
-{
-  (void) vm;
-
-  try {
-    scripting::restart();
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'restart'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger whereami_wrapper(HSQUIRRELVM vm)
-{
-  (void) vm;
-
-  try {
-    scripting::whereami();
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'whereami'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger gotoend_wrapper(HSQUIRRELVM vm)
-{
-  (void) vm;
-
-  try {
-    scripting::gotoend();
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'gotoend'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger warp_wrapper(HSQUIRRELVM vm)
-{
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    scripting::warp(arg0, arg1);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'warp'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger camera_wrapper(HSQUIRRELVM vm)
-{
-  (void) vm;
-
-  try {
-    scripting::camera();
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'camera'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger set_gamma_wrapper(HSQUIRRELVM vm)
-{
-  SQFloat arg0;
-  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    scripting::set_gamma(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_gamma'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger rand_wrapper(HSQUIRRELVM vm)
-{
-
-  try {
-    int return_value = scripting::rand();
-
-    sq_pushinteger(vm, return_value);
-    return 1;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'rand'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger record_demo_wrapper(HSQUIRRELVM vm)
-{
-  const SQChar* arg0;
-  if(SQ_FAILED(sq_getstring(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a string"));
-    return SQ_ERROR;
-  }
-
-  try {
-    scripting::record_demo(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'record_demo'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger play_demo_wrapper(HSQUIRRELVM vm)
-{
-  const SQChar* arg0;
-  if(SQ_FAILED(sq_getstring(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a string"));
-    return SQ_ERROR;
-  }
-
-  try {
-    scripting::play_demo(arg0);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'play_demo'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Level_finish_wrapper(HSQUIRRELVM vm)
-{
-  SQBool arg0;
-  if(SQ_FAILED(sq_getbool(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a bool"));
-    return SQ_ERROR;
-  }
-
-  try {
-    scripting::Level_finish(arg0 == SQTrue);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'Level_finish'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Level_spawn_wrapper(HSQUIRRELVM vm)
-{
-  const SQChar* arg0;
-  if(SQ_FAILED(sq_getstring(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a string"));
-    return SQ_ERROR;
-  }
-  const SQChar* arg1;
-  if(SQ_FAILED(sq_getstring(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a string"));
-    return SQ_ERROR;
-  }
-
-  try {
-    scripting::Level_spawn(arg0, arg1);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'Level_spawn'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Level_set_start_point_wrapper(HSQUIRRELVM vm)
-{
-  const SQChar* arg0;
-  if(SQ_FAILED(sq_getstring(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a string"));
-    return SQ_ERROR;
-  }
-  const SQChar* arg1;
-  if(SQ_FAILED(sq_getstring(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a string"));
-    return SQ_ERROR;
-  }
-
-  try {
-    scripting::Level_set_start_point(arg0, arg1);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'Level_set_start_point'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Level_set_start_pos_wrapper(HSQUIRRELVM vm)
-{
-  const SQChar* arg0;
-  if(SQ_FAILED(sq_getstring(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a string"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg2;
-  if(SQ_FAILED(sq_getfloat(vm, 4, &arg2))) {
-    sq_throwerror(vm, _SC("Argument 3 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    scripting::Level_set_start_pos(arg0, arg1, arg2);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'Level_set_start_pos'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Level_set_respawn_point_wrapper(HSQUIRRELVM vm)
-{
-  const SQChar* arg0;
-  if(SQ_FAILED(sq_getstring(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a string"));
-    return SQ_ERROR;
-  }
-  const SQChar* arg1;
-  if(SQ_FAILED(sq_getstring(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a string"));
-    return SQ_ERROR;
-  }
-
-  try {
-    scripting::Level_set_respawn_point(arg0, arg1);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'Level_set_respawn_point'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Level_set_respawn_pos_wrapper(HSQUIRRELVM vm)
-{
-  const SQChar* arg0;
-  if(SQ_FAILED(sq_getstring(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a string"));
-    return SQ_ERROR;
-  }
-  SQFloat arg1;
-  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
-    sq_throwerror(vm, _SC("Argument 2 not a float"));
-    return SQ_ERROR;
-  }
-  SQFloat arg2;
-  if(SQ_FAILED(sq_getfloat(vm, 4, &arg2))) {
-    sq_throwerror(vm, _SC("Argument 3 not a float"));
-    return SQ_ERROR;
-  }
-
-  try {
-    scripting::Level_set_respawn_pos(arg0, arg1, arg2);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'Level_set_respawn_pos'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Level_flip_vertically_wrapper(HSQUIRRELVM vm)
-{
-  (void) vm;
-
-  try {
-    scripting::Level_flip_vertically();
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'Level_flip_vertically'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Level_toggle_pause_wrapper(HSQUIRRELVM vm)
-{
-  (void) vm;
-
-  try {
-    scripting::Level_toggle_pause();
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'Level_toggle_pause'"));
-    return SQ_ERROR;
-  }
-
-}
-
-static SQInteger Level_edit_wrapper(HSQUIRRELVM vm)
-{
-  SQBool arg0;
-  if(SQ_FAILED(sq_getbool(vm, 2, &arg0))) {
-    sq_throwerror(vm, _SC("Argument 1 not a bool"));
-    return SQ_ERROR;
-  }
-
-  try {
-    scripting::Level_edit(arg0 == SQTrue);
-
-    return 0;
-
-  } catch(std::exception& e) {
-    sq_throwerror(vm, e.what());
-    return SQ_ERROR;
-  } catch(...) {
-    sq_throwerror(vm, _SC("Unexpected exception while executing function 'Level_edit'"));
-    return SQ_ERROR;
-  }
-
-}
-
-} // namespace wrapper
-void create_squirrel_instance(HSQUIRRELVM v, scripting::AmbientSound* object, bool setup_releasehook)
-{
-  using namespace wrapper;
-
-  sq_pushroottable(v);
-  sq_pushstring(v, "AmbientSound", -1);
-  if(SQ_FAILED(sq_get(v, -2))) {
-    std::ostringstream msg;
-    msg << "Couldn't resolved squirrel type 'AmbientSound'";
-    throw SquirrelError(v, msg.str());
-  }
-
-  if(SQ_FAILED(sq_createinstance(v, -1)) || SQ_FAILED(sq_setinstanceup(v, -1, object))) {
-    std::ostringstream msg;
-    msg << "Couldn't setup squirrel instance for object of type 'AmbientSound'";
-    throw SquirrelError(v, msg.str());
-  }
-  sq_remove(v, -2); // remove object name
-
-  if(setup_releasehook) {
-    sq_setreleasehook(v, -1, AmbientSound_release_hook);
-  }
-
-  sq_remove(v, -2); // remove root table
-}
-
-void create_squirrel_instance(HSQUIRRELVM v, scripting::Background* object, bool setup_releasehook)
-{
-  using namespace wrapper;
-
-  sq_pushroottable(v);
-  sq_pushstring(v, "Background", -1);
-  if(SQ_FAILED(sq_get(v, -2))) {
-    std::ostringstream msg;
-    msg << "Couldn't resolved squirrel type 'Background'";
-    throw SquirrelError(v, msg.str());
-  }
-
-  if(SQ_FAILED(sq_createinstance(v, -1)) || SQ_FAILED(sq_setinstanceup(v, -1, object))) {
-    std::ostringstream msg;
-    msg << "Couldn't setup squirrel instance for object of type 'Background'";
-    throw SquirrelError(v, msg.str());
-  }
-  sq_remove(v, -2); // remove object name
-
-  if(setup_releasehook) {
-    sq_setreleasehook(v, -1, Background_release_hook);
-  }
-
-  sq_remove(v, -2); // remove root table
-}
-
-void create_squirrel_instance(HSQUIRRELVM v, scripting::BadGuy* object, bool setup_releasehook)
-{
-  using namespace wrapper;
-
-  sq_pushroottable(v);
-  sq_pushstring(v, "BadGuy", -1);
-  if(SQ_FAILED(sq_get(v, -2))) {
-    std::ostringstream msg;
-    msg << "Couldn't resolved squirrel type 'BadGuy'";
-    throw SquirrelError(v, msg.str());
-  }
-
-  if(SQ_FAILED(sq_createinstance(v, -1)) || SQ_FAILED(sq_setinstanceup(v, -1, object))) {
-    std::ostringstream msg;
-    msg << "Couldn't setup squirrel instance for object of type 'BadGuy'";
-    throw SquirrelError(v, msg.str());
-  }
-  sq_remove(v, -2); // remove object name
-
-  if(setup_releasehook) {
-    sq_setreleasehook(v, -1, BadGuy_release_hook);
-  }
-
-  sq_remove(v, -2); // remove root table
-}
-
-void create_squirrel_instance(HSQUIRRELVM v, scripting::Camera* object, bool setup_releasehook)
-{
-  using namespace wrapper;
-
-  sq_pushroottable(v);
-  sq_pushstring(v, "Camera", -1);
-  if(SQ_FAILED(sq_get(v, -2))) {
-    std::ostringstream msg;
-    msg << "Couldn't resolved squirrel type 'Camera'";
-    throw SquirrelError(v, msg.str());
-  }
-
-  if(SQ_FAILED(sq_createinstance(v, -1)) || SQ_FAILED(sq_setinstanceup(v, -1, object))) {
-    std::ostringstream msg;
-    msg << "Couldn't setup squirrel instance for object of type 'Camera'";
-    throw SquirrelError(v, msg.str());
-  }
-  sq_remove(v, -2); // remove object name
-
-  if(setup_releasehook) {
-    sq_setreleasehook(v, -1, Camera_release_hook);
-  }
-
-  sq_remove(v, -2); // remove root table
-}
-
-void create_squirrel_instance(HSQUIRRELVM v, scripting::Candle* object, bool setup_releasehook)
-{
-  using namespace wrapper;
-
-  sq_pushroottable(v);
-  sq_pushstring(v, "Candle", -1);
-  if(SQ_FAILED(sq_get(v, -2))) {
-    std::ostringstream msg;
-    msg << "Couldn't resolved squirrel type 'Candle'";
-    throw SquirrelError(v, msg.str());
-  }
-
-  if(SQ_FAILED(sq_createinstance(v, -1)) || SQ_FAILED(sq_setinstanceup(v, -1, object))) {
-    std::ostringstream msg;
-    msg << "Couldn't setup squirrel instance for object of type 'Candle'";
-    throw SquirrelError(v, msg.str());
-  }
-  sq_remove(v, -2); // remove object name
-
-  if(setup_releasehook) {
-    sq_setreleasehook(v, -1, Candle_release_hook);
-  }
-
-  sq_remove(v, -2); // remove root table
-}
-
-void create_squirrel_instance(HSQUIRRELVM v, scripting::Clouds* object, bool setup_releasehook)
-{
-  using namespace wrapper;
-
-  sq_pushroottable(v);
-  sq_pushstring(v, "Clouds", -1);
-  if(SQ_FAILED(sq_get(v, -2))) {
-    std::ostringstream msg;
-    msg << "Couldn't resolved squirrel type 'Clouds'";
-    throw SquirrelError(v, msg.str());
-  }
-
-  if(SQ_FAILED(sq_createinstance(v, -1)) || SQ_FAILED(sq_setinstanceup(v, -1, object))) {
-    std::ostringstream msg;
-    msg << "Couldn't setup squirrel instance for object of type 'Clouds'";
-    throw SquirrelError(v, msg.str());
-  }
-  sq_remove(v, -2); // remove object name
-
-  if(setup_releasehook) {
-    sq_setreleasehook(v, -1, Clouds_release_hook);
-  }
-
-  sq_remove(v, -2); // remove root table
-}
-
-void create_squirrel_instance(HSQUIRRELVM v, scripting::CustomParticles* object, bool setup_releasehook)
-{
-  using namespace wrapper;
-
-  sq_pushroottable(v);
-  sq_pushstring(v, "CustomParticles", -1);
-  if(SQ_FAILED(sq_get(v, -2))) {
-    std::ostringstream msg;
-    msg << "Couldn't resolved squirrel type 'CustomParticles'";
-    throw SquirrelError(v, msg.str());
-  }
-
-  if(SQ_FAILED(sq_createinstance(v, -1)) || SQ_FAILED(sq_setinstanceup(v, -1, object))) {
-    std::ostringstream msg;
-    msg << "Couldn't setup squirrel instance for object of type 'CustomParticles'";
-    throw SquirrelError(v, msg.str());
-  }
-  sq_remove(v, -2); // remove object name
-
-  if(setup_releasehook) {
-    sq_setreleasehook(v, -1, CustomParticles_release_hook);
-  }
-
-  sq_remove(v, -2); // remove root table
-}
-
-void create_squirrel_instance(HSQUIRRELVM v, scripting::Decal* object, bool setup_releasehook)
-{
-  using namespace wrapper;
-
-  sq_pushroottable(v);
-  sq_pushstring(v, "Decal", -1);
-  if(SQ_FAILED(sq_get(v, -2))) {
-    std::ostringstream msg;
-    msg << "Couldn't resolved squirrel type 'Decal'";
-    throw SquirrelError(v, msg.str());
-  }
-
-  if(SQ_FAILED(sq_createinstance(v, -1)) || SQ_FAILED(sq_setinstanceup(v, -1, object))) {
-    std::ostringstream msg;
-    msg << "Couldn't setup squirrel instance for object of type 'Decal'";
-    throw SquirrelError(v, msg.str());
-  }
-  sq_remove(v, -2); // remove object name
-
-  if(setup_releasehook) {
-    sq_setreleasehook(v, -1, Decal_release_hook);
-  }
-
-  sq_remove(v, -2); // remove root table
-}
-
-void create_squirrel_instance(HSQUIRRELVM v, scripting::Dispenser* object, bool setup_releasehook)
-{
-  using namespace wrapper;
-
-  sq_pushroottable(v);
-  sq_pushstring(v, "Dispenser", -1);
-  if(SQ_FAILED(sq_get(v, -2))) {
-    std::ostringstream msg;
-    msg << "Couldn't resolved squirrel type 'Dispenser'";
-    throw SquirrelError(v, msg.str());
-  }
-
-  if(SQ_FAILED(sq_createinstance(v, -1)) || SQ_FAILED(sq_setinstanceup(v, -1, object))) {
-    std::ostringstream msg;
-    msg << "Couldn't setup squirrel instance for object of type 'Dispenser'";
-    throw SquirrelError(v, msg.str());
-  }
-  sq_remove(v, -2); // remove object name
-
-  if(setup_releasehook) {
-    sq_setreleasehook(v, -1, Dispenser_release_hook);
-  }
-
-  sq_remove(v, -2); // remove root table
-}
-
-void create_squirrel_instance(HSQUIRRELVM v, scripting::DisplayEffect* object, bool setup_releasehook)
-{
-  using namespace wrapper;
-
-  sq_pushroottable(v);
-  sq_pushstring(v, "DisplayEffect", -1);
-  if(SQ_FAILED(sq_get(v, -2))) {
-    std::ostringstream msg;
-    msg << "Couldn't resolved squirrel type 'DisplayEffect'";
-    throw SquirrelError(v, msg.str());
-  }
-
-  if(SQ_FAILED(sq_createinstance(v, -1)) || SQ_FAILED(sq_setinstanceup(v, -1, object))) {
-    std::ostringstream msg;
-    msg << "Couldn't setup squirrel instance for object of type 'DisplayEffect'";
-    throw SquirrelError(v, msg.str());
-  }
-  sq_remove(v, -2); // remove object name
-
-  if(setup_releasehook) {
-    sq_setreleasehook(v, -1, DisplayEffect_release_hook);
-  }
-
-  sq_remove(v, -2); // remove root table
-}
-
-void create_squirrel_instance(HSQUIRRELVM v, scripting::FloatingImage* object, bool setup_releasehook)
-{
-  using namespace wrapper;
-
-  sq_pushroottable(v);
-  sq_pushstring(v, "FloatingImage", -1);
-  if(SQ_FAILED(sq_get(v, -2))) {
-    std::ostringstream msg;
-    msg << "Couldn't resolved squirrel type 'FloatingImage'";
-    throw SquirrelError(v, msg.str());
-  }
-
-  if(SQ_FAILED(sq_createinstance(v, -1)) || SQ_FAILED(sq_setinstanceup(v, -1, object))) {
-    std::ostringstream msg;
-    msg << "Couldn't setup squirrel instance for object of type 'FloatingImage'";
-    throw SquirrelError(v, msg.str());
-  }
-  sq_remove(v, -2); // remove object name
-
-  if(setup_releasehook) {
-    sq_setreleasehook(v, -1, FloatingImage_release_hook);
-  }
-
-  sq_remove(v, -2); // remove root table
-}
-
-void create_squirrel_instance(HSQUIRRELVM v, scripting::GameObjectManager* object, bool setup_releasehook)
-{
-  using namespace wrapper;
-
-  sq_pushroottable(v);
-  sq_pushstring(v, "GameObjectManager", -1);
-  if(SQ_FAILED(sq_get(v, -2))) {
-    std::ostringstream msg;
-    msg << "Couldn't resolved squirrel type 'GameObjectManager'";
-    throw SquirrelError(v, msg.str());
-  }
-
-  if(SQ_FAILED(sq_createinstance(v, -1)) || SQ_FAILED(sq_setinstanceup(v, -1, object))) {
-    std::ostringstream msg;
-    msg << "Couldn't setup squirrel instance for object of type 'GameObjectManager'";
-    throw SquirrelError(v, msg.str());
-  }
-  sq_remove(v, -2); // remove object name
-
-  if(setup_releasehook) {
-    sq_setreleasehook(v, -1, GameObjectManager_release_hook);
-  }
-
-  sq_remove(v, -2); // remove root table
-}
-
-void create_squirrel_instance(HSQUIRRELVM v, scripting::Gradient* object, bool setup_releasehook)
-{
-  using namespace wrapper;
-
-  sq_pushroottable(v);
-  sq_pushstring(v, "Gradient", -1);
-  if(SQ_FAILED(sq_get(v, -2))) {
-    std::ostringstream msg;
-    msg << "Couldn't resolved squirrel type 'Gradient'";
-    throw SquirrelError(v, msg.str());
-  }
-
-  if(SQ_FAILED(sq_createinstance(v, -1)) || SQ_FAILED(sq_setinstanceup(v, -1, object))) {
-    std::ostringstream msg;
-    msg << "Couldn't setup squirrel instance for object of type 'Gradient'";
-    throw SquirrelError(v, msg.str());
-  }
-  sq_remove(v, -2); // remove object name
-
-  if(setup_releasehook) {
-    sq_setreleasehook(v, -1, Gradient_release_hook);
-  }
-
-  sq_remove(v, -2); // remove root table
-}
-
-void create_squirrel_instance(HSQUIRRELVM v, scripting::LevelTime* object, bool setup_releasehook)
-{
-  using namespace wrapper;
-
-  sq_pushroottable(v);
-  sq_pushstring(v, "LevelTime", -1);
-  if(SQ_FAILED(sq_get(v, -2))) {
-    std::ostringstream msg;
-    msg << "Couldn't resolved squirrel type 'LevelTime'";
-    throw SquirrelError(v, msg.str());
-  }
-
-  if(SQ_FAILED(sq_createinstance(v, -1)) || SQ_FAILED(sq_setinstanceup(v, -1, object))) {
-    std::ostringstream msg;
-    msg << "Couldn't setup squirrel instance for object of type 'LevelTime'";
-    throw SquirrelError(v, msg.str());
-  }
-  sq_remove(v, -2); // remove object name
-
-  if(setup_releasehook) {
-    sq_setreleasehook(v, -1, LevelTime_release_hook);
-  }
-
-  sq_remove(v, -2); // remove root table
-}
-
-void create_squirrel_instance(HSQUIRRELVM v, scripting::LitObject* object, bool setup_releasehook)
-{
-  using namespace wrapper;
-
-  sq_pushroottable(v);
-  sq_pushstring(v, "LitObject", -1);
-  if(SQ_FAILED(sq_get(v, -2))) {
-    std::ostringstream msg;
-    msg << "Couldn't resolved squirrel type 'LitObject'";
-    throw SquirrelError(v, msg.str());
-  }
-
-  if(SQ_FAILED(sq_createinstance(v, -1)) || SQ_FAILED(sq_setinstanceup(v, -1, object))) {
-    std::ostringstream msg;
-    msg << "Couldn't setup squirrel instance for object of type 'LitObject'";
-    throw SquirrelError(v, msg.str());
-  }
-  sq_remove(v, -2); // remove object name
-
-  if(setup_releasehook) {
-    sq_setreleasehook(v, -1, LitObject_release_hook);
-  }
-
-  sq_remove(v, -2); // remove root table
-}
-
-void create_squirrel_instance(HSQUIRRELVM v, scripting::ParticleSystem* object, bool setup_releasehook)
-{
-  using namespace wrapper;
-
-  sq_pushroottable(v);
-  sq_pushstring(v, "ParticleSystem", -1);
-  if(SQ_FAILED(sq_get(v, -2))) {
-    std::ostringstream msg;
-    msg << "Couldn't resolved squirrel type 'ParticleSystem'";
-    throw SquirrelError(v, msg.str());
-  }
-
-  if(SQ_FAILED(sq_createinstance(v, -1)) || SQ_FAILED(sq_setinstanceup(v, -1, object))) {
-    std::ostringstream msg;
-    msg << "Couldn't setup squirrel instance for object of type 'ParticleSystem'";
-    throw SquirrelError(v, msg.str());
-  }
-  sq_remove(v, -2); // remove object name
-
-  if(setup_releasehook) {
-    sq_setreleasehook(v, -1, ParticleSystem_release_hook);
-  }
-
-  sq_remove(v, -2); // remove root table
-}
-
-void create_squirrel_instance(HSQUIRRELVM v, scripting::Platform* object, bool setup_releasehook)
-{
-  using namespace wrapper;
-
-  sq_pushroottable(v);
-  sq_pushstring(v, "Platform", -1);
-  if(SQ_FAILED(sq_get(v, -2))) {
-    std::ostringstream msg;
-    msg << "Couldn't resolved squirrel type 'Platform'";
-    throw SquirrelError(v, msg.str());
-  }
-
-  if(SQ_FAILED(sq_createinstance(v, -1)) || SQ_FAILED(sq_setinstanceup(v, -1, object))) {
-    std::ostringstream msg;
-    msg << "Couldn't setup squirrel instance for object of type 'Platform'";
-    throw SquirrelError(v, msg.str());
-  }
-  sq_remove(v, -2); // remove object name
-
-  if(setup_releasehook) {
-    sq_setreleasehook(v, -1, Platform_release_hook);
-  }
-
-  sq_remove(v, -2); // remove root table
-}
-
-void create_squirrel_instance(HSQUIRRELVM v, scripting::Player* object, bool setup_releasehook)
-{
-  using namespace wrapper;
-
-  sq_pushroottable(v);
-  sq_pushstring(v, "Player", -1);
-  if(SQ_FAILED(sq_get(v, -2))) {
-    std::ostringstream msg;
-    msg << "Couldn't resolved squirrel type 'Player'";
-    throw SquirrelError(v, msg.str());
-  }
-
-  if(SQ_FAILED(sq_createinstance(v, -1)) || SQ_FAILED(sq_setinstanceup(v, -1, object))) {
-    std::ostringstream msg;
-    msg << "Couldn't setup squirrel instance for object of type 'Player'";
-    throw SquirrelError(v, msg.str());
-  }
-  sq_remove(v, -2); // remove object name
-
-  if(setup_releasehook) {
-    sq_setreleasehook(v, -1, Player_release_hook);
-  }
-
-  sq_remove(v, -2); // remove root table
-}
-
-void create_squirrel_instance(HSQUIRRELVM v, scripting::Rain* object, bool setup_releasehook)
-{
-  using namespace wrapper;
-
-  sq_pushroottable(v);
-  sq_pushstring(v, "Rain", -1);
-  if(SQ_FAILED(sq_get(v, -2))) {
-    std::ostringstream msg;
-    msg << "Couldn't resolved squirrel type 'Rain'";
-    throw SquirrelError(v, msg.str());
-  }
-
-  if(SQ_FAILED(sq_createinstance(v, -1)) || SQ_FAILED(sq_setinstanceup(v, -1, object))) {
-    std::ostringstream msg;
-    msg << "Couldn't setup squirrel instance for object of type 'Rain'";
-    throw SquirrelError(v, msg.str());
-  }
-  sq_remove(v, -2); // remove object name
-
-  if(setup_releasehook) {
-    sq_setreleasehook(v, -1, Rain_release_hook);
-  }
-
-  sq_remove(v, -2); // remove root table
-}
-
-void create_squirrel_instance(HSQUIRRELVM v, scripting::Rock* object, bool setup_releasehook)
-{
-  using namespace wrapper;
-
-  sq_pushroottable(v);
-  sq_pushstring(v, "Rock", -1);
-  if(SQ_FAILED(sq_get(v, -2))) {
-    std::ostringstream msg;
-    msg << "Couldn't resolved squirrel type 'Rock'";
-    throw SquirrelError(v, msg.str());
-  }
-
-  if(SQ_FAILED(sq_createinstance(v, -1)) || SQ_FAILED(sq_setinstanceup(v, -1, object))) {
-    std::ostringstream msg;
-    msg << "Couldn't setup squirrel instance for object of type 'Rock'";
-    throw SquirrelError(v, msg.str());
-  }
-  sq_remove(v, -2); // remove object name
-
-  if(setup_releasehook) {
-    sq_setreleasehook(v, -1, Rock_release_hook);
-  }
-
-  sq_remove(v, -2); // remove root table
-}
-
-void create_squirrel_instance(HSQUIRRELVM v, scripting::ScriptedObject* object, bool setup_releasehook)
-{
-  using namespace wrapper;
-
-  sq_pushroottable(v);
-  sq_pushstring(v, "ScriptedObject", -1);
-  if(SQ_FAILED(sq_get(v, -2))) {
-    std::ostringstream msg;
-    msg << "Couldn't resolved squirrel type 'ScriptedObject'";
-    throw SquirrelError(v, msg.str());
-  }
-
-  if(SQ_FAILED(sq_createinstance(v, -1)) || SQ_FAILED(sq_setinstanceup(v, -1, object))) {
-    std::ostringstream msg;
-    msg << "Couldn't setup squirrel instance for object of type 'ScriptedObject'";
-    throw SquirrelError(v, msg.str());
-  }
-  sq_remove(v, -2); // remove object name
-
-  if(setup_releasehook) {
-    sq_setreleasehook(v, -1, ScriptedObject_release_hook);
-  }
-
-  sq_remove(v, -2); // remove root table
-}
-
-void create_squirrel_instance(HSQUIRRELVM v, scripting::Sector* object, bool setup_releasehook)
-{
-  using namespace wrapper;
-
-  sq_pushroottable(v);
-  sq_pushstring(v, "Sector", -1);
-  if(SQ_FAILED(sq_get(v, -2))) {
-    std::ostringstream msg;
-    msg << "Couldn't resolved squirrel type 'Sector'";
-    throw SquirrelError(v, msg.str());
-  }
-
-  if(SQ_FAILED(sq_createinstance(v, -1)) || SQ_FAILED(sq_setinstanceup(v, -1, object))) {
-    std::ostringstream msg;
-    msg << "Couldn't setup squirrel instance for object of type 'Sector'";
-    throw SquirrelError(v, msg.str());
-  }
-  sq_remove(v, -2); // remove object name
-
-  if(setup_releasehook) {
-    sq_setreleasehook(v, -1, Sector_release_hook);
-  }
-
-  sq_remove(v, -2); // remove root table
-}
-
-void create_squirrel_instance(HSQUIRRELVM v, scripting::Spotlight* object, bool setup_releasehook)
-{
-  using namespace wrapper;
-
-  sq_pushroottable(v);
-  sq_pushstring(v, "Spotlight", -1);
-  if(SQ_FAILED(sq_get(v, -2))) {
-    std::ostringstream msg;
-    msg << "Couldn't resolved squirrel type 'Spotlight'";
-    throw SquirrelError(v, msg.str());
-  }
-
-  if(SQ_FAILED(sq_createinstance(v, -1)) || SQ_FAILED(sq_setinstanceup(v, -1, object))) {
-    std::ostringstream msg;
-    msg << "Couldn't setup squirrel instance for object of type 'Spotlight'";
-    throw SquirrelError(v, msg.str());
-  }
-  sq_remove(v, -2); // remove object name
-
-  if(setup_releasehook) {
-    sq_setreleasehook(v, -1, Spotlight_release_hook);
-  }
-
-  sq_remove(v, -2); // remove root table
-}
-
-void create_squirrel_instance(HSQUIRRELVM v, scripting::Text* object, bool setup_releasehook)
-{
-  using namespace wrapper;
-
-  sq_pushroottable(v);
-  sq_pushstring(v, "Text", -1);
-  if(SQ_FAILED(sq_get(v, -2))) {
-    std::ostringstream msg;
-    msg << "Couldn't resolved squirrel type 'Text'";
-    throw SquirrelError(v, msg.str());
-  }
-
-  if(SQ_FAILED(sq_createinstance(v, -1)) || SQ_FAILED(sq_setinstanceup(v, -1, object))) {
-    std::ostringstream msg;
-    msg << "Couldn't setup squirrel instance for object of type 'Text'";
-    throw SquirrelError(v, msg.str());
-  }
-  sq_remove(v, -2); // remove object name
-
-  if(setup_releasehook) {
-    sq_setreleasehook(v, -1, Text_release_hook);
-  }
-
-  sq_remove(v, -2); // remove root table
-}
-
-void create_squirrel_instance(HSQUIRRELVM v, scripting::TextArray* object, bool setup_releasehook)
-{
-  using namespace wrapper;
-
-  sq_pushroottable(v);
-  sq_pushstring(v, "TextArray", -1);
-  if(SQ_FAILED(sq_get(v, -2))) {
-    std::ostringstream msg;
-    msg << "Couldn't resolved squirrel type 'TextArray'";
-    throw SquirrelError(v, msg.str());
-  }
-
-  if(SQ_FAILED(sq_createinstance(v, -1)) || SQ_FAILED(sq_setinstanceup(v, -1, object))) {
-    std::ostringstream msg;
-    msg << "Couldn't setup squirrel instance for object of type 'TextArray'";
-    throw SquirrelError(v, msg.str());
-  }
-  sq_remove(v, -2); // remove object name
-
-  if(setup_releasehook) {
-    sq_setreleasehook(v, -1, TextArray_release_hook);
-  }
-
-  sq_remove(v, -2); // remove root table
-}
-
-void create_squirrel_instance(HSQUIRRELVM v, scripting::Thunderstorm* object, bool setup_releasehook)
-{
-  using namespace wrapper;
-
-  sq_pushroottable(v);
-  sq_pushstring(v, "Thunderstorm", -1);
-  if(SQ_FAILED(sq_get(v, -2))) {
-    std::ostringstream msg;
-    msg << "Couldn't resolved squirrel type 'Thunderstorm'";
-    throw SquirrelError(v, msg.str());
-  }
-
-  if(SQ_FAILED(sq_createinstance(v, -1)) || SQ_FAILED(sq_setinstanceup(v, -1, object))) {
-    std::ostringstream msg;
-    msg << "Couldn't setup squirrel instance for object of type 'Thunderstorm'";
-    throw SquirrelError(v, msg.str());
-  }
-  sq_remove(v, -2); // remove object name
-
-  if(setup_releasehook) {
-    sq_setreleasehook(v, -1, Thunderstorm_release_hook);
-  }
-
-  sq_remove(v, -2); // remove root table
-}
-
-void create_squirrel_instance(HSQUIRRELVM v, scripting::TileMap* object, bool setup_releasehook)
-{
-  using namespace wrapper;
-
-  sq_pushroottable(v);
-  sq_pushstring(v, "TileMap", -1);
-  if(SQ_FAILED(sq_get(v, -2))) {
-    std::ostringstream msg;
-    msg << "Couldn't resolved squirrel type 'TileMap'";
-    throw SquirrelError(v, msg.str());
-  }
-
-  if(SQ_FAILED(sq_createinstance(v, -1)) || SQ_FAILED(sq_setinstanceup(v, -1, object))) {
-    std::ostringstream msg;
-    msg << "Couldn't setup squirrel instance for object of type 'TileMap'";
-    throw SquirrelError(v, msg.str());
-  }
-  sq_remove(v, -2); // remove object name
-
-  if(setup_releasehook) {
-    sq_setreleasehook(v, -1, TileMap_release_hook);
-  }
-
-  sq_remove(v, -2); // remove root table
-}
-
-void create_squirrel_instance(HSQUIRRELVM v, scripting::Torch* object, bool setup_releasehook)
-{
-  using namespace wrapper;
-
-  sq_pushroottable(v);
-  sq_pushstring(v, "Torch", -1);
-  if(SQ_FAILED(sq_get(v, -2))) {
-    std::ostringstream msg;
-    msg << "Couldn't resolved squirrel type 'Torch'";
-    throw SquirrelError(v, msg.str());
-  }
-
-  if(SQ_FAILED(sq_createinstance(v, -1)) || SQ_FAILED(sq_setinstanceup(v, -1, object))) {
-    std::ostringstream msg;
-    msg << "Couldn't setup squirrel instance for object of type 'Torch'";
-    throw SquirrelError(v, msg.str());
-  }
-  sq_remove(v, -2); // remove object name
-
-  if(setup_releasehook) {
-    sq_setreleasehook(v, -1, Torch_release_hook);
-  }
-
-  sq_remove(v, -2); // remove root table
-}
-
-void create_squirrel_instance(HSQUIRRELVM v, scripting::WillOWisp* object, bool setup_releasehook)
-{
-  using namespace wrapper;
-
-  sq_pushroottable(v);
-  sq_pushstring(v, "WillOWisp", -1);
-  if(SQ_FAILED(sq_get(v, -2))) {
-    std::ostringstream msg;
-    msg << "Couldn't resolved squirrel type 'WillOWisp'";
-    throw SquirrelError(v, msg.str());
-  }
-
-  if(SQ_FAILED(sq_createinstance(v, -1)) || SQ_FAILED(sq_setinstanceup(v, -1, object))) {
-    std::ostringstream msg;
-    msg << "Couldn't setup squirrel instance for object of type 'WillOWisp'";
-    throw SquirrelError(v, msg.str());
-  }
-  sq_remove(v, -2); // remove object name
-
-  if(setup_releasehook) {
-    sq_setreleasehook(v, -1, WillOWisp_release_hook);
-  }
-
-  sq_remove(v, -2); // remove root table
-}
-
-void create_squirrel_instance(HSQUIRRELVM v, scripting::Wind* object, bool setup_releasehook)
-{
-  using namespace wrapper;
-
-  sq_pushroottable(v);
-  sq_pushstring(v, "Wind", -1);
-  if(SQ_FAILED(sq_get(v, -2))) {
-    std::ostringstream msg;
-    msg << "Couldn't resolved squirrel type 'Wind'";
-    throw SquirrelError(v, msg.str());
-  }
-
-  if(SQ_FAILED(sq_createinstance(v, -1)) || SQ_FAILED(sq_setinstanceup(v, -1, object))) {
-    std::ostringstream msg;
-    msg << "Couldn't setup squirrel instance for object of type 'Wind'";
-    throw SquirrelError(v, msg.str());
-  }
-  sq_remove(v, -2); // remove object name
-
-  if(setup_releasehook) {
-    sq_setreleasehook(v, -1, Wind_release_hook);
-  }
-
-  sq_remove(v, -2); // remove root table
-}
-
-void create_squirrel_instance(HSQUIRRELVM v, scripting::WorldMap* object, bool setup_releasehook)
-{
-  using namespace wrapper;
-
-  sq_pushroottable(v);
-  sq_pushstring(v, "WorldMap", -1);
-  if(SQ_FAILED(sq_get(v, -2))) {
-    std::ostringstream msg;
-    msg << "Couldn't resolved squirrel type 'WorldMap'";
-    throw SquirrelError(v, msg.str());
-  }
-
-  if(SQ_FAILED(sq_createinstance(v, -1)) || SQ_FAILED(sq_setinstanceup(v, -1, object))) {
-    std::ostringstream msg;
-    msg << "Couldn't setup squirrel instance for object of type 'WorldMap'";
-    throw SquirrelError(v, msg.str());
-  }
-  sq_remove(v, -2); // remove object name
-
-  if(setup_releasehook) {
-    sq_setreleasehook(v, -1, WorldMap_release_hook);
-  }
-
-  sq_remove(v, -2); // remove root table
-}
-
-void register_supertux_wrapper(HSQUIRRELVM v)
-{
-  using namespace wrapper;
-
-  sq_pushstring(v, "ANCHOR_TOP_LEFT", -1);
-  sq_pushinteger(v, 0);
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register constant 'ANCHOR_TOP_LEFT'");
-  }
-
-  sq_pushstring(v, "ANCHOR_TOP", -1);
-  sq_pushinteger(v, 1);
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register constant 'ANCHOR_TOP'");
-  }
-
-  sq_pushstring(v, "ANCHOR_TOP_RIGHT", -1);
-  sq_pushinteger(v, 2);
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register constant 'ANCHOR_TOP_RIGHT'");
-  }
-
-  sq_pushstring(v, "ANCHOR_LEFT", -1);
-  sq_pushinteger(v, 3);
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register constant 'ANCHOR_LEFT'");
-  }
-
-  sq_pushstring(v, "ANCHOR_MIDDLE", -1);
-  sq_pushinteger(v, 4);
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register constant 'ANCHOR_MIDDLE'");
-  }
-
-  sq_pushstring(v, "ANCHOR_RIGHT", -1);
-  sq_pushinteger(v, 5);
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register constant 'ANCHOR_RIGHT'");
-  }
-
-  sq_pushstring(v, "ANCHOR_BOTTOM_LEFT", -1);
-  sq_pushinteger(v, 6);
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register constant 'ANCHOR_BOTTOM_LEFT'");
-  }
-
-  sq_pushstring(v, "ANCHOR_BOTTOM", -1);
-  sq_pushinteger(v, 7);
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register constant 'ANCHOR_BOTTOM'");
-  }
-
-  sq_pushstring(v, "ANCHOR_BOTTOM_RIGHT", -1);
-  sq_pushinteger(v, 8);
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register constant 'ANCHOR_BOTTOM_RIGHT'");
-  }
-
-  sq_pushstring(v, "display", -1);
-  sq_newclosure(v, &display_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, "t.");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'display'");
-  }
-
-  sq_pushstring(v, "print_stacktrace", -1);
-  sq_newclosure(v, &print_stacktrace_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'print_stacktrace'");
-  }
-
-  sq_pushstring(v, "get_current_thread", -1);
-  sq_newclosure(v, &get_current_thread_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, "t");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_current_thread'");
-  }
-
-  sq_pushstring(v, "is_christmas", -1);
-  sq_newclosure(v, &is_christmas_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'is_christmas'");
-  }
-
-  sq_pushstring(v, "display_text_file", -1);
-  sq_newclosure(v, &display_text_file_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".s");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'display_text_file'");
-  }
-
-  sq_pushstring(v, "load_worldmap", -1);
-  sq_newclosure(v, &load_worldmap_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".s");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'load_worldmap'");
-  }
-
-  sq_pushstring(v, "set_next_worldmap", -1);
-  sq_newclosure(v, &set_next_worldmap_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".ss");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_next_worldmap'");
-  }
-
-  sq_pushstring(v, "load_level", -1);
-  sq_newclosure(v, &load_level_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".s");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'load_level'");
-  }
-
-  sq_pushstring(v, "start_cutscene", -1);
-  sq_newclosure(v, &start_cutscene_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'start_cutscene'");
-  }
-
-  sq_pushstring(v, "end_cutscene", -1);
-  sq_newclosure(v, &end_cutscene_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'end_cutscene'");
-  }
-
-  sq_pushstring(v, "check_cutscene", -1);
-  sq_newclosure(v, &check_cutscene_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'check_cutscene'");
-  }
-
-  sq_pushstring(v, "wait", -1);
-  sq_newclosure(v, &wait_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'wait'");
-  }
-
-  sq_pushstring(v, "wait_for_screenswitch", -1);
-  sq_newclosure(v, &wait_for_screenswitch_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'wait_for_screenswitch'");
-  }
-
-  sq_pushstring(v, "exit_screen", -1);
-  sq_newclosure(v, &exit_screen_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'exit_screen'");
-  }
-
-  sq_pushstring(v, "translate", -1);
-  sq_newclosure(v, &translate_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".s");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'translate'");
-  }
-
-  sq_pushstring(v, "_", -1);
-  sq_newclosure(v, &__wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".s");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function '_'");
-  }
-
-  sq_pushstring(v, "translate_plural", -1);
-  sq_newclosure(v, &translate_plural_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".ssb|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'translate_plural'");
-  }
-
-  sq_pushstring(v, "__", -1);
-  sq_newclosure(v, &___wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".ssb|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function '__'");
-  }
-
-  sq_pushstring(v, "import", -1);
-  sq_newclosure(v, &import_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".s");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'import'");
-  }
-
-  sq_pushstring(v, "save_state", -1);
-  sq_newclosure(v, &save_state_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'save_state'");
-  }
-
-  sq_pushstring(v, "load_state", -1);
-  sq_newclosure(v, &load_state_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'load_state'");
-  }
-
-  sq_pushstring(v, "debug_collrects", -1);
-  sq_newclosure(v, &debug_collrects_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'debug_collrects'");
-  }
-
-  sq_pushstring(v, "debug_show_fps", -1);
-  sq_newclosure(v, &debug_show_fps_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'debug_show_fps'");
-  }
-
-  sq_pushstring(v, "debug_draw_solids_only", -1);
-  sq_newclosure(v, &debug_draw_solids_only_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'debug_draw_solids_only'");
-  }
-
-  sq_pushstring(v, "debug_draw_editor_images", -1);
-  sq_newclosure(v, &debug_draw_editor_images_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'debug_draw_editor_images'");
-  }
-
-  sq_pushstring(v, "debug_worldmap_ghost", -1);
-  sq_newclosure(v, &debug_worldmap_ghost_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'debug_worldmap_ghost'");
-  }
-
-  sq_pushstring(v, "play_music", -1);
-  sq_newclosure(v, &play_music_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".s");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'play_music'");
-  }
-
-  sq_pushstring(v, "fade_in_music", -1);
-  sq_newclosure(v, &fade_in_music_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".sb|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'fade_in_music'");
-  }
-
-  sq_pushstring(v, "stop_music", -1);
-  sq_newclosure(v, &stop_music_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'stop_music'");
-  }
-
-  sq_pushstring(v, "resume_music", -1);
-  sq_newclosure(v, &resume_music_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'resume_music'");
-  }
-
-  sq_pushstring(v, "pause_music", -1);
-  sq_newclosure(v, &pause_music_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'pause_music'");
-  }
-
-  sq_pushstring(v, "play_sound", -1);
-  sq_newclosure(v, &play_sound_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".s");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'play_sound'");
-  }
-
-  sq_pushstring(v, "set_game_speed", -1);
-  sq_newclosure(v, &set_game_speed_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_game_speed'");
-  }
-
-  sq_pushstring(v, "grease", -1);
-  sq_newclosure(v, &grease_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'grease'");
-  }
-
-  sq_pushstring(v, "invincible", -1);
-  sq_newclosure(v, &invincible_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'invincible'");
-  }
-
-  sq_pushstring(v, "ghost", -1);
-  sq_newclosure(v, &ghost_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'ghost'");
-  }
-
-  sq_pushstring(v, "mortal", -1);
-  sq_newclosure(v, &mortal_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'mortal'");
-  }
-
-  sq_pushstring(v, "restart", -1);
-  sq_newclosure(v, &restart_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'restart'");
-  }
-
-  sq_pushstring(v, "whereami", -1);
-  sq_newclosure(v, &whereami_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'whereami'");
-  }
-
-  sq_pushstring(v, "gotoend", -1);
-  sq_newclosure(v, &gotoend_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'gotoend'");
-  }
-
-  sq_pushstring(v, "warp", -1);
-  sq_newclosure(v, &warp_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'warp'");
-  }
-
-  sq_pushstring(v, "camera", -1);
-  sq_newclosure(v, &camera_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'camera'");
-  }
-
-  sq_pushstring(v, "set_gamma", -1);
-  sq_newclosure(v, &set_gamma_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_gamma'");
-  }
-
-  sq_pushstring(v, "rand", -1);
-  sq_newclosure(v, &rand_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'rand'");
-  }
-
-  sq_pushstring(v, "record_demo", -1);
-  sq_newclosure(v, &record_demo_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".s");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'record_demo'");
-  }
-
-  sq_pushstring(v, "play_demo", -1);
-  sq_newclosure(v, &play_demo_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".s");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'play_demo'");
-  }
-
-  sq_pushstring(v, "Level_finish", -1);
-  sq_newclosure(v, &Level_finish_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'Level_finish'");
-  }
-
-  sq_pushstring(v, "Level_spawn", -1);
-  sq_newclosure(v, &Level_spawn_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".ss");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'Level_spawn'");
-  }
-
-  sq_pushstring(v, "Level_set_start_point", -1);
-  sq_newclosure(v, &Level_set_start_point_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".ss");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'Level_set_start_point'");
-  }
-
-  sq_pushstring(v, "Level_set_start_pos", -1);
-  sq_newclosure(v, &Level_set_start_pos_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".sb|nb|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'Level_set_start_pos'");
-  }
-
-  sq_pushstring(v, "Level_set_respawn_point", -1);
-  sq_newclosure(v, &Level_set_respawn_point_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".ss");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'Level_set_respawn_point'");
-  }
-
-  sq_pushstring(v, "Level_set_respawn_pos", -1);
-  sq_newclosure(v, &Level_set_respawn_pos_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".sb|nb|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'Level_set_respawn_pos'");
-  }
-
-  sq_pushstring(v, "Level_flip_vertically", -1);
-  sq_newclosure(v, &Level_flip_vertically_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'Level_flip_vertically'");
-  }
-
-  sq_pushstring(v, "Level_toggle_pause", -1);
-  sq_newclosure(v, &Level_toggle_pause_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'Level_toggle_pause'");
-  }
-
-  sq_pushstring(v, "Level_edit", -1);
-  sq_newclosure(v, &Level_edit_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'Level_edit'");
-  }
-
-  // Register class AmbientSound
-  sq_pushstring(v, "AmbientSound", -1);
-  if(sq_newclass(v, SQFalse) < 0) {
-    std::ostringstream msg;
-    msg << "Couldn't create new class 'AmbientSound'";
-    throw SquirrelError(v, msg.str());
-  }
-  sq_pushstring(v, "set_pos", -1);
-  sq_newclosure(v, &AmbientSound_set_pos_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_pos'");
-  }
-
-  sq_pushstring(v, "get_pos_x", -1);
-  sq_newclosure(v, &AmbientSound_get_pos_x_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_pos_x'");
-  }
-
-  sq_pushstring(v, "get_pos_y", -1);
-  sq_newclosure(v, &AmbientSound_get_pos_y_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_pos_y'");
-  }
-
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register class 'AmbientSound'");
-  }
-
-  // Register class Background
-  sq_pushstring(v, "Background", -1);
-  if(sq_newclass(v, SQFalse) < 0) {
-    std::ostringstream msg;
-    msg << "Couldn't create new class 'Background'";
-    throw SquirrelError(v, msg.str());
-  }
-  sq_pushstring(v, "set_image", -1);
-  sq_newclosure(v, &Background_set_image_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".s");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_image'");
-  }
-
-  sq_pushstring(v, "set_images", -1);
-  sq_newclosure(v, &Background_set_images_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".sss");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_images'");
-  }
-
-  sq_pushstring(v, "set_speed", -1);
-  sq_newclosure(v, &Background_set_speed_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_speed'");
-  }
-
-  sq_pushstring(v, "get_color_red", -1);
-  sq_newclosure(v, &Background_get_color_red_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_color_red'");
-  }
-
-  sq_pushstring(v, "get_color_green", -1);
-  sq_newclosure(v, &Background_get_color_green_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_color_green'");
-  }
-
-  sq_pushstring(v, "get_color_blue", -1);
-  sq_newclosure(v, &Background_get_color_blue_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_color_blue'");
-  }
-
-  sq_pushstring(v, "get_color_alpha", -1);
-  sq_newclosure(v, &Background_get_color_alpha_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_color_alpha'");
-  }
-
-  sq_pushstring(v, "set_color", -1);
-  sq_newclosure(v, &Background_set_color_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|nb|nb|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_color'");
-  }
-
-  sq_pushstring(v, "fade_color", -1);
-  sq_newclosure(v, &Background_fade_color_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|nb|nb|nb|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'fade_color'");
-  }
-
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register class 'Background'");
-  }
-
-  // Register class BadGuy
-  sq_pushstring(v, "BadGuy", -1);
-  if(sq_newclass(v, SQFalse) < 0) {
-    std::ostringstream msg;
-    msg << "Couldn't create new class 'BadGuy'";
-    throw SquirrelError(v, msg.str());
-  }
-  sq_pushstring(v, "kill", -1);
-  sq_newclosure(v, &BadGuy_kill_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'kill'");
-  }
-
-  sq_pushstring(v, "ignite", -1);
-  sq_newclosure(v, &BadGuy_ignite_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'ignite'");
-  }
-
-  sq_pushstring(v, "set_action", -1);
-  sq_newclosure(v, &BadGuy_set_action_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".sb|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_action'");
-  }
-
-  sq_pushstring(v, "set_sprite", -1);
-  sq_newclosure(v, &BadGuy_set_sprite_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".s");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_sprite'");
-  }
-
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register class 'BadGuy'");
-  }
-
-  // Register class Dispenser
-  sq_pushstring(v, "Dispenser", -1);
-  sq_pushstring(v, "BadGuy", -1);
-  sq_get(v, -3);
-  if(sq_newclass(v, SQTrue) < 0) {
-    std::ostringstream msg;
-    msg << "Couldn't create new class 'Dispenser'";
-    throw SquirrelError(v, msg.str());
-  }
-  sq_pushstring(v, "activate", -1);
-  sq_newclosure(v, &Dispenser_activate_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'activate'");
-  }
-
-  sq_pushstring(v, "deactivate", -1);
-  sq_newclosure(v, &Dispenser_deactivate_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'deactivate'");
-  }
-
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register class 'Dispenser'");
-  }
-
-  // Register class WillOWisp
-  sq_pushstring(v, "WillOWisp", -1);
-  sq_pushstring(v, "BadGuy", -1);
-  sq_get(v, -3);
-  if(sq_newclass(v, SQTrue) < 0) {
-    std::ostringstream msg;
-    msg << "Couldn't create new class 'WillOWisp'";
-    throw SquirrelError(v, msg.str());
-  }
-  sq_pushstring(v, "goto_node", -1);
-  sq_newclosure(v, &WillOWisp_goto_node_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'goto_node'");
-  }
-
-  sq_pushstring(v, "set_state", -1);
-  sq_newclosure(v, &WillOWisp_set_state_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".s");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_state'");
-  }
-
-  sq_pushstring(v, "start_moving", -1);
-  sq_newclosure(v, &WillOWisp_start_moving_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'start_moving'");
-  }
-
-  sq_pushstring(v, "stop_moving", -1);
-  sq_newclosure(v, &WillOWisp_stop_moving_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'stop_moving'");
-  }
-
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register class 'WillOWisp'");
-  }
-
-  // Register class Camera
-  sq_pushstring(v, "Camera", -1);
-  if(sq_newclass(v, SQFalse) < 0) {
-    std::ostringstream msg;
-    msg << "Couldn't create new class 'Camera'";
-    throw SquirrelError(v, msg.str());
-  }
-  sq_pushstring(v, "reload_config", -1);
-  sq_newclosure(v, &Camera_reload_config_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'reload_config'");
-  }
-
-  sq_pushstring(v, "shake", -1);
-  sq_newclosure(v, &Camera_shake_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|nb|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'shake'");
-  }
-
-  sq_pushstring(v, "set_pos", -1);
-  sq_newclosure(v, &Camera_set_pos_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_pos'");
-  }
-
-  sq_pushstring(v, "move", -1);
-  sq_newclosure(v, &Camera_move_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'move'");
-  }
-
-  sq_pushstring(v, "set_mode", -1);
-  sq_newclosure(v, &Camera_set_mode_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".s");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_mode'");
-  }
-
-  sq_pushstring(v, "scroll_to", -1);
-  sq_newclosure(v, &Camera_scroll_to_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|nb|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'scroll_to'");
-  }
-
-  sq_pushstring(v, "get_current_scale", -1);
-  sq_newclosure(v, &Camera_get_current_scale_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_current_scale'");
-  }
-
-  sq_pushstring(v, "get_target_scale", -1);
-  sq_newclosure(v, &Camera_get_target_scale_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_target_scale'");
-  }
-
-  sq_pushstring(v, "set_scale", -1);
-  sq_newclosure(v, &Camera_set_scale_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_scale'");
-  }
-
-  sq_pushstring(v, "scale", -1);
-  sq_newclosure(v, &Camera_scale_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'scale'");
-  }
-
-  sq_pushstring(v, "ease_scale", -1);
-  sq_newclosure(v, &Camera_ease_scale_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|ns");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'ease_scale'");
-  }
-
-  sq_pushstring(v, "get_screen_width", -1);
-  sq_newclosure(v, &Camera_get_screen_width_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_screen_width'");
-  }
-
-  sq_pushstring(v, "get_screen_height", -1);
-  sq_newclosure(v, &Camera_get_screen_height_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_screen_height'");
-  }
-
-  sq_pushstring(v, "get_x", -1);
-  sq_newclosure(v, &Camera_get_x_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_x'");
-  }
-
-  sq_pushstring(v, "get_y", -1);
-  sq_newclosure(v, &Camera_get_y_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_y'");
-  }
-
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register class 'Camera'");
-  }
-
-  // Register class Candle
-  sq_pushstring(v, "Candle", -1);
-  if(sq_newclass(v, SQFalse) < 0) {
-    std::ostringstream msg;
-    msg << "Couldn't create new class 'Candle'";
-    throw SquirrelError(v, msg.str());
-  }
-  sq_pushstring(v, "get_burning", -1);
-  sq_newclosure(v, &Candle_get_burning_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_burning'");
-  }
-
-  sq_pushstring(v, "set_burning", -1);
-  sq_newclosure(v, &Candle_set_burning_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_burning'");
-  }
-
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register class 'Candle'");
-  }
-
-  // Register class Clouds
-  sq_pushstring(v, "Clouds", -1);
-  if(sq_newclass(v, SQFalse) < 0) {
-    std::ostringstream msg;
-    msg << "Couldn't create new class 'Clouds'";
-    throw SquirrelError(v, msg.str());
-  }
-  sq_pushstring(v, "set_enabled", -1);
-  sq_newclosure(v, &Clouds_set_enabled_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_enabled'");
-  }
-
-  sq_pushstring(v, "get_enabled", -1);
-  sq_newclosure(v, &Clouds_get_enabled_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_enabled'");
-  }
-
-  sq_pushstring(v, "fade_speed", -1);
-  sq_newclosure(v, &Clouds_fade_speed_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'fade_speed'");
-  }
-
-  sq_pushstring(v, "fade_amount", -1);
-  sq_newclosure(v, &Clouds_fade_amount_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|nb|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'fade_amount'");
-  }
-
-  sq_pushstring(v, "set_amount", -1);
-  sq_newclosure(v, &Clouds_set_amount_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_amount'");
-  }
-
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register class 'Clouds'");
-  }
-
-  // Register class CustomParticles
-  sq_pushstring(v, "CustomParticles", -1);
-  if(sq_newclass(v, SQFalse) < 0) {
-    std::ostringstream msg;
-    msg << "Couldn't create new class 'CustomParticles'";
-    throw SquirrelError(v, msg.str());
-  }
-  sq_pushstring(v, "set_enabled", -1);
-  sq_newclosure(v, &CustomParticles_set_enabled_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_enabled'");
-  }
-
-  sq_pushstring(v, "get_enabled", -1);
-  sq_newclosure(v, &CustomParticles_get_enabled_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_enabled'");
-  }
-
-  sq_pushstring(v, "clear", -1);
-  sq_newclosure(v, &CustomParticles_clear_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'clear'");
-  }
-
-  sq_pushstring(v, "spawn_particles", -1);
-  sq_newclosure(v, &CustomParticles_spawn_particles_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'spawn_particles'");
-  }
-
-  sq_pushstring(v, "get_max_amount", -1);
-  sq_newclosure(v, &CustomParticles_get_max_amount_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_max_amount'");
-  }
-
-  sq_pushstring(v, "set_max_amount", -1);
-  sq_newclosure(v, &CustomParticles_set_max_amount_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_max_amount'");
-  }
-
-  sq_pushstring(v, "get_birth_mode", -1);
-  sq_newclosure(v, &CustomParticles_get_birth_mode_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_birth_mode'");
-  }
-
-  sq_pushstring(v, "set_birth_mode", -1);
-  sq_newclosure(v, &CustomParticles_set_birth_mode_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".s");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_birth_mode'");
-  }
-
-  sq_pushstring(v, "get_death_mode", -1);
-  sq_newclosure(v, &CustomParticles_get_death_mode_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_death_mode'");
-  }
-
-  sq_pushstring(v, "set_death_mode", -1);
-  sq_newclosure(v, &CustomParticles_set_death_mode_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".s");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_death_mode'");
-  }
-
-  sq_pushstring(v, "get_rotation_mode", -1);
-  sq_newclosure(v, &CustomParticles_get_rotation_mode_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_rotation_mode'");
-  }
-
-  sq_pushstring(v, "set_rotation_mode", -1);
-  sq_newclosure(v, &CustomParticles_set_rotation_mode_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".s");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_rotation_mode'");
-  }
-
-  sq_pushstring(v, "get_collision_mode", -1);
-  sq_newclosure(v, &CustomParticles_get_collision_mode_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_collision_mode'");
-  }
-
-  sq_pushstring(v, "set_collision_mode", -1);
-  sq_newclosure(v, &CustomParticles_set_collision_mode_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".s");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_collision_mode'");
-  }
-
-  sq_pushstring(v, "get_offscreen_mode", -1);
-  sq_newclosure(v, &CustomParticles_get_offscreen_mode_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_offscreen_mode'");
-  }
-
-  sq_pushstring(v, "set_offscreen_mode", -1);
-  sq_newclosure(v, &CustomParticles_set_offscreen_mode_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".s");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_offscreen_mode'");
-  }
-
-  sq_pushstring(v, "get_cover_screen", -1);
-  sq_newclosure(v, &CustomParticles_get_cover_screen_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_cover_screen'");
-  }
-
-  sq_pushstring(v, "set_cover_screen", -1);
-  sq_newclosure(v, &CustomParticles_set_cover_screen_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_cover_screen'");
-  }
-
-  sq_pushstring(v, "get_delay", -1);
-  sq_newclosure(v, &CustomParticles_get_delay_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_delay'");
-  }
-
-  sq_pushstring(v, "set_delay", -1);
-  sq_newclosure(v, &CustomParticles_set_delay_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_delay'");
-  }
-
-  sq_pushstring(v, "fade_delay", -1);
-  sq_newclosure(v, &CustomParticles_fade_delay_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'fade_delay'");
-  }
-
-  sq_pushstring(v, "ease_delay", -1);
-  sq_newclosure(v, &CustomParticles_ease_delay_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|ns");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'ease_delay'");
-  }
-
-  sq_pushstring(v, "get_lifetime", -1);
-  sq_newclosure(v, &CustomParticles_get_lifetime_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_lifetime'");
-  }
-
-  sq_pushstring(v, "set_lifetime", -1);
-  sq_newclosure(v, &CustomParticles_set_lifetime_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_lifetime'");
-  }
-
-  sq_pushstring(v, "fade_lifetime", -1);
-  sq_newclosure(v, &CustomParticles_fade_lifetime_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'fade_lifetime'");
-  }
-
-  sq_pushstring(v, "ease_lifetime", -1);
-  sq_newclosure(v, &CustomParticles_ease_lifetime_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|ns");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'ease_lifetime'");
-  }
-
-  sq_pushstring(v, "get_lifetime_variation", -1);
-  sq_newclosure(v, &CustomParticles_get_lifetime_variation_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_lifetime_variation'");
-  }
-
-  sq_pushstring(v, "set_lifetime_variation", -1);
-  sq_newclosure(v, &CustomParticles_set_lifetime_variation_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_lifetime_variation'");
-  }
-
-  sq_pushstring(v, "fade_lifetime_variation", -1);
-  sq_newclosure(v, &CustomParticles_fade_lifetime_variation_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'fade_lifetime_variation'");
-  }
-
-  sq_pushstring(v, "ease_lifetime_variation", -1);
-  sq_newclosure(v, &CustomParticles_ease_lifetime_variation_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|ns");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'ease_lifetime_variation'");
-  }
-
-  sq_pushstring(v, "get_birth_time", -1);
-  sq_newclosure(v, &CustomParticles_get_birth_time_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_birth_time'");
-  }
-
-  sq_pushstring(v, "set_birth_time", -1);
-  sq_newclosure(v, &CustomParticles_set_birth_time_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_birth_time'");
-  }
-
-  sq_pushstring(v, "fade_birth_time", -1);
-  sq_newclosure(v, &CustomParticles_fade_birth_time_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'fade_birth_time'");
-  }
-
-  sq_pushstring(v, "ease_birth_time", -1);
-  sq_newclosure(v, &CustomParticles_ease_birth_time_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|ns");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'ease_birth_time'");
-  }
-
-  sq_pushstring(v, "get_birth_time_variation", -1);
-  sq_newclosure(v, &CustomParticles_get_birth_time_variation_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_birth_time_variation'");
-  }
-
-  sq_pushstring(v, "set_birth_time_variation", -1);
-  sq_newclosure(v, &CustomParticles_set_birth_time_variation_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_birth_time_variation'");
-  }
-
-  sq_pushstring(v, "fade_birth_time_variation", -1);
-  sq_newclosure(v, &CustomParticles_fade_birth_time_variation_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'fade_birth_time_variation'");
-  }
-
-  sq_pushstring(v, "ease_birth_time_variation", -1);
-  sq_newclosure(v, &CustomParticles_ease_birth_time_variation_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|ns");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'ease_birth_time_variation'");
-  }
-
-  sq_pushstring(v, "get_death_time", -1);
-  sq_newclosure(v, &CustomParticles_get_death_time_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_death_time'");
-  }
-
-  sq_pushstring(v, "set_death_time", -1);
-  sq_newclosure(v, &CustomParticles_set_death_time_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_death_time'");
-  }
-
-  sq_pushstring(v, "fade_death_time", -1);
-  sq_newclosure(v, &CustomParticles_fade_death_time_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'fade_death_time'");
-  }
-
-  sq_pushstring(v, "ease_death_time", -1);
-  sq_newclosure(v, &CustomParticles_ease_death_time_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|ns");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'ease_death_time'");
-  }
-
-  sq_pushstring(v, "get_death_time_variation", -1);
-  sq_newclosure(v, &CustomParticles_get_death_time_variation_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_death_time_variation'");
-  }
-
-  sq_pushstring(v, "set_death_time_variation", -1);
-  sq_newclosure(v, &CustomParticles_set_death_time_variation_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_death_time_variation'");
-  }
-
-  sq_pushstring(v, "fade_death_time_variation", -1);
-  sq_newclosure(v, &CustomParticles_fade_death_time_variation_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'fade_death_time_variation'");
-  }
-
-  sq_pushstring(v, "ease_death_time_variation", -1);
-  sq_newclosure(v, &CustomParticles_ease_death_time_variation_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|ns");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'ease_death_time_variation'");
-  }
-
-  sq_pushstring(v, "get_speed_x", -1);
-  sq_newclosure(v, &CustomParticles_get_speed_x_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_speed_x'");
-  }
-
-  sq_pushstring(v, "set_speed_x", -1);
-  sq_newclosure(v, &CustomParticles_set_speed_x_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_speed_x'");
-  }
-
-  sq_pushstring(v, "fade_speed_x", -1);
-  sq_newclosure(v, &CustomParticles_fade_speed_x_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'fade_speed_x'");
-  }
-
-  sq_pushstring(v, "ease_speed_x", -1);
-  sq_newclosure(v, &CustomParticles_ease_speed_x_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|ns");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'ease_speed_x'");
-  }
-
-  sq_pushstring(v, "get_speed_y", -1);
-  sq_newclosure(v, &CustomParticles_get_speed_y_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_speed_y'");
-  }
-
-  sq_pushstring(v, "set_speed_y", -1);
-  sq_newclosure(v, &CustomParticles_set_speed_y_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_speed_y'");
-  }
-
-  sq_pushstring(v, "fade_speed_y", -1);
-  sq_newclosure(v, &CustomParticles_fade_speed_y_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'fade_speed_y'");
-  }
-
-  sq_pushstring(v, "ease_speed_y", -1);
-  sq_newclosure(v, &CustomParticles_ease_speed_y_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|ns");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'ease_speed_y'");
-  }
-
-  sq_pushstring(v, "get_speed_variation_x", -1);
-  sq_newclosure(v, &CustomParticles_get_speed_variation_x_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_speed_variation_x'");
-  }
-
-  sq_pushstring(v, "set_speed_variation_x", -1);
-  sq_newclosure(v, &CustomParticles_set_speed_variation_x_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_speed_variation_x'");
-  }
-
-  sq_pushstring(v, "fade_speed_variation_x", -1);
-  sq_newclosure(v, &CustomParticles_fade_speed_variation_x_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'fade_speed_variation_x'");
-  }
-
-  sq_pushstring(v, "ease_speed_variation_x", -1);
-  sq_newclosure(v, &CustomParticles_ease_speed_variation_x_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|ns");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'ease_speed_variation_x'");
-  }
-
-  sq_pushstring(v, "get_speed_variation_y", -1);
-  sq_newclosure(v, &CustomParticles_get_speed_variation_y_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_speed_variation_y'");
-  }
-
-  sq_pushstring(v, "set_speed_variation_y", -1);
-  sq_newclosure(v, &CustomParticles_set_speed_variation_y_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_speed_variation_y'");
-  }
-
-  sq_pushstring(v, "fade_speed_variation_y", -1);
-  sq_newclosure(v, &CustomParticles_fade_speed_variation_y_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'fade_speed_variation_y'");
-  }
-
-  sq_pushstring(v, "ease_speed_variation_y", -1);
-  sq_newclosure(v, &CustomParticles_ease_speed_variation_y_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|ns");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'ease_speed_variation_y'");
-  }
-
-  sq_pushstring(v, "get_acceleration_x", -1);
-  sq_newclosure(v, &CustomParticles_get_acceleration_x_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_acceleration_x'");
-  }
-
-  sq_pushstring(v, "set_acceleration_x", -1);
-  sq_newclosure(v, &CustomParticles_set_acceleration_x_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_acceleration_x'");
-  }
-
-  sq_pushstring(v, "fade_acceleration_x", -1);
-  sq_newclosure(v, &CustomParticles_fade_acceleration_x_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'fade_acceleration_x'");
-  }
-
-  sq_pushstring(v, "ease_acceleration_x", -1);
-  sq_newclosure(v, &CustomParticles_ease_acceleration_x_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|ns");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'ease_acceleration_x'");
-  }
-
-  sq_pushstring(v, "get_acceleration_y", -1);
-  sq_newclosure(v, &CustomParticles_get_acceleration_y_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_acceleration_y'");
-  }
-
-  sq_pushstring(v, "set_acceleration_y", -1);
-  sq_newclosure(v, &CustomParticles_set_acceleration_y_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_acceleration_y'");
-  }
-
-  sq_pushstring(v, "fade_acceleration_y", -1);
-  sq_newclosure(v, &CustomParticles_fade_acceleration_y_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'fade_acceleration_y'");
-  }
-
-  sq_pushstring(v, "ease_acceleration_y", -1);
-  sq_newclosure(v, &CustomParticles_ease_acceleration_y_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|ns");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'ease_acceleration_y'");
-  }
-
-  sq_pushstring(v, "get_friction_x", -1);
-  sq_newclosure(v, &CustomParticles_get_friction_x_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_friction_x'");
-  }
-
-  sq_pushstring(v, "set_friction_x", -1);
-  sq_newclosure(v, &CustomParticles_set_friction_x_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_friction_x'");
-  }
-
-  sq_pushstring(v, "fade_friction_x", -1);
-  sq_newclosure(v, &CustomParticles_fade_friction_x_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'fade_friction_x'");
-  }
-
-  sq_pushstring(v, "ease_friction_x", -1);
-  sq_newclosure(v, &CustomParticles_ease_friction_x_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|ns");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'ease_friction_x'");
-  }
-
-  sq_pushstring(v, "get_friction_y", -1);
-  sq_newclosure(v, &CustomParticles_get_friction_y_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_friction_y'");
-  }
-
-  sq_pushstring(v, "set_friction_y", -1);
-  sq_newclosure(v, &CustomParticles_set_friction_y_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_friction_y'");
-  }
-
-  sq_pushstring(v, "fade_friction_y", -1);
-  sq_newclosure(v, &CustomParticles_fade_friction_y_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'fade_friction_y'");
-  }
-
-  sq_pushstring(v, "ease_friction_y", -1);
-  sq_newclosure(v, &CustomParticles_ease_friction_y_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|ns");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'ease_friction_y'");
-  }
-
-  sq_pushstring(v, "get_feather_factor", -1);
-  sq_newclosure(v, &CustomParticles_get_feather_factor_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_feather_factor'");
-  }
-
-  sq_pushstring(v, "set_feather_factor", -1);
-  sq_newclosure(v, &CustomParticles_set_feather_factor_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_feather_factor'");
-  }
-
-  sq_pushstring(v, "fade_feather_factor", -1);
-  sq_newclosure(v, &CustomParticles_fade_feather_factor_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'fade_feather_factor'");
-  }
-
-  sq_pushstring(v, "ease_feather_factor", -1);
-  sq_newclosure(v, &CustomParticles_ease_feather_factor_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|ns");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'ease_feather_factor'");
-  }
-
-  sq_pushstring(v, "get_rotation", -1);
-  sq_newclosure(v, &CustomParticles_get_rotation_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_rotation'");
-  }
-
-  sq_pushstring(v, "set_rotation", -1);
-  sq_newclosure(v, &CustomParticles_set_rotation_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_rotation'");
-  }
-
-  sq_pushstring(v, "fade_rotation", -1);
-  sq_newclosure(v, &CustomParticles_fade_rotation_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'fade_rotation'");
-  }
-
-  sq_pushstring(v, "ease_rotation", -1);
-  sq_newclosure(v, &CustomParticles_ease_rotation_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|ns");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'ease_rotation'");
-  }
-
-  sq_pushstring(v, "get_rotation_variation", -1);
-  sq_newclosure(v, &CustomParticles_get_rotation_variation_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_rotation_variation'");
-  }
-
-  sq_pushstring(v, "set_rotation_variation", -1);
-  sq_newclosure(v, &CustomParticles_set_rotation_variation_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_rotation_variation'");
-  }
-
-  sq_pushstring(v, "fade_rotation_variation", -1);
-  sq_newclosure(v, &CustomParticles_fade_rotation_variation_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'fade_rotation_variation'");
-  }
-
-  sq_pushstring(v, "ease_rotation_variation", -1);
-  sq_newclosure(v, &CustomParticles_ease_rotation_variation_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|ns");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'ease_rotation_variation'");
-  }
-
-  sq_pushstring(v, "get_rotation_speed", -1);
-  sq_newclosure(v, &CustomParticles_get_rotation_speed_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_rotation_speed'");
-  }
-
-  sq_pushstring(v, "set_rotation_speed", -1);
-  sq_newclosure(v, &CustomParticles_set_rotation_speed_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_rotation_speed'");
-  }
-
-  sq_pushstring(v, "fade_rotation_speed", -1);
-  sq_newclosure(v, &CustomParticles_fade_rotation_speed_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'fade_rotation_speed'");
-  }
-
-  sq_pushstring(v, "ease_rotation_speed", -1);
-  sq_newclosure(v, &CustomParticles_ease_rotation_speed_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|ns");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'ease_rotation_speed'");
-  }
-
-  sq_pushstring(v, "get_rotation_speed_variation", -1);
-  sq_newclosure(v, &CustomParticles_get_rotation_speed_variation_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_rotation_speed_variation'");
-  }
-
-  sq_pushstring(v, "set_rotation_speed_variation", -1);
-  sq_newclosure(v, &CustomParticles_set_rotation_speed_variation_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_rotation_speed_variation'");
-  }
-
-  sq_pushstring(v, "fade_rotation_speed_variation", -1);
-  sq_newclosure(v, &CustomParticles_fade_rotation_speed_variation_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'fade_rotation_speed_variation'");
-  }
-
-  sq_pushstring(v, "ease_rotation_speed_variation", -1);
-  sq_newclosure(v, &CustomParticles_ease_rotation_speed_variation_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|ns");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'ease_rotation_speed_variation'");
-  }
-
-  sq_pushstring(v, "get_rotation_acceleration", -1);
-  sq_newclosure(v, &CustomParticles_get_rotation_acceleration_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_rotation_acceleration'");
-  }
-
-  sq_pushstring(v, "set_rotation_acceleration", -1);
-  sq_newclosure(v, &CustomParticles_set_rotation_acceleration_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_rotation_acceleration'");
-  }
-
-  sq_pushstring(v, "fade_rotation_acceleration", -1);
-  sq_newclosure(v, &CustomParticles_fade_rotation_acceleration_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'fade_rotation_acceleration'");
-  }
-
-  sq_pushstring(v, "ease_rotation_acceleration", -1);
-  sq_newclosure(v, &CustomParticles_ease_rotation_acceleration_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|ns");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'ease_rotation_acceleration'");
-  }
-
-  sq_pushstring(v, "get_rotation_decceleration", -1);
-  sq_newclosure(v, &CustomParticles_get_rotation_decceleration_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_rotation_decceleration'");
-  }
-
-  sq_pushstring(v, "set_rotation_decceleration", -1);
-  sq_newclosure(v, &CustomParticles_set_rotation_decceleration_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_rotation_decceleration'");
-  }
-
-  sq_pushstring(v, "fade_rotation_decceleration", -1);
-  sq_newclosure(v, &CustomParticles_fade_rotation_decceleration_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'fade_rotation_decceleration'");
-  }
-
-  sq_pushstring(v, "ease_rotation_decceleration", -1);
-  sq_newclosure(v, &CustomParticles_ease_rotation_decceleration_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|ns");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'ease_rotation_decceleration'");
-  }
-
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register class 'CustomParticles'");
-  }
-
-  // Register class Decal
-  sq_pushstring(v, "Decal", -1);
-  if(sq_newclass(v, SQFalse) < 0) {
-    std::ostringstream msg;
-    msg << "Couldn't create new class 'Decal'";
-    throw SquirrelError(v, msg.str());
-  }
-  sq_pushstring(v, "fade_sprite", -1);
-  sq_newclosure(v, &Decal_fade_sprite_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".sb|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'fade_sprite'");
-  }
-
-  sq_pushstring(v, "change_sprite", -1);
-  sq_newclosure(v, &Decal_change_sprite_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".s");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'change_sprite'");
-  }
-
-  sq_pushstring(v, "fade_in", -1);
-  sq_newclosure(v, &Decal_fade_in_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'fade_in'");
-  }
-
-  sq_pushstring(v, "fade_out", -1);
-  sq_newclosure(v, &Decal_fade_out_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'fade_out'");
-  }
-
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register class 'Decal'");
-  }
-
-  // Register class DisplayEffect
-  sq_pushstring(v, "DisplayEffect", -1);
-  if(sq_newclass(v, SQFalse) < 0) {
-    std::ostringstream msg;
-    msg << "Couldn't create new class 'DisplayEffect'";
-    throw SquirrelError(v, msg.str());
-  }
-  sq_pushstring(v, "fade_out", -1);
-  sq_newclosure(v, &DisplayEffect_fade_out_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'fade_out'");
-  }
-
-  sq_pushstring(v, "fade_in", -1);
-  sq_newclosure(v, &DisplayEffect_fade_in_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'fade_in'");
-  }
-
-  sq_pushstring(v, "set_black", -1);
-  sq_newclosure(v, &DisplayEffect_set_black_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_black'");
-  }
-
-  sq_pushstring(v, "is_black", -1);
-  sq_newclosure(v, &DisplayEffect_is_black_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'is_black'");
-  }
-
-  sq_pushstring(v, "sixteen_to_nine", -1);
-  sq_newclosure(v, &DisplayEffect_sixteen_to_nine_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'sixteen_to_nine'");
-  }
-
-  sq_pushstring(v, "four_to_three", -1);
-  sq_newclosure(v, &DisplayEffect_four_to_three_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'four_to_three'");
-  }
-
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register class 'DisplayEffect'");
-  }
-
-  // Register class FloatingImage
-  sq_pushstring(v, "FloatingImage", -1);
-  if(sq_newclass(v, SQFalse) < 0) {
-    std::ostringstream msg;
-    msg << "Couldn't create new class 'FloatingImage'";
-    throw SquirrelError(v, msg.str());
-  }
-  sq_pushstring(v, "constructor", -1);
-  sq_newclosure(v, &FloatingImage_constructor_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".s");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'constructor'");
-  }
-
-  sq_pushstring(v, "set_layer", -1);
-  sq_newclosure(v, &FloatingImage_set_layer_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_layer'");
-  }
-
-  sq_pushstring(v, "get_layer", -1);
-  sq_newclosure(v, &FloatingImage_get_layer_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_layer'");
-  }
-
-  sq_pushstring(v, "set_pos", -1);
-  sq_newclosure(v, &FloatingImage_set_pos_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_pos'");
-  }
-
-  sq_pushstring(v, "get_pos_x", -1);
-  sq_newclosure(v, &FloatingImage_get_pos_x_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_pos_x'");
-  }
-
-  sq_pushstring(v, "get_pos_y", -1);
-  sq_newclosure(v, &FloatingImage_get_pos_y_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_pos_y'");
-  }
-
-  sq_pushstring(v, "set_anchor_point", -1);
-  sq_newclosure(v, &FloatingImage_set_anchor_point_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_anchor_point'");
-  }
-
-  sq_pushstring(v, "get_anchor_point", -1);
-  sq_newclosure(v, &FloatingImage_get_anchor_point_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_anchor_point'");
-  }
-
-  sq_pushstring(v, "set_visible", -1);
-  sq_newclosure(v, &FloatingImage_set_visible_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_visible'");
-  }
-
-  sq_pushstring(v, "get_visible", -1);
-  sq_newclosure(v, &FloatingImage_get_visible_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_visible'");
-  }
-
-  sq_pushstring(v, "set_action", -1);
-  sq_newclosure(v, &FloatingImage_set_action_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".s");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_action'");
-  }
-
-  sq_pushstring(v, "get_action", -1);
-  sq_newclosure(v, &FloatingImage_get_action_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_action'");
-  }
-
-  sq_pushstring(v, "fade_in", -1);
-  sq_newclosure(v, &FloatingImage_fade_in_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'fade_in'");
-  }
-
-  sq_pushstring(v, "fade_out", -1);
-  sq_newclosure(v, &FloatingImage_fade_out_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'fade_out'");
-  }
-
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register class 'FloatingImage'");
-  }
-
-  // Register class GameObjectManager
-  sq_pushstring(v, "GameObjectManager", -1);
-  if(sq_newclass(v, SQFalse) < 0) {
-    std::ostringstream msg;
-    msg << "Couldn't create new class 'GameObjectManager'";
-    throw SquirrelError(v, msg.str());
-  }
-  sq_pushstring(v, "set_ambient_light", -1);
-  sq_newclosure(v, &GameObjectManager_set_ambient_light_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|nb|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_ambient_light'");
-  }
-
-  sq_pushstring(v, "fade_to_ambient_light", -1);
-  sq_newclosure(v, &GameObjectManager_fade_to_ambient_light_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|nb|nb|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'fade_to_ambient_light'");
-  }
-
-  sq_pushstring(v, "get_ambient_red", -1);
-  sq_newclosure(v, &GameObjectManager_get_ambient_red_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_ambient_red'");
-  }
-
-  sq_pushstring(v, "get_ambient_green", -1);
-  sq_newclosure(v, &GameObjectManager_get_ambient_green_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_ambient_green'");
-  }
-
-  sq_pushstring(v, "get_ambient_blue", -1);
-  sq_newclosure(v, &GameObjectManager_get_ambient_blue_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_ambient_blue'");
-  }
-
-  sq_pushstring(v, "set_music", -1);
-  sq_newclosure(v, &GameObjectManager_set_music_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".s");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_music'");
-  }
-
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register class 'GameObjectManager'");
-  }
-
-  // Register class Sector
-  sq_pushstring(v, "Sector", -1);
-  sq_pushstring(v, "GameObjectManager", -1);
-  sq_get(v, -3);
-  if(sq_newclass(v, SQTrue) < 0) {
-    std::ostringstream msg;
-    msg << "Couldn't create new class 'Sector'";
-    throw SquirrelError(v, msg.str());
-  }
-  sq_pushstring(v, "set_gravity", -1);
-  sq_newclosure(v, &Sector_set_gravity_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_gravity'");
-  }
-
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register class 'Sector'");
-  }
-
-  // Register class WorldMap
-  sq_pushstring(v, "WorldMap", -1);
-  sq_pushstring(v, "GameObjectManager", -1);
-  sq_get(v, -3);
-  if(sq_newclass(v, SQTrue) < 0) {
-    std::ostringstream msg;
-    msg << "Couldn't create new class 'WorldMap'";
-    throw SquirrelError(v, msg.str());
-  }
-  sq_pushstring(v, "get_tux_x", -1);
-  sq_newclosure(v, &WorldMap_get_tux_x_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_tux_x'");
-  }
-
-  sq_pushstring(v, "get_tux_y", -1);
-  sq_newclosure(v, &WorldMap_get_tux_y_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_tux_y'");
-  }
-
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register class 'WorldMap'");
-  }
-
-  // Register class Gradient
-  sq_pushstring(v, "Gradient", -1);
-  if(sq_newclass(v, SQFalse) < 0) {
-    std::ostringstream msg;
-    msg << "Couldn't create new class 'Gradient'";
-    throw SquirrelError(v, msg.str());
-  }
-  sq_pushstring(v, "set_direction", -1);
-  sq_newclosure(v, &Gradient_set_direction_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".s");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_direction'");
-  }
-
-  sq_pushstring(v, "get_direction", -1);
-  sq_newclosure(v, &Gradient_get_direction_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_direction'");
-  }
-
-  sq_pushstring(v, "set_color1", -1);
-  sq_newclosure(v, &Gradient_set_color1_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|nb|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_color1'");
-  }
-
-  sq_pushstring(v, "set_color2", -1);
-  sq_newclosure(v, &Gradient_set_color2_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|nb|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_color2'");
-  }
-
-  sq_pushstring(v, "set_colors", -1);
-  sq_newclosure(v, &Gradient_set_colors_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|nb|nb|nb|nb|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_colors'");
-  }
-
-  sq_pushstring(v, "fade_color1", -1);
-  sq_newclosure(v, &Gradient_fade_color1_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|nb|nb|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'fade_color1'");
-  }
-
-  sq_pushstring(v, "fade_color2", -1);
-  sq_newclosure(v, &Gradient_fade_color2_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|nb|nb|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'fade_color2'");
-  }
-
-  sq_pushstring(v, "fade_colors", -1);
-  sq_newclosure(v, &Gradient_fade_colors_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|nb|nb|nb|nb|nb|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'fade_colors'");
-  }
-
-  sq_pushstring(v, "swap_colors", -1);
-  sq_newclosure(v, &Gradient_swap_colors_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'swap_colors'");
-  }
-
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register class 'Gradient'");
-  }
-
-  // Register class LevelTime
-  sq_pushstring(v, "LevelTime", -1);
-  if(sq_newclass(v, SQFalse) < 0) {
-    std::ostringstream msg;
-    msg << "Couldn't create new class 'LevelTime'";
-    throw SquirrelError(v, msg.str());
-  }
-  sq_pushstring(v, "start", -1);
-  sq_newclosure(v, &LevelTime_start_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'start'");
-  }
-
-  sq_pushstring(v, "stop", -1);
-  sq_newclosure(v, &LevelTime_stop_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'stop'");
-  }
-
-  sq_pushstring(v, "get_time", -1);
-  sq_newclosure(v, &LevelTime_get_time_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_time'");
-  }
-
-  sq_pushstring(v, "set_time", -1);
-  sq_newclosure(v, &LevelTime_set_time_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_time'");
-  }
-
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register class 'LevelTime'");
-  }
-
-  // Register class LitObject
-  sq_pushstring(v, "LitObject", -1);
-  if(sq_newclass(v, SQFalse) < 0) {
-    std::ostringstream msg;
-    msg << "Couldn't create new class 'LitObject'";
-    throw SquirrelError(v, msg.str());
-  }
-  sq_pushstring(v, "get_action", -1);
-  sq_newclosure(v, &LitObject_get_action_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_action'");
-  }
-
-  sq_pushstring(v, "set_action", -1);
-  sq_newclosure(v, &LitObject_set_action_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".s");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_action'");
-  }
-
-  sq_pushstring(v, "get_light_action", -1);
-  sq_newclosure(v, &LitObject_get_light_action_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_light_action'");
-  }
-
-  sq_pushstring(v, "set_light_action", -1);
-  sq_newclosure(v, &LitObject_set_light_action_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".s");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_light_action'");
-  }
-
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register class 'LitObject'");
-  }
-
-  // Register class ParticleSystem
-  sq_pushstring(v, "ParticleSystem", -1);
-  if(sq_newclass(v, SQFalse) < 0) {
-    std::ostringstream msg;
-    msg << "Couldn't create new class 'ParticleSystem'";
-    throw SquirrelError(v, msg.str());
-  }
-  sq_pushstring(v, "set_enabled", -1);
-  sq_newclosure(v, &ParticleSystem_set_enabled_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_enabled'");
-  }
-
-  sq_pushstring(v, "get_enabled", -1);
-  sq_newclosure(v, &ParticleSystem_get_enabled_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_enabled'");
-  }
-
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register class 'ParticleSystem'");
-  }
-
-  // Register class Platform
-  sq_pushstring(v, "Platform", -1);
-  if(sq_newclass(v, SQFalse) < 0) {
-    std::ostringstream msg;
-    msg << "Couldn't create new class 'Platform'";
-    throw SquirrelError(v, msg.str());
-  }
-  sq_pushstring(v, "goto_node", -1);
-  sq_newclosure(v, &Platform_goto_node_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'goto_node'");
-  }
-
-  sq_pushstring(v, "set_node", -1);
-  sq_newclosure(v, &Platform_set_node_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_node'");
-  }
-
-  sq_pushstring(v, "start_moving", -1);
-  sq_newclosure(v, &Platform_start_moving_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'start_moving'");
-  }
-
-  sq_pushstring(v, "stop_moving", -1);
-  sq_newclosure(v, &Platform_stop_moving_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'stop_moving'");
-  }
-
-  sq_pushstring(v, "get_action", -1);
-  sq_newclosure(v, &Platform_get_action_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_action'");
-  }
-
-  sq_pushstring(v, "set_action", -1);
-  sq_newclosure(v, &Platform_set_action_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".sb|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_action'");
-  }
-
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register class 'Platform'");
-  }
-
-  // Register class Player
-  sq_pushstring(v, "Player", -1);
-  if(sq_newclass(v, SQFalse) < 0) {
-    std::ostringstream msg;
-    msg << "Couldn't create new class 'Player'";
-    throw SquirrelError(v, msg.str());
-  }
-  sq_pushstring(v, "add_bonus", -1);
-  sq_newclosure(v, &Player_add_bonus_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".s");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'add_bonus'");
-  }
-
-  sq_pushstring(v, "set_bonus", -1);
-  sq_newclosure(v, &Player_set_bonus_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".s");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_bonus'");
-  }
-
-  sq_pushstring(v, "get_bonus", -1);
-  sq_newclosure(v, &Player_get_bonus_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_bonus'");
-  }
-
-  sq_pushstring(v, "add_coins", -1);
-  sq_newclosure(v, &Player_add_coins_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'add_coins'");
-  }
-
-  sq_pushstring(v, "get_coins", -1);
-  sq_newclosure(v, &Player_get_coins_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_coins'");
-  }
-
-  sq_pushstring(v, "make_invincible", -1);
-  sq_newclosure(v, &Player_make_invincible_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'make_invincible'");
-  }
-
-  sq_pushstring(v, "deactivate", -1);
-  sq_newclosure(v, &Player_deactivate_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'deactivate'");
-  }
-
-  sq_pushstring(v, "activate", -1);
-  sq_newclosure(v, &Player_activate_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'activate'");
-  }
-
-  sq_pushstring(v, "walk", -1);
-  sq_newclosure(v, &Player_walk_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'walk'");
-  }
-
-  sq_pushstring(v, "set_dir", -1);
-  sq_newclosure(v, &Player_set_dir_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_dir'");
-  }
-
-  sq_pushstring(v, "set_visible", -1);
-  sq_newclosure(v, &Player_set_visible_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_visible'");
-  }
-
-  sq_pushstring(v, "get_visible", -1);
-  sq_newclosure(v, &Player_get_visible_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_visible'");
-  }
-
-  sq_pushstring(v, "kill", -1);
-  sq_newclosure(v, &Player_kill_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'kill'");
-  }
-
-  sq_pushstring(v, "set_ghost_mode", -1);
-  sq_newclosure(v, &Player_set_ghost_mode_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_ghost_mode'");
-  }
-
-  sq_pushstring(v, "get_ghost_mode", -1);
-  sq_newclosure(v, &Player_get_ghost_mode_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_ghost_mode'");
-  }
-
-  sq_pushstring(v, "kick", -1);
-  sq_newclosure(v, &Player_kick_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'kick'");
-  }
-
-  sq_pushstring(v, "do_cheer", -1);
-  sq_newclosure(v, &Player_do_cheer_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'do_cheer'");
-  }
-
-  sq_pushstring(v, "do_duck", -1);
-  sq_newclosure(v, &Player_do_duck_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'do_duck'");
-  }
-
-  sq_pushstring(v, "do_standup", -1);
-  sq_newclosure(v, &Player_do_standup_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'do_standup'");
-  }
-
-  sq_pushstring(v, "do_backflip", -1);
-  sq_newclosure(v, &Player_do_backflip_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'do_backflip'");
-  }
-
-  sq_pushstring(v, "do_jump", -1);
-  sq_newclosure(v, &Player_do_jump_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'do_jump'");
-  }
-
-  sq_pushstring(v, "trigger_sequence", -1);
-  sq_newclosure(v, &Player_trigger_sequence_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".s");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'trigger_sequence'");
-  }
-
-  sq_pushstring(v, "use_scripting_controller", -1);
-  sq_newclosure(v, &Player_use_scripting_controller_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'use_scripting_controller'");
-  }
-
-  sq_pushstring(v, "do_scripting_controller", -1);
-  sq_newclosure(v, &Player_do_scripting_controller_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".sb|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'do_scripting_controller'");
-  }
-
-  sq_pushstring(v, "has_grabbed", -1);
-  sq_newclosure(v, &Player_has_grabbed_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".s");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'has_grabbed'");
-  }
-
-  sq_pushstring(v, "get_velocity_x", -1);
-  sq_newclosure(v, &Player_get_velocity_x_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_velocity_x'");
-  }
-
-  sq_pushstring(v, "get_velocity_y", -1);
-  sq_newclosure(v, &Player_get_velocity_y_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_velocity_y'");
-  }
-
-  sq_pushstring(v, "get_x", -1);
-  sq_newclosure(v, &Player_get_x_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_x'");
-  }
-
-  sq_pushstring(v, "get_y", -1);
-  sq_newclosure(v, &Player_get_y_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_y'");
-  }
-
-  sq_pushstring(v, "set_pos", -1);
-  sq_newclosure(v, &Player_set_pos_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_pos'");
-  }
-
-  sq_pushstring(v, "get_action", -1);
-  sq_newclosure(v, &Player_get_action_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_action'");
-  }
-
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register class 'Player'");
-  }
-
-  // Register class Rain
-  sq_pushstring(v, "Rain", -1);
-  if(sq_newclass(v, SQFalse) < 0) {
-    std::ostringstream msg;
-    msg << "Couldn't create new class 'Rain'";
-    throw SquirrelError(v, msg.str());
-  }
-  sq_pushstring(v, "set_enabled", -1);
-  sq_newclosure(v, &Rain_set_enabled_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_enabled'");
-  }
-
-  sq_pushstring(v, "get_enabled", -1);
-  sq_newclosure(v, &Rain_get_enabled_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_enabled'");
-  }
-
-  sq_pushstring(v, "fade_speed", -1);
-  sq_newclosure(v, &Rain_fade_speed_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'fade_speed'");
-  }
-
-  sq_pushstring(v, "fade_amount", -1);
-  sq_newclosure(v, &Rain_fade_amount_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'fade_amount'");
-  }
-
-  sq_pushstring(v, "fade_angle", -1);
-  sq_newclosure(v, &Rain_fade_angle_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|ns");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'fade_angle'");
-  }
-
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register class 'Rain'");
-  }
-
-  // Register class Rock
-  sq_pushstring(v, "Rock", -1);
-  if(sq_newclass(v, SQFalse) < 0) {
-    std::ostringstream msg;
-    msg << "Couldn't create new class 'Rock'";
-    throw SquirrelError(v, msg.str());
-  }
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register class 'Rock'");
-  }
-
-  // Register class ScriptedObject
-  sq_pushstring(v, "ScriptedObject", -1);
-  if(sq_newclass(v, SQFalse) < 0) {
-    std::ostringstream msg;
-    msg << "Couldn't create new class 'ScriptedObject'";
-    throw SquirrelError(v, msg.str());
-  }
-  sq_pushstring(v, "set_action", -1);
-  sq_newclosure(v, &ScriptedObject_set_action_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".s");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_action'");
-  }
-
-  sq_pushstring(v, "get_action", -1);
-  sq_newclosure(v, &ScriptedObject_get_action_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_action'");
-  }
-
-  sq_pushstring(v, "get_name", -1);
-  sq_newclosure(v, &ScriptedObject_get_name_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_name'");
-  }
-
-  sq_pushstring(v, "move", -1);
-  sq_newclosure(v, &ScriptedObject_move_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'move'");
-  }
-
-  sq_pushstring(v, "set_pos", -1);
-  sq_newclosure(v, &ScriptedObject_set_pos_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_pos'");
-  }
-
-  sq_pushstring(v, "get_pos_x", -1);
-  sq_newclosure(v, &ScriptedObject_get_pos_x_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_pos_x'");
-  }
-
-  sq_pushstring(v, "get_pos_y", -1);
-  sq_newclosure(v, &ScriptedObject_get_pos_y_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_pos_y'");
-  }
-
-  sq_pushstring(v, "set_velocity", -1);
-  sq_newclosure(v, &ScriptedObject_set_velocity_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_velocity'");
-  }
-
-  sq_pushstring(v, "get_velocity_x", -1);
-  sq_newclosure(v, &ScriptedObject_get_velocity_x_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_velocity_x'");
-  }
-
-  sq_pushstring(v, "get_velocity_y", -1);
-  sq_newclosure(v, &ScriptedObject_get_velocity_y_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_velocity_y'");
-  }
-
-  sq_pushstring(v, "enable_gravity", -1);
-  sq_newclosure(v, &ScriptedObject_enable_gravity_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'enable_gravity'");
-  }
-
-  sq_pushstring(v, "gravity_enabled", -1);
-  sq_newclosure(v, &ScriptedObject_gravity_enabled_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'gravity_enabled'");
-  }
-
-  sq_pushstring(v, "set_visible", -1);
-  sq_newclosure(v, &ScriptedObject_set_visible_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_visible'");
-  }
-
-  sq_pushstring(v, "is_visible", -1);
-  sq_newclosure(v, &ScriptedObject_is_visible_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'is_visible'");
-  }
-
-  sq_pushstring(v, "set_solid", -1);
-  sq_newclosure(v, &ScriptedObject_set_solid_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_solid'");
-  }
-
-  sq_pushstring(v, "is_solid", -1);
-  sq_newclosure(v, &ScriptedObject_is_solid_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'is_solid'");
-  }
-
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register class 'ScriptedObject'");
-  }
-
-  // Register class Spotlight
-  sq_pushstring(v, "Spotlight", -1);
-  if(sq_newclass(v, SQFalse) < 0) {
-    std::ostringstream msg;
-    msg << "Couldn't create new class 'Spotlight'";
-    throw SquirrelError(v, msg.str());
-  }
-  sq_pushstring(v, "set_enabled", -1);
-  sq_newclosure(v, &Spotlight_set_enabled_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_enabled'");
-  }
-
-  sq_pushstring(v, "is_enabled", -1);
-  sq_newclosure(v, &Spotlight_is_enabled_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'is_enabled'");
-  }
-
-  sq_pushstring(v, "set_direction", -1);
-  sq_newclosure(v, &Spotlight_set_direction_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".s");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_direction'");
-  }
-
-  sq_pushstring(v, "set_angle", -1);
-  sq_newclosure(v, &Spotlight_set_angle_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_angle'");
-  }
-
-  sq_pushstring(v, "fade_angle", -1);
-  sq_newclosure(v, &Spotlight_fade_angle_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'fade_angle'");
-  }
-
-  sq_pushstring(v, "ease_angle", -1);
-  sq_newclosure(v, &Spotlight_ease_angle_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|ns");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'ease_angle'");
-  }
-
-  sq_pushstring(v, "set_speed", -1);
-  sq_newclosure(v, &Spotlight_set_speed_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_speed'");
-  }
-
-  sq_pushstring(v, "fade_speed", -1);
-  sq_newclosure(v, &Spotlight_fade_speed_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'fade_speed'");
-  }
-
-  sq_pushstring(v, "ease_speed", -1);
-  sq_newclosure(v, &Spotlight_ease_speed_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|ns");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'ease_speed'");
-  }
-
-  sq_pushstring(v, "set_color_rgba", -1);
-  sq_newclosure(v, &Spotlight_set_color_rgba_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|nb|nb|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_color_rgba'");
-  }
-
-  sq_pushstring(v, "fade_color_rgba", -1);
-  sq_newclosure(v, &Spotlight_fade_color_rgba_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|nb|nb|nb|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'fade_color_rgba'");
-  }
-
-  sq_pushstring(v, "ease_color_rgba", -1);
-  sq_newclosure(v, &Spotlight_ease_color_rgba_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|nb|nb|nb|ns");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'ease_color_rgba'");
-  }
-
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register class 'Spotlight'");
-  }
-
-  // Register class Text
-  sq_pushstring(v, "Text", -1);
-  if(sq_newclass(v, SQFalse) < 0) {
-    std::ostringstream msg;
-    msg << "Couldn't create new class 'Text'";
-    throw SquirrelError(v, msg.str());
-  }
-  sq_pushstring(v, "set_text", -1);
-  sq_newclosure(v, &Text_set_text_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".s");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_text'");
-  }
-
-  sq_pushstring(v, "set_font", -1);
-  sq_newclosure(v, &Text_set_font_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".s");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_font'");
-  }
-
-  sq_pushstring(v, "fade_in", -1);
-  sq_newclosure(v, &Text_fade_in_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'fade_in'");
-  }
-
-  sq_pushstring(v, "fade_out", -1);
-  sq_newclosure(v, &Text_fade_out_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'fade_out'");
-  }
-
-  sq_pushstring(v, "grow_in", -1);
-  sq_newclosure(v, &Text_grow_in_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'grow_in'");
-  }
-
-  sq_pushstring(v, "grow_out", -1);
-  sq_newclosure(v, &Text_grow_out_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'grow_out'");
-  }
-
-  sq_pushstring(v, "set_visible", -1);
-  sq_newclosure(v, &Text_set_visible_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_visible'");
-  }
-
-  sq_pushstring(v, "set_centered", -1);
-  sq_newclosure(v, &Text_set_centered_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_centered'");
-  }
-
-  sq_pushstring(v, "set_pos", -1);
-  sq_newclosure(v, &Text_set_pos_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_pos'");
-  }
-
-  sq_pushstring(v, "get_pos_x", -1);
-  sq_newclosure(v, &Text_get_pos_x_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_pos_x'");
-  }
-
-  sq_pushstring(v, "get_pos_y", -1);
-  sq_newclosure(v, &Text_get_pos_y_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_pos_y'");
-  }
-
-  sq_pushstring(v, "set_anchor_point", -1);
-  sq_newclosure(v, &Text_set_anchor_point_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_anchor_point'");
-  }
-
-  sq_pushstring(v, "get_anchor_point", -1);
-  sq_newclosure(v, &Text_get_anchor_point_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_anchor_point'");
-  }
-
-  sq_pushstring(v, "set_anchor_offset", -1);
-  sq_newclosure(v, &Text_set_anchor_offset_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_anchor_offset'");
-  }
-
-  sq_pushstring(v, "set_front_fill_color", -1);
-  sq_newclosure(v, &Text_set_front_fill_color_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|nb|nb|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_front_fill_color'");
-  }
-
-  sq_pushstring(v, "set_back_fill_color", -1);
-  sq_newclosure(v, &Text_set_back_fill_color_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|nb|nb|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_back_fill_color'");
-  }
-
-  sq_pushstring(v, "set_text_color", -1);
-  sq_newclosure(v, &Text_set_text_color_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|nb|nb|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_text_color'");
-  }
-
-  sq_pushstring(v, "set_roundness", -1);
-  sq_newclosure(v, &Text_set_roundness_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_roundness'");
-  }
-
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register class 'Text'");
-  }
-
-  // Register class TextArray
-  sq_pushstring(v, "TextArray", -1);
-  if(sq_newclass(v, SQFalse) < 0) {
-    std::ostringstream msg;
-    msg << "Couldn't create new class 'TextArray'";
-    throw SquirrelError(v, msg.str());
-  }
-  sq_pushstring(v, "clear", -1);
-  sq_newclosure(v, &TextArray_clear_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'clear'");
-  }
-
-  sq_pushstring(v, "add_text", -1);
-  sq_newclosure(v, &TextArray_add_text_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".s");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'add_text'");
-  }
-
-  sq_pushstring(v, "add_text_duration", -1);
-  sq_newclosure(v, &TextArray_add_text_duration_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".sb|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'add_text_duration'");
-  }
-
-  sq_pushstring(v, "set_text_index", -1);
-  sq_newclosure(v, &TextArray_set_text_index_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_text_index'");
-  }
-
-  sq_pushstring(v, "set_keep_visible", -1);
-  sq_newclosure(v, &TextArray_set_keep_visible_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_keep_visible'");
-  }
-
-  sq_pushstring(v, "set_fade_transition", -1);
-  sq_newclosure(v, &TextArray_set_fade_transition_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_fade_transition'");
-  }
-
-  sq_pushstring(v, "set_fade_time", -1);
-  sq_newclosure(v, &TextArray_set_fade_time_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_fade_time'");
-  }
-
-  sq_pushstring(v, "set_done", -1);
-  sq_newclosure(v, &TextArray_set_done_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_done'");
-  }
-
-  sq_pushstring(v, "set_auto", -1);
-  sq_newclosure(v, &TextArray_set_auto_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_auto'");
-  }
-
-  sq_pushstring(v, "next_text", -1);
-  sq_newclosure(v, &TextArray_next_text_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'next_text'");
-  }
-
-  sq_pushstring(v, "prev_text", -1);
-  sq_newclosure(v, &TextArray_prev_text_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'prev_text'");
-  }
-
-  sq_pushstring(v, "set_text", -1);
-  sq_newclosure(v, &TextArray_set_text_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".s");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_text'");
-  }
-
-  sq_pushstring(v, "set_font", -1);
-  sq_newclosure(v, &TextArray_set_font_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".s");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_font'");
-  }
-
-  sq_pushstring(v, "fade_in", -1);
-  sq_newclosure(v, &TextArray_fade_in_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'fade_in'");
-  }
-
-  sq_pushstring(v, "fade_out", -1);
-  sq_newclosure(v, &TextArray_fade_out_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'fade_out'");
-  }
-
-  sq_pushstring(v, "grow_in", -1);
-  sq_newclosure(v, &TextArray_grow_in_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'grow_in'");
-  }
-
-  sq_pushstring(v, "grow_out", -1);
-  sq_newclosure(v, &TextArray_grow_out_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'grow_out'");
-  }
-
-  sq_pushstring(v, "set_visible", -1);
-  sq_newclosure(v, &TextArray_set_visible_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_visible'");
-  }
-
-  sq_pushstring(v, "set_centered", -1);
-  sq_newclosure(v, &TextArray_set_centered_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_centered'");
-  }
-
-  sq_pushstring(v, "set_pos", -1);
-  sq_newclosure(v, &TextArray_set_pos_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_pos'");
-  }
-
-  sq_pushstring(v, "get_pos_x", -1);
-  sq_newclosure(v, &TextArray_get_pos_x_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_pos_x'");
-  }
-
-  sq_pushstring(v, "get_pos_y", -1);
-  sq_newclosure(v, &TextArray_get_pos_y_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_pos_y'");
-  }
-
-  sq_pushstring(v, "set_anchor_point", -1);
-  sq_newclosure(v, &TextArray_set_anchor_point_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_anchor_point'");
-  }
-
-  sq_pushstring(v, "get_anchor_point", -1);
-  sq_newclosure(v, &TextArray_get_anchor_point_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_anchor_point'");
-  }
-
-  sq_pushstring(v, "set_anchor_offset", -1);
-  sq_newclosure(v, &TextArray_set_anchor_offset_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_anchor_offset'");
-  }
-
-  sq_pushstring(v, "set_front_fill_color", -1);
-  sq_newclosure(v, &TextArray_set_front_fill_color_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|nb|nb|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_front_fill_color'");
-  }
-
-  sq_pushstring(v, "set_back_fill_color", -1);
-  sq_newclosure(v, &TextArray_set_back_fill_color_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|nb|nb|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_back_fill_color'");
-  }
-
-  sq_pushstring(v, "set_text_color", -1);
-  sq_newclosure(v, &TextArray_set_text_color_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|nb|nb|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_text_color'");
-  }
-
-  sq_pushstring(v, "set_roundness", -1);
-  sq_newclosure(v, &TextArray_set_roundness_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_roundness'");
-  }
-
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register class 'TextArray'");
-  }
-
-  // Register class Thunderstorm
-  sq_pushstring(v, "Thunderstorm", -1);
-  if(sq_newclass(v, SQFalse) < 0) {
-    std::ostringstream msg;
-    msg << "Couldn't create new class 'Thunderstorm'";
-    throw SquirrelError(v, msg.str());
-  }
-  sq_pushstring(v, "start", -1);
-  sq_newclosure(v, &Thunderstorm_start_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'start'");
-  }
-
-  sq_pushstring(v, "stop", -1);
-  sq_newclosure(v, &Thunderstorm_stop_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'stop'");
-  }
-
-  sq_pushstring(v, "thunder", -1);
-  sq_newclosure(v, &Thunderstorm_thunder_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'thunder'");
-  }
-
-  sq_pushstring(v, "lightning", -1);
-  sq_newclosure(v, &Thunderstorm_lightning_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'lightning'");
-  }
-
-  sq_pushstring(v, "flash", -1);
-  sq_newclosure(v, &Thunderstorm_flash_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'flash'");
-  }
-
-  sq_pushstring(v, "electrify", -1);
-  sq_newclosure(v, &Thunderstorm_electrify_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'electrify'");
-  }
-
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register class 'Thunderstorm'");
-  }
-
-  // Register class TileMap
-  sq_pushstring(v, "TileMap", -1);
-  if(sq_newclass(v, SQFalse) < 0) {
-    std::ostringstream msg;
-    msg << "Couldn't create new class 'TileMap'";
-    throw SquirrelError(v, msg.str());
-  }
-  sq_pushstring(v, "goto_node", -1);
-  sq_newclosure(v, &TileMap_goto_node_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'goto_node'");
-  }
-
-  sq_pushstring(v, "set_node", -1);
-  sq_newclosure(v, &TileMap_set_node_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_node'");
-  }
-
-  sq_pushstring(v, "start_moving", -1);
-  sq_newclosure(v, &TileMap_start_moving_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'start_moving'");
-  }
-
-  sq_pushstring(v, "stop_moving", -1);
-  sq_newclosure(v, &TileMap_stop_moving_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'stop_moving'");
-  }
-
-  sq_pushstring(v, "get_tile_id", -1);
-  sq_newclosure(v, &TileMap_get_tile_id_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_tile_id'");
-  }
-
-  sq_pushstring(v, "get_tile_id_at", -1);
-  sq_newclosure(v, &TileMap_get_tile_id_at_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_tile_id_at'");
-  }
-
-  sq_pushstring(v, "change", -1);
-  sq_newclosure(v, &TileMap_change_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|nb|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'change'");
-  }
-
-  sq_pushstring(v, "change_at", -1);
-  sq_newclosure(v, &TileMap_change_at_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|nb|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'change_at'");
-  }
-
-  sq_pushstring(v, "fade", -1);
-  sq_newclosure(v, &TileMap_fade_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'fade'");
-  }
-
-  sq_pushstring(v, "tint_fade", -1);
-  sq_newclosure(v, &TileMap_tint_fade_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|nb|nb|nb|nb|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'tint_fade'");
-  }
-
-  sq_pushstring(v, "set_alpha", -1);
-  sq_newclosure(v, &TileMap_set_alpha_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_alpha'");
-  }
-
-  sq_pushstring(v, "get_alpha", -1);
-  sq_newclosure(v, &TileMap_get_alpha_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_alpha'");
-  }
-
-  sq_pushstring(v, "set_solid", -1);
-  sq_newclosure(v, &TileMap_set_solid_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_solid'");
-  }
-
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register class 'TileMap'");
-  }
-
-  // Register class Torch
-  sq_pushstring(v, "Torch", -1);
-  if(sq_newclass(v, SQFalse) < 0) {
-    std::ostringstream msg;
-    msg << "Couldn't create new class 'Torch'";
-    throw SquirrelError(v, msg.str());
-  }
-  sq_pushstring(v, "get_burning", -1);
-  sq_newclosure(v, &Torch_get_burning_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'get_burning'");
-  }
-
-  sq_pushstring(v, "set_burning", -1);
-  sq_newclosure(v, &Torch_set_burning_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".b|n");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'set_burning'");
-  }
-
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register class 'Torch'");
-  }
-
-  // Register class Wind
-  sq_pushstring(v, "Wind", -1);
-  if(sq_newclass(v, SQFalse) < 0) {
-    std::ostringstream msg;
-    msg << "Couldn't create new class 'Wind'";
-    throw SquirrelError(v, msg.str());
-  }
-  sq_pushstring(v, "start", -1);
-  sq_newclosure(v, &Wind_start_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'start'");
-  }
-
-  sq_pushstring(v, "stop", -1);
-  sq_newclosure(v, &Wind_stop_wrapper, 0);
-  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, ".");
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register function 'stop'");
-  }
-
-  if(SQ_FAILED(sq_createslot(v, -3))) {
-    throw SquirrelError(v, "Couldn't register class 'Wind'");
-  }
-
+  using namespace squirrel;
+
+  register_constant(v, "ANCHOR_TOP_LEFT", ANCHOR_TOP_LEFT);
+  register_constant(v, "ANCHOR_TOP", ANCHOR_TOP);
+  register_constant(v, "ANCHOR_TOP_RIGHT", ANCHOR_TOP_RIGHT);
+  register_constant(v, "ANCHOR_LEFT", ANCHOR_LEFT);
+  register_constant(v, "ANCHOR_MIDDLE", ANCHOR_MIDDLE);
+  register_constant(v, "ANCHOR_RIGHT", ANCHOR_RIGHT);
+  register_constant(v, "ANCHOR_BOTTOM_LEFT", ANCHOR_BOTTOM_LEFT);
+  register_constant(v, "ANCHOR_BOTTOM", ANCHOR_BOTTOM);
+  register_constant(v, "ANCHOR_BOTTOM_RIGHT", ANCHOR_BOTTOM_RIGHT);
+
+  register_function(v, "display", &display, "t.");
+  register_function(v, "print_stacktrace", SQ_FUNCTION(print_stacktrace));
+  register_function(v, "get_current_thread", &get_current_thread, "t");
+  register_function(v, "is_christmas", SQ_FUNCTION(is_christmas));
+  register_function(v, "display_text_file", SQ_FUNCTION(display_text_file));
+  register_function(v, "load_worldmap", SQ_FUNCTION(load_worldmap));
+  register_function(v, "set_next_worldmap", SQ_FUNCTION(set_next_worldmap));
+  register_function(v, "load_level", SQ_FUNCTION(load_level));
+  register_function(v, "start_cutscene", SQ_FUNCTION(start_cutscene));
+  register_function(v, "end_cutscene", SQ_FUNCTION(end_cutscene));
+  register_function(v, "check_cutscene", SQ_FUNCTION(check_cutscene));
+  register_function(v, "wait", SQ_SUSPEND_FUNCTION(wait));
+  register_function(v, "wait_for_screenswitch", SQ_SUSPEND_FUNCTION(wait_for_screenswitch));
+  register_function(v, "exit_screen", SQ_FUNCTION(exit_screen));
+  register_function(v, "translate", SQ_FUNCTION(translate));
+  register_function(v, "_", SQ_FUNCTION(_));
+  register_function(v, "translate_plural", SQ_FUNCTION(translate_plural));
+  register_function(v, "__", SQ_FUNCTION(__));
+  register_function(v, "import", SQ_FUNCTION(import));
+  register_function(v, "save_state", SQ_FUNCTION(save_state));
+  register_function(v, "load_state", SQ_FUNCTION(load_state));
+  register_function(v, "debug_collrects", SQ_FUNCTION(debug_collrects));
+  register_function(v, "debug_show_fps", SQ_FUNCTION(debug_show_fps));
+  register_function(v, "debug_draw_solids_only", SQ_FUNCTION(debug_draw_solids_only));
+  register_function(v, "debug_draw_editor_images", SQ_FUNCTION(debug_draw_editor_images));
+  register_function(v, "debug_worldmap_ghost", SQ_FUNCTION(debug_worldmap_ghost));
+  register_function(v, "play_music", SQ_FUNCTION(play_music));
+  register_function(v, "fade_in_music", SQ_FUNCTION(fade_in_music));
+  register_function(v, "stop_music", SQ_FUNCTION(stop_music));
+  register_function(v, "resume_music", SQ_FUNCTION(resume_music));
+  register_function(v, "pause_music", SQ_FUNCTION(pause_music));
+  register_function(v, "play_sound", SQ_FUNCTION(play_sound));
+  register_function(v, "set_game_speed", SQ_FUNCTION(set_game_speed));
+  register_function(v, "grease", SQ_FUNCTION(grease));
+  register_function(v, "invincible", SQ_FUNCTION(invincible));
+  register_function(v, "ghost", SQ_FUNCTION(ghost));
+  register_function(v, "mortal", SQ_FUNCTION(mortal));
+  register_function(v, "restart", SQ_FUNCTION(restart));
+  register_function(v, "whereami", SQ_FUNCTION(whereami));
+  register_function(v, "gotoend", SQ_FUNCTION(gotoend));
+  register_function(v, "warp", SQ_FUNCTION(warp));
+  register_function(v, "camera", SQ_FUNCTION(camera));
+  register_function(v, "set_gamma", SQ_FUNCTION(set_gamma));
+  register_function(v, "rand", SQ_FUNCTION(rand));
+  register_function(v, "record_demo", SQ_FUNCTION(record_demo));
+  register_function(v, "play_demo", SQ_FUNCTION(play_demo));
+  register_function(v, "Level_finish", SQ_FUNCTION(Level_finish));
+  register_function(v, "Level_spawn", SQ_FUNCTION(Level_spawn));
+  register_function(v, "Level_set_start_point", SQ_FUNCTION(Level_set_start_point));
+  register_function(v, "Level_set_start_pos", SQ_FUNCTION(Level_set_start_pos));
+  register_function(v, "Level_set_respawn_point", SQ_FUNCTION(Level_set_respawn_point));
+  register_function(v, "Level_set_respawn_pos", SQ_FUNCTION(Level_set_respawn_pos));
+  register_function(v, "Level_flip_vertically", SQ_FUNCTION(Level_flip_vertically));
+  register_function(v, "Level_toggle_pause", SQ_FUNCTION(Level_toggle_pause));
+  register_function(v, "Level_edit", SQ_FUNCTION(Level_edit));
+
+  begin_class(v, "AmbientSound");
+  register_function(v, "set_pos", SQ_METHOD(AmbientSound, set_pos));
+  register_function(v, "get_pos_x", SQ_METHOD(AmbientSound, get_pos_x));
+  register_function(v, "get_pos_y", SQ_METHOD(AmbientSound, get_pos_y));
+  end_class(v, "AmbientSound");
+
+  begin_class(v, "Background");
+  register_function(v, "set_image", SQ_METHOD(Background, set_image));
+  register_function(v, "set_images", SQ_METHOD(Background, set_images));
+  register_function(v, "set_speed", SQ_METHOD(Background, set_speed));
+  register_function(v, "get_color_red", SQ_METHOD(Background, get_color_red));
+  register_function(v, "get_color_green", SQ_METHOD(Background, get_color_green));
+  register_function(v, "get_color_blue", SQ_METHOD(Background, get_color_blue));
+  register_function(v, "get_color_alpha", SQ_METHOD(Background, get_color_alpha));
+  register_function(v, "set_color", SQ_METHOD(Background, set_color));
+  register_function(v, "fade_color", SQ_METHOD(Background, fade_color));
+  end_class(v, "Background");
+
+  begin_class(v, "BadGuy");
+  register_function(v, "kill", SQ_METHOD(BadGuy, kill));
+  register_function(v, "ignite", SQ_METHOD(BadGuy, ignite));
+  register_function(v, "set_action", SQ_METHOD(BadGuy, set_action));
+  register_function(v, "set_sprite", SQ_METHOD(BadGuy, set_sprite));
+  end_class(v, "BadGuy");
+
+  begin_class(v, "Dispenser", "BadGuy");
+  register_function(v, "activate", SQ_METHOD(Dispenser, activate));
+  register_function(v, "deactivate", SQ_METHOD(Dispenser, deactivate));
+  end_class(v, "Dispenser");
+
+  begin_class(v, "WillOWisp", "BadGuy");
+  register_function(v, "goto_node", SQ_METHOD(WillOWisp, goto_node));
+  register_function(v, "set_state", SQ_METHOD(WillOWisp, set_state));
+  register_function(v, "start_moving", SQ_METHOD(WillOWisp, start_moving));
+  register_function(v, "stop_moving", SQ_METHOD(WillOWisp, stop_moving));
+  end_class(v, "WillOWisp");
+
+  begin_class(v, "Camera");
+  register_function(v, "reload_config", SQ_METHOD(Camera, reload_config));
+  register_function(v, "shake", SQ_METHOD(Camera, shake));
+  register_function(v, "set_pos", SQ_METHOD(Camera, set_pos));
+  register_function(v, "move", SQ_METHOD(Camera, move));
+  register_function(v, "set_mode", SQ_METHOD(Camera, set_mode));
+  register_function(v, "scroll_to", SQ_METHOD(Camera, scroll_to));
+  register_function(v, "get_current_scale", SQ_METHOD(Camera, get_current_scale));
+  register_function(v, "get_target_scale", SQ_METHOD(Camera, get_target_scale));
+  register_function(v, "set_scale", SQ_METHOD(Camera, set_scale));
+  register_function(v, "scale", SQ_METHOD(Camera, scale));
+  register_function(v, "ease_scale", SQ_METHOD(Camera, ease_scale));
+  register_function(v, "get_screen_width", SQ_METHOD(Camera, get_screen_width));
+  register_function(v, "get_screen_height", SQ_METHOD(Camera, get_screen_height));
+  register_function(v, "get_x", SQ_METHOD(Camera, get_x));
+  register_function(v, "get_y", SQ_METHOD(Camera, get_y));
+  end_class(v, "Camera");
+
+  begin_class(v, "Candle");
+  register_function(v, "get_burning", SQ_METHOD(Candle, get_burning));
+  register_function(v, "set_burning", SQ_METHOD(Candle, set_burning));
+  end_class(v, "Candle");
+
+  begin_class(v, "Clouds");
+  register_function(v, "set_enabled", SQ_METHOD(Clouds, set_enabled));
+  register_function(v, "get_enabled", SQ_METHOD(Clouds, get_enabled));
+  register_function(v, "fade_speed", SQ_METHOD(Clouds, fade_speed));
+  register_function(v, "fade_amount", SQ_METHOD(Clouds, fade_amount));
+  register_function(v, "set_amount", SQ_METHOD(Clouds, set_amount));
+  end_class(v, "Clouds");
+
+  begin_class(v, "CustomParticles");
+  register_function(v, "set_enabled", SQ_METHOD(CustomParticles, set_enabled));
+  register_function(v, "get_enabled", SQ_METHOD(CustomParticles, get_enabled));
+  register_function(v, "clear", SQ_METHOD(CustomParticles, clear));
+  register_function(v, "spawn_particles", SQ_METHOD(CustomParticles, spawn_particles));
+  register_function(v, "get_max_amount", SQ_METHOD(CustomParticles, get_max_amount));
+  register_function(v, "set_max_amount", SQ_METHOD(CustomParticles, set_max_amount));
+  register_function(v, "get_birth_mode", SQ_METHOD(CustomParticles, get_birth_mode));
+  register_function(v, "set_birth_mode", SQ_METHOD(CustomParticles, set_birth_mode));
+  register_function(v, "get_death_mode", SQ_METHOD(CustomParticles, get_death_mode));
+  register_function(v, "set_death_mode", SQ_METHOD(CustomParticles, set_death_mode));
+  register_function(v, "get_rotation_mode", SQ_METHOD(CustomParticles, get_rotation_mode));
+  register_function(v, "set_rotation_mode", SQ_METHOD(CustomParticles, set_rotation_mode));
+  register_function(v, "get_collision_mode", SQ_METHOD(CustomParticles, get_collision_mode));
+  register_function(v, "set_collision_mode", SQ_METHOD(CustomParticles, set_collision_mode));
+  register_function(v, "get_offscreen_mode", SQ_METHOD(CustomParticles, get_offscreen_mode));
+  register_function(v, "set_offscreen_mode", SQ_METHOD(CustomParticles, set_offscreen_mode));
+  register_function(v, "get_cover_screen", SQ_METHOD(CustomParticles, get_cover_screen));
+  register_function(v, "set_cover_screen", SQ_METHOD(CustomParticles, set_cover_screen));
+  register_function(v, "get_delay", SQ_METHOD(CustomParticles, get_delay));
+  register_function(v, "set_delay", SQ_METHOD(CustomParticles, set_delay));
+  register_function(v, "fade_delay", SQ_METHOD(CustomParticles, fade_delay));
+  register_function(v, "ease_delay", SQ_METHOD(CustomParticles, ease_delay));
+  register_function(v, "get_lifetime", SQ_METHOD(CustomParticles, get_lifetime));
+  register_function(v, "set_lifetime", SQ_METHOD(CustomParticles, set_lifetime));
+  register_function(v, "fade_lifetime", SQ_METHOD(CustomParticles, fade_lifetime));
+  register_function(v, "ease_lifetime", SQ_METHOD(CustomParticles, ease_lifetime));
+  register_function(v, "get_lifetime_variation", SQ_METHOD(CustomParticles, get_lifetime_variation));
+  register_function(v, "set_lifetime_variation", SQ_METHOD(CustomParticles, set_lifetime_variation));
+  register_function(v, "fade_lifetime_variation", SQ_METHOD(CustomParticles, fade_lifetime_variation));
+  register_function(v, "ease_lifetime_variation", SQ_METHOD(CustomParticles, ease_lifetime_variation));
+  register_function(v, "get_birth_time", SQ_METHOD(CustomParticles, get_birth_time));
+  register_function(v, "set_birth_time", SQ_METHOD(CustomParticles, set_birth_time));
+  register_function(v, "fade_birth_time", SQ_METHOD(CustomParticles, fade_birth_time));
+  register_function(v, "ease_birth_time", SQ_METHOD(CustomParticles, ease_birth_time));
+  register_function(v, "get_birth_time_variation", SQ_METHOD(CustomParticles, get_birth_time_variation));
+  register_function(v, "set_birth_time_variation", SQ_METHOD(CustomParticles, set_birth_time_variation));
+  register_function(v, "fade_birth_time_variation", SQ_METHOD(CustomParticles, fade_birth_time_variation));
+  register_function(v, "ease_birth_time_variation", SQ_METHOD(CustomParticles, ease_birth_time_variation));
+  register_function(v, "get_death_time", SQ_METHOD(CustomParticles, get_death_time));
+  register_function(v, "set_death_time", SQ_METHOD(CustomParticles, set_death_time));
+  register_function(v, "fade_death_time", SQ_METHOD(CustomParticles, fade_death_time));
+  register_function(v, "ease_death_time", SQ_METHOD(CustomParticles, ease_death_time));
+  register_function(v, "get_death_time_variation", SQ_METHOD(CustomParticles, get_death_time_variation));
+  register_function(v, "set_death_time_variation", SQ_METHOD(CustomParticles, set_death_time_variation));
+  register_function(v, "fade_death_time_variation", SQ_METHOD(CustomParticles, fade_death_time_variation));
+  register_function(v, "ease_death_time_variation", SQ_METHOD(CustomParticles, ease_death_time_variation));
+  register_function(v, "get_speed_x", SQ_METHOD(CustomParticles, get_speed_x));
+  register_function(v, "set_speed_x", SQ_METHOD(CustomParticles, set_speed_x));
+  register_function(v, "fade_speed_x", SQ_METHOD(CustomParticles, fade_speed_x));
+  register_function(v, "ease_speed_x", SQ_METHOD(CustomParticles, ease_speed_x));
+  register_function(v, "get_speed_y", SQ_METHOD(CustomParticles, get_speed_y));
+  register_function(v, "set_speed_y", SQ_METHOD(CustomParticles, set_speed_y));
+  register_function(v, "fade_speed_y", SQ_METHOD(CustomParticles, fade_speed_y));
+  register_function(v, "ease_speed_y", SQ_METHOD(CustomParticles, ease_speed_y));
+  register_function(v, "get_speed_variation_x", SQ_METHOD(CustomParticles, get_speed_variation_x));
+  register_function(v, "set_speed_variation_x", SQ_METHOD(CustomParticles, set_speed_variation_x));
+  register_function(v, "fade_speed_variation_x", SQ_METHOD(CustomParticles, fade_speed_variation_x));
+  register_function(v, "ease_speed_variation_x", SQ_METHOD(CustomParticles, ease_speed_variation_x));
+  register_function(v, "get_speed_variation_y", SQ_METHOD(CustomParticles, get_speed_variation_y));
+  register_function(v, "set_speed_variation_y", SQ_METHOD(CustomParticles, set_speed_variation_y));
+  register_function(v, "fade_speed_variation_y", SQ_METHOD(CustomParticles, fade_speed_variation_y));
+  register_function(v, "ease_speed_variation_y", SQ_METHOD(CustomParticles, ease_speed_variation_y));
+  register_function(v, "get_acceleration_x", SQ_METHOD(CustomParticles, get_acceleration_x));
+  register_function(v, "set_acceleration_x", SQ_METHOD(CustomParticles, set_acceleration_x));
+  register_function(v, "fade_acceleration_x", SQ_METHOD(CustomParticles, fade_acceleration_x));
+  register_function(v, "ease_acceleration_x", SQ_METHOD(CustomParticles, ease_acceleration_x));
+  register_function(v, "get_acceleration_y", SQ_METHOD(CustomParticles, get_acceleration_y));
+  register_function(v, "set_acceleration_y", SQ_METHOD(CustomParticles, set_acceleration_y));
+  register_function(v, "fade_acceleration_y", SQ_METHOD(CustomParticles, fade_acceleration_y));
+  register_function(v, "ease_acceleration_y", SQ_METHOD(CustomParticles, ease_acceleration_y));
+  register_function(v, "get_friction_x", SQ_METHOD(CustomParticles, get_friction_x));
+  register_function(v, "set_friction_x", SQ_METHOD(CustomParticles, set_friction_x));
+  register_function(v, "fade_friction_x", SQ_METHOD(CustomParticles, fade_friction_x));
+  register_function(v, "ease_friction_x", SQ_METHOD(CustomParticles, ease_friction_x));
+  register_function(v, "get_friction_y", SQ_METHOD(CustomParticles, get_friction_y));
+  register_function(v, "set_friction_y", SQ_METHOD(CustomParticles, set_friction_y));
+  register_function(v, "fade_friction_y", SQ_METHOD(CustomParticles, fade_friction_y));
+  register_function(v, "ease_friction_y", SQ_METHOD(CustomParticles, ease_friction_y));
+  register_function(v, "get_feather_factor", SQ_METHOD(CustomParticles, get_feather_factor));
+  register_function(v, "set_feather_factor", SQ_METHOD(CustomParticles, set_feather_factor));
+  register_function(v, "fade_feather_factor", SQ_METHOD(CustomParticles, fade_feather_factor));
+  register_function(v, "ease_feather_factor", SQ_METHOD(CustomParticles, ease_feather_factor));
+  register_function(v, "get_rotation", SQ_METHOD(CustomParticles, get_rotation));
+  register_function(v, "set_rotation", SQ_METHOD(CustomParticles, set_rotation));
+  register_function(v, "fade_rotation", SQ_METHOD(CustomParticles, fade_rotation));
+  register_function(v, "ease_rotation", SQ_METHOD(CustomParticles, ease_rotation));
+  register_function(v, "get_rotation_variation", SQ_METHOD(CustomParticles, get_rotation_variation));
+  register_function(v, "set_rotation_variation", SQ_METHOD(CustomParticles, set_rotation_variation));
+  register_function(v, "fade_rotation_variation", SQ_METHOD(CustomParticles, fade_rotation_variation));
+  register_function(v, "ease_rotation_variation", SQ_METHOD(CustomParticles, ease_rotation_variation));
+  register_function(v, "get_rotation_speed", SQ_METHOD(CustomParticles, get_rotation_speed));
+  register_function(v, "set_rotation_speed", SQ_METHOD(CustomParticles, set_rotation_speed));
+  register_function(v, "fade_rotation_speed", SQ_METHOD(CustomParticles, fade_rotation_speed));
+  register_function(v, "ease_rotation_speed", SQ_METHOD(CustomParticles, ease_rotation_speed));
+  register_function(v, "get_rotation_speed_variation", SQ_METHOD(CustomParticles, get_rotation_speed_variation));
+  register_function(v, "set_rotation_speed_variation", SQ_METHOD(CustomParticles, set_rotation_speed_variation));
+  register_function(v, "fade_rotation_speed_variation", SQ_METHOD(CustomParticles, fade_rotation_speed_variation));
+  register_function(v, "ease_rotation_speed_variation", SQ_METHOD(CustomParticles, ease_rotation_speed_variation));
+  register_function(v, "get_rotation_acceleration", SQ_METHOD(CustomParticles, get_rotation_acceleration));
+  register_function(v, "set_rotation_acceleration", SQ_METHOD(CustomParticles, set_rotation_acceleration));
+  register_function(v, "fade_rotation_acceleration", SQ_METHOD(CustomParticles, fade_rotation_acceleration));
+  register_function(v, "ease_rotation_acceleration", SQ_METHOD(CustomParticles, ease_rotation_acceleration));
+  register_function(v, "get_rotation_decceleration", SQ_METHOD(CustomParticles, get_rotation_decceleration));
+  register_function(v, "set_rotation_decceleration", SQ_METHOD(CustomParticles, set_rotation_decceleration));
+  register_function(v, "fade_rotation_decceleration", SQ_METHOD(CustomParticles, fade_rotation_decceleration));
+  register_function(v, "ease_rotation_decceleration", SQ_METHOD(CustomParticles, ease_rotation_decceleration));
+  end_class(v, "CustomParticles");
+
+  begin_class(v, "Decal");
+  register_function(v, "fade_sprite", SQ_METHOD(Decal, fade_sprite));
+  register_function(v, "change_sprite", SQ_METHOD(Decal, change_sprite));
+  register_function(v, "fade_in", SQ_METHOD(Decal, fade_in));
+  register_function(v, "fade_out", SQ_METHOD(Decal, fade_out));
+  end_class(v, "Decal");
+
+  begin_class(v, "DisplayEffect");
+  register_function(v, "fade_out", SQ_METHOD(DisplayEffect, fade_out));
+  register_function(v, "fade_in", SQ_METHOD(DisplayEffect, fade_in));
+  register_function(v, "set_black", SQ_METHOD(DisplayEffect, set_black));
+  register_function(v, "is_black", SQ_METHOD(DisplayEffect, is_black));
+  register_function(v, "sixteen_to_nine", SQ_METHOD(DisplayEffect, sixteen_to_nine));
+  register_function(v, "four_to_three", SQ_METHOD(DisplayEffect, four_to_three));
+  end_class(v, "DisplayEffect");
+
+  begin_class(v, "FloatingImage");
+  register_constructor<FloatingImage, const std::string&>(v, "FloatingImage");
+  register_function(v, "set_layer", SQ_METHOD(FloatingImage, set_layer));
+  register_function(v, "get_layer", SQ_METHOD(FloatingImage, get_layer));
+  register_function(v, "set_pos", SQ_METHOD(FloatingImage, set_pos));
+  register_function(v, "get_pos_x", SQ_METHOD(FloatingImage, get_pos_x));
+  register_function(v, "get_pos_y", SQ_METHOD(FloatingImage, get_pos_y));
+  register_function(v, "set_anchor_point", SQ_METHOD(FloatingImage, set_anchor_point));
+  register_function(v, "get_anchor_point", SQ_METHOD(FloatingImage, get_anchor_point));
+  register_function(v, "set_visible", SQ_METHOD(FloatingImage, set_visible));
+  register_function(v, "get_visible", SQ_METHOD(FloatingImage, get_visible));
+  register_function(v, "set_action", SQ_METHOD(FloatingImage, set_action));
+  register_function(v, "get_action", SQ_METHOD(FloatingImage, get_action));
+  register_function(v, "fade_in", SQ_METHOD(FloatingImage, fade_in));
+  register_function(v, "fade_out", SQ_METHOD(FloatingImage, fade_out));
+  end_class(v, "FloatingImage");
+
+  begin_class(v, "GameObjectManager");
+  register_function(v, "set_ambient_light", SQ_METHOD(GameObjectManager, set_ambient_light));
+  register_function(v, "fade_to_ambient_light", SQ_METHOD(GameObjectManager, fade_to_ambient_light));
+  register_function(v, "get_ambient_red", SQ_METHOD(GameObjectManager, get_ambient_red));
+  register_function(v, "get_ambient_green", SQ_METHOD(GameObjectManager, get_ambient_green));
+  register_function(v, "get_ambient_blue", SQ_METHOD(GameObjectManager, get_ambient_blue));
+  register_function(v, "set_music", SQ_METHOD(GameObjectManager, set_music));
+  end_class(v, "GameObjectManager");
+
+  begin_class(v, "Sector", "GameObjectManager");
+  register_function(v, "set_gravity", SQ_METHOD(Sector, set_gravity));
+  end_class(v, "Sector");
+
+  begin_class(v, "WorldMap", "GameObjectManager");
+  register_function(v, "get_tux_x", SQ_METHOD(WorldMap, get_tux_x));
+  register_function(v, "get_tux_y", SQ_METHOD(WorldMap, get_tux_y));
+  end_class(v, "WorldMap");
+
+  begin_class(v, "Gradient");
+  register_function(v, "set_direction", SQ_METHOD(Gradient, set_direction));
+  register_function(v, "get_direction", SQ_METHOD(Gradient, get_direction));
+  register_function(v, "set_color1", SQ_METHOD(Gradient, set_color1));
+  register_function(v, "set_color2", SQ_METHOD(Gradient, set_color2));
+  register_function(v, "set_colors", SQ_METHOD(Gradient, set_colors));
+  register_function(v, "fade_color1", SQ_METHOD(Gradient, fade_color1));
+  register_function(v, "fade_color2", SQ_METHOD(Gradient, fade_color2));
+  register_function(v, "fade_colors", SQ_METHOD(Gradient, fade_colors));
+  register_function(v, "swap_colors", SQ_METHOD(Gradient, swap_colors));
+  end_class(v, "Gradient");
+
+  begin_class(v, "LevelTime");
+  register_function(v, "start", SQ_METHOD(LevelTime, start));
+  register_function(v, "stop", SQ_METHOD(LevelTime, stop));
+  register_function(v, "get_time", SQ_METHOD(LevelTime, get_time));
+  register_function(v, "set_time", SQ_METHOD(LevelTime, set_time));
+  end_class(v, "LevelTime");
+
+  begin_class(v, "LitObject");
+  register_function(v, "get_action", SQ_METHOD(LitObject, get_action));
+  register_function(v, "set_action", SQ_METHOD(LitObject, set_action));
+  register_function(v, "get_light_action", SQ_METHOD(LitObject, get_light_action));
+  register_function(v, "set_light_action", SQ_METHOD(LitObject, set_light_action));
+  end_class(v, "LitObject");
+
+  begin_class(v, "ParticleSystem");
+  register_function(v, "set_enabled", SQ_METHOD(ParticleSystem, set_enabled));
+  register_function(v, "get_enabled", SQ_METHOD(ParticleSystem, get_enabled));
+  end_class(v, "ParticleSystem");
+
+  begin_class(v, "Platform");
+  register_function(v, "goto_node", SQ_METHOD(Platform, goto_node));
+  register_function(v, "set_node", SQ_METHOD(Platform, set_node));
+  register_function(v, "start_moving", SQ_METHOD(Platform, start_moving));
+  register_function(v, "stop_moving", SQ_METHOD(Platform, stop_moving));
+  register_function(v, "get_action", SQ_METHOD(Platform, get_action));
+  register_function(v, "set_action", SQ_METHOD(Platform, set_action));
+  end_class(v, "Platform");
+
+  begin_class(v, "Player");
+  register_function(v, "add_bonus", SQ_METHOD(Player, add_bonus));
+  register_function(v, "set_bonus", SQ_METHOD(Player, set_bonus));
+  register_function(v, "get_bonus", SQ_METHOD(Player, get_bonus));
+  register_function(v, "add_coins", SQ_METHOD(Player, add_coins));
+  register_function(v, "get_coins", SQ_METHOD(Player, get_coins));
+  register_function(v, "make_invincible", SQ_METHOD(Player, make_invincible));
+  register_function(v, "deactivate", SQ_METHOD(Player, deactivate));
+  register_function(v, "activate", SQ_METHOD(Player, activate));
+  register_function(v, "walk", SQ_METHOD(Player, walk));
+  register_function(v, "set_dir", SQ_METHOD(Player, set_dir));
+  register_function(v, "set_visible", SQ_METHOD(Player, set_visible));
+  register_function(v, "get_visible", SQ_METHOD(Player, get_visible));
+  register_function(v, "kill", SQ_METHOD(Player, kill));
+  register_function(v, "set_ghost_mode", SQ_METHOD(Player, set_ghost_mode));
+  register_function(v, "get_ghost_mode", SQ_METHOD(Player, get_ghost_mode));
+  register_function(v, "kick", SQ_METHOD(Player, kick));
+  register_function(v, "do_cheer", SQ_METHOD(Player, do_cheer));
+  register_function(v, "do_duck", SQ_METHOD(Player, do_duck));
+  register_function(v, "do_standup", SQ_METHOD(Player, do_standup));
+  register_function(v, "do_backflip", SQ_METHOD(Player, do_backflip));
+  register_function(v, "do_jump", SQ_METHOD(Player, do_jump));
+  register_function(v, "trigger_sequence", SQ_METHOD(Player, trigger_sequence));
+  register_function(v, "use_scripting_controller", SQ_METHOD(Player, use_scripting_controller));
+  register_function(v, "do_scripting_controller", SQ_METHOD(Player, do_scripting_controller));
+  register_function(v, "has_grabbed", SQ_METHOD(Player, has_grabbed));
+  register_function(v, "get_velocity_x", SQ_METHOD(Player, get_velocity_x));
+  register_function(v, "get_velocity_y", SQ_METHOD(Player, get_velocity_y));
+  register_function(v, "get_x", SQ_METHOD(Player, get_x));
+  register_function(v, "get_y", SQ_METHOD(Player, get_y));
+  register_function(v, "set_pos", SQ_METHOD(Player, set_pos));
+  register_function(v, "get_action", SQ_METHOD(Player, get_action));
+  end_class(v, "Player");
+
+  begin_class(v, "Rain");
+  register_function(v, "set_enabled", SQ_METHOD(Rain, set_enabled));
+  register_function(v, "get_enabled", SQ_METHOD(Rain, get_enabled));
+  register_function(v, "fade_speed", SQ_METHOD(Rain, fade_speed));
+  register_function(v, "fade_amount", SQ_METHOD(Rain, fade_amount));
+  register_function(v, "fade_angle", SQ_METHOD(Rain, fade_angle));
+  end_class(v, "Rain");
+
+  begin_class(v, "Rock");
+  end_class(v, "Rock");
+
+  begin_class(v, "ScriptedObject");
+  register_function(v, "set_action", SQ_METHOD(ScriptedObject, set_action));
+  register_function(v, "get_action", SQ_METHOD(ScriptedObject, get_action));
+  register_function(v, "get_name", SQ_METHOD(ScriptedObject, get_name));
+  register_function(v, "move", SQ_METHOD(ScriptedObject, move));
+  register_function(v, "set_pos", SQ_METHOD(ScriptedObject, set_pos));
+  register_function(v, "get_pos_x", SQ_METHOD(ScriptedObject, get_pos_x));
+  register_function(v, "get_pos_y", SQ_METHOD(ScriptedObject, get_pos_y));
+  register_function(v, "set_velocity", SQ_METHOD(ScriptedObject, set_velocity));
+  register_function(v, "get_velocity_x", SQ_METHOD(ScriptedObject, get_velocity_x));
+  register_function(v, "get_velocity_y", SQ_METHOD(ScriptedObject, get_velocity_y));
+  register_function(v, "enable_gravity", SQ_METHOD(ScriptedObject, enable_gravity));
+  register_function(v, "gravity_enabled", SQ_METHOD(ScriptedObject, gravity_enabled));
+  register_function(v, "set_visible", SQ_METHOD(ScriptedObject, set_visible));
+  register_function(v, "is_visible", SQ_METHOD(ScriptedObject, is_visible));
+  register_function(v, "set_solid", SQ_METHOD(ScriptedObject, set_solid));
+  register_function(v, "is_solid", SQ_METHOD(ScriptedObject, is_solid));
+  end_class(v, "ScriptedObject");
+
+  begin_class(v, "Spotlight");
+  register_function(v, "set_enabled", SQ_METHOD(Spotlight, set_enabled));
+  register_function(v, "is_enabled", SQ_METHOD(Spotlight, is_enabled));
+  register_function(v, "set_direction", SQ_METHOD(Spotlight, set_direction));
+  register_function(v, "set_angle", SQ_METHOD(Spotlight, set_angle));
+  register_function(v, "fade_angle", SQ_METHOD(Spotlight, fade_angle));
+  register_function(v, "ease_angle", SQ_METHOD(Spotlight, ease_angle));
+  register_function(v, "set_speed", SQ_METHOD(Spotlight, set_speed));
+  register_function(v, "fade_speed", SQ_METHOD(Spotlight, fade_speed));
+  register_function(v, "ease_speed", SQ_METHOD(Spotlight, ease_speed));
+  register_function(v, "set_color_rgba", SQ_METHOD(Spotlight, set_color_rgba));
+  register_function(v, "fade_color_rgba", SQ_METHOD(Spotlight, fade_color_rgba));
+  register_function(v, "ease_color_rgba", SQ_METHOD(Spotlight, ease_color_rgba));
+  end_class(v, "Spotlight");
+
+  begin_class(v, "Text");
+  register_function(v, "set_text", SQ_METHOD(Text, set_text));
+  register_function(v, "set_font", SQ_METHOD(Text, set_font));
+  register_function(v, "fade_in", SQ_METHOD(Text, fade_in));
+  register_function(v, "fade_out", SQ_METHOD(Text, fade_out));
+  register_function(v, "grow_in", SQ_METHOD(Text, grow_in));
+  register_function(v, "grow_out", SQ_METHOD(Text, grow_out));
+  register_function(v, "set_visible", SQ_METHOD(Text, set_visible));
+  register_function(v, "set_centered", SQ_METHOD(Text, set_centered));
+  register_function(v, "set_pos", SQ_METHOD(Text, set_pos));
+  register_function(v, "get_pos_x", SQ_METHOD(Text, get_pos_x));
+  register_function(v, "get_pos_y", SQ_METHOD(Text, get_pos_y));
+  register_function(v, "set_anchor_point", SQ_METHOD(Text, set_anchor_point));
+  register_function(v, "get_anchor_point", SQ_METHOD(Text, get_anchor_point));
+  register_function(v, "set_anchor_offset", SQ_METHOD(Text, set_anchor_offset));
+  register_function(v, "set_front_fill_color", SQ_METHOD(Text, set_front_fill_color));
+  register_function(v, "set_back_fill_color", SQ_METHOD(Text, set_back_fill_color));
+  register_function(v, "set_text_color", SQ_METHOD(Text, set_text_color));
+  register_function(v, "set_roundness", SQ_METHOD(Text, set_roundness));
+  end_class(v, "Text");
+
+  begin_class(v, "TextArray");
+  register_function(v, "clear", SQ_METHOD(TextArray, clear));
+  register_function(v, "add_text", SQ_METHOD(TextArray, add_text));
+  register_function(v, "add_text_duration", SQ_METHOD(TextArray, add_text_duration));
+  register_function(v, "set_text_index", SQ_METHOD(TextArray, set_text_index));
+  register_function(v, "set_keep_visible", SQ_METHOD(TextArray, set_keep_visible));
+  register_function(v, "set_fade_transition", SQ_METHOD(TextArray, set_fade_transition));
+  register_function(v, "set_fade_time", SQ_METHOD(TextArray, set_fade_time));
+  register_function(v, "set_done", SQ_METHOD(TextArray, set_done));
+  register_function(v, "set_auto", SQ_METHOD(TextArray, set_auto));
+  register_function(v, "next_text", SQ_METHOD(TextArray, next_text));
+  register_function(v, "prev_text", SQ_METHOD(TextArray, prev_text));
+  register_function(v, "set_text", SQ_METHOD(TextArray, set_text));
+  register_function(v, "set_font", SQ_METHOD(TextArray, set_font));
+  register_function(v, "fade_in", SQ_METHOD(TextArray, fade_in));
+  register_function(v, "fade_out", SQ_METHOD(TextArray, fade_out));
+  register_function(v, "grow_in", SQ_METHOD(TextArray, grow_in));
+  register_function(v, "grow_out", SQ_METHOD(TextArray, grow_out));
+  register_function(v, "set_visible", SQ_METHOD(TextArray, set_visible));
+  register_function(v, "set_centered", SQ_METHOD(TextArray, set_centered));
+  register_function(v, "set_pos", SQ_METHOD(TextArray, set_pos));
+  register_function(v, "get_pos_x", SQ_METHOD(TextArray, get_pos_x));
+  register_function(v, "get_pos_y", SQ_METHOD(TextArray, get_pos_y));
+  register_function(v, "set_anchor_point", SQ_METHOD(TextArray, set_anchor_point));
+  register_function(v, "get_anchor_point", SQ_METHOD(TextArray, get_anchor_point));
+  register_function(v, "set_anchor_offset", SQ_METHOD(TextArray, set_anchor_offset));
+  register_function(v, "set_front_fill_color", SQ_METHOD(TextArray, set_front_fill_color));
+  register_function(v, "set_back_fill_color", SQ_METHOD(TextArray, set_back_fill_color));
+  register_function(v, "set_text_color", SQ_METHOD(TextArray, set_text_color));
+  register_function(v, "set_roundness", SQ_METHOD(TextArray, set_roundness));
+  end_class(v, "TextArray");
+
+  begin_class(v, "Thunderstorm");
+  register_function(v, "start", SQ_METHOD(Thunderstorm, start));
+  register_function(v, "stop", SQ_METHOD(Thunderstorm, stop));
+  register_function(v, "thunder", SQ_METHOD(Thunderstorm, thunder));
+  register_function(v, "lightning", SQ_METHOD(Thunderstorm, lightning));
+  register_function(v, "flash", SQ_METHOD(Thunderstorm, flash));
+  register_function(v, "electrify", SQ_METHOD(Thunderstorm, electrify));
+  end_class(v, "Thunderstorm");
+
+  begin_class(v, "TileMap");
+  register_function(v, "goto_node", SQ_METHOD(TileMap, goto_node));
+  register_function(v, "set_node", SQ_METHOD(TileMap, set_node));
+  register_function(v, "start_moving", SQ_METHOD(TileMap, start_moving));
+  register_function(v, "stop_moving", SQ_METHOD(TileMap, stop_moving));
+  register_function(v, "get_tile_id", SQ_METHOD(TileMap, get_tile_id));
+  register_function(v, "get_tile_id_at", SQ_METHOD(TileMap, get_tile_id_at));
+  register_function(v, "change", SQ_METHOD(TileMap, change));
+  register_function(v, "change_at", SQ_METHOD(TileMap, change_at));
+  register_function(v, "fade", SQ_METHOD(TileMap, fade));
+  register_function(v, "tint_fade", SQ_METHOD(TileMap, tint_fade));
+  register_function(v, "set_alpha", SQ_METHOD(TileMap, set_alpha));
+  register_function(v, "get_alpha", SQ_METHOD(TileMap, get_alpha));
+  register_function(v, "set_solid", SQ_METHOD(TileMap, set_solid));
+  end_class(v, "TileMap");
+
+  begin_class(v, "Torch");
+  register_function(v, "get_burning", SQ_METHOD(Torch, get_burning));
+  register_function(v, "set_burning", SQ_METHOD(Torch, set_burning));
+  end_class(v, "Torch");
+
+  begin_class(v, "Wind");
+  register_function(v, "start", SQ_METHOD(Wind, start));
+  register_function(v, "stop", SQ_METHOD(Wind, stop));
+  end_class(v, "Wind");
 }
 
 } // namespace scripting
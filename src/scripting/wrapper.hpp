@@ -1,8 +1,19 @@
-/**
- * WARNING: This file is automatically generated from:
- *  'src/scripting/wrapper.interface.hpp'
- * DO NOT CHANGE
- */
+//  SuperTux
+//  Copyright (C) 2024 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
 #ifndef HEADER_SUPERTUX_SCRIPTING_WRAPPER_HPP
 #define HEADER_SUPERTUX_SCRIPTING_WRAPPER_HPP
 
@@ -10,6 +21,8 @@
 
 namespace scripting {
 
+/** Registers all classes, functions and constants of the scripting
+    API in the table on top of the stack */
 void register_supertux_wrapper(HSQUIRRELVM v);
 
 class AmbientSound;
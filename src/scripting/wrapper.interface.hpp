@@ -1,4 +1,4 @@
-/* This file is processed by miniswig to produce the scripting API */
+/* All headers of the scripting API, bound in scripting/wrapper.cpp */
 #include "scripting/ambient_sound.hpp"
 #include "scripting/anchor_points.hpp"
 #include "scripting/background.hpp"
@@ -154,6 +154,14 @@ Sprite::draw(Canvas& canvas, const Vector& pos, int layer,
   assert(m_action != nullptr);
   update();
 
+  const SurfacePtr& surface = m_action->surfaces[m_frameidx];
+  const Vector surface_pos = pos - Vector(m_action->x_offset, flip == NO_FLIP ? m_action->y_offset : (static_cast<float>(surface->get_height()) - m_action->y_offset - m_action->hitbox_h));
+
+  // Skip the transform for sprites that are off screen, dark levels
+  // draw a lot of light sprites
+  if (!canvas.is_visible(Rectf(surface_pos, Sizef(static_cast<float>(surface->get_width()),
+                                                  static_cast<float>(surface->get_height()))), m_angle))
+    return;
 
   DrawingContext& context = canvas.get_context();
   context.push_transform();
@@ -161,8 +169,8 @@ Sprite::draw(Canvas& canvas, const Vector& pos, int layer,
   context.set_flip(context.get_flip() ^ flip);
   context.set_alpha(context.get_alpha() * m_alpha);
 
-  canvas.draw_surface(m_action->surfaces[m_frameidx],
-                    pos - Vector(m_action->x_offset, flip == NO_FLIP ? m_action->y_offset : (static_cast<float>(m_action->surfaces[m_frameidx]->get_height()) - m_action->y_offset - m_action->hitbox_h)),
+  canvas.draw_surface(surface,
+                    surface_pos,
                     m_angle,
                     m_color,
                     m_blend,
@@ -0,0 +1,418 @@
+//  SuperTux
+//  Copyright (C) 2024 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef HEADER_SUPERTUX_SQUIRREL_SQUIRREL_BINDING_HPP
+#define HEADER_SUPERTUX_SQUIRREL_SQUIRREL_BINDING_HPP
+
+#include <assert.h>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include <squirrel.h>
+
+#include "squirrel/squirrel_error.hpp"
+
+/** Binds C++ functions and methods to Squirrel. The wrapper for a
+    function is instantiated from its signature: arguments are read
+    from the stack and converted at compile time, and the type mask
+    used by the VM to check the arguments is derived from the same
+    signature, so a binding is a single line in scripting/wrapper.cpp.
+
+    Supported argument and return types are float, int, bool and
+    std::string. A leading HSQUIRRELVM argument receives the calling
+    VM and takes no script argument. */
+
+/** Wrapper for the method \a method of class \a cls */
+#define SQ_METHOD(cls, method) \
+  ::squirrel::MethodBinding<cls, decltype(&cls::method), &cls::method>()
+
+/** Wrapper for the free function \a function */
+#define SQ_FUNCTION(function) \
+  ::squirrel::FunctionBinding<decltype(&function), &function, false>()
+
+/** Wrapper for a free function that suspends the calling VM once
+    it returns, like wait() */
+#define SQ_SUSPEND_FUNCTION(function) \
+  ::squirrel::FunctionBinding<decltype(&function), &function, true>()
+
+namespace squirrel {
+
+/** How values of a C++ type are read from and pushed to the stack.
+    \a checked is set when every value the type mask lets through can
+    be read with get(), so the wrapper doesn't have to check again. */
+template<typename T>
+struct TypeTraits;
+
+template<>
+struct TypeTraits<float>
+{
+  typedef SQFloat Value;
+  static const char* name() { return "a float"; }
+  static const char* typemask() { return "b|n"; }
+  // sq_getfloat() rejects bools
+  static constexpr bool checked = false;
+  static SQRESULT get(HSQUIRRELVM vm, SQInteger idx, Value& value) { return sq_getfloat(vm, idx, &value); }
+  static float convert(Value value) { return value; }
+  static void push(HSQUIRRELVM vm, float value) { sq_pushfloat(vm, value); }
+};
+
+template<>
+struct TypeTraits<int>
+{
+  typedef SQInteger Value;
+  static const char* name() { return "an integer"; }
+  static const char* typemask() { return "b|n"; }
+  // sq_getinteger() reads bools as 0 and 1
+  static constexpr bool checked = true;
+  static SQRESULT get(HSQUIRRELVM vm, SQInteger idx, Value& value) { return sq_getinteger(vm, idx, &value); }
+  static int convert(Value value) { return static_cast<int>(value); }
+  static void push(HSQUIRRELVM vm, int value) { sq_pushinteger(vm, value); }
+};
+
+template<>
+struct TypeTraits<bool>
+{
+  typedef SQBool Value;
+  static const char* name() { return "a bool"; }
+  static const char* typemask() { return "b|n"; }
+  // sq_getbool() rejects numbers
+  static constexpr bool checked = false;
+  static SQRESULT get(HSQUIRRELVM vm, SQInteger idx, Value& value) { return sq_getbool(vm, idx, &value); }
+  static bool convert(Value value) { return value == SQTrue; }
+  static void push(HSQUIRRELVM vm, bool value) { sq_pushbool(vm, value); }
+};
+
+template<>
+struct TypeTraits<std::string>
+{
+  typedef const SQChar* Value;
+  static const char* name() { return "a string"; }
+  static const char* typemask() { return "s"; }
+  static constexpr bool checked = true;
+  static SQRESULT get(HSQUIRRELVM vm, SQInteger idx, Value& value) { return sq_getstring(vm, idx, &value); }
+  static const SQChar* convert(Value value) { return value; }
+  static void push(HSQUIRRELVM vm, const std::string& value)
+  {
+    assert(value.size() < static_cast<size_t>(std::numeric_limits<SQInteger>::max()));
+    sq_pushstring(vm, value.c_str(), static_cast<SQInteger>(value.size()));
+  }
+};
+
+namespace detail {
+
+template<typename T>
+using Traits = TypeTraits<typename std::decay<T>::type>;
+
+inline SQInteger throw_error(HSQUIRRELVM vm, const std::string& message)
+{
+  sq_throwerror(vm, message.c_str());
+  return SQ_ERROR;
+}
+
+/** The name of the running native closure, only used for error
+    messages so that the wrappers don't need to carry it */
+inline std::string get_function_name(HSQUIRRELVM vm)
+{
+  SQStackInfos info;
+  if (SQ_SUCCEEDED(sq_stackinfos(vm, 0, &info)) && info.funcname)
+    return info.funcname;
+  return "unknown";
+}
+
+template<typename... Args>
+std::string typemask()
+{
+  std::string mask = ".";
+  const char* const masks[] = { "", Traits<Args>::typemask()... };
+  for (const char* arg : masks)
+  {
+    mask += arg;
+  }
+  return mask;
+}
+
+/** Reads the argument at \a idx, returns false if it has the wrong
+    type. Reading a type the type mask fully checks can't fail. */
+template<typename T>
+bool get_argument(HSQUIRRELVM vm, SQInteger idx, typename Traits<T>::Value& value)
+{
+  const SQRESULT result = Traits<T>::get(vm, idx, value);
+  if (Traits<T>::checked)
+  {
+    assert(SQ_SUCCEEDED(result));
+    return true;
+  }
+  return SQ_SUCCEEDED(result);
+}
+
+template<typename R>
+struct Return
+{
+  template<typename F>
+  static SQInteger call(HSQUIRRELVM vm, const F& func)
+  {
+    Traits<R>::push(vm, func());
+    return 1;
+  }
+};
+
+template<>
+struct Return<void>
+{
+  template<typename F>
+  static SQInteger call(HSQUIRRELVM, const F& func)
+  {
+    func();
+    return 0;
+  }
+};
+
+/** Reads the script arguments from stack index 2 on, calls \a func
+    with them and pushes its result */
+template<typename R, typename... Args, typename F, size_t... I>
+SQInteger call(HSQUIRRELVM vm, const F& func, std::index_sequence<I...>)
+{
+  std::tuple<typename Traits<Args>::Value...> values;
+  const bool valid[] = { true, get_argument<Args>(vm, static_cast<SQInteger>(I) + 2, std::get<I>(values))... };
+  for (size_t i = 1; i < sizeof(valid) / sizeof(valid[0]); ++i)
+  {
+    if (!valid[i])
+    {
+      const char* const names[] = { "", Traits<Args>::name()... };
+      std::ostringstream msg;
+      msg << "Argument " << i << " not " << names[i];
+      return throw_error(vm, msg.str());
+    }
+  }
+  (void) values;
+
+  try
+  {
+    return Return<R>::call(vm, [&func, &values]() -> R {
+      return func(Traits<Args>::convert(std::get<I>(values))...);
+    });
+  }
+  catch (const std::exception& e)
+  {
+    return throw_error(vm, e.what());
+  }
+  catch (...)
+  {
+    return throw_error(vm, "Unexpected exception while executing function '" + get_function_name(vm) + "'");
+  }
+}
+
+template<typename F>
+struct Signature;
+
+template<typename R, typename... Args>
+struct Signature<R (*)(Args...)>
+{
+  static std::string typemask() { return detail::typemask<Args...>(); }
+
+  template<typename F>
+  static SQInteger call(HSQUIRRELVM vm, const F& func)
+  {
+    return detail::call<typename std::decay<R>::type, Args...>(vm, func, std::index_sequence_for<Args...>());
+  }
+};
+
+template<typename R, typename... Args>
+struct Signature<R (*)(HSQUIRRELVM, Args...)>
+{
+  static std::string typemask() { return detail::typemask<Args...>(); }
+
+  template<typename F>
+  static SQInteger call(HSQUIRRELVM vm, const F& func)
+  {
+    return detail::call<typename std::decay<R>::type, Args...>(vm, [vm, &func](auto&&... args) {
+        return func(vm, std::forward<decltype(args)>(args)...);
+      }, std::index_sequence_for<Args...>());
+  }
+};
+
+template<typename R, typename C, typename... Args>
+struct Signature<R (C::*)(Args...)> : public Signature<R (*)(Args...)> {};
+
+template<typename R, typename C, typename... Args>
+struct Signature<R (C::*)(Args...) const> : public Signature<R (*)(Args...)> {};
+
+} // namespace detail
+
+template<typename T, typename M, M method>
+struct MethodBinding
+{
+  static std::string typemask() { return detail::Signature<M>::typemask(); }
+
+  static SQInteger wrapper(HSQUIRRELVM vm)
+  {
+    SQUserPointer data;
+    if (SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data)
+      return detail::throw_error(vm, "'" + detail::get_function_name(vm) + "' called without instance");
+
+    T* object = reinterpret_cast<T*>(data);
+    return detail::Signature<M>::call(vm, [object](auto&&... args) {
+        return (object->*method)(std::forward<decltype(args)>(args)...);
+      });
+  }
+};
+
+template<typename F, F function, bool suspend>
+struct FunctionBinding
+{
+  static std::string typemask() { return detail::Signature<F>::typemask(); }
+
+  static SQInteger wrapper(HSQUIRRELVM vm)
+  {
+    const SQInteger result = detail::Signature<F>::call(vm, function);
+    if (!suspend || result == SQ_ERROR)
+      return result;
+    return sq_suspendvm(vm);
+  }
+};
+
+template<typename T>
+SQInteger release_hook(SQUserPointer ptr, SQInteger)
+{
+  delete reinterpret_cast<T*>(ptr);
+  return 0;
+}
+
+/** Wrapper for the script constructor of \a T, taking \a Args. The
+    closure carries the script class name as its free variable, see
+    register_constructor(). */
+template<typename T, typename... Args>
+struct ConstructorBinding
+{
+  static std::string typemask() { return detail::typemask<Args...>(); }
+
+  static SQInteger wrapper(HSQUIRRELVM vm)
+  {
+    return detail::call<void, Args...>(vm, [vm](auto&&... args) {
+        auto object = new T(std::forward<decltype(args)>(args)...);
+        if (SQ_FAILED(sq_setinstanceup(vm, 1, object)))
+        {
+          delete object;
+          const SQChar* class_name = "";
+          sq_getstring(vm, sq_gettop(vm), &class_name);
+          throw std::runtime_error(std::string("Couldn't setup instance of '") + class_name + "' class");
+        }
+        sq_setreleasehook(vm, 1, &release_hook<T>);
+      }, std::index_sequence_for<Args...>());
+  }
+};
+
+inline void register_constant(HSQUIRRELVM v, const char* name, int value)
+{
+  sq_pushstring(v, name, -1);
+  sq_pushinteger(v, value);
+  if (SQ_FAILED(sq_createslot(v, -3))) {
+    throw SquirrelError(v, std::string("Couldn't register constant '") + name + "'");
+  }
+}
+
+/** Adds \a func to the table or class on top of the stack */
+inline void register_function(HSQUIRRELVM v, const char* name, SQFUNCTION func, const std::string& typemask)
+{
+  sq_pushstring(v, name, -1);
+  sq_newclosure(v, func, 0);
+  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, typemask.c_str());
+  sq_setnativeclosurename(v, -1, name);
+  if (SQ_FAILED(sq_createslot(v, -3))) {
+    throw SquirrelError(v, std::string("Couldn't register function '") + name + "'");
+  }
+}
+
+template<typename Binding>
+void register_function(HSQUIRRELVM v, const char* name, Binding)
+{
+  register_function(v, name, &Binding::wrapper, Binding::typemask());
+}
+
+/** Adds the constructor of \a T, taking \a Args, to the class on top
+    of the stack, \a class_name is the name used in its errors */
+template<typename T, typename... Args>
+void register_constructor(HSQUIRRELVM v, const char* class_name)
+{
+  typedef ConstructorBinding<T, Args...> Binding;
+
+  sq_pushstring(v, "constructor", -1);
+  sq_pushstring(v, class_name, -1);
+  sq_newclosure(v, &Binding::wrapper, 1);
+  sq_setparamscheck(v, SQ_MATCHTYPEMASKSTRING, Binding::typemask().c_str());
+  sq_setnativeclosurename(v, -1, "constructor");
+  if (SQ_FAILED(sq_createslot(v, -3))) {
+    throw SquirrelError(v, std::string("Couldn't register constructor of '") + class_name + "'");
+  }
+}
+
+/** Pushes a new class, derived from the class \a base in the table on
+    top of the stack if given. The methods are registered with
+    register_function(), the class is added by end_class(). */
+inline void begin_class(HSQUIRRELVM v, const char* name, const char* base = nullptr)
+{
+  sq_pushstring(v, name, -1);
+  if (base)
+  {
+    sq_pushstring(v, base, -1);
+    sq_get(v, -3);
+  }
+  if (sq_newclass(v, base ? SQTrue : SQFalse) < 0) {
+    throw SquirrelError(v, std::string("Couldn't create new class '") + name + "'");
+  }
+}
+
+inline void end_class(HSQUIRRELVM v, const char* name)
+{
+  if (SQ_FAILED(sq_createslot(v, -3))) {
+    throw SquirrelError(v, std::string("Couldn't register class '") + name + "'");
+  }
+}
+
+/** Pushes a new instance of the script class \a class_name for
+    \a object, which is deleted with the instance if
+    \a setup_releasehook is set */
+template<typename T>
+void create_instance(HSQUIRRELVM v, T* object, const char* class_name, bool setup_releasehook)
+{
+  sq_pushroottable(v);
+  sq_pushstring(v, class_name, -1);
+  if (SQ_FAILED(sq_get(v, -2))) {
+    throw SquirrelError(v, std::string("Couldn't resolved squirrel type '") + class_name + "'");
+  }
+
+  if (SQ_FAILED(sq_createinstance(v, -1)) || SQ_FAILED(sq_setinstanceup(v, -1, object))) {
+    throw SquirrelError(v, std::string("Couldn't setup squirrel instance for object of type '") + class_name + "'");
+  }
+  sq_remove(v, -2); // remove object name
+
+  if (setup_releasehook) {
+    sq_setreleasehook(v, -1, &release_hook<T>);
+  }
+
+  sq_remove(v, -2); // remove root table
+}
+
+} // namespace squirrel
+
+#endif
+
+/* EOF */
@@ -52,7 +52,9 @@ CommandLineArguments::CommandLineArguments() :
   christmas_mode(),
   repository_url(),
   editor(),
-  resave()
+  resave(),
+  validate_levels(),
+  resave_levels()
 {
 }
 
@@ -115,6 +117,8 @@ CommandLineArguments::print_help(const char* arg0) const
     << _("Game Options:") << "\n"
     << _("  --edit-level                 Open given level in editor") << "\n"
     << _("  --resave                     Loads given level and saves it") << "\n"
+    << _("  --validate-levels DIR        Load all levels in DIR and print a report") << "\n"
+    << _("  --resave-levels DIR          Load and save all levels in DIR and print a report") << "\n"
     << _("  --show-fps                   Display framerate in levels") << "\n"
     << _("  --no-show-fps                Do not display framerate in levels") << "\n"
     << _("  --show-pos                   Display player's current position") << "\n"
@@ -395,6 +399,18 @@ CommandLineArguments::parse_args(int argc, char** argv)
     {
       resave = true;
     }
+    else if (arg == "--validate-levels")
+    {
+      if (++i >= argc)
+        throw std::runtime_error("--validate-levels DIR needs an argument");
+      validate_levels = std::string(argv[i]);
+    }
+    else if (arg == "--resave-levels")
+    {
+      if (++i >= argc)
+        throw std::runtime_error("--resave-levels DIR needs an argument");
+      resave_levels = std::string(argv[i]);
+    }
     else if (arg[0] != '-')
     {
       filenames.push_back(arg);
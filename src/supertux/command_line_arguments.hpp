@@ -81,6 +81,8 @@ public:
 
   boost::optional<bool> editor;
   boost::optional<bool> resave;
+  boost::optional<std::string> validate_levels;
+  boost::optional<std::string> resave_levels;
 
   // boost::optional<std::string> locale;
 
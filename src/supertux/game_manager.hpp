@@ -33,7 +33,8 @@ public:
 
   void start_worldmap(const World& world, const std::string& spawnpoint = "", const std::string& worldmap_filename = "");
   void start_level(const World& world, const std::string& level_filename,
-                   const boost::optional<std::pair<std::string, Vector>>& start_pos = boost::none);
+                   const boost::optional<std::pair<std::string, Vector>>& start_pos = boost::none,
+                   std::string level_data = std::string());
 
   bool load_next_worldmap();
   void set_next_worldmap(const std::string& worldmap, const std::string &spawnpoint);
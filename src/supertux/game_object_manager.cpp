@@ -30,7 +30,7 @@ GameObjectManager::GameObjectManager() :
   m_solid_tilemaps(),
   m_all_tilemaps(),
   m_objects_by_name(),
-  m_objects_by_uid(),
+  m_objects_by_slot(),
   m_objects_by_type_index(),
   m_name_resolve_requests()
 {
@@ -106,7 +106,13 @@ GameObjectManager::add_object(std::unique_ptr<GameObject> object)
   assert(object);
   assert(!object->get_uid());
 
-  object->set_uid(m_uid_generator.next());
+  const UID uid = m_uid_generator.next();
+  object->set_uid(uid);
+  if (m_objects_by_slot.size() < m_uid_generator.get_slot_count())
+  {
+    m_objects_by_slot.resize(m_uid_generator.get_slot_count(), ObjectSlot{UID(), nullptr});
+  }
+  m_objects_by_slot[uid.get_index()] = ObjectSlot{uid, object.get()};
 
   // make sure the object isn't already in the list
 #ifndef NDEBUG
@@ -130,6 +136,7 @@ GameObjectManager::clear_objects()
 
   for (const auto& obj: m_gameobjects) {
     before_object_remove(*obj);
+    release_uid(*obj);
   }
   m_gameobjects.clear();
 }
@@ -176,6 +183,7 @@ GameObjectManager::flush_game_objects()
                        {
                          this_before_object_remove(*obj);
                          before_object_remove(*obj);
+                         release_uid(*obj);
                          return true;
                        } else {
                          return false;
@@ -196,6 +204,10 @@ GameObjectManager::flush_game_objects()
           this_before_object_add(*object);
           m_gameobjects.push_back(std::move(object));
         }
+        else
+        {
+          release_uid(*object);
+        }
       }
     }
   }
@@ -236,12 +248,6 @@ GameObjectManager::this_before_object_add(GameObject& object)
     }
   }
 
-  { // by_id
-    assert(object.get_uid());
-
-    m_objects_by_uid[object.get_uid()] = &object;
-  }
-
   { // by_type_index
     m_objects_by_type_index[std::type_index(typeid(object))].push_back(&object);
   }
@@ -258,10 +264,6 @@ GameObjectManager::this_before_object_remove(GameObject& object)
     }
   }
 
-  { // by_id
-    m_objects_by_uid.erase(object.get_uid());
-  }
-
   { // by_type_index
     auto& vec = m_objects_by_type_index[std::type_index(typeid(object))];
     auto it = std::find(vec.begin(), vec.end(), &object);
@@ -270,6 +272,16 @@ GameObjectManager::this_before_object_remove(GameObject& object)
   }
 }
 
+void
+GameObjectManager::release_uid(GameObject& object)
+{
+  const UID uid = object.get_uid();
+  assert(m_objects_by_slot[uid.get_index()].object == &object);
+
+  m_objects_by_slot[uid.get_index()] = ObjectSlot{UID(), nullptr};
+  m_uid_generator.release(uid);
+}
+
 float
 GameObjectManager::get_width() const
 {
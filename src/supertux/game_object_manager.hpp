@@ -115,31 +115,26 @@ public:
   template<class T>
   T* get_object_by_uid(const UID& uid) const
   {
-    auto it = m_objects_by_uid.find(uid);
-    if (it == m_objects_by_uid.end())
-    {
-      // FIXME: Is this a good idea? Should gameobjects be made
-      // accessible even when not fully inserted into the manager?
-      for (auto&& itnew : m_gameobjects_new)
-      {
-        if (itnew->get_uid() == uid)
-          return static_cast<T*>(itnew.get());
-      }
+    // UIDs of removed objects or of other managers don't match the
+    // slot, objects queued up in add_object() are already registered
+    const uint32_t index = uid.get_index();
+    if (index >= m_objects_by_slot.size())
       return nullptr;
-    }
-    else
-    {
+
+    const ObjectSlot& slot = m_objects_by_slot[index];
+    if (slot.uid != uid || !slot.object)
+      return nullptr;
+
 #ifdef NDEBUG
-      return static_cast<T*>(it->second);
+    return static_cast<T*>(slot.object);
 #else
-      // Since uids should be unique, there should be no need to guess
-      // the type, thus we assert() when the object type is not what
-      // we expected.
-      auto ptr = dynamic_cast<T*>(it->second);
-      assert(ptr != nullptr);
-      return ptr;
+    // Since uids should be unique, there should be no need to guess
+    // the type, thus we assert() when the object type is not what
+    // we expected.
+    auto ptr = dynamic_cast<T*>(slot.object);
+    assert(ptr != nullptr);
+    return ptr;
 #endif
-    }
   }
 
   /** Register a callback to be called once the given name can be
@@ -201,10 +196,20 @@ protected:
     }
   }
 
+private:
+  struct ObjectSlot
+  {
+    UID uid;
+    GameObject* object;
+  };
+
 private:
   void this_before_object_add(GameObject& object);
   void this_before_object_remove(GameObject& object);
 
+  /** Clear the slot of an object that is about to be destroyed */
+  void release_uid(GameObject& object);
+
 private:
   UIDGenerator m_uid_generator;
 
@@ -220,7 +225,10 @@ private:
   std::vector<TileMap*> m_all_tilemaps;
 
   std::unordered_map<std::string, GameObject*> m_objects_by_name;
-  std::unordered_map<UID, GameObject*> m_objects_by_uid;
+
+  /** Objects indexed by UID::get_index(), filled in by add_object() */
+  std::vector<ObjectSlot> m_objects_by_slot;
+
   std::unordered_map<std::type_index, std::vector<GameObject*> > m_objects_by_type_index;
 
   std::vector<NameResolveRequest> m_name_resolve_requests;
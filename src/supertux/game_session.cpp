@@ -46,7 +46,8 @@
 #include "video/surface.hpp"
 #include "worldmap/worldmap.hpp"
 
-GameSession::GameSession(const std::string& levelfile_, Savegame& savegame, Statistics* statistics) :
+GameSession::GameSession(const std::string& levelfile_, Savegame& savegame, Statistics* statistics,
+                         std::string level_data) :
   GameSessionRecorder(),
   reset_button(false),
   reset_checkpoint_button(false),
@@ -59,6 +60,7 @@ GameSession::GameSession(const std::string& levelfile_, Savegame& savegame, Stat
   m_game_pause(false),
   m_speed_before_pause(ScreenManager::current()->get_speed()),
   m_levelfile(levelfile_),
+  m_level_data(std::move(level_data)),
   m_spawnpoints(),
   m_activated_checkpoint(),
   m_newsector(),
@@ -158,7 +160,10 @@ GameSession::restart_level(bool after_death)
 
   try {
     m_old_level = std::move(m_level);
-    m_level = LevelParser::from_file(m_levelfile, false, false);
+    if (m_level_data.empty())
+      m_level = LevelParser::from_file(m_levelfile, false, false);
+    else
+      m_level = LevelParser::from_string(m_level_data, m_levelfile, false, false);
 
     /* Determine the spawnpoint to spawn/respawn Tux to. */
     const GameSession::SpawnPoint* spawnpoint = nullptr;
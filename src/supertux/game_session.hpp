@@ -76,7 +76,10 @@ private:
   };
 
 public:
-  GameSession(const std::string& levelfile, Savegame& savegame, Statistics* statistics = nullptr);
+  /** @a level_data, when given, is played instead of the content of
+      @a levelfile, e.g. the level currently open in the editor */
+  GameSession(const std::string& levelfile, Savegame& savegame, Statistics* statistics = nullptr,
+              std::string level_data = std::string());
 
   virtual void draw(Compositor& compositor) override;
   virtual void update(float dt_sec, const Controller& controller) override;
@@ -157,6 +160,7 @@ private:
   float m_speed_before_pause;
 
   std::string m_levelfile;
+  std::string m_level_data;
 
   // Spawnpoints
   std::vector<SpawnPoint> m_spawnpoints;
@@ -19,10 +19,12 @@
 #include "config.h"
 
 #include "editor/overlay_widget.hpp"
+#include "math/util.hpp"
 #include "supertux/colorscheme.hpp"
 #include "util/reader_collection.hpp"
 #include "util/reader_document.hpp"
 #include "util/reader_mapping.hpp"
+#include "util/save_queue.hpp"
 #include "util/writer.hpp"
 #include "util/log.hpp"
 #include "video/video_system.hpp"
@@ -53,6 +55,9 @@ Config::Config() :
 #endif
   video(VideoSystem::VIDEO_AUTO),
   try_vsync(true),
+  ttf_glyph_atlas(true),
+  preload_level_tiles(true),
+  lightmap_scale(5),
   show_fps(false),
   show_player_pos(false),
   show_controller(false),
@@ -60,6 +65,7 @@ Config::Config() :
   music_enabled(true),
   sound_volume(100),
   music_volume(50),
+  sound_buffer_cache_size(32),
   random_seed(0), // set by time(), by default (unless in config)
   enable_script_debugger(false),
   start_demo(),
@@ -273,6 +279,10 @@ Config::load()
     config_video_mapping->get("video", video_string);
     video = VideoSystem::get_video_system(video_string);
     config_video_mapping->get("vsync", try_vsync);
+    config_video_mapping->get("ttf_glyph_atlas", ttf_glyph_atlas);
+    config_video_mapping->get("preload_level_tiles", preload_level_tiles);
+    config_video_mapping->get("lightmap_scale", lightmap_scale);
+    lightmap_scale = math::clamp(lightmap_scale, 1, 16);
 
     config_video_mapping->get("fullscreen_width",  fullscreen_size.width);
     config_video_mapping->get("fullscreen_height", fullscreen_size.height);
@@ -310,6 +320,7 @@ Config::load()
     config_audio_mapping->get("music_enabled", music_enabled);
     config_audio_mapping->get("sound_volume", sound_volume);
     config_audio_mapping->get("music_volume", music_volume);
+    config_audio_mapping->get("buffer_cache_size", sound_buffer_cache_size);
   }
 
   boost::optional<ReaderMapping> config_control_mapping;
@@ -359,8 +370,12 @@ Config::load()
 void
 Config::save()
 {
-  Writer writer("config");
+  SaveQueue::save_file("config", [this](Writer& writer) { save(writer); });
+}
 
+void
+Config::save(Writer& writer)
+{
   writer.start_list("supertux-config");
 
   writer.write("profile", profile);
@@ -438,6 +453,9 @@ Config::save()
     writer.write("video", VideoSystem::get_video_string(video));
   }
   writer.write("vsync", try_vsync);
+  writer.write("ttf_glyph_atlas", ttf_glyph_atlas);
+  writer.write("preload_level_tiles", preload_level_tiles);
+  writer.write("lightmap_scale", lightmap_scale);
 
   writer.write("fullscreen_width",  fullscreen_size.width);
   writer.write("fullscreen_height", fullscreen_size.height);
@@ -466,6 +484,7 @@ Config::save()
   writer.write("music_enabled", music_enabled);
   writer.write("sound_volume", sound_volume);
   writer.write("music_volume", music_volume);
+  writer.write("buffer_cache_size", sound_buffer_cache_size);
   writer.end_list("audio");
 
   writer.start_list("control");
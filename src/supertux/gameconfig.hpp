@@ -30,6 +30,8 @@
 #include <boost/date_time/posix_time/posix_time_types.hpp>
 #include <boost/optional.hpp>
 
+class Writer;
+
 class Config final
 {
 public:
@@ -72,6 +74,14 @@ public:
   bool use_fullscreen;
   VideoSystem::Enum video;
   bool try_vsync;
+  bool ttf_glyph_atlas;
+
+  /** Decode the tile images used by a level in the background while it is loading */
+  bool preload_level_tiles;
+
+  /** The lightmap has 1/lightmap_scale of the screen resolution, higher
+      values are faster, but make the light edges blurrier */
+  int lightmap_scale;
   bool show_fps;
   bool show_player_pos;
   bool show_controller;
@@ -80,6 +90,9 @@ public:
   int sound_volume;
   int music_volume;
 
+  /** memory budget for decoded sound effects in MiB */
+  int sound_buffer_cache_size;
+
   /** initial random seed.  0 ==> set from time() */
   int random_seed;
 
@@ -169,6 +182,9 @@ public:
       return false;
     }
   }
+
+private:
+  void save(Writer& writer);
 };
 
 #endif
@@ -21,13 +21,17 @@
 #include "object/coin.hpp"
 #include "physfs/util.hpp"
 #include "supertux/sector.hpp"
+#include "supertux/sector_parser.hpp"
 #include "trigger/secretarea_trigger.hpp"
 #include "util/file_system.hpp"
 #include "util/log.hpp"
+#include "util/reader_document.hpp"
+#include "util/reader_mapping.hpp"
+#include "util/save_queue.hpp"
 #include "util/writer.hpp"
 
+#include <assert.h>
 #include <physfs.h>
-#include <numeric>
 
 #include <boost/algorithm/string/predicate.hpp>
 
@@ -50,7 +54,9 @@ Level::Level(bool worldmap) :
   m_skip_cutscene(false),
   m_icon(),
   m_icon_locked(),
-  m_wmselect_bkg()
+  m_wmselect_bkg(),
+  m_document(),
+  m_deferred_sectors()
 {
   s_current = this;
 }
@@ -93,8 +99,15 @@ Level::save(const std::string& filepath, bool retry)
       }
     }
 
-    Writer writer(filepath);
-    save(writer);
+    // don't let a queued up autosave overwrite this one later on
+    if (SaveQueue::current())
+    {
+      SaveQueue::current()->flush();
+    }
+
+    std::ostringstream out;
+    save(out);
+    SaveQueue::write_file(filepath, out.str());
     log_info << "Level saved as " << filepath << "." 
              << (boost::algorithm::ends_with(filepath, "~") ? " [Autosave]" : "")
              << std::endl;
@@ -123,6 +136,8 @@ Level::save(const std::string& filepath, bool retry)
 void
 Level::save(Writer& writer)
 {
+  construct_deferred_sectors();
+
   writer.start_list("supertux-level");
   // Starts writing to supertux level file. Keep this at the very beginning.
 
@@ -174,81 +189,129 @@ Level::add_sector(std::unique_ptr<Sector> sector)
 }
 
 Sector*
-Level::get_sector(const std::string& name_) const
+Level::get_sector(const std::string& name_)
 {
   auto _sector = std::find_if(m_sectors.begin(), m_sectors.end(), [name_] (const std::unique_ptr<Sector>& sector) {
     return sector->get_name() == name_;
   });
-  if(_sector == m_sectors.end())
+  if (_sector != m_sectors.end())
+    return _sector->get();
+
+  auto deferred = std::find_if(m_deferred_sectors.begin(), m_deferred_sectors.end(),
+                               [&name_] (const DeferredSector& sector) {
+    return sector.name == name_;
+  });
+  if (deferred == m_deferred_sectors.end())
     return nullptr;
-  return _sector->get();
+
+  const DeferredSector sector = *deferred;
+  m_deferred_sectors.erase(deferred);
+  construct_sector(sector);
+  if (m_deferred_sectors.empty())
+    m_document.reset();
+  return m_sectors.back().get();
 }
 
 size_t
-Level::get_sector_count() const
+Level::get_sector_count()
 {
+  construct_deferred_sectors();
   return m_sectors.size();
 }
 
 Sector*
-Level::get_sector(size_t num) const
+Level::get_sector(size_t num)
 {
+  construct_deferred_sectors();
   return m_sectors.at(num).get();
 }
 
+void
+Level::construct_deferred_sectors()
+{
+  for (const auto& sector : m_deferred_sectors)
+  {
+    construct_sector(sector);
+  }
+  m_deferred_sectors.clear();
+  m_document.reset();
+}
+
+void
+Level::construct_sector(const DeferredSector& deferred)
+{
+  assert(m_document);
+  m_sectors.push_back(SectorParser::from_reader(*this, ReaderMapping(*m_document, *deferred.sx), false));
+}
+
 int
 Level::get_total_coins() const
 {
-  int total_coins = 0;
-  for (auto const& sector : m_sectors) {
-    for (const auto& o: sector->get_objects()) {
-      auto coin = dynamic_cast<Coin*>(o.get());
-      if (coin)
-      {
-        total_coins++;
-        continue;
-      }
-      auto block = dynamic_cast<BonusBlock*>(o.get());
-      if (block)
-      {
-        if (block->get_contents() == BonusBlock::Content::COIN)
-        {
-          total_coins += block->get_hit_counter();
-          continue;
-        } else if (block->get_contents() == BonusBlock::Content::RAIN ||
-                   block->get_contents() == BonusBlock::Content::EXPLODE)
-        {
-          total_coins += 10 * block->get_hit_counter();
-          continue;
-        }
-      }
-      auto goldbomb = dynamic_cast<GoldBomb*>(o.get());
-      if (goldbomb)
-        total_coins += 10;
-    }
-  }
-  return total_coins;
+  return get_totals().coins;
 }
 
 int
 Level::get_total_badguys() const
 {
-  int total_badguys = 0;
-  for (auto const& sector : m_sectors) {
-    total_badguys += sector->get_object_count<BadGuy>([] (const BadGuy& badguy) {
-      return badguy.m_countMe;
-    });
-  }
-  return total_badguys;
+  return get_totals().badguys;
 }
 
 int
 Level::get_total_secrets() const
 {
-  auto get_secret_count = [](int accumulator, const std::unique_ptr<Sector>& sector) {
-    return accumulator + sector->get_object_count<SecretAreaTrigger>();
-  };
-  return std::accumulate(m_sectors.begin(), m_sectors.end(), 0, get_secret_count);
+  return get_totals().secrets;
+}
+
+Level::Totals
+Level::get_totals() const
+{
+  Totals totals;
+  for (const auto& sector : m_sectors) {
+    for (const auto& object : sector->get_objects()) {
+      add_to_totals(*object, totals);
+    }
+  }
+  for (const auto& sector : m_deferred_sectors) {
+    totals.coins += sector.totals.coins;
+    totals.badguys += sector.totals.badguys;
+    totals.secrets += sector.totals.secrets;
+  }
+  return totals;
+}
+
+void
+Level::add_to_totals(const GameObject& object, Totals& totals)
+{
+  if (dynamic_cast<const Coin*>(&object))
+  {
+    totals.coins++;
+    return;
+  }
+
+  auto block = dynamic_cast<const BonusBlock*>(&object);
+  if (block)
+  {
+    if (block->get_contents() == BonusBlock::Content::COIN)
+    {
+      totals.coins += block->get_hit_counter();
+      return;
+    } else if (block->get_contents() == BonusBlock::Content::RAIN ||
+               block->get_contents() == BonusBlock::Content::EXPLODE)
+    {
+      totals.coins += 10 * block->get_hit_counter();
+      return;
+    }
+  }
+
+  if (dynamic_cast<const GoldBomb*>(&object))
+    totals.coins += 10;
+
+  auto badguy = dynamic_cast<const BadGuy*>(&object);
+  if (badguy && badguy->m_countMe)
+    totals.badguys++;
+
+  if (dynamic_cast<const SecretAreaTrigger*>(&object))
+    totals.secrets++;
 }
 
 void
@@ -17,8 +17,18 @@
 #ifndef HEADER_SUPERTUX_SUPERTUX_LEVEL_HPP
 #define HEADER_SUPERTUX_SUPERTUX_LEVEL_HPP
 
+#include <memory>
+#include <string>
+#include <vector>
+
 #include "supertux/statistics.hpp"
 
+namespace sexp {
+class Value;
+} // namespace sexp
+
+class GameObject;
+class ReaderDocument;
 class ReaderMapping;
 class Sector;
 class Writer;
@@ -43,18 +53,28 @@ public:
   // saves to a levelfile
   void save(const std::string& filename, bool retry = false);
   void save(std::ostream& stream);
+  void save(Writer& writer);
 
   void add_sector(std::unique_ptr<Sector> sector);
   const std::string& get_name() const { return m_name; }
   const std::string& get_author() const { return m_author; }
 
-  Sector* get_sector(const std::string& name) const;
+  /** Returns the sector called @a name, constructing it first if the
+      LevelParser deferred it */
+  Sector* get_sector(const std::string& name);
+
+  /** Counting or accessing sectors by index constructs all deferred
+      sectors, so that every sector is visited */
+  size_t get_sector_count();
+  Sector* get_sector(size_t num);
 
-  size_t get_sector_count() const;
-  Sector* get_sector(size_t num) const;
+  /** Construct all sectors that were deferred by the LevelParser */
+  void construct_deferred_sectors();
 
   std::string get_tileset() const { return m_tileset; }
 
+  /** The totals include the deferred sectors, whose objects the
+      LevelParser counted without constructing the sectors */
   int get_total_coins() const;
   int get_total_badguys() const;
   int get_total_secrets() const;
@@ -66,9 +86,33 @@ public:
   std::string get_license() const { return m_license; }
 
 private:
-  void save(Writer& writer);
   void load_old_format(const ReaderMapping& reader);
 
+  struct Totals
+  {
+    Totals() : coins(), badguys(), secrets() {}
+
+    int coins;
+    int badguys;
+    int secrets;
+  };
+
+  struct DeferredSector
+  {
+    DeferredSector(const sexp::Value* sx_) : name(), sx(sx_), totals() {}
+
+    std::string name;
+    const sexp::Value* sx;
+    Totals totals;
+  };
+
+  /** Adds what @a object contributes to the coin, badguy and secret
+      totals of the level */
+  static void add_to_totals(const GameObject& object, Totals& totals);
+
+  Totals get_totals() const;
+  void construct_sector(const DeferredSector& deferred);
+
 public:
   bool m_is_worldmap;
   std::string m_name;
@@ -88,6 +132,11 @@ public:
   std::string m_icon_locked;
   std::string m_wmselect_bkg;
 
+private:
+  /** The parsed level file, kept alive for the deferred sectors */
+  std::unique_ptr<ReaderDocument> m_document;
+  std::vector<DeferredSector> m_deferred_sectors;
+
 private:
   Level(const Level&) = delete;
   Level& operator=(const Level&) = delete;
@@ -0,0 +1,246 @@
+//  SuperTux
+//  Copyright (C) 2024 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "supertux/level_batch.hpp"
+
+#include <algorithm>
+#include <boost/filesystem.hpp>
+#include <chrono>
+#include <condition_variable>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <thread>
+
+#include "editor/editor.hpp"
+#include "supertux/level.hpp"
+#include "supertux/level_parser.hpp"
+#include "supertux/sector.hpp"
+#include "util/file_system.hpp"
+#include "util/log.hpp"
+#include "util/reader_document.hpp"
+#include "util/string_util.hpp"
+#include "util/thread_pool.hpp"
+#include "util/writer.hpp"
+
+namespace {
+
+float milliseconds_since(const std::chrono::steady_clock::time_point& start)
+{
+  return std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+} // namespace
+
+LevelBatch::LevelBatch(const std::string& directory, bool resave) :
+  m_directory(directory),
+  m_resave(resave)
+{
+}
+
+int
+LevelBatch::run(std::ostream& out)
+{
+  std::vector<Result> results;
+  for (const auto& filename : find_levels())
+  {
+    results.emplace_back(filename);
+  }
+
+  std::mutex mutex;
+  std::condition_variable parsed_cond;
+  ThreadPool pool(std::max(1, static_cast<int>(std::thread::hardware_concurrency())));
+
+  for (auto& result : results)
+  {
+    pool.post([&result, &mutex, &parsed_cond] {
+      parse(result);
+
+      std::lock_guard<std::mutex> lock(mutex);
+      result.parsed = true;
+      parsed_cond.notify_all();
+    });
+  }
+
+  for (auto& result : results)
+  {
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      parsed_cond.wait(lock, [&result] { return result.parsed; });
+    }
+
+    if (!result.error.empty())
+      continue;
+
+    std::string data = construct(result);
+    if (m_resave && result.error.empty())
+    {
+      pool.post([&result, data = std::move(data)] {
+        try
+        {
+          FileSystem::write_atomically(result.filename, data);
+        }
+        catch (const std::exception& err)
+        {
+          result.error = err.what();
+        }
+      });
+    }
+  }
+  pool.wait();
+
+  int failed = 0;
+  Writer writer(out);
+  writer.start_list("supertux-level-report");
+  writer.write("directory", m_directory);
+  writer.write("resave", m_resave);
+  for (const auto& result : results)
+  {
+    write_report(writer, result);
+    if (!result.error.empty())
+      failed += 1;
+  }
+  writer.end_list("supertux-level-report");
+  out.flush();
+
+  log_info << results.size() << " levels processed, " << failed << " failed" << std::endl;
+  return failed;
+}
+
+std::vector<std::string>
+LevelBatch::find_levels() const
+{
+  std::vector<std::string> filenames;
+  for (boost::filesystem::recursive_directory_iterator it(m_directory), end; it != end; ++it)
+  {
+    if (!boost::filesystem::is_regular_file(it->status()))
+      continue;
+
+    std::string filename = it->path().string();
+    if (StringUtil::has_suffix(filename, ".stl") || StringUtil::has_suffix(filename, ".stwm"))
+      filenames.push_back(std::move(filename));
+  }
+  std::sort(filenames.begin(), filenames.end());
+  return filenames;
+}
+
+void
+LevelBatch::parse(Result& result)
+{
+  // Runs on the thread pool, so neither PhysFS streams nor the log
+  // may be used here
+  const auto start = std::chrono::steady_clock::now();
+  try
+  {
+    std::ifstream in(result.filename);
+    if (!in)
+      throw std::runtime_error("couldn't open file for reading");
+
+    result.doc = std::make_unique<ReaderDocument>(ReaderDocument::from_stream(in, result.filename));
+  }
+  catch (const std::exception& err)
+  {
+    result.error = err.what();
+  }
+  result.parse_time = milliseconds_since(start);
+}
+
+std::string
+LevelBatch::construct(Result& result) const
+{
+  // worldmaps are only ever loaded through the LevelParser by the editor
+  const bool worldmap = StringUtil::has_suffix(result.filename, ".stwm");
+  const bool editable = m_resave || worldmap;
+
+  // collect the warnings of this level for the report instead of
+  // printing them
+  std::ostringstream log;
+  std::ostream& log_stream = get_logging_instance();
+  std::streambuf* log_buffer = log_stream.rdbuf(log.rdbuf());
+  Editor::s_resaving_in_progress = editable;
+
+  std::string data;
+  const auto start = std::chrono::steady_clock::now();
+  try
+  {
+    auto level = LevelParser::from_document(std::move(result.doc), worldmap, editable);
+
+    // when validating, the sectors are deferred, get_sector_count()
+    // constructs them all so they are part of the construct time
+    for (size_t i = 0; i < level->get_sector_count(); ++i)
+    {
+      const Sector& sector = *level->get_sector(i);
+      result.sectors.emplace_back(sector.get_name(), static_cast<int>(sector.get_objects().size()));
+    }
+
+    if (m_resave)
+    {
+      std::ostringstream out;
+      level->save(out);
+      data = out.str();
+    }
+  }
+  catch (const std::exception& err)
+  {
+    result.error = err.what();
+  }
+  catch (...)
+  {
+    result.error = "unknown exception";
+  }
+  result.construct_time = milliseconds_since(start);
+
+  Editor::s_resaving_in_progress = false;
+  log_stream.rdbuf(log_buffer);
+
+  std::istringstream lines(log.str());
+  std::string line;
+  while (std::getline(lines, line))
+  {
+    if (line.compare(0, 9, "[WARNING]") == 0 || line.compare(0, 7, "[FATAL]") == 0)
+      result.warnings.push_back(line);
+  }
+
+  return data;
+}
+
+void
+LevelBatch::write_report(Writer& writer, const Result& result)
+{
+  writer.start_list("level");
+  writer.write("file", result.filename);
+  writer.write("status", result.error.empty() ? "ok" : "error");
+  if (!result.error.empty())
+    writer.write("error", result.error);
+  if (!result.warnings.empty())
+    writer.write("warnings", result.warnings);
+  writer.write("parse-time", result.parse_time);
+  writer.write("construct-time", result.construct_time);
+
+  int objects = 0;
+  for (const auto& sector : result.sectors)
+  {
+    writer.start_list("sector");
+    writer.write("name", sector.first);
+    writer.write("objects", sector.second);
+    writer.end_list("sector");
+    objects += sector.second;
+  }
+  writer.write("objects", objects);
+  writer.end_list("level");
+}
+
+/* EOF */
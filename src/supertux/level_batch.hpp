@@ -0,0 +1,95 @@
+//  SuperTux
+//  Copyright (C) 2024 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef HEADER_SUPERTUX_SUPERTUX_LEVEL_BATCH_HPP
+#define HEADER_SUPERTUX_SUPERTUX_LEVEL_BATCH_HPP
+
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+
+class ReaderDocument;
+class Writer;
+
+/** Loads all levels and worldmaps below a directory for
+    --validate-levels and --resave-levels and writes a report about
+    them.
+
+    Reading and parsing the files and writing the resaved ones happens
+    on a thread pool, resaved files are replaced atomically.
+    Constructing the sectors is not thread safe: it runs scripts in the
+    one Squirrel VM and fills the unlocked sprite, tile and texture
+    caches. So it happens one level at a time on the calling thread,
+    while the pool parses the next files and writes the previous ones. */
+class LevelBatch final
+{
+public:
+  LevelBatch(const std::string& directory, bool resave);
+
+  /** Processes all levels, writes the report to @a out and returns
+      the number of levels that failed to load or save */
+  int run(std::ostream& out);
+
+private:
+  struct Result
+  {
+    Result(const std::string& filename_) :
+      filename(filename_),
+      doc(),
+      parsed(false),
+      error(),
+      warnings(),
+      sectors(),
+      parse_time(0.0f),
+      construct_time(0.0f)
+    {}
+
+    std::string filename;
+    std::unique_ptr<ReaderDocument> doc;
+    bool parsed;
+    std::string error;
+    std::vector<std::string> warnings;
+
+    /** Name and object count of each sector */
+    std::vector<std::pair<std::string, int> > sectors;
+
+    float parse_time;
+    float construct_time;
+  };
+
+private:
+  std::vector<std::string> find_levels() const;
+
+  static void parse(Result& result);
+
+  /** Constructs the level, returns the resaved file contents */
+  std::string construct(Result& result) const;
+
+  static void write_report(Writer& writer, const Result& result);
+
+private:
+  std::string m_directory;
+  bool m_resave;
+
+private:
+  LevelBatch(const LevelBatch&) = delete;
+  LevelBatch& operator=(const LevelBatch&) = delete;
+};
+
+#endif
+
+/* EOF */
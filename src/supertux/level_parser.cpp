@@ -16,16 +16,180 @@
 
 #include "supertux/level_parser.hpp"
 
+#include <algorithm>
+#include <map>
 #include <physfs.h>
+#include <sexp/parser.hpp>
+#include <sexp/value.hpp>
 #include <sstream>
+#include <unordered_set>
 
+#include "audio/sound_manager.hpp"
+#include "supertux/d_scope.hpp"
+#include "supertux/game_object_factory.hpp"
+#include "supertux/game_object_manager.hpp"
+#include "supertux/gameconfig.hpp"
+#include "supertux/globals.hpp"
 #include "supertux/level.hpp"
 #include "supertux/sector.hpp"
 #include "supertux/sector_parser.hpp"
+#include "supertux/tile.hpp"
+#include "supertux/tile_manager.hpp"
+#include "supertux/tile_set.hpp"
 #include "util/log.hpp"
 #include "util/reader.hpp"
 #include "util/reader_document.hpp"
 #include "util/reader_mapping.hpp"
+#include "util/string_util.hpp"
+
+namespace {
+
+void add_sound_reference(const std::string& filename, std::vector<std::string>& sounds)
+{
+  // music is always streamed, so there is nothing to preload
+  if ((StringUtil::has_suffix(filename, ".wav") || StringUtil::has_suffix(filename, ".ogg")) &&
+      filename.find("music/") == std::string::npos &&
+      std::find(sounds.begin(), sounds.end(), filename) == sounds.end())
+  {
+    sounds.push_back(filename);
+  }
+}
+
+/** Collects the sound files referenced anywhere in a level, both as
+    plain properties (e.g. the sample of an ambient sound) and as
+    string literals inside of scripts (e.g. play_sound("speech/...")) */
+void collect_sound_references(const sexp::Value& sx, std::vector<std::string>& sounds)
+{
+  if (sx.is_array())
+  {
+    for (const auto& item : sx.as_array())
+    {
+      collect_sound_references(item, sounds);
+    }
+  }
+  else if (sx.is_string())
+  {
+    const std::string& text = sx.as_string();
+    add_sound_reference(text, sounds);
+
+    // Squirrel string literals are read like the ones of a level file,
+    // so the sexp parser takes care of spaces and escapes
+    std::string::size_type begin = text.find('"');
+    while (begin != std::string::npos)
+    {
+      std::string::size_type end = begin + 1;
+      while (end < text.size() && text[end] != '"')
+      {
+        end += text[end] == '\\' ? 2 : 1;
+      }
+      if (end >= text.size())
+        break;
+
+      try
+      {
+        std::istringstream literal(text.substr(begin, end - begin + 1));
+        const sexp::Value value = sexp::Parser::from_stream(literal);
+        if (value.is_string())
+          add_sound_reference(value.as_string(), sounds);
+      }
+      catch (const std::exception&)
+      {
+        // not a literal the level reader understands, can't be a file
+      }
+
+      begin = text.find('"', end + 1);
+    }
+  }
+}
+
+/** Collects the ids of all tiles used by the tilemaps of a level */
+void collect_tile_references(const sexp::Value& sx, std::vector<bool>& used)
+{
+  if (!sx.is_array())
+    return;
+
+  const auto& arr = sx.as_array();
+  if (!arr.empty() && arr[0].is_symbol() && arr[0].as_string() == "tiles")
+  {
+    for (size_t i = 1; i < arr.size(); ++i)
+    {
+      if (arr[i].is_integer() && arr[i].as_int() > 0)
+      {
+        const size_t id = static_cast<size_t>(arr[i].as_int());
+        if (id >= used.size())
+          used.resize(id + 1);
+        used[id] = true;
+      }
+    }
+  }
+  else
+  {
+    for (const auto& item : arr)
+    {
+      collect_tile_references(item, used);
+    }
+  }
+}
+
+/** Whether an object of the sector entry @a name may count towards the
+    coin, badguy or secret totals, see Level::add_to_totals() */
+bool is_counted_object(const std::string& name)
+{
+  static const std::unordered_set<std::string> s_names = [] {
+    auto& badguys = GameObjectFactory::instance().get_registered_badguys();
+    std::unordered_set<std::string> names(badguys.begin(), badguys.end());
+    names.insert({ "coin", "heavycoin", "bonusblock", "secretarea",
+                   // old names that SectorParser still accepts
+                   "money", "fish" });
+    return names;
+  }();
+  return s_names.find(name) != s_names.end();
+}
+
+/** Counts the tiles of @a tilemap that Sector::convert_tiles2gameobject()
+    replaces with objects that may count towards the totals. Only solid
+    tilemaps are converted, apart from decals, which never count. */
+void count_object_tiles(const ReaderMapping& tilemap, const TileSet& tileset, std::map<uint32_t, int>& counts)
+{
+  bool solid = false;
+  float alpha = 1.0f;
+  tilemap.get("solid", solid);
+  tilemap.get("alpha", alpha);
+  // see TileMap::update_effective_solid()
+  if (!solid || alpha < 0.75f)
+    return;
+
+  std::vector<unsigned int> tiles;
+  tilemap.get("tiles", tiles);
+  for (const auto id : tiles)
+  {
+    if (id != 0 && is_counted_object(tileset.get(id).get_object_name()))
+    {
+      counts[id] += 1;
+    }
+  }
+}
+
+/** Keeps whatever the objects that are only constructed for counting
+    add on their own, e.g. their paths */
+class CountingObjectManager final : public GameObjectManager
+{
+public:
+  CountingObjectManager() {}
+  ~CountingObjectManager() override
+  {
+    clear_objects();
+  }
+
+  bool before_object_add(GameObject&) override { return true; }
+  void before_object_remove(GameObject&) override {}
+
+private:
+  CountingObjectManager(const CountingObjectManager&) = delete;
+  CountingObjectManager& operator=(const CountingObjectManager&) = delete;
+};
+
+} // namespace
 
 std::string
 LevelParser::get_level_name(const std::string& filename)
@@ -62,6 +226,15 @@ LevelParser::from_stream(std::istream& stream, const std::string& context, bool
   return level;
 }
 
+std::unique_ptr<Level>
+LevelParser::from_document(std::unique_ptr<ReaderDocument> doc, bool worldmap, bool editable)
+{
+  auto level = std::make_unique<Level>(worldmap);
+  LevelParser parser(*level, worldmap, editable);
+  parser.load(std::move(doc));
+  return level;
+}
+
 std::unique_ptr<Level>
 LevelParser::from_file(const std::string& filename, bool worldmap, bool editable)
 {
@@ -71,6 +244,20 @@ LevelParser::from_file(const std::string& filename, bool worldmap, bool editable
   return level;
 }
 
+std::unique_ptr<Level>
+LevelParser::from_string(const std::string& data, const std::string& filename,
+                         bool worldmap, bool editable)
+{
+  auto level = std::make_unique<Level>(worldmap);
+  LevelParser parser(*level, worldmap, editable);
+  level->m_filename = filename;
+  register_translation_directory(filename);
+
+  std::istringstream stream(data);
+  parser.load(stream, filename);
+  return level;
+}
+
 std::unique_ptr<Level>
 LevelParser::from_nothing(const std::string& basedir)
 {
@@ -121,11 +308,20 @@ LevelParser::LevelParser(Level& level, bool worldmap, bool editable) :
 {
 }
 
+void
+LevelParser::load(std::unique_ptr<ReaderDocument> doc)
+{
+  load(*doc);
+
+  // the deferred sectors point into the document
+  if (!m_level.m_deferred_sectors.empty())
+    m_level.m_document = std::move(doc);
+}
+
 void
 LevelParser::load(std::istream& stream, const std::string& context)
 {
-  auto doc = ReaderDocument::from_stream(stream, context);
-  load(doc);
+  load(std::make_unique<ReaderDocument>(ReaderDocument::from_stream(stream, context)));
 }
 
 void
@@ -134,8 +330,7 @@ LevelParser::load(const std::string& filepath)
   m_level.m_filename = filepath;
   register_translation_directory(filepath);
   try {
-    auto doc = ReaderDocument::from_file(filepath);
-    load(doc);
+    load(std::make_unique<ReaderDocument>(ReaderDocument::from_file(filepath)));
   } catch(std::exception& e) {
     std::stringstream msg;
     msg << "Problem when reading level '" << filepath << "': " << e.what();
@@ -172,13 +367,51 @@ LevelParser::load(const ReaderDocument& doc)
     level.get("icon-locked", m_level.m_icon_locked);
     level.get("bkg", m_level.m_wmselect_bkg);
 
+    if (!m_editable && SoundManager::current())
+    {
+      // Decode all sounds the level refers to in the background while the
+      // sectors are being constructed, objects add their own sounds via
+      // SoundManager::preload() in their constructors
+      std::vector<std::string> sound_manifest;
+      collect_sound_references(root.get_sexp(), sound_manifest);
+      SoundManager::current()->preload(sound_manifest);
+    }
+
+    if (!m_editable && g_config->preload_level_tiles && TileManager::current())
+    {
+      // Tile images are loaded when the tilemaps are constructed, start
+      // decoding the ones this level uses before that happens
+      std::vector<bool> used;
+      collect_tile_references(root.get_sexp(), used);
+
+      std::vector<uint32_t> tile_ids;
+      for (size_t id = 0; id < used.size(); ++id)
+      {
+        if (used[id])
+          tile_ids.push_back(static_cast<uint32_t>(id));
+      }
+      TileManager::current()->get_tileset(m_level.m_tileset)->warm(tile_ids);
+    }
+
     auto iter = level.get_iter();
     while (iter.next())
     {
       if (iter.get_key() == "sector")
       {
-        auto sector = SectorParser::from_reader(m_level, iter.as_mapping(), m_editable);
-        m_level.add_sector(std::move(sector));
+        std::string name;
+        iter.as_mapping().get("name", name);
+        if (!m_editable && !m_worldmap && name != "main")
+        {
+          // Only the sectors that are entered get constructed. The
+          // start sector is entered right away, so it is constructed
+          // here and counted from its objects.
+          defer_sector(iter.as_mapping());
+        }
+        else
+        {
+          auto sector = SectorParser::from_reader(m_level, iter.as_mapping(), m_editable);
+          m_level.add_sector(std::move(sector));
+        }
       }
     }
 
@@ -195,6 +428,75 @@ LevelParser::load(const ReaderDocument& doc)
   m_level.m_stats.init(m_level);
 }
 
+void
+LevelParser::defer_sector(const ReaderMapping& sector)
+{
+  Level::DeferredSector deferred(&sector.get_sexp());
+  sector.get("name", deferred.name);
+  if (std::any_of(m_level.m_deferred_sectors.begin(), m_level.m_deferred_sectors.end(),
+                  [&deferred] (const Level::DeferredSector& other) {
+                    return other.name == deferred.name;
+                  }) ||
+      std::any_of(m_level.m_sectors.begin(), m_level.m_sectors.end(),
+                  [&deferred] (const std::unique_ptr<Sector>& other) {
+                    return other->get_name() == deferred.name;
+                  }))
+  {
+    throw std::runtime_error("Trying to add 2 sectors with same name");
+  }
+
+  // The statistics need the coin, badguy and secret totals right away.
+  // Only the objects that can count towards them are constructed, on
+  // their own, and added up like those of a constructed sector.
+  CountingObjectManager manager;
+  auto gameobject_manager_guard = d_gameobject_manager.bind(manager);
+
+  const TileSet* tileset = TileManager::current() ? TileManager::current()->get_tileset(m_level.m_tileset) : nullptr;
+  std::map<uint32_t, int> object_tiles;
+
+  auto iter = sector.get_iter();
+  while (iter.next())
+  {
+    if (iter.get_key() == "tilemap" && tileset)
+    {
+      count_object_tiles(iter.as_mapping(), *tileset, object_tiles);
+      continue;
+    }
+
+    if (!is_counted_object(iter.get_key()))
+      continue;
+
+    auto object = SectorParser::parse_object(iter.get_key(), iter.as_mapping());
+    if (object)
+    {
+      Level::add_to_totals(*object, deferred.totals);
+    }
+  }
+
+  // All tiles with the same id become the same object, so each one is
+  // constructed only once
+  for (const auto& object_tile : object_tiles)
+  {
+    const Tile& tile = tileset->get(object_tile.first);
+    try
+    {
+      auto object = GameObjectFactory::instance().create(tile.get_object_name(), Vector(0.0f, 0.0f),
+                                                         Direction::AUTO, tile.get_object_data());
+      Level::Totals totals;
+      Level::add_to_totals(*object, totals);
+      deferred.totals.coins += totals.coins * object_tile.second;
+      deferred.totals.badguys += totals.badguys * object_tile.second;
+      deferred.totals.secrets += totals.secrets * object_tile.second;
+    }
+    catch(const std::exception& err)
+    {
+      log_warning << err.what() << std::endl;
+    }
+  }
+
+  m_level.m_deferred_sectors.push_back(deferred);
+}
+
 void
 LevelParser::load_old_format(const ReaderMapping& reader)
 {
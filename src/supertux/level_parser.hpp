@@ -28,7 +28,20 @@ class LevelParser final
 {
 public:
   static std::unique_ptr<Level> from_stream(std::istream& stream, const std::string& context, bool worldmap, bool editable);
+
+  /** Construct a level from a document that was parsed beforehand,
+      e.g. on a worker thread */
+  static std::unique_ptr<Level> from_document(std::unique_ptr<ReaderDocument> doc, bool worldmap, bool editable);
+
+  /** Unless the level is loaded for editing, its sectors are not
+      constructed right away, but by Level::get_sector() once they are
+      needed */
   static std::unique_ptr<Level> from_file(const std::string& filename, bool worldmap, bool editable);
+
+  /** Parse a level that is already in memory as if it was loaded
+      from @a filename */
+  static std::unique_ptr<Level> from_string(const std::string& data, const std::string& filename,
+                                            bool worldmap, bool editable);
   static std::unique_ptr<Level> from_nothing(const std::string& basedir);
   static std::unique_ptr<Level> from_nothing_worldmap(const std::string& basedir, const std::string& name);
 
@@ -38,9 +51,13 @@ private:
   LevelParser(Level& level, bool worldmap, bool editable);
 
   void load(const ReaderDocument& doc);
+  void load(std::unique_ptr<ReaderDocument> doc);
   void load(std::istream& stream, const std::string& context);
   void load(const std::string& filepath);
   void load_old_format(const ReaderMapping& reader);
+
+  /** Remember @a sector to be constructed on first access */
+  void defer_sector(const ReaderMapping& sector);
   void create(const std::string& filepath, const std::string& levelname);
 
 private:
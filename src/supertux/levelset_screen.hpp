@@ -38,7 +38,8 @@ private:
 
 public:
   LevelsetScreen(const std::string& basedir, const std::string& level_filename, Savegame& savegame,
-                 const boost::optional<std::pair<std::string, Vector>>& start_pos);
+                 const boost::optional<std::pair<std::string, Vector>>& start_pos,
+                 std::string level_data = std::string());
 
   virtual void draw(Compositor& compositor) override;
   virtual void update(float dt_sec, const Controller& controller) override;
@@ -52,6 +53,7 @@ public:
 
 private:
   boost::optional<std::pair<std::string, Vector>> m_start_pos;
+  std::string m_level_data;
 
   LevelsetScreen(const LevelsetScreen&) = delete;
   LevelsetScreen& operator=(const LevelsetScreen&) = delete;
@@ -18,6 +18,7 @@
 
 #include <config.h>
 #include <version.h>
+#include <algorithm>
 #include <fstream>
 
 #include <SDL_image.h>
@@ -64,6 +65,7 @@ extern "C" {
 #include "supertux/gameconfig.hpp"
 #include "supertux/globals.hpp"
 #include "supertux/level.hpp"
+#include "supertux/level_batch.hpp"
 #include "supertux/level_parser.hpp"
 #include "supertux/player_status.hpp"
 #include "supertux/resources.hpp"
@@ -124,6 +126,7 @@ ConfigSubsystem::~ConfigSubsystem()
 
 Main::Main() :
   m_physfs_subsystem(),
+  m_save_queue(),
   m_config_subsystem(),
   m_sdl_subsystem(),
   m_console_buffer(),
@@ -168,6 +171,8 @@ Main::init_tinygettext()
     FL_FreeLocale(&locale);
     g_dictionary_manager->set_language(language);
   }
+
+  invalidate_translations();
 }
 
 PhysfsSubsystem::PhysfsSubsystem(const char* argv0,
@@ -454,6 +459,28 @@ Main::resave(const std::string& input_filename, const std::string& output_filena
   Editor::s_resaving_in_progress = false;
 }
 
+int
+Main::process_levels(const CommandLineArguments& args)
+{
+  m_sdl_subsystem.reset(new SDLSubsystem());
+  m_input_manager.reset(new InputManager(g_config->keyboard_config, g_config->joystick_config));
+  m_video_system = VideoSystem::create(VideoSystem::VIDEO_NULL);
+  m_ttf_surface_manager.reset(new TTFSurfaceManager());
+
+  m_sound_manager.reset(new SoundManager());
+  m_sound_manager->enable_sound(false);
+  m_sound_manager->enable_music(false);
+
+  m_squirrel_virtual_machine.reset(new SquirrelVirtualMachine(false));
+  m_tile_manager.reset(new TileManager());
+  m_sprite_manager.reset(new SpriteManager());
+  m_resources.reset(new Resources());
+
+  const bool resave = static_cast<bool>(args.resave_levels);
+  LevelBatch batch(resave ? *args.resave_levels : *args.validate_levels, resave);
+  return batch.run(std::cout) == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
 void
 Main::launch_game(const CommandLineArguments& args)
 {
@@ -489,6 +516,7 @@ Main::launch_game(const CommandLineArguments& args)
   init_video();
 
   m_ttf_surface_manager.reset(new TTFSurfaceManager());
+  m_ttf_surface_manager->set_glyph_atlas_enabled(g_config->ttf_glyph_atlas);
 
   s_timelog.log("audio");
   m_sound_manager.reset(new SoundManager());
@@ -496,6 +524,7 @@ Main::launch_game(const CommandLineArguments& args)
   m_sound_manager->enable_music(g_config->music_enabled);
   m_sound_manager->set_sound_volume(g_config->sound_volume);
   m_sound_manager->set_music_volume(g_config->music_volume);
+  m_sound_manager->set_buffer_cache_size(static_cast<size_t>(std::max(g_config->sound_buffer_cache_size, 0)) * 1024 * 1024);
 
   s_timelog.log("scripting");
   m_squirrel_virtual_machine.reset(new SquirrelVirtualMachine(g_config->enable_script_debugger));
@@ -675,6 +704,8 @@ Main::run(int argc, char** argv)
     m_physfs_subsystem.reset(new PhysfsSubsystem(argv[0], args.datadir, args.userdir));
     m_physfs_subsystem->print_search_path();
 
+    m_save_queue.reset(new SaveQueue());
+
     s_timelog.log("config");
     m_config_subsystem.reset(new ConfigSubsystem());
     args.merge_into(*g_config);
@@ -700,7 +731,10 @@ Main::run(int argc, char** argv)
         return 0;
 
       default:
-        launch_game(args);
+        if (args.validate_levels || args.resave_levels)
+          result = process_levels(args);
+        else
+          launch_game(args);
         break;
     }
   }
@@ -721,6 +755,10 @@ Main::run(int argc, char** argv)
   // SDL2 keeps shared libraries loaded after the app is closed,
   // when we launch the app again the static initializers will run twice and crash the app.
   // So we just need to terminate the app process 'gracefully', without running destructors or atexit() functions.
+  if (m_save_queue)
+  {
+    m_save_queue->flush();
+  }
   _exit(result);
 #endif
 
@@ -36,6 +36,7 @@
 #include "supertux/screen_manager.hpp"
 #include "supertux/tile_manager.hpp"
 #include "supertux/tile_set.hpp"
+#include "util/save_queue.hpp"
 #include "video/ttf_surface_manager.hpp"
 
 class ConfigSubsystem final
@@ -86,11 +87,15 @@ private:
 
   void launch_game(const CommandLineArguments& args);
   void resave(const std::string& input_filename, const std::string& output_filename);
+
+  /** Runs --validate-levels and --resave-levels, returns the exit code */
+  int process_levels(const CommandLineArguments& args);
   void release_check();
 
 private:
   // Using pointers allows us to initialize them whenever we want
   std::unique_ptr<PhysfsSubsystem> m_physfs_subsystem;
+  std::unique_ptr<SaveQueue> m_save_queue;
   std::unique_ptr<ConfigSubsystem> m_config_subsystem;
   std::unique_ptr<SDLSubsystem> m_sdl_subsystem;
   std::unique_ptr<ConsoleBuffer> m_console_buffer;
@@ -51,6 +51,7 @@ EditorLevelMenu::~EditorLevelMenu()
   if (editor == nullptr) {
     return;
   }
+  editor->record_level();
   if (editor->get_level()->m_tileset != old_tileset) {
     try
     {
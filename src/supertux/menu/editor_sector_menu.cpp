@@ -52,6 +52,7 @@ EditorSectorMenu::~EditorSectorMenu()
   if (editor == nullptr) {
     return;
   }
+  editor->record_level();
   // Makes sure that the name of the sector isn't already used.
   auto level = editor->get_level();
   bool is_sector = false;
@@ -95,6 +95,8 @@ LanguageMenu::menu_action(MenuItem& item)
     }
   }
 
+  invalidate_translations();
+
   // Reload font files
   Resources::load();
 
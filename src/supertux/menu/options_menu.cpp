@@ -39,6 +39,15 @@
 #include <emscripten/html5.h>
 #endif
 
+#include <cstdlib>
+
+namespace {
+
+/** Lightmap downscale factors of the "Lighting Quality" entries */
+const int s_lightmap_scales[] = { 3, 5, 8 };
+
+} // namespace
+
 bool
 OptionsMenu::less_than_volume(const std::string& lhs, const std::string& rhs)
 {
@@ -59,6 +68,7 @@ OptionsMenu::OptionsMenu(Type type, bool complete) :
   m_window_resolutions(),
   m_resolutions(),
   m_vsyncs(),
+  m_lightmap_scales(),
   m_sound_volumes(),
   m_music_volumes(),
   m_mobile_control_scales()
@@ -106,6 +116,7 @@ OptionsMenu::OptionsMenu(Type type, bool complete) :
 
       add_magnification();
       add_vsync();
+      add_lightmap_scales();
 
 #if !defined(HIDE_NONMOBILE_OPTIONS) && !defined(__EMSCRIPTEN__)
       add_aspect_ratio();
@@ -427,6 +438,28 @@ OptionsMenu::add_vsync()
     .set_help(_("Set the VSync mode"));
 }
 
+void
+OptionsMenu::add_lightmap_scales()
+{
+  m_lightmap_scales.list.push_back(_("high"));
+  m_lightmap_scales.list.push_back(_("normal"));
+  m_lightmap_scales.list.push_back(_("low"));
+
+  // pick the entry closest to the configured scale
+  m_lightmap_scales.next = 0;
+  for (int i = 0; i < static_cast<int>(m_lightmap_scales.list.size()); ++i)
+  {
+    if (std::abs(s_lightmap_scales[i] - g_config->lightmap_scale) <
+        std::abs(s_lightmap_scales[m_lightmap_scales.next] - g_config->lightmap_scale))
+    {
+      m_lightmap_scales.next = i;
+    }
+  }
+
+  add_string_select(MNID_LIGHTMAP_SCALE, _("Lighting Quality"), &m_lightmap_scales.next, m_lightmap_scales.list)
+    .set_help(_("Lower quality makes levels with many lights faster to draw"));
+}
+
 void
 OptionsMenu::add_sound_volume()
 {
@@ -656,6 +689,12 @@ OptionsMenu::menu_action(MenuItem& item)
       }
       break;
 
+    case MNID_LIGHTMAP_SCALE:
+      g_config->lightmap_scale = s_lightmap_scales[m_lightmap_scales.next];
+      VideoSystem::current()->apply_config();
+      g_config->save();
+      break;
+
     case MNID_FULLSCREEN:
       VideoSystem::current()->apply_config();
       MenuManager::instance().on_window_resize();
@@ -51,6 +51,7 @@ private:
   void add_window_resolutions();
   void add_resolutions();
   void add_vsync();
+  void add_lightmap_scales();
   void add_sound_volume();
   void add_music_volume();
   void add_mobile_control_scales();
@@ -65,6 +66,7 @@ private:
     MNID_MAGNIFICATION,
     MNID_ASPECTRATIO,
     MNID_VSYNC,
+    MNID_LIGHTMAP_SCALE,
     MNID_SOUND,
     MNID_MUSIC,
     MNID_SOUND_VOLUME,
@@ -93,6 +95,7 @@ private:
   StringOption m_window_resolutions;
   StringOption m_resolutions;
   StringOption m_vsyncs;
+  StringOption m_lightmap_scales;
   StringOption m_sound_volumes;
   StringOption m_music_volumes;
   StringOption m_mobile_control_scales;
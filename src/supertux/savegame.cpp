@@ -31,6 +31,7 @@
 #include "util/log.hpp"
 #include "util/reader_document.hpp"
 #include "util/reader_mapping.hpp"
+#include "util/save_queue.hpp"
 #include "util/writer.hpp"
 #include "worldmap/worldmap.hpp"
 
@@ -141,6 +142,12 @@ Savegame::load()
 
   clear_state_table();
 
+  // the savegame might still be queued up for writing
+  if (SaveQueue::current())
+  {
+    SaveQueue::current()->flush();
+  }
+
   if (!PHYSFS_exists(m_filename.c_str()))
   {
     log_info << m_filename << " doesn't exist, not loading state" << std::endl;
@@ -254,9 +261,13 @@ Savegame::save()
     }
   }
 
-  SquirrelVM& vm = SquirrelVirtualMachine::current()->get_vm();
+  SaveQueue::save_file(m_filename, [this](Writer& writer) { save(writer); });
+}
 
-  Writer writer(m_filename);
+void
+Savegame::save(Writer& writer)
+{
+  SquirrelVM& vm = SquirrelVirtualMachine::current()->get_vm();
 
   writer.start_list("supertux-savegame");
   writer.write("version", 1);
@@ -23,6 +23,7 @@
 #include <vector>
 
 class PlayerStatus;
+class Writer;
 
 struct LevelState
 {
@@ -91,6 +92,7 @@ public:
 
 private:
   void load();
+  void save(Writer& writer);
   void clear_state_table();
 
 private:
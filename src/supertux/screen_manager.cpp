@@ -41,8 +41,10 @@
 #include "supertux/screen_fade.hpp"
 #include "supertux/sector.hpp"
 #include "util/log.hpp"
+#include "util/save_queue.hpp"
 #include "video/compositor.hpp"
 #include "video/drawing_context.hpp"
+#include "video/ttf_surface_manager.hpp"
 
 #include <stdio.h>
 #include <chrono>
@@ -134,6 +136,7 @@ private:
 ScreenManager::ScreenManager(VideoSystem& video_system, InputManager& input_manager) :
   m_video_system(video_system),
   m_input_manager(input_manager),
+  m_compositor(new Compositor(video_system)),
   m_menu_storage(new MenuStorage),
   m_menu_manager(new MenuManager()),
   m_controller_hud(new ControllerHUD),
@@ -242,6 +245,26 @@ ScreenManager::draw_fps(DrawingContext& context, FPS_Stats& fps_statistics)
   pos.x -= w2;
   context.color().draw_text(Resources::small_font, str1,
     pos, ALIGN_RIGHT, LAYER_HUD);
+
+  if (g_config->developer_mode)
+  {
+    // Text textures uploaded per second, see TTFSurfaceManager
+    snprintf(str1, str_length, "Text uploads/s: %3.1f (%.1f KiB/s)",
+      static_cast<double>(TTFSurfaceManager::current()->get_texture_upload_rate()),
+      static_cast<double>(TTFSurfaceManager::current()->get_texture_upload_pixel_rate()) * 4.0 / 1024.0);
+    pos.x = static_cast<float>(context.get_width()) - BORDER_X;
+    pos.y += 15;
+    context.color().draw_text(Resources::small_font, str1,
+      pos, ALIGN_RIGHT, LAYER_HUD);
+
+    // Vertex data streamed to the GPU during the last frame
+    snprintf(str1, str_length, "Vertex uploads: %d (%.1f KiB)",
+      m_video_system.get_vertex_uploads(),
+      static_cast<double>(m_video_system.get_vertex_upload_bytes()) / 1024.0);
+    pos.y += 15;
+    context.color().draw_text(Resources::small_font, str1,
+      pos, ALIGN_RIGHT, LAYER_HUD);
+  }
 }
 
 void
@@ -638,12 +661,15 @@ void ScreenManager::loop_iter()
   if ((steps > 0 && !m_screen_stack.empty())
       || g_debug.draw_redundant_frames) {
     // Draw a frame
-    Compositor compositor(m_video_system);
-    draw(compositor, *m_fps_statistics);
+    draw(*m_compositor, *m_fps_statistics);
     m_fps_statistics->report_frame();
   }
 
   SoundManager::current()->update();
+  if (SaveQueue::current())
+  {
+    SaveQueue::current()->update();
+  }
 
   handle_screen_switch();
 
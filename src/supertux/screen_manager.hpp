@@ -71,6 +71,7 @@ private:
 private:
   VideoSystem& m_video_system;
   InputManager& m_input_manager;
+  std::unique_ptr<Compositor> m_compositor;
   std::unique_ptr<MenuStorage> m_menu_storage;
   std::unique_ptr<MenuManager> m_menu_manager;
   std::unique_ptr<ControllerHUD> m_controller_hud;
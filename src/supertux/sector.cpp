@@ -76,7 +76,9 @@ Sector::Sector(Level& parent) :
   m_foremost_layer(),
   m_squirrel_environment(new SquirrelEnvironment(SquirrelVirtualMachine::current()->get_vm(), "sector")),
   m_collision_system(new CollisionSystem(*this)),
-  m_gravity(10.0)
+  m_gravity(10.0),
+  m_query_collision_objects(),
+  m_query_objects()
 {
   Savegame* savegame = (Editor::current() && Editor::is_active()) ?
     Editor::current()->m_savegame.get() :
@@ -485,7 +487,7 @@ Sector::draw(DrawingContext& context)
   if (m_level.m_is_in_cutscene && !m_level.m_skip_cutscene)
   {
     context.color().draw_text(Resources::normal_font,
-                              _("Press escape to skip"),
+                              _s("Press escape to skip"),
                               Vector(32.f, 32.f),
                               ALIGN_LEFT,
                               LAYER_OBJECTS + 1000,
@@ -643,17 +645,38 @@ Sector::get_nearest_player (const Vector& pos) const
 }
 
 std::vector<MovingObject*>
-Sector::get_nearby_objects(const Vector& center, float max_distance) const
+Sector::get_nearby_objects(const Vector& center, float max_distance)
 {
-  std::vector<MovingObject*> result;
-  for (auto& object : m_collision_system->get_nearby_objects(center, max_distance))
+  return query_radius<MovingObject>(center, max_distance);
+}
+
+const std::vector<MovingObject*>&
+Sector::query_objects(const Rectf& rect)
+{
+  m_query_collision_objects.clear();
+  m_collision_system->query_rect(rect, m_query_collision_objects);
+
+  m_query_objects.clear();
+  for (auto* object : m_query_collision_objects)
   {
-    auto* moving_object = dynamic_cast<MovingObject*>(&object->get_listener());
-    if (moving_object) {
-      result.push_back(moving_object);
-    }
+    // only MovingObjects are added to the collision system
+    m_query_objects.push_back(static_cast<MovingObject*>(&object->get_listener()));
+  }
+  return m_query_objects;
+}
+
+const std::vector<MovingObject*>&
+Sector::query_objects(const Vector& center, float radius)
+{
+  m_query_collision_objects.clear();
+  m_collision_system->query_radius(center, radius, m_query_collision_objects);
+
+  m_query_objects.clear();
+  for (auto* object : m_query_collision_objects)
+  {
+    m_query_objects.push_back(static_cast<MovingObject*>(&object->get_listener()));
   }
-  return result;
+  return m_query_objects;
 }
 
 void
@@ -690,6 +713,12 @@ Sector::save(Writer &writer)
     writer.write("init-script", m_init_script,false);
   }
 
+  if (writer.get_objects_placeholder()) {
+    writer.write("objects-placeholder", true);
+    writer.end_list("sector");
+    return;
+  }
+
   // saving objects;
   std::vector<GameObject*> objects(get_objects().size());
   std::transform(get_objects().begin(), get_objects().end(), objects.begin(), [] (auto& obj) {
@@ -34,6 +34,7 @@ class Constraints;
 }
 
 class Camera;
+class CollisionObject;
 class CollisionSystem;
 class CollisionGroundMovementManager;
 class DisplayEffect;
@@ -121,7 +122,26 @@ public:
     return (get_nearest_player (get_anchor_pos (pos, ANCHOR_MIDDLE)));
   }
 
-  std::vector<MovingObject*> get_nearby_objects (const Vector& center, float max_distance) const;
+  std::vector<MovingObject*> get_nearby_objects (const Vector& center, float max_distance);
+
+  /** Returns the objects of type T whose bbox overlaps @a rect. The
+      lookup goes through a spatial hash which follows the objects on
+      each collision update, an object moved with set_pos() since is
+      still found at its previous place. Not const, as the hash marks
+      the objects it visits. */
+  template<class T = MovingObject>
+  std::vector<T*> query_rect(const Rectf& rect)
+  {
+    return filter_objects<T>(query_objects(rect));
+  }
+
+  /** Returns the objects of type T whose center is within @a radius
+      of @a center */
+  template<class T = MovingObject>
+  std::vector<T*> query_radius(const Vector& center, float radius)
+  {
+    return filter_objects<T>(query_objects(center, radius));
+  }
 
   Rectf get_active_region() const;
 
@@ -158,6 +178,23 @@ private:
 
   int calculate_foremost_layer() const;
 
+  /** The returned list is reused by the next query */
+  const std::vector<MovingObject*>& query_objects(const Rectf& rect);
+  const std::vector<MovingObject*>& query_objects(const Vector& center, float radius);
+
+  template<class T>
+  static std::vector<T*> filter_objects(const std::vector<MovingObject*>& objects)
+  {
+    std::vector<T*> result;
+    for (auto* object : objects)
+    {
+      auto* t = dynamic_cast<T*>(object);
+      if (t)
+        result.push_back(t);
+    }
+    return result;
+  }
+
   /** Convert tiles into their corresponding GameObjects (e.g.
       bonusblocks, add light to lava tiles) */
   void convert_tiles2gameobject();
@@ -179,6 +216,10 @@ private:
 
   float m_gravity;
 
+  /** Scratch space for query_objects() */
+  std::vector<CollisionObject*> m_query_collision_objects;
+  std::vector<MovingObject*> m_query_objects;
+
 private:
   Sector(const Sector&) = delete;
   Sector& operator=(const Sector&) = delete;
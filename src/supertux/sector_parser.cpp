@@ -16,6 +16,7 @@
 
 #include "supertux/sector_parser.hpp"
 
+#include <chrono>
 #include <iostream>
 #include <physfs.h>
 #include <sexp/value.hpp>
@@ -40,6 +41,7 @@
 #include "supertux/sector.hpp"
 #include "supertux/tile.hpp"
 #include "supertux/tile_manager.hpp"
+#include "util/log.hpp"
 #include "util/reader_collection.hpp"
 #include "util/reader_mapping.hpp"
 
@@ -48,10 +50,16 @@ static const std::string DEFAULT_BG = "images/background/antarctic/arctis2.png";
 std::unique_ptr<Sector>
 SectorParser::from_reader(Level& level, const ReaderMapping& reader, bool editable)
 {
+  const auto start = std::chrono::steady_clock::now();
+
   auto sector = std::make_unique<Sector>(level);
   BIND_SECTOR(*sector);
   SectorParser parser(*sector, editable);
   parser.parse(reader);
+
+  log_debug << "Constructed sector '" << sector->get_name() << "' in "
+            << std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count()
+            << " ms" << std::endl;
   return sector;
 }
 
@@ -32,13 +32,16 @@ public:
   static std::unique_ptr<Sector> from_reader_old_format(Level& level, const ReaderMapping& sector, bool editable);
   static std::unique_ptr<Sector> from_nothing(Level& level);
 
+  /** Creates the object a sector entry stands for, nullptr if it
+      couldn't be created */
+  static std::unique_ptr<GameObject> parse_object(const std::string& name_, const ReaderMapping& reader);
+
 private:
   SectorParser(Sector& sector, bool editable);
 
   void parse_old_format(const ReaderMapping& reader);
   void parse(const ReaderMapping& sector);
   void create_sector();
-  std::unique_ptr<GameObject> parse_object(const std::string& name_, const ReaderMapping& reader);
 
 private:
   Sector& m_sector;
@@ -44,7 +44,42 @@ bool is_below_line (float l_x, float l_y, float m,
 
 } // namespace
 
+Tile::ImageSource::ImageSource(const std::string& filename, const boost::optional<Rect>& rect) :
+  m_filename(filename),
+  m_rect(rect),
+  m_surface()
+{
+}
+
+Tile::ImageSource::ImageSource(const SurfacePtr& surface) :
+  m_filename(),
+  m_rect(),
+  m_surface(surface)
+{
+}
+
+const SurfacePtr&
+Tile::ImageSource::get()
+{
+  if (!m_surface && !m_filename.empty())
+  {
+    try
+    {
+      m_surface = Surface::from_file(m_filename, m_rect);
+    }
+    catch(const std::exception& err)
+    {
+      log_warning << "Couldn't load tile image '" << m_filename << "': " << err.what() << std::endl;
+      m_filename.clear();
+    }
+  }
+  return m_surface;
+}
+
 Tile::Tile() :
+  m_image_specs(),
+  m_editor_image_specs(),
+  m_images_resolved(true),
   m_images(),
   m_editor_images(),
   m_attributes(0),
@@ -56,14 +91,17 @@ Tile::Tile() :
 {
 }
 
-Tile::Tile(const std::vector<SurfacePtr>& images,
-           const std::vector<SurfacePtr>& editor_images,
+Tile::Tile(const std::vector<ImageSpec>& images,
+           const std::vector<ImageSpec>& editor_images,
            uint32_t attributes, uint32_t data, float fps,
            const std::string& obj_name,
            const std::string& obj_data,
            bool deprecated) :
-  m_images(images),
-  m_editor_images(editor_images),
+  m_image_specs(images),
+  m_editor_image_specs(editor_images),
+  m_images_resolved(images.empty() && editor_images.empty()),
+  m_images(),
+  m_editor_images(),
   m_attributes(attributes),
   m_data(data),
   m_fps(fps),
@@ -73,6 +111,54 @@ Tile::Tile(const std::vector<SurfacePtr>& images,
 {
 }
 
+void
+Tile::resolve_images()
+{
+  if (m_images_resolved)
+    return;
+
+  auto resolve = [](const std::vector<ImageSpec>& specs, std::vector<SurfacePtr>& surfaces) {
+    surfaces.reserve(specs.size());
+    for (const auto& spec : specs)
+    {
+      const SurfacePtr& surface = spec.source->get();
+      if (surface)
+      {
+        surfaces.push_back(spec.region ? surface->region(*spec.region) : surface);
+      }
+    }
+  };
+
+  resolve(m_image_specs, m_images);
+  resolve(m_editor_image_specs, m_editor_images);
+
+  // Sources shared with other tiles stay alive through those tiles
+  m_image_specs.clear();
+  m_image_specs.shrink_to_fit();
+  m_editor_image_specs.clear();
+  m_editor_image_specs.shrink_to_fit();
+
+  m_images_resolved = true;
+}
+
+void
+Tile::get_image_files(std::vector<std::string>& files) const
+{
+  if (m_images_resolved)
+    return;
+
+  for (const auto* specs : { &m_image_specs, &m_editor_image_specs })
+  {
+    for (const auto& spec : *specs)
+    {
+      if (!spec.source->is_loaded() && !spec.source->get_filename().empty())
+      {
+        files.push_back(spec.source->get_filename());
+      }
+    }
+  }
+}
+
 void
 Tile::draw(Canvas& canvas, const Vector& pos, int z_pos, const Color& color) const
 {
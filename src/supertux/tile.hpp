@@ -19,9 +19,13 @@
 #ifndef HEADER_SUPERTUX_SUPERTUX_TILE_HPP
 #define HEADER_SUPERTUX_SUPERTUX_TILE_HPP
 
+#include <memory>
+#include <string>
 #include <vector>
 #include <stdint.h>
+#include <boost/optional.hpp>
 
+#include "math/rect.hpp"
 #include "math/rectf.hpp"
 #include "video/color.hpp"
 #include "video/surface_ptr.hpp"
@@ -97,14 +101,61 @@ public:
     UNI_DIR_MASK  = 3
   };
 
+  /** Image file that one or more tiles are cut from. The file is
+      only loaded once the first of these tiles gets resolved. */
+  class ImageSource final
+  {
+  public:
+    ImageSource(const std::string& filename, const boost::optional<Rect>& rect);
+    ImageSource(const SurfacePtr& surface);
+
+    const SurfacePtr& get();
+
+    /** Empty if the surface was not loaded from a plain image file */
+    const std::string& get_filename() const { return m_filename; }
+    bool is_loaded() const { return m_surface != nullptr; }
+
+  private:
+    std::string m_filename;
+    boost::optional<Rect> m_rect;
+    SurfacePtr m_surface;
+
+  private:
+    ImageSource(const ImageSource&) = delete;
+    ImageSource& operator=(const ImageSource&) = delete;
+  };
+
+  /** Unresolved reference to a single tile image, \a region is
+      relative to the source image */
+  struct ImageSpec
+  {
+    ImageSpec(const std::shared_ptr<ImageSource>& source_,
+              const boost::optional<Rect>& region_ = boost::none) :
+      source(source_),
+      region(region_)
+    {}
+
+    std::shared_ptr<ImageSource> source;
+    boost::optional<Rect> region;
+  };
+
 public:
   Tile();
-  Tile(const std::vector<SurfacePtr>& images,
-       const std::vector<SurfacePtr>& editor_images,
+  Tile(const std::vector<ImageSpec>& images,
+       const std::vector<ImageSpec>& editor_images,
        uint32_t attributes, uint32_t data, float fps,
        const std::string& obj_name = "", const std::string& obj_data = "",
        bool deprecated = false);
 
+  /** Loads the images of the tile, does nothing if they are already
+      loaded. Called by TileSet::resolve(). */
+  void resolve_images();
+
+  bool is_resolved() const { return m_images_resolved; }
+
+  /** Appends the image files that resolving this tile will load */
+  void get_image_files(std::vector<std::string>& files) const;
+
   /** Draw a tile on the screen */
   void draw(Canvas& canvas, const Vector& pos, int z_pos, const Color& color = Color(1, 1, 1)) const;
   void draw_debug(Canvas& canvas, const Vector& pos, int z_pos, const Color& color = Color(1.0f, 0.f, 1.0f, 0.5f)) const;
@@ -156,6 +207,12 @@ private:
                                 const Rectf& tile_bbox) const;
 
 private:
+  /** Images that haven't been loaded yet, the sources are shared
+      with the other tiles cut from the same file */
+  std::vector<ImageSpec> m_image_specs;
+  std::vector<ImageSpec> m_editor_image_specs;
+  bool m_images_resolved;
+
   std::vector<SurfacePtr> m_images;
   std::vector<SurfacePtr> m_editor_images;
 
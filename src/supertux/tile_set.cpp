@@ -16,6 +16,9 @@
 
 #include "supertux/tile_set.hpp"
 
+#include <algorithm>
+#include <chrono>
+
 #include "editor/editor.hpp"
 #include "supertux/autotile_parser.hpp"
 #include "supertux/resources.hpp"
@@ -25,6 +28,7 @@
 #include "util/log.hpp"
 #include "video/drawing_context.hpp"
 #include "video/surface.hpp"
+#include "video/texture_manager.hpp"
 
 Tilegroup::Tilegroup() :
   developers_group(),
@@ -36,11 +40,17 @@ Tilegroup::Tilegroup() :
 std::unique_ptr<TileSet>
 TileSet::from_file(const std::string& filename)
 {
+  const auto start = std::chrono::steady_clock::now();
   auto tileset = std::make_unique<TileSet>();
 
   TileSetParser parser(*tileset, filename);
   parser.parse();
 
+  // Tile images are only loaded on first use, so this is just the parsing
+  log_debug << "Parsed tileset '" << filename << "' with " << tileset->m_tiles.size() << " tiles in "
+            << std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count()
+            << "ms" << std::endl;
+
   tileset->print_debug_info(filename);
 
   return tileset;
@@ -50,6 +60,8 @@ TileSet::TileSet() :
   m_autotilesets(),
   m_thunderstorm_tiles(),
   m_tiles(1),
+  m_collision_flags(1, 0),
+  m_resolved_count(0),
   m_tilegroups()
 {
   m_tiles[0] = std::make_unique<Tile>();
@@ -66,11 +78,16 @@ TileSet::add_tile(int id, std::unique_ptr<Tile> tile)
 {
   if (id >= static_cast<int>(m_tiles.size())) {
     m_tiles.resize(id + 1);
+    m_collision_flags.resize(id + 1, 0);
   }
 
   if (m_tiles[id]) {
     log_warning << "Tile with ID " << id << " redefined" << std::endl;
   } else {
+    uint16_t flags = static_cast<uint16_t>(tile->get_attributes() & (Tile::SOLID | Tile::UNISOLID | Tile::SLOPE));
+    if (tile->is_slope())
+      flags = static_cast<uint16_t>(flags | ((tile->get_data() & 0xFF) << 8));
+    m_collision_flags[id] = flags;
     m_tiles[id] = std::move(tile);
   }
 }
@@ -93,6 +110,36 @@ TileSet::get(const uint32_t id) const
   }
 }
 
+const Tile&
+TileSet::resolve(const uint32_t id)
+{
+  if (id < m_tiles.size() && m_tiles[id] && !m_tiles[id]->is_resolved())
+  {
+    m_tiles[id]->resolve_images();
+    m_resolved_count += 1;
+  }
+  return get(id);
+}
+
+void
+TileSet::warm(const std::vector<uint32_t>& ids) const
+{
+  std::vector<std::string> files;
+  for (const auto id : ids)
+  {
+    if (id < m_tiles.size() && m_tiles[id])
+    {
+      m_tiles[id]->get_image_files(files);
+    }
+  }
+
+  std::sort(files.begin(), files.end());
+  files.erase(std::unique(files.begin(), files.end()), files.end());
+
+  log_debug << "Warming " << files.size() << " tile images for " << ids.size() << " tiles" << std::endl;
+  TextureManager::current()->preload(files);
+}
+
 AutotileSet*
 TileSet::get_autotileset_from_tile(uint32_t tile_id) const
 {
@@ -58,10 +58,32 @@ public:
 
   void add_tilegroup(const Tilegroup& tilegroup);
 
+  /** Loads the images of the tile with the given id, unless that
+      already happened, and returns the tile. TileMap resolves its
+      tiles when they are first drawn. */
+  const Tile& resolve(const uint32_t id);
+
+  /** Returns the tile with the given id, its images are only
+      available once it has been resolved */
   const Tile& get(const uint32_t id) const;
+
+  /** Decodes the images of the given tiles in the background, so that
+      resolving them later only has to upload the textures */
+  void warm(const std::vector<uint32_t>& ids) const;
   
   AutotileSet* get_autotileset_from_tile(uint32_t tile_id) const;
 
+  /** Returns the Tile::SOLID, Tile::UNISOLID and Tile::SLOPE
+      attributes of the given tile in the lower byte and its slope
+      direction in the upper byte, without touching the Tile */
+  uint16_t get_collision_flags(uint32_t id) const
+  {
+    return id < m_collision_flags.size() ? m_collision_flags[id] : 0;
+  }
+
+  /** Number of tiles whose images have been loaded */
+  size_t get_resolved_count() const { return m_resolved_count; }
+
   uint32_t get_max_tileid() const {
     return static_cast<uint32_t>(m_tiles.size());
   }
@@ -83,6 +105,8 @@ public:
 
 private:
   std::vector<std::unique_ptr<Tile> > m_tiles;
+  std::vector<uint16_t> m_collision_flags;
+  size_t m_resolved_count;
   std::vector<Tilegroup> m_tilegroups;
 
 private:
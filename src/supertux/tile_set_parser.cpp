@@ -237,13 +237,13 @@ TileSetParser::parse_tile(const ReaderMapping& reader, int32_t min, int32_t max,
     attributes |= Tile::SOLID | Tile::SLOPE;
   }
 
-  std::vector<SurfacePtr> editor_surfaces;
+  std::vector<Tile::ImageSpec> editor_surfaces;
   boost::optional<ReaderMapping> editor_images_mapping;
   if (reader.get("editor-images", editor_images_mapping)) {
     editor_surfaces = parse_imagespecs(*editor_images_mapping);
   }
 
-  std::vector<SurfacePtr> surfaces;
+  std::vector<Tile::ImageSpec> surfaces;
   boost::optional<ReaderMapping> images_mapping;
   if (reader.get("images", images_mapping)) {
     surfaces = parse_imagespecs(*images_mapping);
@@ -333,13 +333,13 @@ TileSetParser::parse_tiles(const ReaderMapping& reader, int32_t min, int32_t max
   {
     if (shared_surface)
     {
-      std::vector<SurfacePtr> editor_surfaces;
+      std::vector<Tile::ImageSpec> editor_surfaces;
       boost::optional<ReaderMapping> editor_surfaces_mapping;
       if (reader.get("editor-images", editor_surfaces_mapping)) {
         editor_surfaces = parse_imagespecs(*editor_surfaces_mapping);
       }
 
-      std::vector<SurfacePtr> surfaces;
+      std::vector<Tile::ImageSpec> surfaces;
       boost::optional<ReaderMapping> surfaces_mapping;
       if (reader.get("image", surfaces_mapping) ||
          reader.get("images", surfaces_mapping)) {
@@ -354,18 +354,20 @@ TileSetParser::parse_tiles(const ReaderMapping& reader, int32_t min, int32_t max
         const int x = static_cast<int>(32 * (i % width));
         const int y = static_cast<int>(32 * (i / width));
 
-        std::vector<SurfacePtr> regions;
+        // All tiles share the image source, it gets loaded once the
+        // first of them is used
+        std::vector<Tile::ImageSpec> regions;
         regions.reserve(surfaces.size());
         std::transform(surfaces.begin(), surfaces.end(), std::back_inserter(regions),
-            [x, y] (const SurfacePtr& surface) { 
-              return surface->region(Rect(x, y, Size(32, 32)));
+            [x, y] (const Tile::ImageSpec& spec) {
+              return Tile::ImageSpec(spec.source, Rect(x, y, Size(32, 32)));
             });
 
-        std::vector<SurfacePtr> editor_regions;
+        std::vector<Tile::ImageSpec> editor_regions;
         editor_regions.reserve(editor_surfaces.size());
         std::transform(editor_surfaces.begin(), editor_surfaces.end(), std::back_inserter(editor_regions),
-            [x, y] (const SurfacePtr& surface) { 
-              return surface->region(Rect(x, y, Size(32, 32)));
+            [x, y] (const Tile::ImageSpec& spec) {
+              return Tile::ImageSpec(spec.source, Rect(x, y, Size(32, 32)));
             });
 
         auto tile = std::make_unique<Tile>(regions,
@@ -387,14 +389,14 @@ TileSetParser::parse_tiles(const ReaderMapping& reader, int32_t min, int32_t max
         int x = static_cast<int>(32 * (i % width));
         int y = static_cast<int>(32 * (i / width));
 
-        std::vector<SurfacePtr> surfaces;
+        std::vector<Tile::ImageSpec> surfaces;
         boost::optional<ReaderMapping> surfaces_mapping;
         if (reader.get("image", surfaces_mapping) ||
            reader.get("images", surfaces_mapping)) {
           surfaces = parse_imagespecs(*surfaces_mapping, Rect(x, y, Size(32, 32)));
         }
 
-        std::vector<SurfacePtr> editor_surfaces;
+        std::vector<Tile::ImageSpec> editor_surfaces;
         boost::optional<ReaderMapping> editor_surfaces_mapping;
         if (reader.get("editor-images", editor_surfaces_mapping)) {
           editor_surfaces = parse_imagespecs(*editor_surfaces_mapping, Rect(x, y, Size(32, 32)));
@@ -412,11 +414,13 @@ TileSetParser::parse_tiles(const ReaderMapping& reader, int32_t min, int32_t max
   }
 }
 
-std::vector<SurfacePtr>
+std::vector<Tile::ImageSpec>
   TileSetParser::parse_imagespecs(const ReaderMapping& images_mapping,
                                   const boost::optional<Rect>& surface_region) const
 {
-  std::vector<SurfacePtr> surfaces;
+  // Image files are not loaded here, but when the tile is first drawn,
+  // see TileSet::resolve()
+  std::vector<Tile::ImageSpec> surfaces;
 
   // (images "foo.png" "foo.bar" ...)
   // (images (region "foo.png" 0 0 32 32))
@@ -426,11 +430,12 @@ std::vector<SurfacePtr>
     if (iter.is_string())
     {
       std::string file = iter.as_string_item();
-      surfaces.push_back(Surface::from_file(FileSystem::join(m_tiles_path, file), surface_region));
+      surfaces.emplace_back(std::make_shared<Tile::ImageSource>(FileSystem::join(m_tiles_path, file), surface_region));
     }
     else if (iter.is_pair() && iter.get_key() == "surface")
     {
-      surfaces.push_back(Surface::from_reader(iter.as_mapping(), surface_region));
+      // The mapping doesn't outlive the parser, so this one is loaded right away
+      surfaces.emplace_back(std::make_shared<Tile::ImageSource>(Surface::from_reader(iter.as_mapping(), surface_region)));
     }
     else if (iter.is_pair() && iter.get_key() == "region")
     {
@@ -459,8 +464,8 @@ std::vector<SurfacePtr>
           rect.bottom = rect.top + surface_region->get_height();
         }
 
-        surfaces.push_back(Surface::from_file(FileSystem::join(m_tiles_path, file),
-                                              rect));
+        surfaces.emplace_back(std::make_shared<Tile::ImageSource>(FileSystem::join(m_tiles_path, file),
+                                                                  rect));
       }
     }
     else
@@ -43,8 +43,8 @@ public:
 private:
   void parse_tile(const ReaderMapping& reader, int32_t min, int32_t max, int32_t offset);
   void parse_tiles(const ReaderMapping& reader, int32_t min, int32_t max, int32_t offset);
-  std::vector<SurfacePtr> parse_imagespecs(const ReaderMapping& cur,
-                                           const boost::optional<Rect>& region = boost::none) const;
+  std::vector<Tile::ImageSpec> parse_imagespecs(const ReaderMapping& cur,
+                                                const boost::optional<Rect>& region = boost::none) const;
 
 private:
   TileSetParser(const TileSetParser&) = delete;
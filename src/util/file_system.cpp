@@ -18,6 +18,7 @@
 
 #include <boost/filesystem.hpp>
 #include <boost/version.hpp>
+#include <fstream>
 #include <sstream>
 #include <stdexcept>
 #include <sys/stat.h>
@@ -243,6 +244,38 @@ bool remove(const std::string& path)
   return fs::remove(location);
 }
 
+void rename(const std::string& old_path, const std::string& new_path)
+{
+  fs::rename(fs::path(old_path), fs::path(new_path));
+}
+
+void write_atomically(const std::string& path, const std::string& data)
+{
+  const std::string tmp_path = path + ".tmp";
+  {
+    std::ofstream file(tmp_path, std::ios::binary);
+    file.write(data.data(), static_cast<std::streamsize>(data.size()));
+    file.close();
+    if (!file)
+    {
+      boost::system::error_code ec;
+      fs::remove(fs::path(tmp_path), ec);
+      throw std::runtime_error("Couldn't write file '" + tmp_path + "'");
+    }
+  }
+
+  try
+  {
+    rename(tmp_path, path);
+  }
+  catch(const std::exception& e)
+  {
+    boost::system::error_code ec;
+    fs::remove(fs::path(tmp_path), ec);
+    throw std::runtime_error("Couldn't replace '" + path + "': " + e.what());
+  }
+}
+
 void open_path(const std::string& path)
 {
 #ifdef __ANDROID__
@@ -60,6 +60,15 @@ std::string join(const std::string& lhs, const std::string& rhs);
     @return true when successfully removed, false otherwise */
  bool remove(const std::string& path);
 
+/** Rename a file, replacing the target if it exists */
+ void rename(const std::string& old_path, const std::string& new_path);
+
+/** Replace the content of the file at @a path with @a data. The data
+    is written to a temporary file next to it first, which is then
+    renamed over the old file, so a crash never leaves a truncated
+    file behind. Throws on failure. */
+ void write_atomically(const std::string& path, const std::string& data);
+
 /** Opens a file path with the user's preferred app for that file.
  * @param path path to open
  */
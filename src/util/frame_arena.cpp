@@ -0,0 +1,97 @@
+//  SuperTux
+//  Copyright (C) 2024 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "util/frame_arena.hpp"
+
+#include <algorithm>
+#include <stdint.h>
+
+FrameArena::FrameArena(size_t initial_size) :
+  m_buffers(),
+  m_current(0)
+{
+  for (auto& buffer : m_buffers)
+  {
+    buffer.chunks.emplace_back(initial_size);
+  }
+}
+
+void*
+FrameArena::allocate(size_t bytes, size_t alignment)
+{
+  assert(alignment != 0 && (alignment & (alignment - 1)) == 0);
+
+  Buffer& buffer = m_buffers[m_current];
+  Chunk& chunk = buffer.chunks.back();
+
+  const uintptr_t base = reinterpret_cast<uintptr_t>(chunk.memory.get());
+  const uintptr_t aligned = (base + buffer.used + alignment - 1) & ~static_cast<uintptr_t>(alignment - 1);
+  const size_t offset = static_cast<size_t>(aligned - base);
+
+  if (offset + bytes > chunk.size)
+  {
+    buffer.used_in_previous_chunks += buffer.used;
+    buffer.chunks.emplace_back(std::max(chunk.size * 2, bytes + alignment));
+    buffer.used = 0;
+    return allocate(bytes, alignment);
+  }
+
+  buffer.used = offset + bytes;
+  return chunk.memory.get() + offset;
+}
+
+void
+FrameArena::next_frame()
+{
+  m_current = 1 - m_current;
+
+  Buffer& buffer = m_buffers[m_current];
+  if (buffer.chunks.size() > 1)
+  {
+    size_t total = 0;
+    for (const auto& chunk : buffer.chunks)
+    {
+      total += chunk.size;
+    }
+    buffer.chunks.clear();
+    buffer.chunks.emplace_back(total);
+  }
+  buffer.used = 0;
+  buffer.used_in_previous_chunks = 0;
+}
+
+size_t
+FrameArena::get_bytes_used() const
+{
+  const Buffer& buffer = m_buffers[m_current];
+  return buffer.used_in_previous_chunks + buffer.used;
+}
+
+size_t
+FrameArena::get_capacity() const
+{
+  size_t total = 0;
+  for (const auto& buffer : m_buffers)
+  {
+    for (const auto& chunk : buffer.chunks)
+    {
+      total += chunk.size;
+    }
+  }
+  return total;
+}
+
+/* EOF */
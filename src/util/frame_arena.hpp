@@ -0,0 +1,136 @@
+//  SuperTux
+//  Copyright (C) 2024 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef HEADER_SUPERTUX_UTIL_FRAME_ARENA_HPP
+#define HEADER_SUPERTUX_UTIL_FRAME_ARENA_HPP
+
+#include <assert.h>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+/** A non-owning view of a contiguous array allocated from a FrameArena */
+template<typename T>
+class FrameSpan final
+{
+public:
+  FrameSpan() : m_data(nullptr), m_size(0) {}
+  FrameSpan(T* data, size_t size) : m_data(data), m_size(size) {}
+
+  T* begin() const { return m_data; }
+  T* end() const { return m_data + m_size; }
+
+  T* data() const { return m_data; }
+  size_t size() const { return m_size; }
+  bool empty() const { return m_size == 0; }
+
+  T& operator[](size_t idx) const { assert(idx < m_size); return m_data[idx]; }
+
+private:
+  T* m_data;
+  size_t m_size;
+};
+
+/** Bump allocator for data that only lives for the duration of a
+    frame. It holds two buffers, next_frame() switches to the other
+    one and rewinds it, so the memory handed out during the previous
+    frame stays valid while the next one is being recorded. Buffers
+    that overflowed are merged into a single larger block on rewind,
+    so after the first few frames no further heap allocations happen.
+
+    Destructors are never run, objects with non-trivial destructors
+    have to be destroyed by the caller. */
+class FrameArena final
+{
+public:
+  FrameArena(size_t initial_size = 64 * 1024);
+
+  void* allocate(size_t bytes, size_t alignment = alignof(std::max_align_t));
+
+  /** Allocate @a count copies of @a value */
+  template<typename T>
+  FrameSpan<T> make_span(size_t count, const T& value = T())
+  {
+    static_assert(std::is_trivially_destructible<T>::value, "FrameSpan elements are never destroyed");
+    T* data = static_cast<T*>(allocate(sizeof(T) * count, alignof(T)));
+    std::uninitialized_fill_n(data, count, value);
+    return FrameSpan<T>(data, count);
+  }
+
+  template<typename T>
+  FrameSpan<T> copy_span(const std::vector<T>& values)
+  {
+    static_assert(std::is_trivially_destructible<T>::value, "FrameSpan elements are never destroyed");
+    T* data = static_cast<T*>(allocate(sizeof(T) * values.size(), alignof(T)));
+    std::uninitialized_copy(values.begin(), values.end(), data);
+    return FrameSpan<T>(data, values.size());
+  }
+
+  /** Switch to the other buffer and rewind it, invalidating the
+      memory allocated two frames ago */
+  void next_frame();
+
+  /** Bytes handed out from the current buffer */
+  size_t get_bytes_used() const;
+
+  /** Bytes reserved by both buffers */
+  size_t get_capacity() const;
+
+private:
+  struct Chunk
+  {
+    Chunk(size_t size_) : memory(new char[size_]), size(size_) {}
+
+    std::unique_ptr<char[]> memory;
+    size_t size;
+  };
+
+  struct Buffer
+  {
+    Buffer() : chunks(), used(0), used_in_previous_chunks(0) {}
+
+    std::vector<Chunk> chunks;
+
+    /** Offset into the last chunk */
+    size_t used;
+    size_t used_in_previous_chunks;
+  };
+
+private:
+  Buffer m_buffers[2];
+  int m_current;
+
+private:
+  FrameArena(const FrameArena&) = delete;
+  FrameArena& operator=(const FrameArena&) = delete;
+};
+
+inline void*
+operator new (size_t bytes, FrameArena& arena)
+{
+  return arena.allocate(bytes);
+}
+
+inline void
+operator delete (void*, FrameArena&)
+{
+  // memory is reclaimed by FrameArena::next_frame()
+}
+
+#endif
+
+/* EOF */
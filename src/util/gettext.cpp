@@ -16,6 +16,65 @@
 
 #include "util/gettext.hpp"
 
+#include <assert.h>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+
 std::unique_ptr<tinygettext::DictionaryManager> g_dictionary_manager = nullptr;
 
+namespace {
+
+/** Translations of the messages registered by TranslatedMessage */
+std::unordered_map<std::string, std::string> s_translations;
+
+/** Incremented on every invalidation, so that TranslatedMessage can
+    tell whether its cached translation is still current */
+int s_translations_generation = 0;
+
+/** Static initialization runs on the main thread */
+const std::thread::id s_main_thread = std::this_thread::get_id();
+
+const std::string&
+get_cached_translation(const char* message)
+{
+  assert(std::this_thread::get_id() == s_main_thread);
+
+  auto it = s_translations.find(message);
+  if (it == s_translations.end())
+  {
+    it = s_translations.emplace(message, _(message)).first;
+  }
+  return it->second;
+}
+
+} // namespace
+
+void
+invalidate_translations()
+{
+  assert(std::this_thread::get_id() == s_main_thread);
+
+  s_translations.clear();
+  s_translations_generation += 1;
+}
+
+TranslatedMessage::TranslatedMessage(const char* message) :
+  m_message(message),
+  m_translation(nullptr),
+  m_generation(-1)
+{
+}
+
+const std::string&
+TranslatedMessage::get() const
+{
+  if (m_generation != s_translations_generation)
+  {
+    m_translation = &get_cached_translation(m_message);
+    m_generation = s_translations_generation;
+  }
+  return *m_translation;
+}
+
 /* EOF */
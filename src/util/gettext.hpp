@@ -19,6 +19,7 @@
 
 #include <tinygettext/tinygettext.hpp>
 #include <memory>
+#include <string>
 
 extern std::unique_ptr<tinygettext::DictionaryManager> g_dictionary_manager;
 
@@ -85,6 +86,43 @@ static inline std::string __(const std::string& message,
   }
 }
 
+/** Drops all cached translations, to be called whenever the language
+    or the dictionary search path changes */
+void invalidate_translations();
+
+/** A message whose translation is looked up once per language instead
+    of on every use, for strings that are translated every frame.
+
+    The translations are cached by message, so only messages known at
+    compile time may be registered, dynamic strings would make the
+    cache grow without bound. The cache is not locked, it may only be
+    used from the main thread. */
+class TranslatedMessage final
+{
+public:
+  explicit TranslatedMessage(const char* message);
+
+  const std::string& get() const;
+
+private:
+  const char* m_message;
+  mutable const std::string* m_translation;
+  mutable int m_generation;
+
+private:
+  TranslatedMessage(const TranslatedMessage&) = delete;
+  TranslatedMessage& operator=(const TranslatedMessage&) = delete;
+};
+
+/** Same as _(), but the message is registered once per call site, so
+    repeated use neither constructs a key nor does a lookup. The
+    returned reference stays valid until invalidate_translations() is
+    called. @a message has to be a string literal. */
+#define _s(message) ([]() -> const std::string& {             \
+      static const TranslatedMessage s_translated_message(message); \
+      return s_translated_message.get();                        \
+    }())
+
 #endif
 
 /* EOF */
@@ -81,6 +81,7 @@ void register_translation_directory(const std::string& filename)
 
     if (!rel_dir.empty()) {
       g_dictionary_manager->add_directory(rel_dir);
+      invalidate_translations();
     }
   }
 }
@@ -0,0 +1,244 @@
+//  SuperTux
+//  Copyright (C) 2024 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "util/save_queue.hpp"
+
+#include <chrono>
+#include <physfs.h>
+#include <sstream>
+#include <stdexcept>
+
+#include "util/file_system.hpp"
+#include "util/log.hpp"
+#include "util/thread_pool.hpp"
+#include "util/writer.hpp"
+
+namespace {
+
+float seconds_since(const std::chrono::steady_clock::time_point& start)
+{
+  return std::chrono::duration<float>(std::chrono::steady_clock::now() - start).count();
+}
+
+std::string serialize_to_string(const std::function<void (Writer&)>& serialize)
+{
+  std::ostringstream out;
+  {
+    Writer writer(out);
+    serialize(writer);
+  }
+  return out.str();
+}
+
+} // namespace
+
+void
+SaveQueue::save_file(const std::string& filename,
+                     const std::function<void (Writer&)>& serialize,
+                     Callback callback)
+{
+  if (current())
+  {
+    current()->save(filename, serialize, std::move(callback));
+    return;
+  }
+
+  const auto start = std::chrono::steady_clock::now();
+  const std::string data = serialize_to_string(serialize);
+  Result result{filename, data.size(), seconds_since(start), 0.0f, {}, std::move(callback)};
+  write(result, data);
+  finish(result);
+}
+
+void
+SaveQueue::save_file(const std::string& filename, std::string data, Callback callback)
+{
+  if (current())
+  {
+    current()->save(filename, std::move(data), std::move(callback));
+    return;
+  }
+
+  Result result{filename, data.size(), 0.0f, 0.0f, {}, std::move(callback)};
+  write(result, data);
+  finish(result);
+}
+
+void
+SaveQueue::write_file(const std::string& filename, const std::string& data)
+{
+  const char* write_dir = PHYSFS_getWriteDir();
+  if (!write_dir)
+  {
+    throw std::runtime_error("Couldn't save '" + filename + "': no write directory set");
+  }
+
+  const std::string tmp_filename = filename + ".tmp";
+  PHYSFS_File* file = PHYSFS_openWrite(tmp_filename.c_str());
+  if (!file)
+  {
+    std::ostringstream msg;
+    msg << "Couldn't open file '" << tmp_filename << "': "
+        << PHYSFS_getErrorByCode(PHYSFS_getLastErrorCode());
+    throw std::runtime_error(msg.str());
+  }
+
+  bool success = PHYSFS_writeBytes(file, data.data(), data.size()) == static_cast<PHYSFS_sint64>(data.size());
+  std::string error = success ? std::string() : PHYSFS_getErrorByCode(PHYSFS_getLastErrorCode());
+  if (!PHYSFS_close(file) && success)
+  {
+    success = false;
+    error = PHYSFS_getErrorByCode(PHYSFS_getLastErrorCode());
+  }
+
+  if (!success)
+  {
+    PHYSFS_delete(tmp_filename.c_str());
+    throw std::runtime_error("Couldn't write file '" + tmp_filename + "': " + error);
+  }
+
+  try
+  {
+    FileSystem::rename(FileSystem::join(write_dir, tmp_filename),
+                       FileSystem::join(write_dir, filename));
+  }
+  catch(const std::exception& e)
+  {
+    PHYSFS_delete(tmp_filename.c_str());
+    throw std::runtime_error("Couldn't replace '" + filename + "': " + e.what());
+  }
+}
+
+SaveQueue::SaveQueue() :
+  m_writer(),
+  m_mutex(),
+  m_results(),
+  m_main_thread_time(0.0f)
+{
+#ifndef __EMSCRIPTEN__
+  m_writer = std::make_unique<ThreadPool>(1);
+#endif
+}
+
+SaveQueue::~SaveQueue()
+{
+  flush();
+}
+
+void
+SaveQueue::save(const std::string& filename, const std::function<void (Writer&)>& serialize,
+                Callback callback)
+{
+  const auto start = std::chrono::steady_clock::now();
+  std::string data = serialize_to_string(serialize);
+  const float main_thread_time = seconds_since(start);
+  m_main_thread_time += main_thread_time;
+
+  Result result{filename, data.size(), main_thread_time, 0.0f, {}, std::move(callback)};
+  queue(std::move(result), std::move(data));
+}
+
+void
+SaveQueue::save(const std::string& filename, std::string data, Callback callback)
+{
+  Result result{filename, data.size(), 0.0f, 0.0f, {}, std::move(callback)};
+  queue(std::move(result), std::move(data));
+}
+
+void
+SaveQueue::queue(Result result_, std::string data_)
+{
+  auto result = std::make_shared<Result>(std::move(result_));
+  auto data = std::make_shared<std::string>(std::move(data_));
+  auto job = [this, result, data]
+  {
+    write(*result, *data);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_results.push_back(std::move(*result));
+  };
+
+  if (m_writer)
+  {
+    m_writer->post(std::move(job));
+  }
+  else
+  {
+    job();
+    update();
+  }
+}
+
+void
+SaveQueue::update()
+{
+  std::vector<Result> results;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_results.empty())
+      return;
+    results.swap(m_results);
+  }
+
+  for (const auto& result : results)
+  {
+    finish(result);
+  }
+}
+
+void
+SaveQueue::flush()
+{
+  if (m_writer)
+  {
+    m_writer->wait();
+  }
+  update();
+}
+
+void
+SaveQueue::write(Result& result, const std::string& data)
+{
+  const auto start = std::chrono::steady_clock::now();
+  try
+  {
+    write_file(result.filename, data);
+  }
+  catch(const std::exception& e)
+  {
+    result.error = e.what();
+  }
+  result.write_time = seconds_since(start);
+}
+
+void
+SaveQueue::finish(const Result& result)
+{
+  log_debug << "Saved '" << result.filename << "' (" << result.size << " bytes): "
+            << result.main_thread_time * 1000.0f << " ms on the main thread, "
+            << result.write_time * 1000.0f << " ms writing" << std::endl;
+
+  if (result.callback)
+  {
+    result.callback(result.error);
+  }
+  else if (!result.error.empty())
+  {
+    log_warning << result.error << std::endl;
+  }
+}
+
+/* EOF */
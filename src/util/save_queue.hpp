@@ -0,0 +1,109 @@
+//  SuperTux
+//  Copyright (C) 2024 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef HEADER_SUPERTUX_UTIL_SAVE_QUEUE_HPP
+#define HEADER_SUPERTUX_UTIL_SAVE_QUEUE_HPP
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "util/currenton.hpp"
+
+class ThreadPool;
+class Writer;
+
+/** Writes files on a background thread. The data is serialized into
+    memory on the calling thread, the file is then written to a
+    temporary file next to it and renamed over the old one, so a crash
+    in the middle of saving never leaves a truncated file behind.
+    Writes are done in the order they were queued, the destructor
+    waits for all of them to finish. */
+class SaveQueue final : public Currenton<SaveQueue>
+{
+public:
+  /** Called on the main thread once the file is written, @a error is
+      empty on success */
+  using Callback = std::function<void (const std::string& error)>;
+
+  /** Serialize through @a serialize and queue up the result to be
+      written to @a filename, or write it right away when there is no
+      SaveQueue. Failing to serialize throws, failing to write is
+      reported through @a callback, or logged when there is none. */
+  static void save_file(const std::string& filename,
+                        const std::function<void (Writer&)>& serialize,
+                        Callback callback = {});
+
+  /** Same as above, for data that is already serialized */
+  static void save_file(const std::string& filename, std::string data, Callback callback = {});
+
+  /** Atomically replace the content of @a filename in the PhysFS
+      write directory with @a data, throws on failure */
+  static void write_file(const std::string& filename, const std::string& data);
+
+public:
+  SaveQueue();
+  ~SaveQueue() override;
+
+  void save(const std::string& filename, const std::function<void (Writer&)>& serialize,
+            Callback callback = {});
+  void save(const std::string& filename, std::string data, Callback callback = {});
+
+  /** Run the callbacks of the writes finished so far */
+  void update();
+
+  /** Block until all queued writes are done and run their callbacks */
+  void flush();
+
+  /** Total time spent serializing on the calling thread, in seconds */
+  float get_main_thread_time() const { return m_main_thread_time; }
+
+private:
+  struct Result
+  {
+    std::string filename;
+    size_t size;
+    float main_thread_time;
+    float write_time;
+    std::string error;
+    Callback callback;
+  };
+
+private:
+  /** Write the file described by @a result, storing the outcome in it */
+  static void write(Result& result, const std::string& data);
+  static void finish(const Result& result);
+
+  void queue(Result result, std::string data);
+
+private:
+  std::unique_ptr<ThreadPool> m_writer;
+
+  std::mutex m_mutex;
+  std::vector<Result> m_results;
+
+  float m_main_thread_time;
+
+private:
+  SaveQueue(const SaveQueue&) = delete;
+  SaveQueue& operator=(const SaveQueue&) = delete;
+};
+
+#endif
+
+/* EOF */
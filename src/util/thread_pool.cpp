@@ -0,0 +1,109 @@
+//  SuperTux
+//  Copyright (C) 2024 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "util/thread_pool.hpp"
+
+#include <algorithm>
+
+ThreadPool::ThreadPool(int num_threads) :
+  m_threads(),
+  m_jobs(),
+  m_mutex(),
+  m_job_cond(),
+  m_idle_cond(),
+  m_running(0),
+  m_quit(false)
+{
+  num_threads = std::max(1, num_threads);
+  m_threads.reserve(num_threads);
+  for (int i = 0; i < num_threads; ++i)
+  {
+    m_threads.emplace_back([this] { run(); });
+  }
+}
+
+ThreadPool::~ThreadPool()
+{
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_quit = true;
+  }
+  m_job_cond.notify_all();
+
+  for (auto& thread : m_threads)
+  {
+    thread.join();
+  }
+}
+
+void
+ThreadPool::post(std::function<void ()> job)
+{
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_jobs.push_back(std::move(job));
+  }
+  m_job_cond.notify_one();
+}
+
+void
+ThreadPool::clear()
+{
+  std::deque<std::function<void ()> > dropped;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    dropped.swap(m_jobs);
+  }
+  m_idle_cond.notify_all();
+  // 'dropped' is destroyed outside of the lock, as the destructors
+  // of captured state may be arbitrarily expensive
+}
+
+void
+ThreadPool::wait()
+{
+  std::unique_lock<std::mutex> lock(m_mutex);
+  m_idle_cond.wait(lock, [this]{ return m_jobs.empty() && m_running == 0; });
+}
+
+void
+ThreadPool::run()
+{
+  while (true)
+  {
+    std::function<void ()> job;
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_job_cond.wait(lock, [this]{ return m_quit || !m_jobs.empty(); });
+      if (m_jobs.empty())
+        return; // m_quit is set and nothing is left to do
+
+      job = std::move(m_jobs.front());
+      m_jobs.pop_front();
+      m_running += 1;
+    }
+
+    job();
+
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_running -= 1;
+    }
+    m_idle_cond.notify_all();
+  }
+}
+
+/* EOF */
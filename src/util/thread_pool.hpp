@@ -0,0 +1,69 @@
+//  SuperTux
+//  Copyright (C) 2024 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef HEADER_SUPERTUX_UTIL_THREAD_POOL_HPP
+#define HEADER_SUPERTUX_UTIL_THREAD_POOL_HPP
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/** A small fixed-size pool of worker threads that executes jobs in
+    the order they were posted. Jobs must not touch the log console,
+    the video system or any other main-thread-only state; results are
+    handed back through futures or queues owned by the caller. */
+class ThreadPool final
+{
+public:
+  explicit ThreadPool(int num_threads = 1);
+
+  /** Finishes all queued jobs, then joins the worker threads */
+  ~ThreadPool();
+
+  /** Queues a job for execution on one of the worker threads */
+  void post(std::function<void ()> job);
+
+  /** Drops all jobs that have not been started yet */
+  void clear();
+
+  /** Blocks until all queued and running jobs have finished */
+  void wait();
+
+  int get_thread_count() const { return static_cast<int>(m_threads.size()); }
+
+private:
+  void run();
+
+private:
+  std::vector<std::thread> m_threads;
+  std::deque<std::function<void ()> > m_jobs;
+  std::mutex m_mutex;
+  std::condition_variable m_job_cond;
+  std::condition_variable m_idle_cond;
+  int m_running;
+  bool m_quit;
+
+private:
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+};
+
+#endif
+
+/* EOF */
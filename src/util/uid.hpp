@@ -34,6 +34,11 @@ struct hash<UID>
 
 } // namespace std {
 
+/** Handle of a GameObject within its GameObjectManager. Besides the
+    magic of the manager it encodes a slot index into the manager's
+    object table and the generation of that slot, so resolving it is a
+    plain array access and handles of removed objects can be detected
+    as stale once their slot has been reused. */
 class UID
 {
   friend class UIDGenerator;
@@ -44,7 +49,7 @@ public:
   using Magic = uint8_t;
 
 private:
-  explicit UID(uint32_t value) :
+  explicit UID(uint64_t value) :
     m_value(value)
   {
     assert(m_value != 0);
@@ -71,10 +76,12 @@ public:
     return m_value != other.m_value;
   }
 
-  inline Magic get_magic() const { return static_cast<Magic>((m_value & 0xffff0000u) >> 16); }
+  inline Magic get_magic() const { return static_cast<Magic>(m_value >> 56); }
+  inline uint32_t get_generation() const { return static_cast<uint32_t>((m_value >> 32) & 0xffffffu); }
+  inline uint32_t get_index() const { return static_cast<uint32_t>(m_value & 0xffffffffu); }
 
 protected:
-  uint32_t m_value;
+  uint64_t m_value;
 };
 
 std::ostream& operator<<(std::ostream& os, const UID& uid);
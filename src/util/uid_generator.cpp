@@ -16,13 +16,20 @@
 
 #include "util/uid_generator.hpp"
 
-#include "util/log.hpp"
+#include <assert.h>
 
 uint8_t UIDGenerator::s_magic_counter = 1;
 
+namespace {
+
+const uint32_t MAX_GENERATION = 0xffffff;
+
+} // namespace
+
 UIDGenerator::UIDGenerator() :
   m_magic(s_magic_counter++),
-  m_id_counter()
+  m_generations(),
+  m_free_slots()
 {
   if (s_magic_counter == 0)
   {
@@ -33,15 +40,39 @@ UIDGenerator::UIDGenerator() :
 UID
 UIDGenerator::next()
 {
-  m_id_counter += 1;
-
-  if (m_id_counter > 0xffffff)
+  uint32_t index;
+  if (m_free_slots.empty())
   {
-    log_warning << "UIDGenerator overflow" << std::endl;
-    m_id_counter = 0;
+    index = static_cast<uint32_t>(m_generations.size());
+    m_generations.push_back(0);
+  }
+  else
+  {
+    index = m_free_slots.back();
+    m_free_slots.pop_back();
   }
 
-  return UID((m_magic << 24) | m_id_counter);
+  return UID((static_cast<uint64_t>(m_magic) << 56) |
+             (static_cast<uint64_t>(m_generations[index]) << 32) |
+             index);
+}
+
+void
+UIDGenerator::release(const UID& uid)
+{
+  assert(uid.get_magic() == m_magic);
+
+  const uint32_t index = uid.get_index();
+  assert(index < m_generations.size());
+  assert(uid.get_generation() == m_generations[index]);
+
+  // A slot whose generation would wrap around is retired, so that old
+  // UIDs can't ever resolve to a new object
+  if (m_generations[index] < MAX_GENERATION)
+  {
+    m_generations[index] += 1;
+    m_free_slots.push_back(index);
+  }
 }
 
 /* EOF */
@@ -17,8 +17,13 @@
 #ifndef HEADER_SUPERTUX_UTIL_UID_GENERATOR_HPP
 #define HEADER_SUPERTUX_UTIL_UID_GENERATOR_HPP
 
+#include <vector>
+
 #include "util/uid.hpp"
 
+/** Hands out the slots of an object table as UIDs. Released slots
+    are reused with a bumped generation, so the table stays dense
+    while UIDs of released slots never match again. */
 class UIDGenerator
 {
 private:
@@ -29,9 +34,19 @@ public:
 
   UID next();
 
+  /** Return the slot of @a uid for reuse by next() */
+  void release(const UID& uid);
+
+  /** Upper bound of the slot indices handed out so far */
+  size_t get_slot_count() const { return m_generations.size(); }
+
 private:
   uint8_t m_magic;
-  uint32_t m_id_counter;
+
+  /** Generation of the next UID handed out for each slot */
+  std::vector<uint32_t> m_generations;
+
+  std::vector<uint32_t> m_free_slots;
 
 private:
   UIDGenerator(const UIDGenerator&) = delete;
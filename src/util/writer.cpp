@@ -27,7 +27,9 @@ Writer::Writer(const std::string& filename) :
   out(new OFileStream(filename)),
   out_owned(true),
   indent_depth(0),
-  lists()
+  lists(),
+  m_tiles_placeholder(false),
+  m_objects_placeholder(false)
 {
   out->precision(7);
 }
@@ -37,7 +39,9 @@ Writer::Writer(std::ostream& newout) :
   out(&newout),
   out_owned(false),
   indent_depth(0),
-  lists()
+  lists(),
+  m_tiles_placeholder(false),
+  m_objects_placeholder(false)
 {
   out->precision(7);
 }
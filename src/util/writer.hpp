@@ -49,6 +49,18 @@ public:
 
   void end_list(const std::string& listname);
 
+  /** When set, tilemaps write "(tiles-placeholder #t)" instead of
+      their tile data, used by the UndoManager to track the tiles
+      separately */
+  void set_tiles_placeholder(bool placeholder) { m_tiles_placeholder = placeholder; }
+  bool get_tiles_placeholder() const { return m_tiles_placeholder; }
+
+  /** When set, sectors write "(objects-placeholder #t)" instead of
+      their objects, used by the UndoManager to track every object
+      separately */
+  void set_objects_placeholder(bool placeholder) { m_objects_placeholder = placeholder; }
+  bool get_objects_placeholder() const { return m_objects_placeholder; }
+
 private:
   void write_escaped_string(const std::string& str);
   void write_sexp(const sexp::Value& value, bool fudge);
@@ -60,6 +72,8 @@ private:
   bool out_owned;
   int indent_depth;
   std::vector<std::string> lists;
+  bool m_tiles_placeholder;
+  bool m_objects_placeholder;
 
 private:
   Writer(const Writer&) = delete;
@@ -23,6 +23,7 @@
 #include <sstream>
 
 #include "physfs/physfs_sdl.hpp"
+#include "supertux/globals.hpp"
 #include "util/file_system.hpp"
 #include "util/log.hpp"
 #include "util/reader_document.hpp"
@@ -54,7 +55,8 @@ bool vline_empty(const SDLSurfacePtr& surface, int x, int start_y, int end_y, Ui
 
 BitmapFont::BitmapFont(GlyphWidth glyph_width_,
            const std::string& filename,
-           int shadowsize_) :
+           int shadowsize_,
+           bool use_layout_cache_) :
   glyph_width(glyph_width_),
   glyph_surfaces(),
   shadow_surfaces(),
@@ -62,7 +64,13 @@ BitmapFont::BitmapFont(GlyphWidth glyph_width_,
   shadowsize(shadowsize_),
   border(0),
   rtl(false),
-  glyphs(65536)
+  glyphs(65536),
+  use_layout_cache(use_layout_cache_),
+  layouts(),
+  layouts_cleanup_size(256),
+  scratch_layout(),
+  line_positions(),
+  scratch_dstrects()
 {
   for (unsigned int i=0; i<65536;i++) glyphs[i].surface_idx = -1;
 
@@ -263,6 +271,11 @@ BitmapFont::~BitmapFont()
 float
 BitmapFont::get_text_width(const std::string& text) const
 {
+  // menus measure the texts they draw every frame
+  auto layout = layouts.find(text);
+  if (layout != layouts.end())
+    return layout->second.width;
+
   float curr_width = 0;
   float last_width = 0;
 
@@ -356,34 +369,110 @@ BitmapFont::wrap_to_width(const std::string& s_, float width, std::string* overf
   return s;
 }
 
-
 void
 BitmapFont::draw_text(Canvas& canvas, const std::string& text,
-                      const Vector& pos_, FontAlignment alignment, int layer, const Color& color)
+                      const Vector& pos, FontAlignment alignment, int layer, const Color& color)
+{
+  const TextLayout* layout = &scratch_layout;
+  if (use_layout_cache)
+  {
+    layout = &get_layout(text);
+  }
+  else
+  {
+    layout_text(text, scratch_layout);
+  }
+
+  line_positions.clear();
+  for (const auto& line : layout->lines)
+  {
+    // calculate X positions based on the alignment type
+    float x = pos.x;
+    if (alignment == ALIGN_CENTER)
+      x -= line.width / 2;
+    else if (alignment == ALIGN_RIGHT)
+      x -= line.width;
+
+    // Cast font position to integer to get a clean drawing result and
+    // no blurring as we would get with subpixel positions
+    line_positions.emplace_back(std::truncf(x), pos.y + line.y);
+  }
+
+  if (shadowsize > 0)
+    draw_layout(canvas, *layout, true,
+                Vector(static_cast<float>(shadowsize), static_cast<float>(shadowsize)), layer,
+                Color(1,1,1));
+
+  draw_layout(canvas, *layout, false, Vector(0.0f, 0.0f), layer, color);
+}
+
+const BitmapFont::TextLayout&
+BitmapFont::get_layout(const std::string& text)
+{
+  auto it = layouts.find(text);
+  if (it == layouts.end())
+  {
+    if (layouts.size() >= layouts_cleanup_size)
+      cleanup_layouts();
+
+    it = layouts.emplace(text, TextLayout()).first;
+    layout_text(text, it->second);
+  }
+
+  it->second.last_access = g_game_time;
+  return it->second;
+}
+
+void
+BitmapFont::layout_text(const std::string& text, TextLayout& layout) const
 {
-  float x = pos_.x;
-  float y = pos_.y;
+  layout.lines.clear();
+  layout.batches.clear();
+  layout.width = 0.0f;
 
+  float y = 0.0f;
   std::string::size_type last = 0;
   for (std::string::size_type i = 0;; ++i)
   {
-    if (text[i] == '\n' || i == text.size())
+    if (i == text.size() || text[i] == '\n')
     {
-      std::string temp = text.substr(last, i - last);
+      const size_t line_idx = layout.lines.size();
+      const std::string line = rtl ?
+        std::string(text.rbegin() + (text.size() - i), text.rbegin() + (text.size() - last)) :
+        text.substr(last, i - last);
 
-      // calculate X positions based on the alignment type
-      Vector pos = Vector(x, y);
+      float x = 0.0f;
+      for (UTF8Iterator it(line); !it.done(); ++it)
+      {
+        const Glyph& glyph = (glyphs.at(*it).surface_idx != -1) ? glyphs[*it] : glyphs[0x20];
 
-      if (alignment == ALIGN_CENTER)
-        pos.x -= get_text_width(temp) / 2;
-      else if (alignment == ALIGN_RIGHT)
-        pos.x -= get_text_width(temp);
+        if (*it != ' ' && glyph.surface_idx != -1)
+        {
+          auto batch = std::find_if(layout.batches.begin(), layout.batches.end(),
+                                    [&glyph](const TextLayout::Batch& b) {
+                                      return b.surface_idx == glyph.surface_idx;
+                                    });
+          if (batch == layout.batches.end())
+          {
+            layout.batches.emplace_back();
+            batch = layout.batches.end() - 1;
+            batch->surface_idx = glyph.surface_idx;
+          }
+
+          // srcrects are relative to the texture, which may hold more than the glyph sheet
+          batch->glyph_srcrects.push_back(glyph_surfaces[glyph.surface_idx]->get_texture_rect(glyph.rect));
+          batch->shadow_srcrects.push_back(shadow_surfaces[glyph.surface_idx]->get_texture_rect(glyph.rect));
+          batch->dstrects.emplace_back(Vector(x, 0.0f) + glyph.offset, glyph.rect.get_size());
+          batch->lines.push_back(line_idx);
+        }
 
-      // Cast font position to integer to get a clean drawing result and
-      // no blurring as we would get with subpixel positions
-      pos.x = std::truncf(pos.x);
+        x += glyph.advance;
+      }
 
-      draw_text(canvas, temp, pos, layer, color);
+      layout.lines.emplace_back();
+      layout.lines.back().width = x;
+      layout.lines.back().y = y;
+      layout.width = std::max(layout.width, x);
 
       if (i == text.size())
         break;
@@ -395,52 +484,35 @@ BitmapFont::draw_text(Canvas& canvas, const std::string& text,
 }
 
 void
-BitmapFont::draw_text(Canvas& canvas, const std::string& text, const Vector& pos, int layer, Color color) const
+BitmapFont::draw_layout(Canvas& canvas, const TextLayout& layout, bool shadow,
+                        const Vector& offset, int layer, const Color& color)
 {
-  if (shadowsize > 0)
-    draw_chars(canvas, false, rtl ? std::string(text.rbegin(), text.rend()) : text,
-               pos + Vector(static_cast<float>(shadowsize), static_cast<float>(shadowsize)), layer,
-               Color(1,1,1));
+  for (const auto& batch : layout.batches)
+  {
+    scratch_dstrects.clear();
+    for (size_t i = 0; i < batch.dstrects.size(); ++i)
+    {
+      scratch_dstrects.push_back(batch.dstrects[i].moved(line_positions[batch.lines[i]] + offset));
+    }
 
-  draw_chars(canvas, true, rtl ? std::string(text.rbegin(), text.rend()) : text, pos, layer, color);
+    canvas.draw_surface_batch(shadow ? shadow_surfaces[batch.surface_idx] : glyph_surfaces[batch.surface_idx],
+                              shadow ? batch.shadow_srcrects : batch.glyph_srcrects,
+                              scratch_dstrects, color, layer);
+  }
 }
 
 void
-BitmapFont::draw_chars(Canvas& canvas, bool notshadow, const std::string& text, const Vector& pos, int layer, Color color) const
+BitmapFont::cleanup_layouts()
 {
-  Vector p = pos;
-
-  for (UTF8Iterator it(text); !it.done(); ++it)
+  for (auto it = layouts.begin(); it != layouts.end();)
   {
-    if (*it == '\n')
-    {
-      p.x = pos.x;
-      p.y += static_cast<float>(char_height) + 2.0f;
-    }
-    else if (*it == ' ')
-    {
-      p.x += glyphs[0x20].advance;
-    }
+    if (g_game_time - it->second.last_access > 10.0f)
+      it = layouts.erase(it);
     else
-    {
-      Glyph glyph;
-      if ( glyphs.at(*it).surface_idx != -1 )
-        glyph = glyphs[*it];
-      else
-        glyph = glyphs[0x20];
-
-      // FIXME: not supported! request.color = color;
-      canvas.draw_surface_part(notshadow ?
-                               glyph_surfaces[glyph.surface_idx] :
-                               shadow_surfaces[glyph.surface_idx],
-                               glyph.rect,
-                               Rectf(p + glyph.offset, glyph.rect.get_size()),
-                               layer,
-                               PaintStyle().set_color(color));
-
-      p.x += glyph.advance;
-    }
+      ++it;
   }
+
+  layouts_cleanup_size = std::max(static_cast<size_t>(256), layouts.size() * 2);
 }
 
 /* EOF */
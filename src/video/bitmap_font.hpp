@@ -19,6 +19,8 @@
 #define HEADER_SUPERTUX_VIDEO_BITMAP_FONT_HPP
 
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "math/rectf.hpp"
 #include "math/vector.hpp"
@@ -43,8 +45,12 @@ public:
    *  @param glyph_width  VARIABLE for proportional fonts, VARIABLE for monospace ones
    *  @param fontfile     file in format supertux-font
    *  @param sgadowsize   offset of shadow
+   *  @param use_layout_cache  keep the layout of drawn texts around, so
+   *                           that drawing the same text again only has
+   *                           to move its glyph quads into place
    */
-  BitmapFont(GlyphWidth glyph_width, const std::string& fontfile, int shadowsize = 2);
+  BitmapFont(GlyphWidth glyph_width, const std::string& fontfile, int shadowsize = 2,
+             bool use_layout_cache = true);
   ~BitmapFont() override;
 
   int get_shadow_size() const { return shadowsize; }
@@ -75,14 +81,17 @@ public:
   virtual void draw_text(Canvas& canvas, const std::string& text,
                          const Vector& pos, FontAlignment alignment, int layer, const Color& color) override;
 
-private:
-  friend class DrawingContext;
+  /** Number of texts whose layout is currently cached */
+  size_t get_layout_count() const { return layouts.size(); }
 
-  void draw_text(Canvas& painter, const std::string& text, const Vector& pos, int layer,
-                 Color color = Color(1.0,1.0,1.0)) const;
+private:
+  struct TextLayout;
 
-  void draw_chars(Canvas& painter, bool nonshadow, const std::string& text,
-                  const Vector& position, int layer, Color color) const;
+  const TextLayout& get_layout(const std::string& text);
+  void layout_text(const std::string& text, TextLayout& layout) const;
+  void draw_layout(Canvas& canvas, const TextLayout& layout, bool shadow,
+                   const Vector& offset, int layer, const Color& color);
+  void cleanup_layouts();
 
   void loadFontFile(const std::string &filename);
   void loadFontSurface(const std::string &glyphimage,
@@ -113,6 +122,37 @@ private:
     {}
   };
 
+  /** Glyph quads of a text, relative to the start of their line */
+  struct TextLayout
+  {
+    struct Line
+    {
+      Line() : width(), y() {}
+
+      float width;
+      float y;
+    };
+
+    /** All glyphs of the text that are on the same glyph sheet */
+    struct Batch
+    {
+      Batch() : surface_idx(), glyph_srcrects(), shadow_srcrects(), dstrects(), lines() {}
+
+      int surface_idx;
+      std::vector<Rectf> glyph_srcrects;
+      std::vector<Rectf> shadow_srcrects;
+      std::vector<Rectf> dstrects;
+      std::vector<size_t> lines;
+    };
+
+    TextLayout() : lines(), batches(), width(), last_access() {}
+
+    std::vector<Line> lines;
+    std::vector<Batch> batches;
+    float width;
+    float last_access;
+  };
+
 private:
   GlyphWidth glyph_width;
 
@@ -125,6 +165,19 @@ private:
 
   /** 65536 of glyphs */
   std::vector<Glyph> glyphs;
+
+  bool use_layout_cache;
+  std::unordered_map<std::string, TextLayout> layouts;
+
+  /** Layouts not drawn for a while are dropped once the cache reaches
+      this size */
+  size_t layouts_cleanup_size;
+
+  /** Scratch space for the layout of uncached texts and the positions
+      of the current draw */
+  TextLayout scratch_layout;
+  std::vector<Vector> line_positions;
+  std::vector<Rectf> scratch_dstrects;
 };
 
 #endif
@@ -20,17 +20,22 @@
 
 #include "supertux/globals.hpp"
 #include "util/log.hpp"
-#include "util/obstackpp.hpp"
+#include "util/frame_arena.hpp"
 #include "video/drawing_request.hpp"
 #include "video/painter.hpp"
 #include "video/renderer.hpp"
 #include "video/surface.hpp"
 #include "video/video_system.hpp"
 
-Canvas::Canvas(DrawingContext& context, obstack& obst) :
+Canvas::Canvas(DrawingContext& context, FrameArena& arena) :
   m_context(context),
-  m_obst(obst),
-  m_requests()
+  m_arena(arena),
+  m_requests(),
+  m_sort_keys(),
+  m_sorted_requests(),
+  m_pixel_requests(),
+  m_num_sorted(0),
+  m_num_batched(0)
 {
   m_requests.reserve(500);
 }
@@ -48,28 +53,157 @@ Canvas::clear()
     request->~DrawingRequest();
   }
   m_requests.clear();
+  m_num_sorted = 0;
+  m_num_batched = 0;
 }
 
 void
-Canvas::render(Renderer& renderer, Filter filter)
+Canvas::sort()
 {
+  if (m_num_sorted == m_requests.size())
+    return;
+
   // On a regular level, each frame has around 50-250 requests (before
-  // batching it was 1000-3000), the sort comparator function is
-  // called approximatly 3-7 times for each request.
-  std::stable_sort(m_requests.begin(), m_requests.end(),
-                   [](const DrawingRequest* r1, const DrawingRequest* r2){
-                     return r1->layer < r2->layer;
-                   });
+  // batching it was 1000-3000). Sorting (layer, index) keys gives the
+  // same order as a stable sort, without std::stable_sort()'s
+  // temporary buffer allocation.
+  m_sort_keys.clear();
+  for (size_t i = 0; i < m_requests.size(); ++i)
+  {
+    m_sort_keys.emplace_back(m_requests[i]->layer, i);
+  }
+  std::sort(m_sort_keys.begin(), m_sort_keys.end());
 
-  Painter& painter = renderer.get_painter();
+  m_sorted_requests.clear();
+  for (const auto& key : m_sort_keys)
+  {
+    m_sorted_requests.push_back(m_requests[key.second]);
+  }
+  m_requests.swap(m_sorted_requests);
+
+  m_num_sorted = m_requests.size();
+}
+
+namespace {
+
+bool can_batch(const DrawingRequest& lhs, const DrawingRequest& rhs)
+{
+  if (lhs.type != TEXTURE || rhs.type != TEXTURE)
+    return false;
+
+  const auto& lhs_texture = static_cast<const TextureRequest&>(lhs);
+  const auto& rhs_texture = static_cast<const TextureRequest&>(rhs);
+  return lhs.layer == rhs.layer &&
+         lhs.flip == rhs.flip &&
+         lhs.alpha == rhs.alpha &&
+         lhs.blend == rhs.blend &&
+         lhs.viewport == rhs.viewport &&
+         lhs_texture.texture == rhs_texture.texture &&
+         lhs_texture.displacement_texture == rhs_texture.displacement_texture &&
+         lhs_texture.color == rhs_texture.color;
+}
+
+} // namespace
+
+void
+Canvas::batch()
+{
+  if (m_num_batched == m_requests.size())
+    return;
+
+  m_sorted_requests.clear();
+  size_t begin = 0;
+  while (begin < m_requests.size())
+  {
+    size_t end = begin + 1;
+    while (end < m_requests.size() && can_batch(*m_requests[begin], *m_requests[end]))
+    {
+      end += 1;
+    }
+
+    if (end - begin == 1)
+    {
+      m_sorted_requests.push_back(m_requests[begin]);
+    }
+    else
+    {
+      size_t count = 0;
+      for (size_t i = begin; i < end; ++i)
+      {
+        count += static_cast<const TextureRequest*>(m_requests[i])->srcrects.size();
+      }
+
+      const auto& first = static_cast<const TextureRequest&>(*m_requests[begin]);
+      auto request = new(m_arena) TextureRequest();
+      request->layer = first.layer;
+      request->flip = first.flip;
+      request->alpha = first.alpha;
+      request->blend = first.blend;
+      request->viewport = first.viewport;
+      request->texture = first.texture;
+      request->displacement_texture = first.displacement_texture;
+      request->color = first.color;
+
+      request->srcrects = m_arena.make_span<Rectf>(count);
+      request->dstrects = m_arena.make_span<Rectf>(count);
+      request->angles = m_arena.make_span<float>(count);
+
+      size_t offset = 0;
+      for (size_t i = begin; i < end; ++i)
+      {
+        const auto& part = static_cast<const TextureRequest&>(*m_requests[i]);
+        std::copy(part.srcrects.begin(), part.srcrects.end(), request->srcrects.begin() + offset);
+        std::copy(part.dstrects.begin(), part.dstrects.end(), request->dstrects.begin() + offset);
+        std::copy(part.angles.begin(), part.angles.end(), request->angles.begin() + offset);
+        offset += part.srcrects.size();
+
+        m_requests[i]->~DrawingRequest();
+      }
+
+      m_sorted_requests.push_back(request);
+    }
+
+    begin = end;
+  }
+  m_requests.swap(m_sorted_requests);
+
+  m_num_sorted = m_requests.size();
+  m_num_batched = m_requests.size();
+}
+
+void
+Canvas::render(Renderer& renderer, Filter filter)
+{
+  sort();
+  batch();
+
+  // The requests are sorted by layer, so each filter selects a
+  // contiguous range of them
+  auto begin = m_requests.begin();
+  auto end = m_requests.end();
+  if (filter == BELOW_LIGHTMAP)
+  {
+    end = std::lower_bound(begin, end, static_cast<int>(LAYER_LIGHTMAP),
+                           [](const DrawingRequest* request, int layer) {
+                             return request->layer < layer;
+                           });
+  }
+  else if (filter == ABOVE_LIGHTMAP)
+  {
+    begin = std::upper_bound(begin, end, static_cast<int>(LAYER_LIGHTMAP),
+                             [](int layer, const DrawingRequest* request) {
+                               return layer < request->layer;
+                             });
+  }
 
-  for (const auto& i : m_requests) {
-    const DrawingRequest& request = *i;
+  if (begin == end)
+    return;
 
-    if (filter == BELOW_LIGHTMAP && request.layer >= LAYER_LIGHTMAP)
-      continue;
-    else if (filter == ABOVE_LIGHTMAP && request.layer <= LAYER_LIGHTMAP)
-      continue;
+  Painter& painter = renderer.get_painter();
+  painter.prepare(&*begin, static_cast<size_t>(end - begin));
+
+  for (auto it = begin; it != end; ++it) {
+    const DrawingRequest& request = **it;
 
     painter.set_clip_rect(request.viewport);
 
@@ -99,10 +233,16 @@ Canvas::render(Renderer& renderer, Filter filter)
         break;
 
       case GETPIXEL:
-        painter.get_pixel(static_cast<const GetPixelRequest&>(request));
+        m_pixel_requests.push_back(static_cast<const GetPixelRequest*>(&request));
         break;
     }
   }
+
+  if (!m_pixel_requests.empty())
+  {
+    painter.get_pixels(m_pixel_requests.data(), m_pixel_requests.size());
+    m_pixel_requests.clear();
+  }
 }
 
 void
@@ -112,16 +252,12 @@ Canvas::draw_surface(const SurfacePtr& surface,
 {
   if (!surface) return;
 
-  const auto& cliprect = m_context.get_cliprect();
-
   // discard clipped surface
-  if (position.x > cliprect.get_right() ||
-     position.y > cliprect.get_bottom() ||
-     position.x + static_cast<float>(surface->get_width()) < cliprect.get_left() ||
-     position.y + static_cast<float>(surface->get_height()) < cliprect.get_top())
+  if (!is_visible(Rectf(position, Sizef(static_cast<float>(surface->get_width()),
+                                        static_cast<float>(surface->get_height()))), angle))
     return;
 
-  auto request = new(m_obst) TextureRequest();
+  auto request = new(m_arena) TextureRequest();
 
   request->type = TEXTURE;
   request->layer = layer;
@@ -130,11 +266,11 @@ Canvas::draw_surface(const SurfacePtr& surface,
   request->blend = blend;
   request->viewport = m_context.get_viewport();
 
-  request->srcrects.emplace_back(Rectf(surface->get_region()));
-  request->dstrects.emplace_back(Rectf(apply_translate(position) * scale(),
-                                 Sizef(static_cast<float>(surface->get_width()) * scale(),
-                                       static_cast<float>(surface->get_height()) * scale())));
-  request->angles.emplace_back(angle);
+  request->srcrects = m_arena.make_span<Rectf>(1, surface->get_texture_rect());
+  request->dstrects = m_arena.make_span<Rectf>(1, Rectf(apply_translate(position) * scale(),
+                                                        Sizef(static_cast<float>(surface->get_width()) * scale(),
+                                                              static_cast<float>(surface->get_height()) * scale())));
+  request->angles = m_arena.make_span<float>(1, angle);
   request->texture = surface->get_texture().get();
   request->displacement_texture = surface->get_displacement_texture().get();
   request->color = color;
@@ -142,6 +278,25 @@ Canvas::draw_surface(const SurfacePtr& surface,
   m_requests.push_back(request);
 }
 
+bool
+Canvas::is_visible(const Rectf& rect, float angle) const
+{
+  Rectf bbox = rect;
+  if (angle != 0.0f)
+  {
+    // the rotated rect fits into the circle around the original one
+    const float radius = glm::length(rect.get_size().as_vector()) / 2.0f;
+    const Vector middle = rect.get_middle();
+    bbox = Rectf(middle - Vector(radius, radius), middle + Vector(radius, radius));
+  }
+
+  const Rectf cliprect = m_context.get_cliprect();
+  return !(bbox.get_left() > cliprect.get_right() ||
+           bbox.get_top() > cliprect.get_bottom() ||
+           bbox.get_right() < cliprect.get_left() ||
+           bbox.get_bottom() < cliprect.get_top());
+}
+
 void
 Canvas::draw_surface(const SurfacePtr& surface, const Vector& position, int layer)
 {
@@ -162,7 +317,7 @@ Canvas::draw_surface_part(const SurfacePtr& surface, const Rectf& srcrect, const
 {
   if (!surface) return;
 
-  auto request = new(m_obst) TextureRequest();
+  auto request = new(m_arena) TextureRequest();
 
   request->type = TEXTURE;
   request->layer = layer;
@@ -171,9 +326,10 @@ Canvas::draw_surface_part(const SurfacePtr& surface, const Rectf& srcrect, const
   request->blend = style.get_blend();
   request->viewport = m_context.get_viewport();
 
-  request->srcrects.emplace_back(srcrect);
-  request->dstrects.emplace_back(apply_translate(dstrect.p1())*scale(), dstrect.get_size()*scale());
-  request->angles.emplace_back(0.0f);
+  // srcrect is relative to the surface, which may be a region of a larger texture
+  request->srcrects = m_arena.make_span<Rectf>(1, surface->get_texture_rect(srcrect));
+  request->dstrects = m_arena.make_span<Rectf>(1, Rectf(apply_translate(dstrect.p1())*scale(), dstrect.get_size()*scale()));
+  request->angles = m_arena.make_span<float>(1, 0.0f);
   request->texture = surface->get_texture().get();
   request->displacement_texture = surface->get_displacement_texture().get();
   request->color = style.get_color();
@@ -183,41 +339,58 @@ Canvas::draw_surface_part(const SurfacePtr& surface, const Rectf& srcrect, const
 
 void
 Canvas::draw_surface_batch(const SurfacePtr& surface,
-                           std::vector<Rectf> srcrects,
-                           std::vector<Rectf> dstrects,
+                           const std::vector<Rectf>& srcrects,
+                           const std::vector<Rectf>& dstrects,
                            const Color& color,
-                           int layer)
+                           int layer,
+                           const Blend& blend)
 {
-  const size_t len = srcrects.size();
-  draw_surface_batch(surface,
-                     std::move(srcrects),
-                     std::move(dstrects),
-                     std::vector<float>(len, 0.0f),
-                     color, layer);
+  if (!surface) return;
+
+  draw_surface_batch(surface, srcrects, dstrects,
+                     m_arena.make_span<float>(srcrects.size(), 0.0f),
+                     color, layer, blend);
 }
 
 void
 Canvas::draw_surface_batch(const SurfacePtr& surface,
-                           std::vector<Rectf> srcrects,
-                           std::vector<Rectf> dstrects,
-                           std::vector<float> angles,
+                           const std::vector<Rectf>& srcrects,
+                           const std::vector<Rectf>& dstrects,
+                           const std::vector<float>& angles,
                            const Color& color,
-                           int layer)
+                           int layer,
+                           const Blend& blend)
 {
   if (!surface) return;
 
-  auto request = new(m_obst) TextureRequest();
+  draw_surface_batch(surface, srcrects, dstrects, m_arena.copy_span(angles), color, layer, blend);
+}
+
+void
+Canvas::draw_surface_batch(const SurfacePtr& surface,
+                           const std::vector<Rectf>& srcrects,
+                           const std::vector<Rectf>& dstrects,
+                           const FrameSpan<float>& angles,
+                           const Color& color,
+                           int layer,
+                           const Blend& blend)
+{
+  assert(srcrects.size() == dstrects.size());
+  assert(srcrects.size() == angles.size());
+
+  auto request = new(m_arena) TextureRequest();
 
   request->type = TEXTURE;
   request->layer = layer;
   request->flip = m_context.transform().flip ^ surface->get_flip();
   request->alpha = m_context.transform().alpha;
+  request->blend = blend;
   request->color = color;
   request->viewport = m_context.get_viewport();
 
-  request->srcrects = std::move(srcrects);
-  request->dstrects = std::move(dstrects);
-  request->angles = std::move(angles);
+  request->srcrects = m_arena.copy_span(srcrects);
+  request->dstrects = m_arena.copy_span(dstrects);
+  request->angles = angles;
 
   for (auto& dstrect : request->dstrects)
   {
@@ -251,7 +424,7 @@ Canvas::draw_gradient(const Color& top, const Color& bottom, int layer,
                       const GradientDirection& direction, const Rectf& region,
                       const Blend& blend)
 {
-  auto request = new(m_obst) GradientRequest();
+  auto request = new(m_arena) GradientRequest();
 
   request->type = GRADIENT;
   request->layer = layer;
@@ -280,7 +453,7 @@ Canvas::draw_filled_rect(const Rectf& rect, const Color& color,
 void
 Canvas::draw_filled_rect(const Rectf& rect, const Color& color, float radius, int layer)
 {
-  auto request = new(m_obst) FillRectRequest;
+  auto request = new(m_arena) FillRectRequest;
 
   request->type   = FILLRECT;
   request->layer  = layer;
@@ -301,7 +474,7 @@ Canvas::draw_filled_rect(const Rectf& rect, const Color& color, float radius, in
 void
 Canvas::draw_inverse_ellipse(const Vector& pos, const Vector& size, const Color& color, int layer)
 {
-  auto request = new(m_obst) InverseEllipseRequest;
+  auto request = new(m_arena) InverseEllipseRequest;
 
   request->type   = INVERSEELLIPSE;
   request->layer  = layer;
@@ -321,7 +494,7 @@ Canvas::draw_inverse_ellipse(const Vector& pos, const Vector& size, const Color&
 void
 Canvas::draw_line(const Vector& pos1, const Vector& pos2, const Color& color, int layer)
 {
-  auto request = new(m_obst) LineRequest;
+  auto request = new(m_arena) LineRequest;
 
   request->type   = LINE;
   request->layer  = layer;
@@ -341,7 +514,7 @@ Canvas::draw_line(const Vector& pos1, const Vector& pos2, const Color& color, in
 void
 Canvas::draw_triangle(const Vector& pos1, const Vector& pos2, const Vector& pos3, const Color& color, int layer)
 {
-  auto request = new(m_obst) TriangleRequest;
+  auto request = new(m_arena) TriangleRequest;
 
   request->type   = TRIANGLE;
   request->layer  = layer;
@@ -376,7 +549,7 @@ Canvas::get_pixel(const Vector& position, const std::shared_ptr<Color>& color_ou
     return;
   }
 
-  auto request = new(m_obst) GetPixelRequest();
+  auto request = new(m_arena) GetPixelRequest();
 
   request->layer = LAYER_GETPIXEL;
   request->pos = pos;
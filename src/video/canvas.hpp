@@ -19,12 +19,13 @@
 #define HEADER_SUPERTUX_VIDEO_CANVAS_HPP
 
 #include <string>
+#include <utility>
 #include <vector>
 #include <memory>
-#include <obstack.h>
 
 #include "math/rectf.hpp"
 #include "math/vector.hpp"
+#include "util/frame_arena.hpp"
 #include "video/blend.hpp"
 #include "video/color.hpp"
 #include "video/drawing_target.hpp"
@@ -39,6 +40,7 @@ class DrawingContext;
 class Renderer;
 class VideoSystem;
 struct DrawingRequest;
+struct GetPixelRequest;
 
 class Canvas final
 {
@@ -46,7 +48,7 @@ public:
   enum Filter { BELOW_LIGHTMAP, ABOVE_LIGHTMAP, ALL };
 
 public:
-  Canvas(DrawingContext& context, obstack& obst);
+  Canvas(DrawingContext& context, FrameArena& arena);
   ~Canvas();
 
   void draw_surface(const SurfacePtr& surface, const Vector& position, int layer);
@@ -56,17 +58,22 @@ public:
                          int layer, const PaintStyle& style = PaintStyle());
   void draw_surface_scaled(const SurfacePtr& surface, const Rectf& dstrect,
                            int layer, const PaintStyle& style = PaintStyle());
+  /** Unlike draw_surface_part(), \a srcrects are in pixels of the
+      surface's texture and not relative to the surface's region. The
+      rects are copied, so callers can reuse their vectors. */
   void draw_surface_batch(const SurfacePtr& surface,
-                          std::vector<Rectf> srcrects,
-                          std::vector<Rectf> dstrects,
+                          const std::vector<Rectf>& srcrects,
+                          const std::vector<Rectf>& dstrects,
                           const Color& color,
-                          int layer);
+                          int layer,
+                          const Blend& blend = Blend());
   void draw_surface_batch(const SurfacePtr& surface,
-                          std::vector<Rectf> srcrects,
-                          std::vector<Rectf> dstrects,
-                          std::vector<float> angles,
+                          const std::vector<Rectf>& srcrects,
+                          const std::vector<Rectf>& dstrects,
+                          const std::vector<float>& angles,
                           const Color& color,
-                          int layer);
+                          int layer,
+                          const Blend& blend = Blend());
   void draw_text(const FontPtr& font, const std::string& text,
                  const Vector& position, FontAlignment alignment, int layer, const Color& color = Color(1.0,1.0,1.0));
   /** Draw text to the center of the screen */
@@ -85,20 +92,62 @@ public:
   /** on next update, set color to lightmap's color at position */
   void get_pixel(const Vector& position, const std::shared_ptr<Color>& color_out);
 
+  /** Whether @a rect, in untranslated coordinates and rotated by
+      @a angle around its center, touches the visible area. Drawing
+      functions cull surfaces with it, callers can use it to skip
+      preparing requests that would be culled anyway. */
+  bool is_visible(const Rectf& rect, float angle = 0.0f) const;
+
   void clear();
+
+  /** Order the requests by layer, keeping the drawing order within a
+      layer. render() sorts on demand. */
+  void sort();
+
+  /** Sorts and batches the requests, then draws the ones selected by
+      @a filter */
   void render(Renderer& renderer, Filter filter);
 
   DrawingContext& get_context() { return m_context; }
+  const std::vector<DrawingRequest*>& get_requests() const { return m_requests; }
 
 private:
+  void draw_surface_batch(const SurfacePtr& surface,
+                          const std::vector<Rectf>& srcrects,
+                          const std::vector<Rectf>& dstrects,
+                          const FrameSpan<float>& angles,
+                          const Color& color,
+                          int layer,
+                          const Blend& blend);
+
+  /** Merge runs of texture requests that only differ in their rects,
+      e.g. lights of the same kind, so each run is a single draw call.
+      Only runs on the thread that draws, as it allocates from the
+      arena. */
+  void batch();
+
   Vector apply_translate(const Vector& pos) const;
   float scale() const;
 
 private:
   DrawingContext& m_context;
-  obstack& m_obst;
+  FrameArena& m_arena;
   std::vector<DrawingRequest*> m_requests;
 
+  /** Scratch buffers for sort(), kept to avoid allocations */
+  std::vector<std::pair<int, size_t> > m_sort_keys;
+  std::vector<DrawingRequest*> m_sorted_requests;
+
+  /** Scratch buffer for render(), the pixel requests of a pass are
+      handed to the painter together at the end */
+  std::vector<const GetPixelRequest*> m_pixel_requests;
+
+  /** Number of requests that were in order after the last sort() */
+  size_t m_num_sorted;
+
+  /** Number of requests after the last batch() */
+  size_t m_num_batched;
+
 private:
   Canvas(const Canvas&) = delete;
   Canvas& operator=(const Canvas&) = delete;
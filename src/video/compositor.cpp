@@ -27,22 +27,31 @@ bool Compositor::s_render_lighting = true;
 
 Compositor::Compositor(VideoSystem& video_system) :
   m_video_system(video_system),
-  m_obst(),
-  m_drawing_contexts()
+  m_arena(),
+  m_drawing_contexts(),
+  m_unused_contexts()
 {
-  obstack_init(&m_obst);
 }
 
 Compositor::~Compositor()
 {
   m_drawing_contexts.clear();
-  obstack_free(&m_obst, nullptr);
+  m_unused_contexts.clear();
 }
 
 DrawingContext&
 Compositor::make_context(bool overlay)
 {
-  m_drawing_contexts.emplace_back(new DrawingContext(m_video_system, m_obst, overlay));
+  if (m_unused_contexts.empty())
+  {
+    m_drawing_contexts.emplace_back(new DrawingContext(m_video_system, m_arena, overlay));
+  }
+  else
+  {
+    m_drawing_contexts.push_back(std::move(m_unused_contexts.back()));
+    m_unused_contexts.pop_back();
+    m_drawing_contexts.back()->reset(overlay);
+  }
   return *m_drawing_contexts.back();
 }
 
@@ -122,11 +131,15 @@ Compositor::render()
         request.alpha = 1.0f;
         request.blend = Blend::MOD;
 
-        request.srcrects.emplace_back(0.0f, 0.0f,
-                                      static_cast<float>(texture->get_image_width()),
-                                      static_cast<float>(texture->get_image_height()));
-        request.dstrects.emplace_back(Vector(0.0f, 0.0f), lightmap.get_logical_size());
-        request.angles.emplace_back(0.0f);
+        Rectf srcrect(0.0f, 0.0f,
+                      static_cast<float>(texture->get_image_width()),
+                      static_cast<float>(texture->get_image_height()));
+        Rectf dstrect(Vector(0.0f, 0.0f), lightmap.get_logical_size());
+        float angle = 0.0f;
+
+        request.srcrects = FrameSpan<Rectf>(&srcrect, 1);
+        request.dstrects = FrameSpan<Rectf>(&dstrect, 1);
+        request.angles = FrameSpan<float>(&angle, 1);
 
         request.texture = texture.get();
         request.color = Color::WHITE;
@@ -146,15 +159,16 @@ Compositor::render()
     renderer.end_draw();
   }
 
-  // cleanup
+  // cleanup, keep the contexts around for the next frame
   for (auto& ctx : m_drawing_contexts)
   {
     ctx->clear();
+    m_unused_contexts.push_back(std::move(ctx));
   }
+  m_drawing_contexts.clear();
   m_video_system.flip();
 
-  obstack_free(&m_obst, nullptr);
-  obstack_init(&m_obst);
+  m_arena.next_frame();
 }
 
 /* EOF */
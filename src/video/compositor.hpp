@@ -20,12 +20,20 @@
 #include <vector>
 #include <memory>
 
-#include "util/obstackpp.hpp"
+#include "util/frame_arena.hpp"
 
 class DrawingContext;
 class Rect;
 class VideoSystem;
 
+/** Owned by the ScreenManager and reused for every frame, the
+    DrawingContexts handed out by make_context() are recycled and all
+    drawing requests are allocated from a FrameArena.
+
+    Recording and rendering both run on the thread that owns the video
+    system. GameObject::draw() advances animations, resolves tile images
+    and uploads text textures, so drawing can't be recorded on other
+    threads without a snapshot of the game state. */
 class Compositor final
 {
 public:
@@ -36,6 +44,8 @@ public:
   Compositor(VideoSystem& video_system);
   ~Compositor();
 
+  /** Render all contexts created since the last call and recycle
+      them for the next frame */
   void render();
 
   /** Create a DrawingContext, if overlay is true the context will not
@@ -47,11 +57,14 @@ public:
 private:
   VideoSystem& m_video_system;
 
-  /* obstack holding the memory of the drawing requests */
-  obstack m_obst;
+  /* arena holding the memory of the drawing requests */
+  FrameArena m_arena;
 
   std::vector<std::unique_ptr<DrawingContext> > m_drawing_contexts;
 
+  /* contexts of previous frames, waiting to be reused */
+  std::vector<std::unique_ptr<DrawingContext> > m_unused_contexts;
+
 private:
   Compositor(const Compositor&) = delete;
   Compositor& operator=(const Compositor&) = delete;
@@ -19,24 +19,24 @@
 #include <algorithm>
 
 #include "supertux/globals.hpp"
-#include "util/obstackpp.hpp"
+#include "util/frame_arena.hpp"
 #include "video/drawing_request.hpp"
 #include "video/renderer.hpp"
 #include "video/surface.hpp"
 #include "video/video_system.hpp"
 #include "video/viewport.hpp"
 
-DrawingContext::DrawingContext(VideoSystem& video_system_, obstack& obst, bool overlay) :
+DrawingContext::DrawingContext(VideoSystem& video_system_, FrameArena& arena, bool overlay) :
   m_video_system(video_system_),
-  m_obst(obst),
+  m_arena(arena),
   m_overlay(overlay),
   m_viewport(0, 0,
              m_video_system.get_viewport().get_screen_width(),
              m_video_system.get_viewport().get_screen_height()),
   m_ambient_color(Color::WHITE),
   m_transform_stack(1),
-  m_colormap_canvas(*this, m_obst),
-  m_lightmap_canvas(*this, m_obst)
+  m_colormap_canvas(*this, m_arena),
+  m_lightmap_canvas(*this, m_arena)
 {
 }
 
@@ -45,6 +45,20 @@ DrawingContext::~DrawingContext()
   clear();
 }
 
+void
+DrawingContext::reset(bool overlay)
+{
+  clear();
+
+  m_overlay = overlay;
+  m_viewport = Rect(0, 0,
+                    m_video_system.get_viewport().get_screen_width(),
+                    m_video_system.get_viewport().get_screen_height());
+  m_ambient_color = Color::WHITE;
+  m_transform_stack.resize(1);
+  m_transform_stack.back() = DrawingTransform();
+}
+
 void
 DrawingContext::set_ambient_color(Color ambient_color)
 {
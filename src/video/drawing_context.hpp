@@ -19,7 +19,6 @@
 
 #include <string>
 #include <vector>
-#include <obstack.h>
 #include <boost/optional.hpp>
 
 #include "math/rect.hpp"
@@ -34,7 +33,7 @@
 
 class VideoSystem;
 struct DrawingRequest;
-struct obstack;
+class FrameArena;
 
 /** This class provides functions for drawing things on screen. It
     also maintains a stack of transforms that are applied to
@@ -42,7 +41,7 @@ struct obstack;
 class DrawingContext final
 {
 public:
-  DrawingContext(VideoSystem& video_system, obstack& obst, bool overlay);
+  DrawingContext(VideoSystem& video_system, FrameArena& arena, bool overlay);
   ~DrawingContext();
 
   /** Returns the visible area in world coordinates */
@@ -92,6 +91,11 @@ public:
     m_colormap_canvas.clear();
   }
 
+  /** Clear the requests and return to the state of a freshly
+      constructed context, used by the Compositor to reuse contexts
+      across frames */
+  void reset(bool overlay);
+
   void set_viewport(const Rect& viewport)
   {
     m_viewport = viewport;
@@ -114,9 +118,9 @@ public:
 private:
   VideoSystem& m_video_system;
 
-  /** obstack holds the memory of all the drawing requests, it is
+  /** FrameArena holds the memory of all the drawing requests, it is
       shared with the Canvas */
-  obstack& m_obst;
+  FrameArena& m_arena;
 
   /** A context marked as overlay will not have it's light section
       rendered. */
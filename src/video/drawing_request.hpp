@@ -23,6 +23,7 @@
 #include "math/rectf.hpp"
 #include "math/sizef.hpp"
 #include "math/vector.hpp"
+#include "util/frame_arena.hpp"
 #include "video/color.hpp"
 #include "video/drawing_context.hpp"
 #include "video/font.hpp"
@@ -70,9 +71,10 @@ struct TextureRequest : public DrawingRequest
 
   const Texture* texture;
   const Texture* displacement_texture;
-  std::vector<Rectf> srcrects;
-  std::vector<Rectf> dstrects;
-  std::vector<float> angles;
+  /** Allocated from the FrameArena of the Compositor */
+  FrameSpan<Rectf> srcrects;
+  FrameSpan<Rectf> dstrects;
+  FrameSpan<float> angles;
   Color color;
 
 private:
@@ -19,11 +19,13 @@
 #include "supertux/globals.hpp"
 #include "video/glutil.hpp"
 #include "video/color.hpp"
+#include "video/gl/gl_stream_buffer.hpp"
 #include "video/gl/gl_texture.hpp"
 
 #ifndef USE_OPENGLES2
 
-GL20Context::GL20Context()
+GL20Context::GL20Context() :
+  m_stream_buffer(new GLStreamBuffer)
 {
   assert_gl();
 }
@@ -86,8 +88,10 @@ GL20Context::set_positions(const float* data, size_t size)
 {
   assert_gl();
 
+  const size_t offset = m_stream_buffer->upload(data, size);
+
   glEnableClientState(GL_VERTEX_ARRAY);
-  glVertexPointer(2, GL_FLOAT, 0, data);
+  glVertexPointer(2, GL_FLOAT, 0, reinterpret_cast<const void*>(offset));
 
   assert_gl();
 }
@@ -97,8 +101,10 @@ GL20Context::set_texcoords(const float* data, size_t size)
 {
   assert_gl();
 
+  const size_t offset = m_stream_buffer->upload(data, size);
+
   glEnableClientState(GL_TEXTURE_COORD_ARRAY);
-  glTexCoordPointer(2, GL_FLOAT, 0, data);
+  glTexCoordPointer(2, GL_FLOAT, 0, reinterpret_cast<const void*>(offset));
 
   assert_gl();
 }
@@ -113,13 +119,31 @@ GL20Context::set_texcoord(float u, float v)
   assert_gl();
 }
 
+void
+GL20Context::set_textured_vertices(size_t offset)
+{
+  assert_gl();
+
+  m_stream_buffer->bind();
+
+  glEnableClientState(GL_VERTEX_ARRAY);
+  glVertexPointer(2, GL_FLOAT, 4 * sizeof(float), reinterpret_cast<const void*>(offset));
+
+  glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+  glTexCoordPointer(2, GL_FLOAT, 4 * sizeof(float), reinterpret_cast<const void*>(offset + 2 * sizeof(float)));
+
+  assert_gl();
+}
+
 void
 GL20Context::set_colors(const float* data, size_t size)
 {
   assert_gl();
 
+  const size_t offset = m_stream_buffer->upload(data, size);
+
   glEnableClientState(GL_COLOR_ARRAY);
-  glColorPointer(4, GL_FLOAT, 0, data);
+  glColorPointer(4, GL_FLOAT, 0, reinterpret_cast<const void*>(offset));
 
   assert_gl();
 }
@@ -19,6 +19,8 @@
 
 #include "video/gl/gl_context.hpp"
 
+#include <memory>
+
 #ifndef USE_OPENGLES2
 
 class GL20Context final : public GLContext
@@ -39,6 +41,7 @@ public:
 
   virtual void set_texcoords(const float* data, size_t size) override;
   virtual void set_texcoord(float u, float v) override;
+  virtual void set_textured_vertices(size_t offset) override;
 
   virtual void set_colors(const float* data, size_t size) override;
   virtual void set_color(const Color& color) override;
@@ -49,6 +52,10 @@ public:
   virtual void draw_arrays(GLenum type, GLint first, GLsizei count) override;
 
   virtual bool supports_framebuffer() const override { return false; }
+  virtual GLStreamBuffer& get_stream_buffer() override { return *m_stream_buffer; }
+
+private:
+  std::unique_ptr<GLStreamBuffer> m_stream_buffer;
 
 private:
   GL20Context(const GL20Context&) = delete;
@@ -162,6 +162,12 @@ GL33CoreContext::set_texcoord(float u, float v)
   m_vertex_arrays->set_texcoord(u, v);
 }
 
+void
+GL33CoreContext::set_textured_vertices(size_t offset)
+{
+  m_vertex_arrays->set_textured_vertices(offset);
+}
+
 void
 GL33CoreContext::set_colors(const float* data, size_t size)
 {
@@ -174,6 +180,12 @@ GL33CoreContext::set_color(const Color& color)
   m_vertex_arrays->set_color(color);
 }
 
+GLStreamBuffer&
+GL33CoreContext::get_stream_buffer()
+{
+  return m_vertex_arrays->get_stream_buffer();
+}
+
 void
 GL33CoreContext::bind_texture(const Texture& texture, const Texture* displacement_texture)
 {
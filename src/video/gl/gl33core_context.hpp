@@ -44,6 +44,7 @@ public:
 
   virtual void set_texcoords(const float* data, size_t size) override;
   virtual void set_texcoord(float u, float v) override;
+  virtual void set_textured_vertices(size_t offset) override;
 
   virtual void set_colors(const float* data, size_t size) override;
   virtual void set_color(const Color& color) override;
@@ -53,6 +54,7 @@ public:
   virtual void draw_arrays(GLenum type, GLint first, GLsizei count) override;
 
   virtual bool supports_framebuffer() const override { return true; }
+  virtual GLStreamBuffer& get_stream_buffer() override;
 
   GLProgram& get_program() const { return *m_program; }
   GLVertexArrays& get_vertex_arrays() const { return *m_vertex_arrays; }
@@ -23,6 +23,7 @@
 #include "video/gl.hpp"
 
 class Color;
+class GLStreamBuffer;
 class GLTexture;
 class Texture;
 
@@ -45,6 +46,10 @@ public:
   virtual void set_texcoords(const float* data, size_t size) = 0;
   virtual void set_texcoord(float u, float v) = 0;
 
+  /** Use interleaved positions and texture coordinates, x, y, u, v
+      per vertex, that were uploaded to the stream buffer at offset */
+  virtual void set_textured_vertices(size_t offset) = 0;
+
   virtual void set_colors(const float* data, size_t size) = 0;
   virtual void set_color(const Color& color) = 0;
 
@@ -55,6 +60,9 @@ public:
 
   virtual bool supports_framebuffer() const = 0;
 
+  /** Buffer that all vertex data is streamed through */
+  virtual GLStreamBuffer& get_stream_buffer() = 0;
+
 private:
   GLContext(const GLContext&) = delete;
   GLContext& operator=(const GLContext&) = delete;
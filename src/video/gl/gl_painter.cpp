@@ -23,9 +23,9 @@
 #include "supertux/globals.hpp"
 #include "video/drawing_request.hpp"
 #include "video/gl/gl_context.hpp"
-#include "video/gl/gl_pixel_request.hpp"
 #include "video/gl/gl_program.hpp"
 #include "video/gl/gl_renderer.hpp"
+#include "video/gl/gl_stream_buffer.hpp"
 #include "video/gl/gl_texture.hpp"
 #include "video/gl/gl_vertex_arrays.hpp"
 #include "video/gl/gl_video_system.hpp"
@@ -63,26 +63,20 @@ GLPainter::GLPainter(GLVideoSystem& video_system, GLRenderer& renderer) :
   m_video_system(video_system),
   m_renderer(renderer),
   m_vertices(),
-  m_uvs()
+  m_prepared(),
+  m_next_prepared(0),
+  m_prepared_generation(0)
 {
 }
 
 void
-GLPainter::draw_texture(const TextureRequest& request)
+GLPainter::append_vertices(const TextureRequest& request, std::vector<float>& vertices)
 {
-  assert_gl();
-
   const auto& texture = static_cast<const GLTexture&>(*request.texture);
 
   assert(request.srcrects.size() == request.dstrects.size());
   assert(request.srcrects.size() == request.angles.size());
 
-  m_vertices.clear();
-  m_uvs.clear();
-
-  m_vertices.reserve(request.srcrects.size() * 12);
-  m_uvs.reserve(request.srcrects.size() * 12);
-
   for (size_t i = 0; i < request.srcrects.size(); ++i)
   {
     const float left = request.dstrects[i].get_left();
@@ -103,27 +97,16 @@ GLPainter::draw_texture(const TextureRequest& request)
 
     if (request.angles[i] == 0.0f)
     {
-      auto vertices_lst = {
-        left, top,
-        right, top,
-        right, bottom,
-
-        left, bottom,
-        left, top,
-        right, bottom,
-      };
-      m_vertices.insert(m_vertices.end(), std::begin(vertices_lst), std::end(vertices_lst));
-
-      auto uvs_lst = {
-        uv_left, uv_top,
-        uv_right, uv_top,
-        uv_right, uv_bottom,
+      const float vertices_lst[] = {
+        left, top, uv_left, uv_top,
+        right, top, uv_right, uv_top,
+        right, bottom, uv_right, uv_bottom,
 
-        uv_left, uv_bottom,
-        uv_left, uv_top,
-        uv_right, uv_bottom,
+        left, bottom, uv_left, uv_bottom,
+        left, top, uv_left, uv_top,
+        right, bottom, uv_right, uv_bottom,
       };
-      m_uvs.insert(m_uvs.end(), std::begin(uvs_lst), std::end(uvs_lst));
+      vertices.insert(vertices.end(), std::begin(vertices_lst), std::end(vertices_lst));
     }
     else
     {
@@ -141,35 +124,77 @@ GLPainter::draw_texture(const TextureRequest& request)
       const float new_bottom = bottom - center_y;
 
       const float vertices_lst[] = {
-        new_left*ca - new_top*sa + center_x, new_left*sa + new_top*ca + center_y,
-        new_right*ca - new_top*sa + center_x, new_right*sa + new_top*ca + center_y,
-        new_right*ca - new_bottom*sa + center_x, new_right*sa + new_bottom*ca + center_y,
+        new_left*ca - new_top*sa + center_x, new_left*sa + new_top*ca + center_y, uv_left, uv_top,
+        new_right*ca - new_top*sa + center_x, new_right*sa + new_top*ca + center_y, uv_right, uv_top,
+        new_right*ca - new_bottom*sa + center_x, new_right*sa + new_bottom*ca + center_y, uv_right, uv_bottom,
 
-        new_left*ca - new_bottom*sa + center_x, new_left*sa + new_bottom*ca + center_y,
-        new_left*ca - new_top*sa + center_x, new_left*sa + new_top*ca + center_y,
-        new_right*ca - new_bottom*sa + center_x, new_right*sa + new_bottom*ca + center_y,
+        new_left*ca - new_bottom*sa + center_x, new_left*sa + new_bottom*ca + center_y, uv_left, uv_bottom,
+        new_left*ca - new_top*sa + center_x, new_left*sa + new_top*ca + center_y, uv_left, uv_top,
+        new_right*ca - new_bottom*sa + center_x, new_right*sa + new_bottom*ca + center_y, uv_right, uv_bottom,
       };
-      m_vertices.insert(m_vertices.end(), std::begin(vertices_lst), std::end(vertices_lst));
+      vertices.insert(vertices.end(), std::begin(vertices_lst), std::end(vertices_lst));
+    }
+  }
+}
 
-      const float uvs_lst[] = {
-        uv_left, uv_top,
-        uv_right, uv_top,
-        uv_right, uv_bottom,
+void
+GLPainter::prepare(DrawingRequest* const* requests, size_t count)
+{
+  m_vertices.clear();
+  m_prepared.clear();
+  m_next_prepared = 0;
 
-        uv_left, uv_bottom,
-        uv_left, uv_top,
-        uv_right, uv_bottom,
-      };
-      m_uvs.insert(m_uvs.end(), std::begin(uvs_lst), std::end(uvs_lst));
+  for (size_t i = 0; i < count; ++i)
+  {
+    if (requests[i]->type == TEXTURE)
+    {
+      const auto& request = static_cast<const TextureRequest&>(*requests[i]);
+      m_prepared.emplace_back(&request, sizeof(float) * m_vertices.size());
+      append_vertices(request, m_vertices);
     }
   }
 
+  if (m_vertices.empty())
+    return;
+
+  // Upload the vertices of the whole pass at once
+  GLStreamBuffer& stream_buffer = m_video_system.get_context().get_stream_buffer();
+  const size_t offset = stream_buffer.upload(m_vertices.data(), sizeof(float) * m_vertices.size());
+  for (auto& prepared : m_prepared)
+  {
+    prepared.second += offset;
+  }
+  m_prepared_generation = stream_buffer.get_generation();
+}
+
+void
+GLPainter::draw_texture(const TextureRequest& request)
+{
+  assert_gl();
+
   GLContext& context = m_video_system.get_context();
+  GLStreamBuffer& stream_buffer = context.get_stream_buffer();
+
+  size_t offset;
+  if (m_next_prepared < m_prepared.size() &&
+      m_prepared[m_next_prepared].first == &request &&
+      m_prepared_generation == stream_buffer.get_generation())
+  {
+    offset = m_prepared[m_next_prepared].second;
+    m_next_prepared += 1;
+  }
+  else
+  {
+    // Not part of a prepared pass or the stream buffer was orphaned
+    // in the meantime, e.g. the lightmap drawn by the Compositor
+    m_vertices.clear();
+    append_vertices(request, m_vertices);
+    offset = stream_buffer.upload(m_vertices.data(), sizeof(float) * m_vertices.size());
+  }
 
   context.blend_func(sfactor(request.blend), dfactor(request.blend));
-  context.bind_texture(texture, request.displacement_texture);
-  context.set_texcoords(m_uvs.data(), sizeof(float) * m_uvs.size());
-  context.set_positions(m_vertices.data(), sizeof(float) * m_vertices.size());
+  context.bind_texture(*request.texture, request.displacement_texture);
+  context.set_textured_vertices(offset);
   context.set_color(Color(request.color.red,
                           request.color.green,
                           request.color.blue,
@@ -199,31 +224,24 @@ GLPainter::draw_gradient(const GradientRequest& request)
     region.get_left(), region.get_bottom()
   };
 
+  const bool vertical = direction == VERTICAL || direction == VERTICAL_SECTOR;
+  const Color& second = vertical ? top : bottom;
+  const Color& fourth = vertical ? bottom : top;
+  const float colors[] = {
+    top.red, top.green, top.blue, top.alpha,
+    second.red, second.green, second.blue, second.alpha,
+    bottom.red, bottom.green, bottom.blue, bottom.alpha,
+    fourth.red, fourth.green, fourth.blue, fourth.alpha,
+  };
+
   context.blend_func(sfactor(request.blend), dfactor(request.blend));
   context.bind_no_texture();
+
+  // both attributes have to end up in the same storage of the buffer
+  context.get_stream_buffer().reserve(sizeof(vertices) + sizeof(colors), 2);
   context.set_positions(vertices, sizeof(vertices));
   context.set_texcoord(0.0f, 0.0f);
-
-  if (direction == VERTICAL || direction == VERTICAL_SECTOR)
-  {
-    const float colors[] = {
-      top.red, top.green, top.blue, top.alpha,
-      top.red, top.green, top.blue, top.alpha,
-      bottom.red, bottom.green, bottom.blue, bottom.alpha,
-      bottom.red, bottom.green, bottom.blue, bottom.alpha,
-    };
-    context.set_colors(colors, sizeof(colors));
-  }
-  else
-  {
-    const float colors[] = {
-      top.red, top.green, top.blue, top.alpha,
-      bottom.red, bottom.green, bottom.blue, bottom.alpha,
-      bottom.red, bottom.green, bottom.blue, bottom.alpha,
-      top.red, top.green, top.blue, top.alpha,
-    };
-    context.set_colors(colors, sizeof(colors));
-  }
+  context.set_colors(colors, sizeof(colors));
 
   context.draw_arrays(GL_TRIANGLE_FAN, 0, 4);
 
@@ -473,38 +491,59 @@ GLPainter::clear(const Color& color)
 }
 
 void
-GLPainter::get_pixel(const GetPixelRequest& request) const
+GLPainter::get_pixels(const GetPixelRequest* const* requests, size_t count) const
 {
   assert_gl();
 
   const Rect& rect = m_renderer.get_rect();
   const Size& logical_size = m_renderer.get_logical_size();
 
-  float x = request.pos.x * static_cast<float>(rect.get_width()) / static_cast<float>(logical_size.width);
-  float y = request.pos.y * static_cast<float>(rect.get_height()) / static_cast<float>(logical_size.height);
+  auto to_pixel = [&rect, &logical_size](const Vector& pos) {
+    return Vector(static_cast<float>(rect.left) + pos.x * static_cast<float>(rect.get_width()) / static_cast<float>(logical_size.width),
+                  static_cast<float>(rect.top) + pos.y * static_cast<float>(rect.get_height()) / static_cast<float>(logical_size.height));
+  };
 
-  x += static_cast<float>(rect.left);
-  y += static_cast<float>(rect.top);
+  // glReadPixels() waits for all pending rendering, so read the
+  // bounding box of all requests at once instead of one pixel each.
+  // OpenGLES2 does not have PBOs, and glFenceSync() causes crashes on
+  // Intel I965, so GLPixelRequest is not used for this.
+  int left = rect.right;
+  int top = rect.bottom;
+  int right = rect.left;
+  int bottom = rect.top;
+  for (size_t i = 0; i < count; ++i)
+  {
+    const Vector pos = to_pixel(requests[i]->pos);
+    left = std::min(left, static_cast<int>(pos.x));
+    top = std::min(top, static_cast<int>(pos.y));
+    right = std::max(right, static_cast<int>(pos.x) + 1);
+    bottom = std::max(bottom, static_cast<int>(pos.y) + 1);
+  }
 
-#if 0
-  // #ifndef USE_OPENGLES2
-  //
-  // FIXME: glFenceSync() causes crashes on Intel I965, so disable
-  // GLPixelRequest for now, it's not yet properly used anyway.
-  GLPixelRequest pixel_request(1, 1);
-  pixel_request.request(static_cast<int>(x), static_cast<int>(y));
+  left = std::max(left, rect.left);
+  top = std::max(top, rect.top);
+  right = std::min(right, rect.right);
+  bottom = std::min(bottom, rect.bottom);
+  if (left >= right || top >= bottom)
+    return;
 
-  *(request.color_ptr) = pixel_request.get_color();
+  const int width = right - left;
+  const int height = bottom - top;
 
-#else
-  float pixels[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+  // GL_RGBA/GL_UNSIGNED_BYTE is the one combination every GL version
+  // supports and it needs no row padding
+  m_pixels.resize(static_cast<size_t>(width * height * 4));
+  glReadPixels(left, top, width, height, GL_RGBA, GL_UNSIGNED_BYTE, m_pixels.data());
 
-  // OpenGLES2 does not have PBOs, only GLES3 has
-  glReadPixels(static_cast<GLint>(x), static_cast<GLint>(y),
-               1, 1, GL_RGB, GL_FLOAT, pixels);
+  for (size_t i = 0; i < count; ++i)
+  {
+    const Vector pos = to_pixel(requests[i]->pos);
+    const int x = math::clamp(static_cast<int>(pos.x), left, right - 1) - left;
+    const int y = math::clamp(static_cast<int>(pos.y), top, bottom - 1) - top;
 
-  *(request.color_ptr) = Color(pixels[0], pixels[1], pixels[2]);
-#endif
+    const uint8_t* pixel = &m_pixels[static_cast<size_t>((y * width + x) * 4)];
+    *(requests[i]->color_ptr) = Color::from_rgb888(pixel[0], pixel[1], pixel[2]);
+  }
 
   assert_gl();
 }
@@ -19,6 +19,10 @@
 
 #include "video/painter.hpp"
 
+#include <stdint.h>
+#include <utility>
+#include <vector>
+
 #include "video/flip.hpp"
 
 enum class Blend;
@@ -30,6 +34,7 @@ class GLPainter final : public Painter
 public:
   GLPainter(GLVideoSystem& video_system, GLRenderer& renderer);
 
+  virtual void prepare(DrawingRequest* const* requests, size_t count) override;
   virtual void draw_texture(const TextureRequest& request) override;
   virtual void draw_gradient(const GradientRequest& request) override;
   virtual void draw_filled_rect(const FillRectRequest& request) override;
@@ -38,18 +43,31 @@ public:
   virtual void draw_triangle(const TriangleRequest& request) override;
 
   virtual void clear(const Color& color) override;
-  virtual void get_pixel(const GetPixelRequest& request) const override;
+  virtual void get_pixels(const GetPixelRequest* const* requests, size_t count) const override;
 
   virtual void set_clip_rect(const Rect& rect) override;
   virtual void clear_clip_rect() override;
 
+private:
+  /** Appends x, y, u, v for the two triangles of each rect */
+  static void append_vertices(const TextureRequest& request, std::vector<float>& vertices);
+
 private:
   GLVideoSystem& m_video_system;
   GLRenderer& m_renderer;
 
 private:
   std::vector<float> m_vertices;
-  std::vector<float> m_uvs;
+
+  /** Texture requests of the current pass whose vertices have been
+      uploaded by prepare(), along with their offset in the stream
+      buffer, in drawing order */
+  std::vector<std::pair<const TextureRequest*, size_t> > m_prepared;
+  size_t m_next_prepared;
+  int m_prepared_generation;
+
+  /** Scratch buffer for get_pixels() */
+  mutable std::vector<uint8_t> m_pixels;
 
 private:
   GLPainter(const GLPainter&) = delete;
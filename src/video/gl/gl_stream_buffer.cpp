@@ -0,0 +1,125 @@
+//  SuperTux
+//  Copyright (C) 2024 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "video/gl/gl_stream_buffer.hpp"
+
+#include "video/glutil.hpp"
+
+namespace {
+
+/** Keeps every upload aligned, some drivers are slow with attribute
+    offsets that are not a multiple of four */
+const size_t ALIGNMENT = 16;
+
+} // namespace
+
+GLStreamBuffer::GLStreamBuffer(size_t capacity) :
+  m_buffer(),
+  m_capacity(capacity),
+  m_offset(0),
+  m_generation(0),
+  m_frame_bytes(0),
+  m_frame_uploads(0),
+  m_last_frame_bytes(0),
+  m_last_frame_uploads(0)
+{
+  assert_gl();
+
+  glGenBuffers(1, &m_buffer);
+  glBindBuffer(GL_ARRAY_BUFFER, m_buffer);
+  orphan();
+
+  assert_gl();
+}
+
+GLStreamBuffer::~GLStreamBuffer()
+{
+  glDeleteBuffers(1, &m_buffer);
+}
+
+size_t
+GLStreamBuffer::upload(const void* data, size_t size)
+{
+  assert_gl();
+
+  glBindBuffer(GL_ARRAY_BUFFER, m_buffer);
+
+  const size_t offset = make_room(size);
+  glBufferSubData(GL_ARRAY_BUFFER, static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(size), data);
+  m_offset = offset + size;
+
+  m_frame_bytes += size;
+  m_frame_uploads += 1;
+
+  assert_gl();
+
+  return offset;
+}
+
+void
+GLStreamBuffer::reserve(size_t size, int uploads)
+{
+  assert_gl();
+
+  glBindBuffer(GL_ARRAY_BUFFER, m_buffer);
+
+  // each upload may need up to ALIGNMENT - 1 bytes of padding
+  const size_t padding = static_cast<size_t>(uploads > 0 ? uploads - 1 : 0) * (ALIGNMENT - 1);
+  m_offset = make_room(size + padding);
+
+  assert_gl();
+}
+
+void
+GLStreamBuffer::bind()
+{
+  glBindBuffer(GL_ARRAY_BUFFER, m_buffer);
+}
+
+void
+GLStreamBuffer::next_frame()
+{
+  m_last_frame_bytes = m_frame_bytes;
+  m_last_frame_uploads = m_frame_uploads;
+  m_frame_bytes = 0;
+  m_frame_uploads = 0;
+}
+
+size_t
+GLStreamBuffer::make_room(size_t size)
+{
+  const size_t offset = (m_offset + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+  if (offset + size <= m_capacity)
+    return offset;
+
+  // Ranges written earlier may still be in use by the GPU, so
+  // instead of waiting for it, detach them from the buffer.
+  while (size > m_capacity)
+  {
+    m_capacity *= 2;
+  }
+  orphan();
+  return 0;
+}
+
+void
+GLStreamBuffer::orphan()
+{
+  glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(m_capacity), nullptr, GL_STREAM_DRAW);
+  m_generation += 1;
+}
+
+/* EOF */
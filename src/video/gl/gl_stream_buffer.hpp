@@ -0,0 +1,82 @@
+//  SuperTux
+//  Copyright (C) 2024 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef HEADER_SUPERTUX_VIDEO_GL_GL_STREAM_BUFFER_HPP
+#define HEADER_SUPERTUX_VIDEO_GL_GL_STREAM_BUFFER_HPP
+
+#include <stddef.h>
+
+#include "video/gl.hpp"
+
+/** A vertex buffer that is used as a ring: each upload goes into the
+    next free range and the storage is only orphaned when the end is
+    reached, instead of reallocating the buffer for every draw. */
+class GLStreamBuffer final
+{
+public:
+  GLStreamBuffer(size_t capacity = 1024 * 1024);
+  ~GLStreamBuffer();
+
+  /** Copies size bytes of data into the buffer, leaves it bound as
+      GL_ARRAY_BUFFER and returns the byte offset of the data */
+  size_t upload(const void* data, size_t size);
+
+  /** Makes sure that the next \a uploads calls to upload(), of
+      \a size bytes in total, fit without orphaning the storage in
+      between. Draws that upload several attributes call this first,
+      as orphaning would invalidate the attributes uploaded before. */
+  void reserve(size_t size, int uploads);
+
+  void bind();
+
+  /** Incremented whenever the storage is orphaned, which invalidates
+      the offsets of all earlier uploads */
+  int get_generation() const { return m_generation; }
+
+  /** Latches the upload statistics of the frame that just ended */
+  void next_frame();
+
+  /** Bytes uploaded during the last complete frame */
+  size_t get_frame_bytes() const { return m_last_frame_bytes; }
+
+  /** Number of uploads during the last complete frame */
+  int get_frame_uploads() const { return m_last_frame_uploads; }
+
+private:
+  /** Orphans the storage unless \a size more bytes fit, returns the
+      aligned offset at which they go */
+  size_t make_room(size_t size);
+  void orphan();
+
+private:
+  GLuint m_buffer;
+  size_t m_capacity;
+  size_t m_offset;
+  int m_generation;
+
+  size_t m_frame_bytes;
+  int m_frame_uploads;
+  size_t m_last_frame_bytes;
+  int m_last_frame_uploads;
+
+private:
+  GLStreamBuffer(const GLStreamBuffer&) = delete;
+  GLStreamBuffer& operator=(const GLStreamBuffer&) = delete;
+};
+
+#endif
+
+/* EOF */
@@ -194,6 +194,42 @@ GLTexture::~GLTexture()
   glDeleteTextures(1, &m_handle);
 }
 
+void
+GLTexture::update(const SDL_Surface& image, const Rect& srcrect, int x, int y)
+{
+  if (srcrect.empty())
+    return;
+
+  SDLSurfacePtr convert = SDLSurface::create_rgba(srcrect.get_width(), srcrect.get_height());
+
+  SDL_Rect sdl_srcrect = srcrect.to_sdl();
+  SDL_SetSurfaceBlendMode(const_cast<SDL_Surface*>(&image), SDL_BLENDMODE_NONE);
+  SDL_BlitSurface(const_cast<SDL_Surface*>(&image), &sdl_srcrect, convert.get(), nullptr);
+
+  assert_gl();
+
+  glBindTexture(GL_TEXTURE_2D, m_handle);
+  glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+#if defined(GL_UNPACK_ROW_LENGTH) || defined(USE_GLBINDING)
+  glPixelStorei(GL_UNPACK_ROW_LENGTH, convert->pitch/convert->format->BytesPerPixel);
+#else
+  assert(convert->pitch == static_cast<int>(srcrect.get_width() * convert->format->BytesPerPixel));
+#endif
+
+  if (SDL_MUSTLOCK(convert.get())) {
+    SDL_LockSurface(convert.get());
+  }
+
+  glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, srcrect.get_width(), srcrect.get_height(),
+                  GL_RGBA, GL_UNSIGNED_BYTE, convert->pixels);
+
+  if (SDL_MUSTLOCK(convert.get())) {
+    SDL_UnlockSurface(convert.get());
+  }
+
+  assert_gl();
+}
+
 void
 GLTexture::set_texture_params()
 {
@@ -42,6 +42,8 @@ public:
   virtual int get_image_width() const override { return m_image_width; }
   virtual int get_image_height() const override { return m_image_height; }
 
+  virtual void update(const SDL_Surface& image, const Rect& srcrect, int x, int y) override;
+
   void set_handle(GLuint handle) { m_handle = handle; }
   const GLuint &get_handle() const { return m_handle; }
 
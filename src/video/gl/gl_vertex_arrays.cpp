@@ -25,25 +25,17 @@
 GLVertexArrays::GLVertexArrays(GL33CoreContext& context) :
   m_context(context),
   m_vao(),
-  m_positions_buffer(),
-  m_texcoords_buffer(),
-  m_color_buffer()
+  m_stream_buffer()
 {
   assert_gl();
 
   glGenVertexArrays(1, &m_vao);
-  glGenBuffers(1, &m_positions_buffer);
-  glGenBuffers(1, &m_texcoords_buffer);
-  glGenBuffers(1, &m_color_buffer);
 
   assert_gl();
 }
 
 GLVertexArrays::~GLVertexArrays()
 {
-  glDeleteBuffers(1, &m_positions_buffer);
-  glDeleteBuffers(1, &m_texcoords_buffer);
-  glDeleteBuffers(1, &m_color_buffer);
   glDeleteVertexArrays(1, &m_vao);
 }
 
@@ -62,11 +54,10 @@ GLVertexArrays::set_positions(const float* data, size_t size)
 {
   assert_gl();
 
-  glBindBuffer(GL_ARRAY_BUFFER, m_positions_buffer);
-  glBufferData(GL_ARRAY_BUFFER, size, data, GL_DYNAMIC_DRAW);
+  const size_t offset = m_stream_buffer.upload(data, size);
 
   int loc = m_context.get_program().get_attrib_location("position");
-  glVertexAttribPointer(loc, 2, GL_FLOAT, GL_FALSE, 0, nullptr);
+  glVertexAttribPointer(loc, 2, GL_FLOAT, GL_FALSE, 0, reinterpret_cast<const void*>(offset));
   glEnableVertexAttribArray(loc);
 
   assert_gl();
@@ -77,11 +68,10 @@ GLVertexArrays::set_texcoords(const float* data, size_t size)
 {
   assert_gl();
 
-  glBindBuffer(GL_ARRAY_BUFFER, m_texcoords_buffer);
-  glBufferData(GL_ARRAY_BUFFER, size, data, GL_DYNAMIC_DRAW);
+  const size_t offset = m_stream_buffer.upload(data, size);
 
   int loc = m_context.get_program().get_attrib_location("texcoord");
-  glVertexAttribPointer(loc, 2, GL_FLOAT, GL_FALSE, 0, nullptr);
+  glVertexAttribPointer(loc, 2, GL_FLOAT, GL_FALSE, 0, reinterpret_cast<const void*>(offset));
   glEnableVertexAttribArray(loc);
 
   assert_gl();
@@ -99,16 +89,36 @@ GLVertexArrays::set_texcoord(float u, float v)
   assert_gl();
 }
 
+void
+GLVertexArrays::set_textured_vertices(size_t offset)
+{
+  assert_gl();
+
+  m_stream_buffer.bind();
+
+  const GLsizei stride = 4 * sizeof(float);
+
+  int position_loc = m_context.get_program().get_attrib_location("position");
+  glVertexAttribPointer(position_loc, 2, GL_FLOAT, GL_FALSE, stride, reinterpret_cast<const void*>(offset));
+  glEnableVertexAttribArray(position_loc);
+
+  int texcoord_loc = m_context.get_program().get_attrib_location("texcoord");
+  glVertexAttribPointer(texcoord_loc, 2, GL_FLOAT, GL_FALSE, stride,
+                        reinterpret_cast<const void*>(offset + 2 * sizeof(float)));
+  glEnableVertexAttribArray(texcoord_loc);
+
+  assert_gl();
+}
+
 void
 GLVertexArrays::set_colors(const float* data, size_t size)
 {
   assert_gl();
 
-  glBindBuffer(GL_ARRAY_BUFFER, m_color_buffer);
-  glBufferData(GL_ARRAY_BUFFER, size, data, GL_DYNAMIC_DRAW);
+  const size_t offset = m_stream_buffer.upload(data, size);
 
   int loc = m_context.get_program().get_attrib_location("diffuse");
-  glVertexAttribPointer(loc, 4, GL_FLOAT, GL_FALSE, 0, nullptr);
+  glVertexAttribPointer(loc, 4, GL_FLOAT, GL_FALSE, 0, reinterpret_cast<const void*>(offset));
   glEnableVertexAttribArray(loc);
 
   assert_gl();
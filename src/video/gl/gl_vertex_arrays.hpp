@@ -20,6 +20,7 @@
 #include <stddef.h>
 
 #include "video/gl.hpp"
+#include "video/gl/gl_stream_buffer.hpp"
 
 class Color;
 class GL33CoreContext;
@@ -38,15 +39,18 @@ public:
   void set_texcoords(const float* data, size_t size);
   void set_texcoord(float u, float v);
 
+  /** Interleaved positions and texcoords at offset in the stream buffer */
+  void set_textured_vertices(size_t offset);
+
   void set_colors(const float* data, size_t size);
   void set_color(const Color& color);
 
+  GLStreamBuffer& get_stream_buffer() { return m_stream_buffer; }
+
 private:
   GL33CoreContext& m_context;
   GLuint m_vao;
-  GLuint m_positions_buffer;
-  GLuint m_texcoords_buffer;
-  GLuint m_color_buffer;
+  GLStreamBuffer m_stream_buffer;
 
 private:
   GLVertexArrays(const GLVertexArrays&) = delete;
@@ -25,6 +25,7 @@
 #include "video/gl/gl_context.hpp"
 #include "video/gl/gl_program.hpp"
 #include "video/gl/gl_screen_renderer.hpp"
+#include "video/gl/gl_stream_buffer.hpp"
 #include "video/gl/gl_texture.hpp"
 #include "video/gl/gl_texture_renderer.hpp"
 #include "video/gl/gl_texture_renderer.hpp"
@@ -282,7 +283,7 @@ GLVideoSystem::apply_config()
   m_viewport = Viewport::from_size(g_config->window_size, g_config->window_size);
 #endif
 
-  m_lightmap.reset(new GLTextureRenderer(*this, m_viewport.get_screen_size(), 5));
+  m_lightmap.reset(new GLTextureRenderer(*this, m_viewport.get_screen_size(), g_config->lightmap_scale));
   if (m_use_opengl33core)
   {
     m_back_renderer.reset(new GLTextureRenderer(*this, m_viewport.get_screen_size(), 1));
@@ -318,6 +319,20 @@ GLVideoSystem::flip()
 {
   assert_gl();
   SDL_GL_SwapWindow(m_sdl_window.get());
+
+  m_context->get_stream_buffer().next_frame();
+}
+
+size_t
+GLVideoSystem::get_vertex_upload_bytes() const
+{
+  return m_context->get_stream_buffer().get_frame_bytes();
+}
+
+int
+GLVideoSystem::get_vertex_uploads() const
+{
+  return m_context->get_stream_buffer().get_frame_uploads();
 }
 
 void
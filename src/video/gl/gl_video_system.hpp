@@ -58,6 +58,9 @@ public:
 
   virtual SDLSurfacePtr make_screenshot() override;
 
+  virtual size_t get_vertex_upload_bytes() const override;
+  virtual int get_vertex_uploads() const override;
+
   GLContext& get_context() const { return *m_context; }
 
 private:
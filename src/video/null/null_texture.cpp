@@ -50,4 +50,9 @@ NullTexture::get_image_height() const
   return m_image_size.height;
 }
 
+void
+NullTexture::update(const SDL_Surface& /*image*/, const Rect& /*srcrect*/, int /*x*/, int /*y*/)
+{
+}
+
 /* EOF */
@@ -18,6 +18,8 @@
 #ifndef HEADER_SUPERTUX_VIDEO_PAINTER_HPP
 #define HEADER_SUPERTUX_VIDEO_PAINTER_HPP
 
+#include <stddef.h>
+
 #include "math/rect.hpp"
 #include "math/vector.hpp"
 #include "video/color.hpp"
@@ -39,6 +41,11 @@ public:
   Painter() {}
   virtual ~Painter() {}
 
+  /** Called by Canvas::render() with all requests of a pass, in the
+      order they will be drawn, before any of them is drawn. Allows
+      the painter to upload their vertex data at once. */
+  virtual void prepare(DrawingRequest* const* requests, size_t count) {}
+
   virtual void draw_texture(const TextureRequest& request) = 0;
   virtual void draw_gradient(const GradientRequest& request) = 0;
   virtual void draw_filled_rect(const FillRectRequest& request) = 0;
@@ -47,7 +54,10 @@ public:
   virtual void draw_triangle(const TriangleRequest& request) = 0;
 
   virtual void clear(const Color& color) = 0;
-  virtual void get_pixel(const GetPixelRequest& request) const = 0;
+
+  /** Stores the color at the position of each request, reading all
+      of them back at once so that the renderer only stalls once */
+  virtual void get_pixels(const GetPixelRequest* const* requests, size_t count) const = 0;
 
   virtual void set_clip_rect(const Rect& rect) = 0;
   virtual void clear_clip_rect() = 0;
@@ -0,0 +1,128 @@
+//  SuperTux
+//  Copyright (C) 2024 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "video/sdl/sdl_geometry_batch.hpp"
+
+#include <math.h>
+#include <utility>
+
+#include "math/util.hpp"
+
+SDLGeometryBatch::SDLGeometryBatch() :
+  m_texture_width(1.0f),
+  m_texture_height(1.0f),
+  m_vertices(),
+  m_indices()
+{
+}
+
+void
+SDLGeometryBatch::clear(int texture_width, int texture_height)
+{
+  m_texture_width = static_cast<float>(texture_width);
+  m_texture_height = static_cast<float>(texture_height);
+  m_vertices.clear();
+  m_indices.clear();
+}
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+
+void
+SDLGeometryBatch::add_quad(const SDL_Rect& srcrect, const SDL_Rect& dstrect,
+                           float angle, SDL_RendererFlip flip, const SDL_Color& color)
+{
+  float u1 = static_cast<float>(srcrect.x) / m_texture_width;
+  float v1 = static_cast<float>(srcrect.y) / m_texture_height;
+  float u2 = static_cast<float>(srcrect.x + srcrect.w) / m_texture_width;
+  float v2 = static_cast<float>(srcrect.y + srcrect.h) / m_texture_height;
+
+  if (flip & SDL_FLIP_HORIZONTAL)
+    std::swap(u1, u2);
+  if (flip & SDL_FLIP_VERTICAL)
+    std::swap(v1, v2);
+
+  const float left = static_cast<float>(dstrect.x);
+  const float top = static_cast<float>(dstrect.y);
+  const float right = static_cast<float>(dstrect.x + dstrect.w);
+  const float bottom = static_cast<float>(dstrect.y + dstrect.h);
+
+  const int base = static_cast<int>(m_vertices.size());
+
+  if (angle == 0.0f)
+  {
+    m_vertices.push_back({ { left, top }, color, { u1, v1 } });
+    m_vertices.push_back({ { right, top }, color, { u2, v1 } });
+    m_vertices.push_back({ { right, bottom }, color, { u2, v2 } });
+    m_vertices.push_back({ { left, bottom }, color, { u1, v2 } });
+  }
+  else
+  {
+    const float center_x = (left + right) / 2.0f;
+    const float center_y = (top + bottom) / 2.0f;
+    const float half_w = static_cast<float>(dstrect.w) / 2.0f;
+    const float half_h = static_cast<float>(dstrect.h) / 2.0f;
+
+    const float rad = math::radians(angle);
+    const float c = cosf(rad);
+    const float s = sinf(rad);
+
+    auto rotated = [center_x, center_y, c, s](float x, float y) -> SDL_FPoint {
+      return { center_x + x * c - y * s, center_y + x * s + y * c };
+    };
+
+    m_vertices.push_back({ rotated(-half_w, -half_h), color, { u1, v1 } });
+    m_vertices.push_back({ rotated(half_w, -half_h), color, { u2, v1 } });
+    m_vertices.push_back({ rotated(half_w, half_h), color, { u2, v2 } });
+    m_vertices.push_back({ rotated(-half_w, half_h), color, { u1, v2 } });
+  }
+
+  m_indices.push_back(base + 0);
+  m_indices.push_back(base + 1);
+  m_indices.push_back(base + 2);
+  m_indices.push_back(base + 0);
+  m_indices.push_back(base + 2);
+  m_indices.push_back(base + 3);
+}
+
+bool
+SDLGeometryBatch::render(SDL_Renderer* renderer, SDL_Texture* texture) const
+{
+  if (m_vertices.empty())
+    return true;
+
+  return SDL_RenderGeometry(renderer, texture,
+                            m_vertices.data(), static_cast<int>(m_vertices.size()),
+                            m_indices.data(), static_cast<int>(m_indices.size())) == 0;
+}
+
+#else
+
+void
+SDLGeometryBatch::add_quad(const SDL_Rect& /*srcrect*/, const SDL_Rect& dstrect,
+                           float /*angle*/, SDL_RendererFlip /*flip*/, const SDL_Color& /*color*/)
+{
+  m_vertices.push_back(dstrect);
+}
+
+bool
+SDLGeometryBatch::render(SDL_Renderer* /*renderer*/, SDL_Texture* /*texture*/) const
+{
+  return false;
+}
+
+#endif
+
+/* EOF */
@@ -0,0 +1,69 @@
+//  SuperTux
+//  Copyright (C) 2024 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef HEADER_SUPERTUX_VIDEO_SDL_SDL_GEOMETRY_BATCH_HPP
+#define HEADER_SUPERTUX_VIDEO_SDL_SDL_GEOMETRY_BATCH_HPP
+
+#include <SDL.h>
+#include <vector>
+
+/** Collects textured quads, so that a whole TextureRequest can be
+    submitted with a single SDL_RenderGeometry() call instead of one
+    SDL_RenderCopyEx() per rectangle. Requires SDL >= 2.0.18, with
+    older versions render() always fails and the caller has to fall
+    back to SDL_RenderCopyEx(). */
+class SDLGeometryBatch final
+{
+public:
+  SDLGeometryBatch();
+
+  /** Starts a new batch for a texture of the given size, the
+      allocated memory is kept for reuse */
+  void clear(int texture_width, int texture_height);
+
+  /** Adds a quad, 'angle' is in degrees clockwise around the center
+      of dstrect, same as with SDL_RenderCopyEx() */
+  void add_quad(const SDL_Rect& srcrect, const SDL_Rect& dstrect,
+                float angle, SDL_RendererFlip flip, const SDL_Color& color);
+
+  /** Returns false if the renderer can't draw geometry */
+  bool render(SDL_Renderer* renderer, SDL_Texture* texture) const;
+
+  bool empty() const { return m_vertices.empty(); }
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+  const std::vector<SDL_Vertex>& get_vertices() const { return m_vertices; }
+  const std::vector<int>& get_indices() const { return m_indices; }
+#endif
+
+private:
+  float m_texture_width;
+  float m_texture_height;
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+  std::vector<SDL_Vertex> m_vertices;
+#else
+  std::vector<SDL_Rect> m_vertices;
+#endif
+  std::vector<int> m_indices;
+
+private:
+  SDLGeometryBatch(const SDLGeometryBatch&) = delete;
+  SDLGeometryBatch& operator=(const SDLGeometryBatch&) = delete;
+};
+
+#endif
+
+/* EOF */
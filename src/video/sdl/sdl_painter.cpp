@@ -218,7 +218,13 @@ SDLPainter::SDLPainter(SDLVideoSystem& video_system, Renderer& renderer, SDL_Ren
   m_video_system(video_system),
   m_renderer(renderer),
   m_sdl_renderer(sdl_renderer),
-  m_cliprect()
+  m_cliprect(),
+  m_geometry(),
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+  m_geometry_supported(true)
+#else
+  m_geometry_supported(false)
+#endif
 {}
 
 void
@@ -229,30 +235,57 @@ SDLPainter::draw_texture(const TextureRequest& request)
   assert(request.srcrects.size() == request.dstrects.size());
   assert(request.srcrects.size() == request.angles.size());
 
-  for (size_t i = 0; i < request.srcrects.size(); ++i)
+  Uint8 r = static_cast<Uint8>(request.color.red * 255);
+  Uint8 g = static_cast<Uint8>(request.color.green * 255);
+  Uint8 b = static_cast<Uint8>(request.color.blue * 255);
+  Uint8 a = static_cast<Uint8>(request.color.alpha * request.alpha * 255);
+
+  SDL_SetTextureBlendMode(texture.get_texture(), blend2sdl(request.blend));
+
+  SDL_RendererFlip flip = SDL_FLIP_NONE;
+  if ((request.flip & HORIZONTAL_FLIP) != 0)
   {
-    const SDL_Rect& src_rect = to_sdl_rect(request.srcrects[i]);
-    const SDL_Rect& dst_rect = to_sdl_rect(request.dstrects[i]);
+    flip = static_cast<SDL_RendererFlip>(flip | SDL_FLIP_HORIZONTAL);
+  }
 
-    Uint8 r = static_cast<Uint8>(request.color.red * 255);
-    Uint8 g = static_cast<Uint8>(request.color.green * 255);
-    Uint8 b = static_cast<Uint8>(request.color.blue * 255);
-    Uint8 a = static_cast<Uint8>(request.color.alpha * request.alpha * 255);
+  if ((request.flip & VERTICAL_FLIP) != 0)
+  {
+    flip = static_cast<SDL_RendererFlip>(flip | SDL_FLIP_VERTICAL);
+  }
 
-    SDL_SetTextureColorMod(texture.get_texture(), r, g, b);
-    SDL_SetTextureAlphaMod(texture.get_texture(), a);
-    SDL_SetTextureBlendMode(texture.get_texture(), blend2sdl(request.blend));
+  // Animated textures need their srcrects wrapped around, which only
+  // RenderCopyEx() handles
+  const Vector animate = texture.get_sampler().get_animate();
+  if (m_geometry_supported && animate.x == 0.0f && animate.y == 0.0f)
+  {
+    const SDL_Color color = { r, g, b, a };
 
-    SDL_RendererFlip flip = SDL_FLIP_NONE;
-    if ((request.flip & HORIZONTAL_FLIP) != 0)
+    m_geometry.clear(texture.get_texture_width(), texture.get_texture_height());
+    for (size_t i = 0; i < request.srcrects.size(); ++i)
     {
-      flip = static_cast<SDL_RendererFlip>(flip | SDL_FLIP_HORIZONTAL);
+      m_geometry.add_quad(to_sdl_rect(request.srcrects[i]), to_sdl_rect(request.dstrects[i]),
+                          request.angles[i], flip, color);
     }
 
-    if ((request.flip & VERTICAL_FLIP) != 0)
-    {
-      flip = static_cast<SDL_RendererFlip>(flip | SDL_FLIP_VERTICAL);
-    }
+    // The color is part of the vertices
+    SDL_SetTextureColorMod(texture.get_texture(), 255, 255, 255);
+    SDL_SetTextureAlphaMod(texture.get_texture(), 255);
+
+    if (m_geometry.render(m_sdl_renderer, texture.get_texture()))
+      return;
+
+    log_warning << "SDL_RenderGeometry() failed, falling back to SDL_RenderCopyEx(): "
+                << SDL_GetError() << std::endl;
+    m_geometry_supported = false;
+  }
+
+  SDL_SetTextureColorMod(texture.get_texture(), r, g, b);
+  SDL_SetTextureAlphaMod(texture.get_texture(), a);
+
+  for (size_t i = 0; i < request.srcrects.size(); ++i)
+  {
+    const SDL_Rect& src_rect = to_sdl_rect(request.srcrects[i]);
+    const SDL_Rect& dst_rect = to_sdl_rect(request.dstrects[i]);
 
     RenderCopyEx(m_sdl_renderer, texture.get_texture(),
                  &src_rect, &dst_rect,
@@ -601,28 +634,66 @@ SDLPainter::clear_clip_rect()
 }
 
 void
-SDLPainter::get_pixel(const GetPixelRequest& request) const
+SDLPainter::get_pixels(const GetPixelRequest* const* requests, size_t count) const
 {
   const Rect& rect = m_renderer.get_rect();
   const Size& logical_size = m_renderer.get_logical_size();
 
+  // Every SDL_RenderReadPixels() flushes the renderer and waits for
+  // it, so read the bounding box of all requests in one go
+  auto to_pixel = [&rect, &logical_size](const Vector& pos) {
+    return Vector(static_cast<float>(rect.left) + pos.x * static_cast<float>(rect.get_width()) / static_cast<float>(logical_size.width),
+                  static_cast<float>(rect.top) + pos.y * static_cast<float>(rect.get_height()) / static_cast<float>(logical_size.height));
+  };
+
+  int left = rect.right;
+  int top = rect.bottom;
+  int right = rect.left;
+  int bottom = rect.top;
+  for (size_t i = 0; i < count; ++i)
+  {
+    const Vector pos = to_pixel(requests[i]->pos);
+    left = std::min(left, static_cast<int>(pos.x));
+    top = std::min(top, static_cast<int>(pos.y));
+    right = std::max(right, static_cast<int>(pos.x) + 1);
+    bottom = std::max(bottom, static_cast<int>(pos.y) + 1);
+  }
+
+  left = std::max(left, rect.left);
+  top = std::max(top, rect.top);
+  right = std::min(right, rect.right);
+  bottom = std::min(bottom, rect.bottom);
+  if (left >= right || top >= bottom)
+    return;
+
   SDL_Rect srcrect;
-  srcrect.x = rect.left + static_cast<int>(request.pos.x * static_cast<float>(rect.get_width()) / static_cast<float>(logical_size.width));
-  srcrect.y = rect.top + static_cast<int>(request.pos.y * static_cast<float>(rect.get_height()) / static_cast<float>(logical_size.height));
-  srcrect.w = 1;
-  srcrect.h = 1;
+  srcrect.x = left;
+  srcrect.y = top;
+  srcrect.w = right - left;
+  srcrect.h = bottom - top;
 
-  Uint8 pixel[4];
+  m_pixels.resize(static_cast<size_t>(srcrect.w * srcrect.h));
   int ret = SDL_RenderReadPixels(m_sdl_renderer, &srcrect,
                                  SDL_PIXELFORMAT_RGB888,
-                                 pixel,
-                                 1);
+                                 m_pixels.data(),
+                                 srcrect.w * static_cast<int>(sizeof(Uint32)));
   if (ret != 0)
   {
     log_warning << "failed to read pixels: " << SDL_GetError() << std::endl;
+    return;
   }
 
-  *(request.color_ptr) = Color::from_rgb888(pixel[2], pixel[1], pixel[0]);
+  for (size_t i = 0; i < count; ++i)
+  {
+    const Vector pos = to_pixel(requests[i]->pos);
+    const int x = math::clamp(static_cast<int>(pos.x), left, right - 1) - left;
+    const int y = math::clamp(static_cast<int>(pos.y), top, bottom - 1) - top;
+
+    const Uint32 pixel = m_pixels[static_cast<size_t>(y * srcrect.w + x)];
+    *(requests[i]->color_ptr) = Color::from_rgb888(static_cast<uint8_t>((pixel >> 16) & 0xff),
+                                                   static_cast<uint8_t>((pixel >> 8) & 0xff),
+                                                   static_cast<uint8_t>(pixel & 0xff));
+  }
 }
 
 /* EOF */
@@ -20,6 +20,9 @@
 #include "video/painter.hpp"
 
 #include <boost/optional.hpp>
+#include <vector>
+
+#include "video/sdl/sdl_geometry_batch.hpp"
 
 class Renderer;
 class SDLScreenRenderer;
@@ -40,7 +43,7 @@ public:
   virtual void draw_triangle(const TriangleRequest& request) override;
 
   virtual void clear(const Color& color) override;
-  virtual void get_pixel(const GetPixelRequest& request) const override;
+  virtual void get_pixels(const GetPixelRequest* const* requests, size_t count) const override;
 
   virtual void set_clip_rect(const Rect& rect) override;
   virtual void clear_clip_rect() override;
@@ -51,6 +54,16 @@ private:
   SDL_Renderer* m_sdl_renderer;
   boost::optional<SDL_Rect> m_cliprect;
 
+  /** Reused for every draw_texture() call to avoid reallocations */
+  SDLGeometryBatch m_geometry;
+
+  /** Cleared when SDL_RenderGeometry() fails, draw_texture() then
+      falls back to one SDL_RenderCopyEx() per rectangle */
+  bool m_geometry_supported;
+
+  /** Scratch buffer for get_pixels() */
+  mutable std::vector<Uint32> m_pixels;
+
 private:
   SDLPainter(const SDLPainter&) = delete;
   SDLPainter& operator=(const SDLPainter&) = delete;
@@ -19,7 +19,9 @@
 #include <SDL.h>
 #include <sstream>
 
+#include "util/log.hpp"
 #include "video/sdl/sdl_screen_renderer.hpp"
+#include "video/sdl_surface.hpp"
 #include "video/video_system.hpp"
 
 SDLTexture::SDLTexture(SDL_Texture* texture, int width, int height, const Sampler& sampler) :
@@ -54,4 +56,32 @@ SDLTexture::~SDLTexture()
   SDL_DestroyTexture(m_texture);
 }
 
+void
+SDLTexture::update(const SDL_Surface& image, const Rect& srcrect, int x, int y)
+{
+  if (srcrect.empty())
+    return;
+
+  Uint32 format;
+  if (SDL_QueryTexture(m_texture, &format, nullptr, nullptr, nullptr) != 0)
+  {
+    log_warning << "couldn't update texture: " << SDL_GetError() << std::endl;
+    return;
+  }
+
+  SDLSurfacePtr region = SDLSurface::create_rgba(srcrect.get_width(), srcrect.get_height());
+  SDL_Rect sdl_srcrect = srcrect.to_sdl();
+  SDL_SetSurfaceBlendMode(const_cast<SDL_Surface*>(&image), SDL_BLENDMODE_NONE);
+  SDL_BlitSurface(const_cast<SDL_Surface*>(&image), &sdl_srcrect, region.get(), nullptr);
+
+  SDL_Rect dstrect{x, y, srcrect.get_width(), srcrect.get_height()};
+
+  // SDL_UpdateTexture() takes the pixels in the format of the texture
+  SDLSurfacePtr convert(SDL_ConvertSurfaceFormat(region.get(), format, 0));
+  if (!convert || SDL_UpdateTexture(m_texture, &dstrect, convert->pixels, convert->pitch) != 0)
+  {
+    log_warning << "couldn't update texture: " << SDL_GetError() << std::endl;
+  }
+}
+
 /* EOF */
@@ -28,16 +28,23 @@
 SurfacePtr
 Surface::from_reader(const ReaderMapping& mapping, const boost::optional<Rect>& rect, const std::string& filename)
 {
-  TexturePtr diffuse_texture;
   boost::optional<ReaderMapping> diffuse_texture_mapping;
-  if (mapping.get("diffuse-texture", diffuse_texture_mapping))
+  boost::optional<ReaderMapping> displacement_texture_mapping;
+  mapping.get("diffuse-texture", diffuse_texture_mapping);
+  mapping.get("displacement-texture", displacement_texture_mapping);
+
+  // Both textures would have to share the same region, so only plain
+  // surfaces are drawn from a parent texture
+  Rect view;
+  TexturePtr diffuse_texture;
+  if (diffuse_texture_mapping)
   {
-    diffuse_texture = TextureManager::current()->get(*diffuse_texture_mapping, rect);
+    diffuse_texture = TextureManager::current()->get(*diffuse_texture_mapping, rect,
+                                                     displacement_texture_mapping ? nullptr : &view);
   }
 
   TexturePtr displacement_texture;
-  boost::optional<ReaderMapping> displacement_texture_mapping;
-  if (mapping.get("displacement-texture", displacement_texture_mapping))
+  if (displacement_texture_mapping)
   {
     displacement_texture = TextureManager::current()->get(*displacement_texture_mapping, rect);
   }
@@ -50,6 +57,11 @@ Surface::from_reader(const ReaderMapping& mapping, const boost::optional<Rect>&
     flip ^= flip_v[1] ? VERTICAL_FLIP : NO_FLIP;
   }
 
+  if (diffuse_texture && !displacement_texture)
+  {
+    return SurfacePtr(new Surface(diffuse_texture, displacement_texture, view, flip, filename));
+  }
+
   auto surface = new Surface(diffuse_texture, displacement_texture, flip, filename);
   return SurfacePtr(surface);
 }
@@ -76,8 +88,9 @@ Surface::from_file(const std::string& filename, const boost::optional<Rect>& rec
   {
     if (rect)
     {
-      TexturePtr texture = TextureManager::current()->get(filename, *rect);
-      return SurfacePtr(new Surface(texture, TexturePtr(), NO_FLIP, filename));
+      Rect view;
+      TexturePtr texture = TextureManager::current()->get(filename, *rect, Sampler(), &view);
+      return SurfacePtr(new Surface(texture, TexturePtr(), view, NO_FLIP, filename));
     }
     else
     {
@@ -135,7 +148,7 @@ Surface::region(const Rect& rect) const
 {
   SurfacePtr surface(new Surface(m_diffuse_texture,
                                  m_displacement_texture,
-                                 rect,
+                                 rect.moved(m_region.left, m_region.top),
                                  m_flip));
   return surface;
 }
@@ -152,6 +165,18 @@ Surface::get_displacement_texture() const
   return m_displacement_texture;
 }
 
+Rectf
+Surface::get_texture_rect(const Rectf& srcrect) const
+{
+  return srcrect.moved(Vector(static_cast<float>(m_region.left), static_cast<float>(m_region.top)));
+}
+
+Rectf
+Surface::get_texture_rect() const
+{
+  return get_texture_rect(Rectf(0.0f, 0.0f, static_cast<float>(get_width()), static_cast<float>(get_height())));
+}
+
 int
 Surface::get_width() const
 {
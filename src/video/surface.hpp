@@ -21,6 +21,7 @@
 #include <boost/optional.hpp>
 
 #include "math/rect.hpp"
+#include "math/rectf.hpp"
 #include "math/vector.hpp"
 #include "video/flip.hpp"
 #include "video/surface_ptr.hpp"
@@ -46,12 +47,19 @@ private:
 public:
   ~Surface();
 
+  /** Returns a surface showing \a rect, relative to this surface's region */
   SurfacePtr region(const Rect& rect) const;
   SurfacePtr clone(Flip flip = NO_FLIP) const;
 
   TexturePtr get_texture() const;
   TexturePtr get_displacement_texture() const;
   Rect get_region() const { return m_region; }
+
+  /** Returns \a srcrect, given relative to the surface, in texels of
+      its texture */
+  Rectf get_texture_rect(const Rectf& srcrect) const;
+  Rectf get_texture_rect() const;
+
   int get_width() const;
   int get_height() const;
   Flip get_flip() const { return m_flip; }
@@ -35,9 +35,10 @@ public:
   void draw(const Rectf& dstrect, float angle = 0.0f);
   void draw(const Rectf& srcrect, const Rectf& dstrect, float angle = 0.0f);
 
-  std::vector<Rectf> move_srcrects() { return std::move(m_srcrects); }
-  std::vector<Rectf> move_dstrects() { return std::move(m_dstrects); }
-  std::vector<float> move_angles() { return std::move(m_angles); }
+  const SurfacePtr& get_surface() const { return m_surface; }
+  const std::vector<Rectf>& get_srcrects() const { return m_srcrects; }
+  const std::vector<Rectf>& get_dstrects() const { return m_dstrects; }
+  const std::vector<float>& get_angles() const { return m_angles; }
 
   Color get_color() const { return m_color; }
 
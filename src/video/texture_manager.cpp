@@ -17,8 +17,10 @@
 #include "video/texture_manager.hpp"
 
 #include <SDL_image.h>
+#include <algorithm>
 #include <assert.h>
 #include <sstream>
+#include <thread>
 
 #include "math/rect.hpp"
 #include "physfs/physfs_sdl.hpp"
@@ -26,6 +28,8 @@
 #include "util/log.hpp"
 #include "util/reader_document.hpp"
 #include "util/reader_mapping.hpp"
+#include "util/string_util.hpp"
+#include "util/thread_pool.hpp"
 #include "video/color.hpp"
 #include "video/gl.hpp"
 #include "video/sampler.hpp"
@@ -35,6 +39,59 @@
 
 namespace {
 
+/** Budget for decoded images kept around for cutting out regions */
+const size_t SURFACE_CACHE_SIZE = 16 * 1024 * 1024;
+
+/** Size of the atlas textures that regions of filtered images go to */
+const int ATLAS_PAGE_SIZE = 1024;
+
+size_t get_surface_bytes(const SDL_Surface& surface)
+{
+  return static_cast<size_t>(surface.pitch) * static_cast<size_t>(surface.h);
+}
+
+/** Regions can only be drawn from a shared texture if the sampler
+    never reaches beyond the edges of the region */
+bool can_share_texture(const Sampler& sampler)
+{
+  return sampler.get_wrap_s() == GL_CLAMP_TO_EDGE &&
+         sampler.get_wrap_t() == GL_CLAMP_TO_EDGE &&
+         sampler.get_animate() == Vector(0.0f, 0.0f);
+}
+
+/** Copies \a rect of \a image into a new surface, surrounded by a
+    border of its own edge pixels, one pixel wide */
+SDLSurfacePtr extrude_region(const SDL_Surface& image, const Rect& rect)
+{
+  const int width = rect.get_width();
+  const int height = rect.get_height();
+  SDLSurfacePtr result = SDLSurface::create_rgba(width + 2, height + 2);
+
+  SDL_Surface* src = const_cast<SDL_Surface*>(&image);
+  SDL_SetSurfaceBlendMode(src, SDL_BLENDMODE_NONE);
+  auto blit = [&](const Rect& srcrect, int x, int y) {
+    SDL_Rect sdl_srcrect = srcrect.to_sdl();
+    SDL_Rect dstrect{x, y, srcrect.get_width(), srcrect.get_height()};
+    SDL_BlitSurface(src, &sdl_srcrect, result.get(), &dstrect);
+  };
+
+  blit(rect, 1, 1);
+
+  // edges
+  blit(Rect(rect.left, rect.top, rect.right, rect.top + 1), 1, 0);
+  blit(Rect(rect.left, rect.bottom - 1, rect.right, rect.bottom), 1, height + 1);
+  blit(Rect(rect.left, rect.top, rect.left + 1, rect.bottom), 0, 1);
+  blit(Rect(rect.right - 1, rect.top, rect.right, rect.bottom), width + 1, 1);
+
+  // corners
+  blit(Rect(rect.left, rect.top, rect.left + 1, rect.top + 1), 0, 0);
+  blit(Rect(rect.right - 1, rect.top, rect.right, rect.top + 1), width + 1, 0);
+  blit(Rect(rect.left, rect.bottom - 1, rect.left + 1, rect.bottom), 0, height + 1);
+  blit(Rect(rect.right - 1, rect.bottom - 1, rect.right, rect.bottom), width + 1, height + 1);
+
+  return result;
+}
+
 GLenum string2wrap(const std::string& text)
 {
   if (text == "clamp-to-edge")
@@ -73,11 +130,31 @@ GLenum string2filter(const std::string& text)
   }
 }
 
+/** Same as SDLSurface::from_file(), but safe to call from a worker
+    thread as it doesn't log */
+SDLSurfacePtr decode_image(const std::string& filename)
+{
+  SDLSurfacePtr surface(IMG_Load_RW(get_physfs_SDLRWops(filename), 1));
+  if (!surface)
+  {
+    std::ostringstream msg;
+    msg << "Couldn't load image '" << filename << "' :" << SDL_GetError();
+    throw std::runtime_error(msg.str());
+  }
+  return surface;
+}
+
 } // namespace
 
 TextureManager::TextureManager() :
   m_image_textures(),
-  m_surfaces()
+  m_atlas_pages(),
+  m_atlas_regions(),
+  m_surfaces(),
+  m_surface_cache_bytes(0),
+  m_surface_use_counter(0),
+  m_pending_surfaces(),
+  m_loader()
 {
 }
 
@@ -90,12 +167,21 @@ TextureManager::~TextureManager()
       log_warning << "Texture '" << std::get<0>(texture.first) << "' not freed" << std::endl;
     }
   }
+  if (m_loader)
+  {
+    m_loader->clear();
+    m_loader.reset();
+  }
+
   m_image_textures.clear();
+  m_atlas_pages.clear();
+  m_atlas_regions.clear();
   m_surfaces.clear();
+  m_surface_cache_bytes = 0;
 }
 
 TexturePtr
-TextureManager::get(const ReaderMapping& mapping, const boost::optional<Rect>& region)
+TextureManager::get(const ReaderMapping& mapping, const boost::optional<Rect>& region, Rect* view)
 {
   std::string filename;
   if (!mapping.get("file", filename))
@@ -177,7 +263,7 @@ TextureManager::get(const ReaderMapping& mapping, const boost::optional<Rect>& r
     }
   }
 
-  return get(filename, rect, Sampler(filter, wrap_s, wrap_t, animate));
+  return get(filename, rect, Sampler(filter, wrap_s, wrap_t, animate), view);
 }
 
 TexturePtr
@@ -203,9 +289,36 @@ TextureManager::get(const std::string& _filename)
 TexturePtr
 TextureManager::get(const std::string& _filename,
                     const boost::optional<Rect>& rect,
-                    const Sampler& sampler)
+                    const Sampler& sampler,
+                    Rect* view)
 {
   std::string filename = FileSystem::normalize(_filename);
+
+  if (rect && view && can_share_texture(sampler))
+  {
+    if (sampler.get_filter() == GL_NEAREST)
+    {
+      // Draw the region from the texture of the whole image instead of
+      // uploading a texture of its own
+      TexturePtr parent = get(filename, boost::none, sampler);
+      if (Rect(0, 0, parent->get_image_width(), parent->get_image_height()).contains(*rect))
+      {
+        *view = *rect;
+        return parent;
+      }
+    }
+    else
+    {
+      // Filtering would blend in the pixels around the region in the
+      // whole image, so it gets copied into an atlas instead
+      TexturePtr atlas = get_atlas_region(filename, *rect, sampler, *view);
+      if (atlas)
+      {
+        return atlas;
+      }
+    }
+  }
+
   Texture::Key key;
   if (rect)
   {
@@ -235,6 +348,11 @@ TextureManager::get(const std::string& _filename,
     m_image_textures[key] = texture;
   }
 
+  if (view)
+  {
+    *view = Rect(0, 0, texture->get_image_width(), texture->get_image_height());
+  }
+
   return texture;
 }
 
@@ -253,6 +371,99 @@ TextureManager::reap_cache_entry(const Texture::Key& key)
   }
 }
 
+TexturePtr
+TextureManager::get_atlas_region(const std::string& filename, const Rect& rect, const Sampler& sampler,
+                                 Rect& view)
+{
+  const Texture::Key key(filename, rect);
+  auto it = m_atlas_regions.find(key);
+  if (it != m_atlas_regions.end())
+  {
+    TexturePtr texture = it->second.texture.lock();
+    if (texture)
+    {
+      view = it->second.rect;
+      return texture;
+    }
+    m_atlas_regions.erase(it);
+  }
+
+  // with the border added by extrude_region()
+  const int width = rect.get_width() + 2;
+  const int height = rect.get_height() + 2;
+  if (!rect.valid() || width > ATLAS_PAGE_SIZE || height > ATLAS_PAGE_SIZE)
+    return TexturePtr();
+
+  SDLSurfacePtr region;
+  try
+  {
+    const SDL_Surface& image = get_surface(filename);
+    if (!Rect(0, 0, image.w, image.h).contains(rect))
+      return TexturePtr();
+
+    region = extrude_region(image, rect);
+  }
+  catch(const std::exception&)
+  {
+    // the regular loading path will report the error
+    return TexturePtr();
+  }
+
+  TexturePtr texture;
+  int x, y;
+  if (!allocate_atlas_region(sampler, width, height, texture, x, y))
+    return TexturePtr();
+
+  texture->update(*region, Rect(0, 0, width, height), x, y);
+
+  view = Rect(x + 1, y + 1, x + 1 + rect.get_width(), y + 1 + rect.get_height());
+  m_atlas_regions[key] = AtlasRegion{texture, view};
+  return texture;
+}
+
+bool
+TextureManager::allocate_atlas_region(const Sampler& sampler, int width, int height,
+                                      TexturePtr& texture, int& x, int& y)
+{
+  // Pages are freed once no surface uses any of their regions
+  m_atlas_pages.erase(std::remove_if(m_atlas_pages.begin(), m_atlas_pages.end(),
+                                     [](const AtlasPage& page) { return page.texture.expired(); }),
+                      m_atlas_pages.end());
+
+  for (auto& page : m_atlas_pages)
+  {
+    if (page.filter != sampler.get_filter())
+      continue;
+
+    if (page.shelf_x + width > ATLAS_PAGE_SIZE)
+    {
+      page.shelf_y += page.shelf_height;
+      page.shelf_x = 0;
+      page.shelf_height = 0;
+    }
+
+    if (page.shelf_y + height <= ATLAS_PAGE_SIZE)
+    {
+      texture = page.texture.lock();
+      x = page.shelf_x;
+      y = page.shelf_y;
+      page.shelf_x += width;
+      page.shelf_height = std::max(page.shelf_height, height);
+      return true;
+    }
+  }
+
+  SDLSurfacePtr image = SDLSurface::create_rgba(ATLAS_PAGE_SIZE, ATLAS_PAGE_SIZE);
+  if (!image)
+    return false;
+
+  texture = VideoSystem::current()->new_texture(*image, sampler);
+  m_atlas_pages.push_back(AtlasPage{texture, sampler.get_filter(), width, 0, height});
+  x = 0;
+  y = 0;
+  return true;
+}
+
 TexturePtr
 TextureManager::create_image_texture(const std::string& filename, const Rect& rect, const Sampler& sampler)
 {
@@ -267,17 +478,50 @@ TextureManager::create_image_texture(const std::string& filename, const Rect& re
   }
 }
 
+void
+TextureManager::preload(const std::vector<std::string>& filenames)
+{
+  for (const auto& name : filenames)
+  {
+    std::string filename = FileSystem::normalize(name);
+    if (StringUtil::has_suffix(filename, ".surface") ||
+        m_surfaces.find(filename) != m_surfaces.end() ||
+        m_pending_surfaces.find(filename) != m_pending_surfaces.end())
+    {
+      continue;
+    }
+
+    if (!m_loader)
+    {
+      const int num_threads = std::max(1, std::min(4, static_cast<int>(std::thread::hardware_concurrency()) - 1));
+      m_loader = std::make_unique<ThreadPool>(num_threads);
+    }
+
+    auto task = std::make_shared<std::packaged_task<SDLSurfacePtr ()> >([filename] {
+      return decode_image(filename);
+    });
+    m_pending_surfaces[filename] = task->get_future();
+    m_loader->post([task] { (*task)(); });
+  }
+}
+
 const SDL_Surface&
 TextureManager::get_surface(const std::string& filename)
 {
   auto i = m_surfaces.find(filename);
   if (i != m_surfaces.end())
   {
-    return *i->second;
+    i->second.last_use = ++m_surface_use_counter;
+    return *i->second.surface;
   }
+
   else
   {
-    SDLSurfacePtr image = SDLSurface::from_file(filename);
+    SDLSurfacePtr image = take_preloaded_surface(filename);
+    if (!image)
+    {
+      image = SDLSurface::from_file(filename);
+    }
     if (!image)
     {
       std::ostringstream msg;
@@ -285,8 +529,58 @@ TextureManager::get_surface(const std::string& filename)
       throw std::runtime_error(msg.str());
     }
 
-    return *(m_surfaces[filename] = std::move(image));
+    m_surface_cache_bytes += get_surface_bytes(*image);
+    CachedSurface& entry = m_surfaces[filename];
+    entry.surface = std::move(image);
+    entry.last_use = ++m_surface_use_counter;
+
+    evict_surfaces(filename);
+    return *entry.surface;
+  }
+}
+
+void
+TextureManager::evict_surfaces(const std::string& keep)
+{
+  while (m_surface_cache_bytes > SURFACE_CACHE_SIZE)
+  {
+    auto oldest = m_surfaces.end();
+    for (auto it = m_surfaces.begin(); it != m_surfaces.end(); ++it)
+    {
+      if (it->first != keep &&
+          (oldest == m_surfaces.end() || it->second.last_use < oldest->second.last_use))
+      {
+        oldest = it;
+      }
+    }
+
+    if (oldest == m_surfaces.end())
+      return;
+
+    m_surface_cache_bytes -= get_surface_bytes(*oldest->second.surface);
+    m_surfaces.erase(oldest);
+  }
+}
+
+SDLSurfacePtr
+TextureManager::take_preloaded_surface(const std::string& filename)
+{
+  auto pending = m_pending_surfaces.find(filename);
+  if (pending == m_pending_surfaces.end())
+    return SDLSurfacePtr();
+
+  SDLSurfacePtr image;
+  try
+  {
+    image = pending->second.get();
+  }
+  catch(const std::exception& err)
+  {
+    // the regular loading path will report the error
+    log_debug << "Preloading image failed: " << err.what() << std::endl;
   }
+  m_pending_surfaces.erase(pending);
+  return image;
 }
 
 TexturePtr
@@ -369,7 +663,11 @@ TextureManager::create_image_texture(const std::string& filename, const Sampler&
 TexturePtr
 TextureManager::create_image_texture_raw(const std::string& filename, const Sampler& sampler)
 {
-  SDLSurfacePtr image = SDLSurface::from_file(filename);
+  SDLSurfacePtr image = take_preloaded_surface(filename);
+  if (!image)
+  {
+    image = SDLSurface::from_file(filename);
+  }
   if (!image)
   {
     std::ostringstream msg;
@@ -416,14 +714,16 @@ TextureManager::create_dummy_texture()
 void
 TextureManager::debug_print(std::ostream& out) const
 {
+  size_t live_texture_count = 0;
   size_t total_texture_pixels = 0;
   out << "textures:begin" << std::endl;
   for(const auto& it : m_image_textures)
   {
     const auto& key = it.first;
 
-    if (it.second.lock()) {
-      total_texture_pixels += std::get<1>(key).get_area();
+    if (auto texture = it.second.lock()) {
+      live_texture_count += 1;
+      total_texture_pixels += texture->get_image_width() * texture->get_image_height();
     }
 
     out << "  texture "
@@ -432,12 +732,22 @@ TextureManager::debug_print(std::ostream& out) const
   }
   out << "textures:end" << std::endl;
 
+  size_t live_atlas_count = 0;
+  for (const auto& page : m_atlas_pages)
+  {
+    if (auto texture = page.texture.lock()) {
+      live_atlas_count += 1;
+      live_texture_count += 1;
+      total_texture_pixels += texture->get_image_width() * texture->get_image_height();
+    }
+  }
+
   size_t total_surface_pixels = 0;
   out << "surfaces:begin" << std::endl;
   for(const auto& it : m_surfaces)
   {
     const auto& filename = it.first;
-    const auto& surface = it.second;
+    const auto& surface = it.second.surface;
 
     total_surface_pixels += surface->w * surface->h;
     out << "  surface filename:" << filename << " " << surface->w << "x" << surface->h << std::endl;
@@ -445,10 +755,14 @@ TextureManager::debug_print(std::ostream& out) const
   out << "surfaces:end" << std::endl;
 
   out << "total texture count:" << m_image_textures.size() << std::endl;
+  out << "live texture count:" << live_texture_count << std::endl;
+  out << "live atlas count:" << live_atlas_count << std::endl;
+  out << "total atlas regions:" << m_atlas_regions.size() << std::endl;
   out << "total texture pixels:" << total_texture_pixels << std::endl;
 
   out << "total surface count:" << m_surfaces.size() << std::endl;
   out << "total surface pixels:" << total_surface_pixels << std::endl;
+  out << "total surface bytes:" << m_surface_cache_bytes << std::endl;
 }
 
 /* EOF */
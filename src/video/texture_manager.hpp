@@ -18,6 +18,7 @@
 #define HEADER_SUPERTUX_VIDEO_TEXTURE_MANAGER_HPP
 
 #include <config.h>
+#include <future>
 #include <map>
 #include <memory>
 #include <ostream>
@@ -35,6 +36,7 @@
 
 class GLTexture;
 class ReaderMapping;
+class ThreadPool;
 struct SDL_Surface;
 
 class TextureManager final : public Currenton<TextureManager>
@@ -46,18 +48,43 @@ public:
   TextureManager();
   ~TextureManager() override;
 
-  TexturePtr get(const ReaderMapping& mapping, const boost::optional<Rect>& region = boost::none);
+  /** If \a view is given, a sub-region of an image may be returned
+      as a texture shared with other images, with \a view set to the
+      region to draw from it. Otherwise the returned texture contains
+      just the requested region. */
+  TexturePtr get(const ReaderMapping& mapping, const boost::optional<Rect>& region = boost::none,
+                 Rect* view = nullptr);
   TexturePtr get(const std::string& filename);
   TexturePtr get(const std::string& filename,
                  const boost::optional<Rect>& rect,
-                 const Sampler& sampler = Sampler());
+                 const Sampler& sampler = Sampler(),
+                 Rect* view = nullptr);
+
+  /** Decodes the given image files on background threads, so that
+      creating textures from them later only has to upload them */
+  void preload(const std::vector<std::string>& filenames);
 
   void debug_print(std::ostream& out) const;
 
 private:
   const SDL_Surface& get_surface(const std::string& filename);
+
+  /** Drops least recently used decoded images until the cache fits
+      into its budget, \a keep is never dropped */
+  void evict_surfaces(const std::string& keep);
+
+  /** Returns the image decoded by preload(), waiting for it if
+      necessary, or nullptr if the file wasn't preloaded */
+  SDLSurfacePtr take_preloaded_surface(const std::string& filename);
   void reap_cache_entry(const Texture::Key& key);
 
+  /** Copies a region of a filtered image into a shared atlas texture,
+      returns nullptr if it doesn't fit or can't be loaded */
+  TexturePtr get_atlas_region(const std::string& filename, const Rect& rect, const Sampler& sampler,
+                              Rect& view);
+  bool allocate_atlas_region(const Sampler& sampler, int width, int height,
+                             TexturePtr& texture, int& x, int& y);
+
   TexturePtr create_image_texture(const std::string& filename, const Rect& rect, const Sampler& sampler);
 
   /** on failure a dummy texture is returned and no exception is thrown */
@@ -71,7 +98,42 @@ private:
 
 private:
   std::map<Texture::Key, std::weak_ptr<Texture> > m_image_textures;
-  std::map<std::string, SDLSurfacePtr> m_surfaces;
+
+  /** A texture that regions of linear filtered images are packed into
+      shelf by shelf. Each region is surrounded by a copy of its edge
+      pixels, so that filtering doesn't blend in its neighbours. */
+  struct AtlasPage
+  {
+    std::weak_ptr<Texture> texture;
+    GLenum filter;
+    int shelf_x;
+    int shelf_y;
+    int shelf_height;
+  };
+
+  struct AtlasRegion
+  {
+    std::weak_ptr<Texture> texture;
+    Rect rect;
+  };
+
+  std::vector<AtlasPage> m_atlas_pages;
+  std::map<Texture::Key, AtlasRegion> m_atlas_regions;
+  struct CachedSurface
+  {
+    SDLSurfacePtr surface;
+    size_t last_use;
+  };
+
+  /** Decoded images that regions are cut from. Only needed until the
+      textures are uploaded, so they get evicted to stay in budget. */
+  std::map<std::string, CachedSurface> m_surfaces;
+  size_t m_surface_cache_bytes;
+  size_t m_surface_use_counter;
+
+  /** Images that are still being decoded by m_loader */
+  std::map<std::string, std::future<SDLSurfacePtr> > m_pending_surfaces;
+  std::unique_ptr<ThreadPool> m_loader;
 
 private:
   TextureManager(const TextureManager&) = delete;
@@ -26,6 +26,7 @@
 #include "util/log.hpp"
 #include "video/canvas.hpp"
 #include "video/surface.hpp"
+#include "video/ttf_glyph_atlas.hpp"
 #include "video/ttf_surface_manager.hpp"
 
 TTFFont::TTFFont(const std::string& filename, int font_size, float line_spacing, int shadow_size, int border) :
@@ -34,7 +35,8 @@ TTFFont::TTFFont(const std::string& filename, int font_size, float line_spacing,
   m_font_size(font_size),
   m_line_spacing(line_spacing),
   m_shadow_size(shadow_size),
-  m_border(border)
+  m_border(border),
+  m_glyph_atlas()
 {
   m_font = TTF_OpenFontRW(get_physfs_SDLRWops(m_filename), 1, font_size);
   if (!m_font)
@@ -58,6 +60,16 @@ TTFFont::get_text_width(const std::string& text) const
 
   float max_width = 0.0f;
 
+  if (TTFSurfaceManager::current()->get_glyph_atlas_enabled())
+  {
+    LineIterator iter(text);
+    while (iter.next())
+    {
+      max_width = std::max(max_width, get_glyph_atlas().get_line_width(iter.get()));
+    }
+    return max_width;
+  }
+
   LineIterator iter(text);
   while (iter.next())
   {
@@ -103,6 +115,12 @@ TTFFont::draw_text(Canvas& canvas, const std::string& text,
                    const Vector& pos, FontAlignment alignment, int layer, const Color& color)
 
 {
+  if (TTFSurfaceManager::current()->get_glyph_atlas_enabled())
+  {
+    draw_text_from_atlas(canvas, text, pos, alignment, layer, color);
+    return;
+  }
+
   float last_y = pos.y - (static_cast<float>(TTF_FontHeight(m_font)) - get_height()) / 2.0f;
 
   LineIterator iter(text);
@@ -133,6 +151,81 @@ TTFFont::draw_text(Canvas& canvas, const std::string& text,
   }
 }
 
+void
+TTFFont::draw_text_from_atlas(Canvas& canvas, const std::string& text,
+                              const Vector& pos, FontAlignment alignment, int layer, const Color& color)
+{
+  TTFGlyphAtlas& atlas = get_glyph_atlas();
+
+  // Glyph quads overlap, translucent text has to be blended as a
+  // whole line so that the overlaps don't come out darker. The lines
+  // are composed from the atlas, so they have the same metrics.
+  if (color.alpha < 1.0f)
+  {
+    float last_y = pos.y - (static_cast<float>(TTF_FontHeight(m_font)) - get_height()) / 2.0f;
+
+    LineIterator iter(text);
+    while (iter.next())
+    {
+      const std::string& line = iter.get();
+      if (!line.empty())
+      {
+        TTFSurfacePtr ttf_surface = TTFSurfaceManager::current()->create_surface(*this, line);
+        if (ttf_surface->get_surface())
+        {
+          canvas.draw_surface(ttf_surface->get_surface(),
+                              atlas.get_line_origin(line, Vector(pos.x, last_y), alignment) + ttf_surface->get_offset(),
+                              0.0f, color, Blend(), layer);
+        }
+      }
+      last_y += get_height();
+    }
+    return;
+  }
+
+  TTFGlyphAtlas::Batch batch;
+
+  // A full atlas gets cleared while adding glyphs, in which case the
+  // text is laid out once more against the fresh atlas
+  for (int attempt = 0; attempt < 2; ++attempt)
+  {
+    batch.clear();
+
+    bool valid = true;
+    float last_y = pos.y - (static_cast<float>(TTF_FontHeight(m_font)) - get_height()) / 2.0f;
+
+    LineIterator iter(text);
+    while (iter.next())
+    {
+      const std::string& line = iter.get();
+      if (!line.empty())
+      {
+        valid = atlas.layout_line(line, Vector(pos.x, last_y), alignment, batch) && valid;
+      }
+      last_y += get_height();
+    }
+
+    if (valid)
+      break;
+  }
+
+  batch.finish();
+  if (batch.srcrects.empty())
+    return;
+
+  canvas.draw_surface_batch(atlas.get_surface(), batch.srcrects, batch.dstrects, color, layer);
+}
+
+TTFGlyphAtlas&
+TTFFont::get_glyph_atlas() const
+{
+  if (!m_glyph_atlas)
+  {
+    m_glyph_atlas.reset(new TTFGlyphAtlas(*this));
+  }
+  return *m_glyph_atlas;
+}
+
 std::string
 TTFFont::wrap_to_width(const std::string& text, float width, std::string* overflow)
 {
@@ -20,12 +20,15 @@
 
 #include <SDL_ttf.h>
 
+#include <memory>
+
 #include "math/fwd.hpp"
 #include "video/color.hpp"
 #include "video/font.hpp"
 
 class Canvas;
 class Painter;
+class TTFGlyphAtlas;
 
 class TTFFont final : public Font
 {
@@ -54,6 +57,13 @@ public:
 
   TTF_Font* get_ttf_font() const { return m_font; }
 
+  /** Created on first use, only valid in glyph atlas mode */
+  TTFGlyphAtlas& get_glyph_atlas() const;
+
+private:
+  void draw_text_from_atlas(Canvas& canvas, const std::string& text,
+                            const Vector& pos, FontAlignment alignment, int layer, const Color& color);
+
 private:
   TTF_Font* m_font;
   std::string m_filename;
@@ -62,6 +72,9 @@ private:
   int m_shadow_size;
   int m_border;
 
+  /** Created on first use when TTFSurfaceManager is in glyph atlas mode */
+  mutable std::unique_ptr<TTFGlyphAtlas> m_glyph_atlas;
+
 private:
   TTFFont(const TTFFont&) = delete;
   TTFFont& operator=(const TTFFont&) = delete;
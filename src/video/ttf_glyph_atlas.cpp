@@ -0,0 +1,474 @@
+//  SuperTux
+//  Copyright (C) 2024 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "video/ttf_glyph_atlas.hpp"
+
+#include <SDL_ttf.h>
+
+#include <algorithm>
+#include <tuple>
+
+#include "supertux/globals.hpp"
+#include "util/log.hpp"
+#include "util/utf8_iterator.hpp"
+#include "video/sdl_surface.hpp"
+#include "video/surface.hpp"
+#include "video/ttf_font.hpp"
+#include "video/ttf_surface_manager.hpp"
+#include "video/video_system.hpp"
+
+#if SDL_VERSIONNUM(SDL_TTF_MAJOR_VERSION, SDL_TTF_MINOR_VERSION, SDL_TTF_PATCHLEVEL) >= SDL_VERSIONNUM(2, 0, 18)
+#  define TTF_GLYPH_ATLAS_HAVE_GLYPH32
+#endif
+
+#if SDL_VERSIONNUM(SDL_TTF_MAJOR_VERSION, SDL_TTF_MINOR_VERSION, SDL_TTF_PATCHLEVEL) >= SDL_VERSIONNUM(2, 0, 14)
+#  define TTF_GLYPH_ATLAS_HAVE_KERNING
+#endif
+
+namespace {
+
+const int ATLAS_WIDTH = 512;
+const int ATLAS_INITIAL_HEIGHT = 256;
+const int ATLAS_MAX_HEIGHT = 2048;
+
+/** Empty space between cells, avoids bleeding with linear filtering */
+const int CELL_PADDING = 1;
+
+/** How long a replaced atlas texture is kept alive */
+const float RETIRED_SURFACE_LIFETIME = 1.0f;
+
+SDLSurfacePtr create_atlas_surface(int width, int height)
+{
+  SDLSurfacePtr surface = SDLSurface::create_rgba(width, height);
+#if !SDL_VERSION_ATLEAST(2,0,5)
+  // Perform blitting in ARGB8888, instead of RGBA8888, to avoid bug in older SDL2.
+  // https://bugzilla.libsdl.org/show_bug.cgi?id=3159
+  surface.reset(SDL_ConvertSurfaceFormat(surface.get(), SDL_PIXELFORMAT_ARGB8888, 0));
+#endif
+  return surface;
+}
+
+SDL_Surface* render_glyph(TTF_Font* font, uint32_t codepoint)
+{
+#ifdef TTF_GLYPH_ATLAS_HAVE_GLYPH32
+  return TTF_RenderGlyph32_Blended(font, codepoint, SDL_Color{255, 255, 255, 255});
+#else
+  if (codepoint > 0xffff)
+    codepoint = 0xfffd;
+  return TTF_RenderGlyph_Blended(font, static_cast<Uint16>(codepoint), SDL_Color{255, 255, 255, 255});
+#endif
+}
+
+int get_glyph_advance(TTF_Font* font, uint32_t codepoint)
+{
+  int minx, maxx, miny, maxy, advance = 0;
+#ifdef TTF_GLYPH_ATLAS_HAVE_GLYPH32
+  TTF_GlyphMetrics32(font, codepoint, &minx, &maxx, &miny, &maxy, &advance);
+#else
+  if (codepoint > 0xffff)
+    codepoint = 0xfffd;
+  TTF_GlyphMetrics(font, static_cast<Uint16>(codepoint), &minx, &maxx, &miny, &maxy, &advance);
+#endif
+  return advance;
+}
+
+} // namespace
+
+void
+TTFGlyphAtlas::Batch::clear()
+{
+  srcrects.clear();
+  dstrects.clear();
+  m_core_srcrects.clear();
+  m_core_dstrects.clear();
+}
+
+void
+TTFGlyphAtlas::Batch::finish()
+{
+  srcrects.insert(srcrects.end(), m_core_srcrects.begin(), m_core_srcrects.end());
+  dstrects.insert(dstrects.end(), m_core_dstrects.begin(), m_core_dstrects.end());
+  m_core_srcrects.clear();
+  m_core_dstrects.clear();
+}
+
+TTFGlyphAtlas::TTFGlyphAtlas(const TTFFont& font) :
+  m_font(font),
+  m_decoration_left(),
+  m_decoration_right(),
+  m_atlas(create_atlas_surface(ATLAS_WIDTH, ATLAS_INITIAL_HEIGHT)),
+  m_glyphs(),
+  m_shelf_x(0),
+  m_shelf_y(0),
+  m_shelf_height(0),
+  m_cleared(false),
+  m_dirty_rect(),
+  m_surface(),
+  m_retired_surfaces()
+{
+  // Same offsets as used by TTFSurface::create()
+  const int border = std::min(2, font.get_border());
+  const int shadow_size = std::min(2, font.get_shadow_size());
+
+  m_decoration_left = border;
+  m_decoration_right = std::max(border, shadow_size > 0 ? 2 + (shadow_size - 1) : 0);
+}
+
+bool
+TTFGlyphAtlas::layout_line(const std::string& line, const Vector& pos, FontAlignment alignment, Batch& batch)
+{
+  m_cleared = false;
+
+  // Rasterizes all missing glyphs before any of them gets placed
+  const Vector origin = get_line_origin(line, pos, alignment);
+
+  float x = origin.x;
+  uint32_t prev = 0;
+  for (UTF8Iterator it(line); !it.done(); ++it)
+  {
+    const uint32_t codepoint = *it;
+    if (prev != 0)
+    {
+      x += static_cast<float>(get_kerning(prev, codepoint));
+    }
+
+    const Glyph& glyph = get_glyph(codepoint);
+    if (glyph.decoration.get_width() > 0.0f)
+    {
+      const float offset = static_cast<float>(m_decoration_left);
+      batch.srcrects.push_back(glyph.decoration);
+      batch.dstrects.push_back(Rectf(Vector(x - offset, origin.y - offset), glyph.decoration.get_size()));
+    }
+    if (glyph.core.get_width() > 0.0f)
+    {
+      batch.m_core_srcrects.push_back(glyph.core);
+      batch.m_core_dstrects.push_back(Rectf(Vector(x, origin.y), glyph.core.get_size()));
+    }
+
+    x += static_cast<float>(glyph.advance);
+    prev = codepoint;
+  }
+
+  return !m_cleared;
+}
+
+float
+TTFGlyphAtlas::get_line_width(const std::string& line)
+{
+  int width = 0;
+  uint32_t prev = 0;
+  for (UTF8Iterator it(line); !it.done(); ++it)
+  {
+    const uint32_t codepoint = *it;
+    if (prev != 0)
+    {
+      width += get_kerning(prev, codepoint);
+    }
+    width += get_glyph(codepoint).advance;
+    prev = codepoint;
+  }
+
+  const int grow = std::max(m_font.get_border() * 2, m_font.get_shadow_size() * 2);
+  return static_cast<float>(width + grow);
+}
+
+Vector
+TTFGlyphAtlas::get_line_origin(const std::string& line, const Vector& pos, FontAlignment alignment)
+{
+  const float width = get_line_width(line);
+
+  Vector origin = pos;
+  if (alignment == ALIGN_CENTER)
+  {
+    origin.x -= width / 2.0f;
+  }
+  else if (alignment == ALIGN_RIGHT)
+  {
+    origin.x -= width;
+  }
+  return glm::floor(origin);
+}
+
+SDLSurfacePtr
+TTFGlyphAtlas::render_line(const std::string& line, Vector& offset)
+{
+  Batch batch;
+  for (int attempt = 0; attempt < 2; ++attempt)
+  {
+    batch.clear();
+    if (layout_line(line, Vector(0.0f, 0.0f), ALIGN_LEFT, batch))
+      break;
+  }
+  batch.finish();
+
+  if (batch.dstrects.empty())
+    return SDLSurfacePtr();
+
+  Rectf bounds = batch.dstrects.front();
+  for (const auto& rect : batch.dstrects)
+  {
+    bounds = Rectf(std::min(bounds.get_left(), rect.get_left()), std::min(bounds.get_top(), rect.get_top()),
+                   std::max(bounds.get_right(), rect.get_right()), std::max(bounds.get_bottom(), rect.get_bottom()));
+  }
+  offset = bounds.p1();
+
+  SDLSurfacePtr surface = create_atlas_surface(static_cast<int>(bounds.get_width()),
+                                               static_cast<int>(bounds.get_height()));
+
+  // Blended at full opacity, the text as a whole gets the alpha when drawn
+  SDL_SetSurfaceBlendMode(m_atlas.get(), SDL_BLENDMODE_BLEND);
+  for (size_t i = 0; i < batch.srcrects.size(); ++i)
+  {
+    SDL_Rect srcrect = Rect(batch.srcrects[i]).to_sdl();
+    SDL_Rect dstrect = Rect(batch.dstrects[i].moved(-offset)).to_sdl();
+    SDL_BlitSurface(m_atlas.get(), &srcrect, surface.get(), &dstrect);
+  }
+
+#if !SDL_VERSION_ATLEAST(2,0,5)
+  surface.reset(SDL_ConvertSurfaceFormat(surface.get(), SDL_PIXELFORMAT_RGBA8888, 0));
+#endif
+
+  return surface;
+}
+
+SurfacePtr
+TTFGlyphAtlas::get_surface()
+{
+  if (!m_surface)
+  {
+    m_retired_surfaces.erase(std::remove_if(m_retired_surfaces.begin(), m_retired_surfaces.end(),
+                                            [](const std::pair<float, SurfacePtr>& retired) {
+                                              return g_real_time - retired.first > RETIRED_SURFACE_LIFETIME;
+                                            }),
+                             m_retired_surfaces.end());
+
+#if !SDL_VERSION_ATLEAST(2,0,5)
+    SDLSurfacePtr converted(SDL_ConvertSurfaceFormat(m_atlas.get(), SDL_PIXELFORMAT_RGBA8888, 0));
+    m_surface = Surface::from_texture(VideoSystem::current()->new_texture(*converted));
+#else
+    m_surface = Surface::from_texture(VideoSystem::current()->new_texture(*m_atlas));
+#endif
+    TTFSurfaceManager::current()->count_texture_upload(m_atlas->w * m_atlas->h);
+  }
+  else if (!m_dirty_rect.empty())
+  {
+    // New glyphs only go to unused cells, so quads of the current frame
+    // that were laid out before stay valid
+    m_surface->get_texture()->update(*m_atlas, m_dirty_rect, m_dirty_rect.left, m_dirty_rect.top);
+    TTFSurfaceManager::current()->count_texture_upload(m_dirty_rect.get_area());
+  }
+  m_dirty_rect = Rect();
+
+  return m_surface;
+}
+
+const TTFGlyphAtlas::Glyph&
+TTFGlyphAtlas::get_glyph(uint32_t codepoint)
+{
+  auto it = m_glyphs.find(codepoint);
+  if (it != m_glyphs.end())
+    return it->second;
+
+  return m_glyphs.emplace(codepoint, create_glyph(codepoint)).first->second;
+}
+
+TTFGlyphAtlas::Glyph
+TTFGlyphAtlas::create_glyph(uint32_t codepoint)
+{
+  Glyph glyph;
+  glyph.advance = get_glyph_advance(m_font.get_ttf_font(), codepoint);
+
+  SDLSurfacePtr glyph_surface(render_glyph(m_font.get_ttf_font(), codepoint));
+  if (!glyph_surface)
+  {
+    // Whitespace and unsupported characters only advance the pen
+    return glyph;
+  }
+
+  const int w = glyph_surface->w;
+  const int h = glyph_surface->h;
+  const int margin = m_decoration_left + m_decoration_right;
+  const bool has_decoration = margin > 0;
+
+  // Decoration and core share a single cell, so that clearing the
+  // atlas can't happen in between their allocations
+  const int deco_width = has_decoration ? w + margin + CELL_PADDING : 0;
+  int deco_x, deco_y;
+  if (!allocate(deco_width + w, h + margin, deco_x, deco_y))
+  {
+    log_warning << "Glyph " << codepoint << " doesn't fit into the glyph atlas" << std::endl;
+    return glyph;
+  }
+  const int core_x = deco_x + deco_width;
+  const int core_y = deco_y;
+
+  if (has_decoration)
+  {
+    // The decoration cell has its glyph origin at (m_decoration_left, m_decoration_left)
+    const int origin_x = deco_x + m_decoration_left;
+    const int origin_y = deco_y + m_decoration_left;
+
+    { // shadow
+      SDL_SetSurfaceAlphaMod(glyph_surface.get(), 192);
+      SDL_SetSurfaceColorMod(glyph_surface.get(), 0, 0, 0);
+      SDL_SetSurfaceBlendMode(glyph_surface.get(), SDL_BLENDMODE_BLEND);
+
+      using P = std::tuple<int, int>;
+      const std::initializer_list<std::tuple<int, int> > positions[] = {
+        {},
+        {P{0, 0}},
+        {P{-1, 0}, P{1, 0}, P{0, -1}, P{0, 1}}
+      };
+
+      const int shadow_size = std::min(2, m_font.get_shadow_size());
+      for (const auto& p : positions[shadow_size])
+      {
+        SDL_Rect dstrect{origin_x + std::get<0>(p) + 2, origin_y + std::get<1>(p) + 2, w, h};
+        SDL_BlitSurface(glyph_surface.get(), nullptr, m_atlas.get(), &dstrect);
+      }
+    }
+
+    { // outline
+      SDL_SetSurfaceAlphaMod(glyph_surface.get(), 255);
+      SDL_SetSurfaceColorMod(glyph_surface.get(), 0, 0, 0);
+      SDL_SetSurfaceBlendMode(glyph_surface.get(), SDL_BLENDMODE_BLEND);
+
+      using P = std::tuple<int, int>;
+      const std::initializer_list<std::tuple<int, int> > positions[] = {
+        {},
+        {P{-1, 0}, P{1, 0}, P{0, -1}, P{0, 1}},
+        {P{-2, 0}, P{2, 0}, P{0, -2}, P{0, 2},
+         P{-1, -1}, P{1, -1}, P{-1, 1}, P{1, 1}}
+      };
+
+      const int border = std::min(2, m_font.get_border());
+      for (const auto& p : positions[border])
+      {
+        SDL_Rect dstrect{origin_x + std::get<0>(p), origin_y + std::get<1>(p), w, h};
+        SDL_BlitSurface(glyph_surface.get(), nullptr, m_atlas.get(), &dstrect);
+      }
+    }
+
+    glyph.decoration = Rectf(static_cast<float>(deco_x), static_cast<float>(deco_y),
+                             static_cast<float>(deco_x + w + margin), static_cast<float>(deco_y + h + margin));
+  }
+
+  { // white core
+    SDL_SetSurfaceAlphaMod(glyph_surface.get(), 255);
+    SDL_SetSurfaceColorMod(glyph_surface.get(), 255, 255, 255);
+    SDL_SetSurfaceBlendMode(glyph_surface.get(), SDL_BLENDMODE_BLEND);
+
+    SDL_Rect dstrect{core_x, core_y, w, h};
+    SDL_BlitSurface(glyph_surface.get(), nullptr, m_atlas.get(), &dstrect);
+
+    glyph.core = Rectf(static_cast<float>(core_x), static_cast<float>(core_y),
+                       static_cast<float>(core_x + w), static_cast<float>(core_y + h));
+  }
+
+  const Rect cell(deco_x, deco_y, core_x + w, deco_y + h + margin);
+  m_dirty_rect = m_dirty_rect.empty() ? cell :
+    Rect(std::min(m_dirty_rect.left, cell.left), std::min(m_dirty_rect.top, cell.top),
+         std::max(m_dirty_rect.right, cell.right), std::max(m_dirty_rect.bottom, cell.bottom));
+  return glyph;
+}
+
+bool
+TTFGlyphAtlas::allocate(int width, int height, int& x, int& y)
+{
+  if (width + CELL_PADDING > ATLAS_WIDTH || height + CELL_PADDING > ATLAS_MAX_HEIGHT)
+    return false;
+
+  while (true)
+  {
+    if (m_shelf_x + width + CELL_PADDING > ATLAS_WIDTH)
+    {
+      m_shelf_y += m_shelf_height;
+      m_shelf_x = 0;
+      m_shelf_height = 0;
+    }
+
+    if (m_shelf_y + height + CELL_PADDING <= m_atlas->h)
+      break;
+
+    if (m_atlas->h < ATLAS_MAX_HEIGHT)
+    {
+      grow();
+    }
+    else
+    {
+      clear();
+    }
+  }
+
+  x = m_shelf_x;
+  y = m_shelf_y;
+  m_shelf_x += width + CELL_PADDING;
+  m_shelf_height = std::max(m_shelf_height, height + CELL_PADDING);
+  return true;
+}
+
+void
+TTFGlyphAtlas::grow()
+{
+  SDLSurfacePtr atlas = create_atlas_surface(m_atlas->w, std::min(m_atlas->h * 2, ATLAS_MAX_HEIGHT));
+
+  // Cells keep their position, so already laid out glyphs stay valid
+  SDL_SetSurfaceBlendMode(m_atlas.get(), SDL_BLENDMODE_NONE);
+  SDL_BlitSurface(m_atlas.get(), nullptr, atlas.get(), nullptr);
+
+  m_atlas = std::move(atlas);
+  retire_surface();
+}
+
+void
+TTFGlyphAtlas::clear()
+{
+  log_debug << "Glyph atlas is full, clearing " << m_glyphs.size() << " glyphs" << std::endl;
+
+  SDL_FillRect(m_atlas.get(), nullptr, 0);
+  m_glyphs.clear();
+  m_shelf_x = 0;
+  m_shelf_y = 0;
+  m_shelf_height = 0;
+  m_cleared = true;
+  retire_surface();
+}
+
+void
+TTFGlyphAtlas::retire_surface()
+{
+  if (m_surface)
+  {
+    m_retired_surfaces.emplace_back(g_real_time, std::move(m_surface));
+  }
+  m_dirty_rect = Rect();
+}
+
+int
+TTFGlyphAtlas::get_kerning(uint32_t prev, uint32_t codepoint) const
+{
+#if defined(TTF_GLYPH_ATLAS_HAVE_GLYPH32)
+  return TTF_GetFontKerningSizeGlyphs32(m_font.get_ttf_font(), prev, codepoint);
+#elif defined(TTF_GLYPH_ATLAS_HAVE_KERNING)
+  if (prev > 0xffff || codepoint > 0xffff)
+    return 0;
+  return TTF_GetFontKerningSizeGlyphs(m_font.get_ttf_font(), static_cast<Uint16>(prev), static_cast<Uint16>(codepoint));
+#else
+  return 0;
+#endif
+}
+
+/* EOF */
@@ -0,0 +1,141 @@
+//  SuperTux
+//  Copyright (C) 2024 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef HEADER_SUPERTUX_VIDEO_TTF_GLYPH_ATLAS_HPP
+#define HEADER_SUPERTUX_VIDEO_TTF_GLYPH_ATLAS_HPP
+
+#include <stdint.h>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "math/rect.hpp"
+#include "math/rectf.hpp"
+#include "video/font.hpp"
+#include "video/sdl_surface_ptr.hpp"
+#include "video/surface_ptr.hpp"
+
+class TTFFont;
+
+/** Rasterizes the glyphs of a TTFFont once into a shared texture, so
+    that text can be drawn as a single batch of quads instead of
+    rendering and uploading a new texture for every distinct string.
+    Shadow and border are baked into a separate cell per glyph, which
+    is drawn below all glyph cores of the same text. */
+class TTFGlyphAtlas final
+{
+public:
+  /** Source and destination rectangles of a laid out text, ready to
+      be passed to Canvas::draw_surface_batch() */
+  struct Batch
+  {
+    Batch() : srcrects(), dstrects(), m_core_srcrects(), m_core_dstrects() {}
+
+    void clear();
+
+    /** Appends the glyph cores behind the decorations */
+    void finish();
+
+    std::vector<Rectf> srcrects;
+    std::vector<Rectf> dstrects;
+
+  private:
+    friend class TTFGlyphAtlas;
+
+    std::vector<Rectf> m_core_srcrects;
+    std::vector<Rectf> m_core_dstrects;
+  };
+
+public:
+  TTFGlyphAtlas(const TTFFont& font);
+
+  /** Appends the glyphs of a single line to @a batch and returns
+      false if the atlas had to be cleared in the process, which
+      invalidates all previously laid out glyphs */
+  bool layout_line(const std::string& line, const Vector& pos, FontAlignment alignment, Batch& batch);
+
+  /** Width of a single line of text, including shadow and border */
+  float get_line_width(const std::string& line);
+
+  /** Pen position of a line drawn at @a pos with @a alignment */
+  Vector get_line_origin(const std::string& line, const Vector& pos, FontAlignment alignment);
+
+  /** Composes a single line into a surface of its own, for
+      translucent text, whose overlapping quads can't be blended one
+      by one. @a offset receives the position of the surface relative
+      to the pen position. */
+  SDLSurfacePtr render_line(const std::string& line, Vector& offset);
+
+  /** Returns the atlas texture, uploading only the area of the
+      glyphs added since the last call */
+  SurfacePtr get_surface();
+
+private:
+  struct Glyph
+  {
+    Glyph() : core(), decoration(), advance(0) {}
+
+    Rectf core;
+    Rectf decoration;
+    int advance;
+  };
+
+private:
+  const Glyph& get_glyph(uint32_t codepoint);
+  Glyph create_glyph(uint32_t codepoint);
+  bool allocate(int width, int height, int& x, int& y);
+  void grow();
+  void clear();
+  /** Keeps the current texture alive for the rest of the frame and
+      makes the next get_surface() create a new one */
+  void retire_surface();
+  int get_kerning(uint32_t prev, uint32_t codepoint) const;
+
+private:
+  const TTFFont& m_font;
+
+  /** Extent of the shadow and border around the glyph core */
+  int m_decoration_left;
+  int m_decoration_right;
+
+  SDLSurfacePtr m_atlas;
+  std::unordered_map<uint32_t, Glyph> m_glyphs;
+
+  /** Shelf packer state */
+  int m_shelf_x;
+  int m_shelf_y;
+  int m_shelf_height;
+
+  /** Set when m_glyphs was cleared during the current layout */
+  bool m_cleared;
+
+  /** Area of m_atlas that changed since the last upload */
+  Rect m_dirty_rect;
+  SurfacePtr m_surface;
+
+  /** Textures replaced by a newer upload, kept around for a moment
+      since requests of the current frame may still refer to them */
+  std::vector<std::pair<float, SurfacePtr> > m_retired_surfaces;
+
+private:
+  TTFGlyphAtlas(const TTFGlyphAtlas&) = delete;
+  TTFGlyphAtlas& operator=(const TTFGlyphAtlas&) = delete;
+};
+
+#endif
+
+/* EOF */
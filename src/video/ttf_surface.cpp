@@ -24,12 +24,18 @@
 #include "video/sdl_surface.hpp"
 #include "video/surface.hpp"
 #include "video/ttf_font.hpp"
+#include "video/ttf_glyph_atlas.hpp"
 #include "video/ttf_surface_manager.hpp"
 #include "video/video_system.hpp"
 
 TTFSurfacePtr
 TTFSurface::create(const TTFFont& font, const std::string& text)
 {
+  if (TTFSurfaceManager::current()->get_glyph_atlas_enabled())
+  {
+    return create_from_atlas(font, text);
+  }
+
   SDLSurfacePtr text_surface(TTF_RenderUTF8_Blended(font.get_ttf_font(),
                                                     text.c_str(),
                                                     SDL_Color{255, 255, 255, 255}));
@@ -113,6 +119,20 @@ TTFSurface::create(const TTFFont& font, const std::string& text)
   return std::make_shared<TTFSurface>(result, Vector(0, 0));
 }
 
+TTFSurfacePtr
+TTFSurface::create_from_atlas(const TTFFont& font, const std::string& text)
+{
+  Vector offset(0.0f, 0.0f);
+  SDLSurfacePtr line_surface = font.get_glyph_atlas().render_line(text, offset);
+  if (!line_surface)
+  {
+    return std::make_shared<TTFSurface>(SurfacePtr(), Vector(0.0f, 0.0f));
+  }
+
+  SurfacePtr result = Surface::from_texture(VideoSystem::current()->new_texture(*line_surface));
+  return std::make_shared<TTFSurface>(result, offset);
+}
+
 TTFSurface::TTFSurface(const SurfacePtr& surface, const Vector& offset) :
   m_surface(surface),
   m_offset(offset)
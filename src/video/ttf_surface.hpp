@@ -34,6 +34,11 @@ class TTFSurface final
 public:
   static TTFSurfacePtr create(const TTFFont& font, const std::string& text);
 
+private:
+  /** Composes the line from the glyph atlas of the font, so that it
+      matches the width of text drawn from the atlas directly */
+  static TTFSurfacePtr create_from_atlas(const TTFFont& font, const std::string& text);
+
 public:
   TTFSurface(const SurfacePtr& surface, const Vector& offset);
 
@@ -36,7 +36,13 @@ TTFSurfaceManager::CacheEntry::CacheEntry(const TTFSurfacePtr& s) :
 
 TTFSurfaceManager::TTFSurfaceManager() :
   m_cache(),
-  m_cache_iter(m_cache.end())
+  m_cache_iter(m_cache.end()),
+  m_glyph_atlas_enabled(false),
+  m_texture_uploads(0),
+  m_texture_upload_pixels(0),
+  m_texture_upload_start(0.0f),
+  m_texture_upload_rate(0.0f),
+  m_texture_upload_pixel_rate(0.0f)
 {
 }
 
@@ -65,6 +71,7 @@ TTFSurfaceManager::create_surface(const TTFFont& font, const std::string& text)
     cache_cleanup_step();
 
     TTFSurfacePtr ttf_surface = TTFSurface::create(font, text);
+    count_texture_upload(ttf_surface->get_width() * ttf_surface->get_height());
     m_cache[key] = ttf_surface;
     return ttf_surface;
   }
@@ -83,6 +90,53 @@ TTFSurfaceManager::get_cached_surface_width(const TTFFont& font,
   return entry.ttf_surface->get_width();
 }
 
+void
+TTFSurfaceManager::set_glyph_atlas_enabled(bool enabled)
+{
+  if (enabled == m_glyph_atlas_enabled)
+    return;
+
+  m_glyph_atlas_enabled = enabled;
+  m_cache.clear();
+  m_cache_iter = m_cache.end();
+}
+
+void
+TTFSurfaceManager::count_texture_upload(int pixels)
+{
+  update_texture_upload_rate();
+  m_texture_uploads += 1;
+  m_texture_upload_pixels += pixels;
+}
+
+float
+TTFSurfaceManager::get_texture_upload_rate()
+{
+  update_texture_upload_rate();
+  return m_texture_upload_rate;
+}
+
+float
+TTFSurfaceManager::get_texture_upload_pixel_rate()
+{
+  update_texture_upload_rate();
+  return m_texture_upload_pixel_rate;
+}
+
+void
+TTFSurfaceManager::update_texture_upload_rate()
+{
+  const float elapsed = g_real_time - m_texture_upload_start;
+  if (elapsed >= 1.0f)
+  {
+    m_texture_upload_rate = static_cast<float>(m_texture_uploads) / elapsed;
+    m_texture_upload_pixel_rate = static_cast<float>(m_texture_upload_pixels) / elapsed;
+    m_texture_uploads = 0;
+    m_texture_upload_pixels = 0;
+    m_texture_upload_start = g_real_time;
+  }
+}
+
 void
 TTFSurfaceManager::cache_cleanup_step()
 {
@@ -113,6 +167,8 @@ TTFSurfaceManager::print_debug_info(std::ostream& out)
     return accumulator + entry.second.ttf_surface->get_width() * entry.second.ttf_surface->get_height() * 4;
   });
   out << "TTFSurfaceManager.cache_size: " << m_cache.size() << "  " << cache_bytes / 1000 << "KB" << std::endl;
+  out << "TTFSurfaceManager.glyph_atlas: " << m_glyph_atlas_enabled
+      << "  uploads/s: " << get_texture_upload_rate() << std::endl;
 }
 
 /* EOF */
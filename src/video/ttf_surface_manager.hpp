@@ -39,10 +39,25 @@ public:
   // Returns -1 if there is no cached text surface
   int get_cached_surface_width(const TTFFont& font, const std::string& text);
 
+  /** Draw text from per-font glyph atlases instead of a texture per
+      string, clears the cache as the surfaces differ between both */
+  void set_glyph_atlas_enabled(bool enabled);
+  bool get_glyph_atlas_enabled() const { return m_glyph_atlas_enabled; }
+
+  /** Called whenever text pixels get uploaded to the video system */
+  void count_texture_upload(int pixels);
+
+  /** Text texture uploads per second, measured over the last second */
+  float get_texture_upload_rate();
+
+  /** Uploaded text pixels per second, measured over the last second */
+  float get_texture_upload_pixel_rate();
+
   void print_debug_info(std::ostream& out);
 
 private:
   void cache_cleanup_step();
+  void update_texture_upload_rate();
 
 private:
   struct CacheEntry
@@ -60,6 +75,14 @@ private:
 
   std::map<Key, CacheEntry>::iterator m_cache_iter;
 
+  bool m_glyph_atlas_enabled;
+
+  int m_texture_uploads;
+  int m_texture_upload_pixels;
+  float m_texture_upload_start;
+  float m_texture_upload_rate;
+  float m_texture_upload_pixel_rate;
+
 private:
   TTFSurfaceManager(const TTFSurfaceManager&) = delete;
   TTFSurfaceManager& operator=(const TTFSurfaceManager&) = delete;
@@ -77,6 +77,11 @@ public:
   virtual void set_icon(const SDL_Surface& icon) = 0;
   virtual SDLSurfacePtr make_screenshot() = 0;
 
+  /** Vertex data sent to the GPU during the last frame, for the
+      developer overlay; zero for video systems that don't track it */
+  virtual size_t get_vertex_upload_bytes() const { return 0; }
+  virtual int get_vertex_uploads() const { return 0; }
+
   void do_take_screenshot();
 
 private:
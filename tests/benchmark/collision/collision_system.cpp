@@ -0,0 +1,169 @@
+//  SuperTux
+//  Copyright (C) 2016 Tapesh Mandal <tapesh.mandal@gmail.com>
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "collision/collision_system.hpp"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "collision/collision.hpp"
+#include "math/aatriangle.hpp"
+#include "math/rectf.hpp"
+#include "object/tilemap.hpp"
+#include "supertux/tile.hpp"
+#include "supertux/tile_set.hpp"
+
+namespace {
+
+/** A tileset with a solid tile, a unisolid tile and every slope */
+std::unique_ptr<TileSet> make_tileset()
+{
+  auto tileset = std::make_unique<TileSet>();
+  tileset->add_tile(1, std::make_unique<Tile>(std::vector<Tile::ImageSpec>(), std::vector<Tile::ImageSpec>(),
+                                              Tile::SOLID, 0, 0.0f));
+  tileset->add_tile(2, std::make_unique<Tile>(std::vector<Tile::ImageSpec>(), std::vector<Tile::ImageSpec>(),
+                                              Tile::SOLID | Tile::UNISOLID, 0, 0.0f));
+  for (int deform = 0; deform < 5; ++deform)
+  {
+    for (int direction = 0; direction < 4; ++direction)
+    {
+      tileset->add_tile(10 + deform * 4 + direction,
+                        std::make_unique<Tile>(std::vector<Tile::ImageSpec>(), std::vector<Tile::ImageSpec>(),
+                                               Tile::SOLID | Tile::SLOPE, (deform << 4) | direction, 0.0f));
+    }
+  }
+  return tileset;
+}
+
+} // namespace
+
+TEST(CollisionSystemBenchmark, tile_sweep)
+{
+  // hilly ground of solid tiles and slopes, 300 objects walking on it
+  auto tileset = make_tileset();
+  const int width = 500;
+  const int height = 40;
+  std::mt19937 rng(1234);
+  std::uniform_int_distribution<int> tile(0, 40);
+
+  std::vector<unsigned int> tiles(width * height, 0);
+  for (int x = 0; x < width; ++x)
+  {
+    for (int y = 0; y < height; ++y)
+    {
+      const int id = tile(rng);
+      if (y >= 30)
+        tiles[y * width + x] = 1;
+      else if (y >= 20 && id < 30)
+        tiles[y * width + x] = id < 10 ? id % 3 : id;
+    }
+  }
+  TileMap tilemap(tileset.get());
+  tilemap.set(width, height, tiles, 0, true);
+
+  std::uniform_real_distribution<float> position_x(0.0f, static_cast<float>(width) * 32.0f - 64.0f);
+  std::uniform_real_distribution<float> position_y(18.0f * 32.0f, 32.0f * 32.0f);
+  std::vector<Rectf> objects;
+  for (int i = 0; i < 300; ++i)
+  {
+    const Vector pos(position_x(rng), position_y(rng));
+    objects.emplace_back(pos, pos + Vector(31.8f, 63.8f));
+  }
+
+  // the tile sweep of CollisionSystem::collision_tilemap() before and
+  // after, without the unisolid check that needs a moving object
+  auto sweep_tiles = [&tilemap](const Rectf& dest, collision::Constraints& constraints) {
+    const Rect test_tiles = tilemap.get_tiles_overlapping(dest);
+    for (int x = test_tiles.left; x < test_tiles.right; ++x)
+    {
+      for (int y = test_tiles.top; y < test_tiles.bottom; ++y)
+      {
+        const Tile& tile = tilemap.get_tile(x, y);
+        if (!tile.is_solid() || tile.is_unisolid())
+          continue;
+
+        const Rectf tile_bbox = tilemap.get_tile_bbox(x, y);
+        if (tile.is_slope())
+          collision::rectangle_aatriangle(&constraints, dest, AATriangle(tile_bbox, tile.get_data()));
+        else if (collision::intersects(dest, tile_bbox))
+          collision::set_rectangle_rectangle_constraints(&constraints, dest, tile_bbox);
+      }
+    }
+  };
+  auto sweep_flags = [&tilemap](const Rectf& dest, collision::Constraints& constraints) {
+    const Rect test_tiles = tilemap.get_tiles_overlapping(dest);
+    for (int x = test_tiles.left; x < test_tiles.right; ++x)
+    {
+      const uint16_t* column = tilemap.get_collision_column(x);
+      for (int y = test_tiles.top; y < test_tiles.bottom; ++y)
+      {
+        const uint16_t flags = column[y];
+        if (!(flags & Tile::SOLID) || (flags & Tile::UNISOLID))
+          continue;
+
+        const Rectf tile_bbox = tilemap.get_tile_bbox(x, y);
+        bool hits_bottom = false;
+        if (flags & Tile::SLOPE)
+          collision::rectangle_slope(&constraints, dest, tile_bbox, flags >> 8, hits_bottom);
+        else if (collision::intersects(dest, tile_bbox))
+          collision::set_rectangle_rectangle_constraints(&constraints, dest, tile_bbox);
+      }
+    }
+  };
+
+  const int frames = 600;
+  int hits_tiles = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (int frame = 0; frame < frames; ++frame)
+  {
+    for (const auto& object : objects)
+    {
+      collision::Constraints constraints;
+      sweep_tiles(object.moved(Vector(static_cast<float>(frame % 32), 0.0f)), constraints);
+      hits_tiles += constraints.hit.bottom;
+    }
+  }
+  auto time_tiles = std::chrono::duration_cast<std::chrono::microseconds>(
+    std::chrono::steady_clock::now() - start);
+
+  int hits_flags = 0;
+  start = std::chrono::steady_clock::now();
+  for (int frame = 0; frame < frames; ++frame)
+  {
+    for (const auto& object : objects)
+    {
+      collision::Constraints constraints;
+      sweep_flags(object.moved(Vector(static_cast<float>(frame % 32), 0.0f)), constraints);
+      hits_flags += constraints.hit.bottom;
+    }
+  }
+  auto time_flags = std::chrono::duration_cast<std::chrono::microseconds>(
+    std::chrono::steady_clock::now() - start);
+
+  // the planes are moved to the tile instead of being computed at its
+  // position, which may round differently for objects just touching
+  ASSERT_NEAR(hits_flags, hits_tiles, hits_tiles / 1000);
+  std::cout << objects.size() << " objects against " << width << "x" << height << " tiles: Tile lookups "
+            << static_cast<double>(time_tiles.count()) / frames << " us/frame, collision flags "
+            << static_cast<double>(time_flags.count()) / frames << " us/frame" << std::endl;
+}
+
+/* EOF */
@@ -0,0 +1,106 @@
+//  SuperTux
+//  Copyright (C) 2024 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "collision/spatial_hash.hpp"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "collision/collision_hit.hpp"
+#include "collision/collision_listener.hpp"
+#include "collision/collision_object.hpp"
+#include "math/rectf.hpp"
+
+namespace {
+
+class DummyListener final : public CollisionListener
+{
+public:
+  void collision_solid(const CollisionHit&) override {}
+  bool collides(GameObject&, const CollisionHit&) const override { return false; }
+  HitResponse collision(GameObject&, const CollisionHit&) override { return ABORT_MOVE; }
+  void collision_tile(uint32_t) override {}
+  bool listener_is_valid() const override { return true; }
+};
+
+} // namespace
+
+TEST(SpatialHashBenchmark, queries)
+{
+  // a sector of 3000 objects in a 600x30 tile level
+  std::mt19937 rng(1234);
+  std::uniform_real_distribution<float> x(0.0f, 600.0f * 32.0f);
+  std::uniform_real_distribution<float> y(0.0f, 30.0f * 32.0f);
+
+  DummyListener listener;
+  std::vector<std::unique_ptr<CollisionObject> > objects;
+  SpatialHash hash;
+  for (int i = 0; i < 3000; ++i)
+  {
+    objects.emplace_back(new CollisionObject(COLGROUP_MOVING, listener));
+    objects.back()->set_size(32.0f, 32.0f);
+    objects.back()->set_pos(Vector(x(rng), y(rng)));
+    hash.insert(*objects.back());
+  }
+
+  // every object looks around itself once per frame, like the player
+  // does for bricks and badguys
+  const int frames = 10;
+
+  size_t found_linear = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (int frame = 0; frame < frames; ++frame)
+  {
+    for (const auto& object : objects)
+    {
+      const Rectf rect = object->get_bbox().grown(16.0f);
+      for (const auto& other : objects)
+      {
+        if (rect.contains(other->get_bbox()))
+          found_linear += 1;
+      }
+    }
+  }
+  auto time_linear = std::chrono::duration_cast<std::chrono::microseconds>(
+    std::chrono::steady_clock::now() - start);
+
+  size_t found_hash = 0;
+  std::vector<CollisionObject*> result;
+  start = std::chrono::steady_clock::now();
+  for (int frame = 0; frame < frames; ++frame)
+  {
+    for (const auto& object : objects)
+    {
+      result.clear();
+      hash.query(object->get_bbox().grown(16.0f), result);
+      found_hash += result.size();
+    }
+  }
+  auto time_hash = std::chrono::duration_cast<std::chrono::microseconds>(
+    std::chrono::steady_clock::now() - start);
+
+  ASSERT_EQ(found_hash, found_linear);
+  std::cout << objects.size() << " objects, " << objects.size() << " queries/frame: linear "
+            << static_cast<double>(time_linear.count()) / frames << " us/frame, spatial hash "
+            << static_cast<double>(time_hash.count()) / frames << " us/frame" << std::endl;
+}
+
+/* EOF */
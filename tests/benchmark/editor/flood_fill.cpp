@@ -0,0 +1,136 @@
+//  SuperTux
+//  Copyright (C) 2024 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "editor/flood_fill.hpp"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+#include <stdint.h>
+#include <vector>
+
+namespace {
+
+struct Grid
+{
+  int width;
+  int height;
+  std::vector<uint32_t> tiles;
+
+  uint32_t& at(int x, int y) { return tiles[y * width + x]; }
+};
+
+/** A 2x2 pattern of tiles, like a TileSelection */
+uint32_t pattern(int x, int y, bool multi)
+{
+  if (!multi)
+    return 7;
+  return 7 + static_cast<uint32_t>(((x % 2) + 2) % 2 + (((y % 2) + 2) % 2) * 2);
+}
+
+bool check(uint32_t replace_tile, uint32_t target_tile, uint32_t third_tile)
+{
+  return replace_tile == target_tile && replace_tile != third_tile;
+}
+
+/** The depth first fill that EditorOverlayWidget::fill() used before */
+void reference_fill(Grid& grid, int sx, int sy, bool multi)
+{
+  uint32_t replace_tile = grid.at(sx, sy);
+  if (replace_tile == pattern(0, 0, multi))
+    return;
+
+  std::vector<std::pair<int, int> > stack;
+  stack.push_back({ sx, sy });
+  while (!stack.empty()) {
+    const int x = stack.back().first;
+    const int y = stack.back().second;
+    const int tx = x - sx;
+    const int ty = y - sy;
+
+    grid.at(x, y) = pattern(tx, ty, multi);
+
+    if (x > 0 && check(replace_tile, grid.at(x - 1, y), pattern(tx - 1, ty, multi))) {
+      stack.push_back({ x - 1, y });
+      continue;
+    }
+    if (x < grid.width - 1 && check(replace_tile, grid.at(x + 1, y), pattern(tx + 1, ty, multi))) {
+      stack.push_back({ x + 1, y });
+      continue;
+    }
+    if (y > 0 && check(replace_tile, grid.at(x, y - 1), pattern(tx, ty - 1, multi))) {
+      stack.push_back({ x, y - 1 });
+      continue;
+    }
+    if (y < grid.height - 1 && check(replace_tile, grid.at(x, y + 1), pattern(tx, ty + 1, multi))) {
+      stack.push_back({ x, y + 1 });
+      continue;
+    }
+    stack.pop_back();
+  }
+}
+
+Rect scanline_fill(Grid& grid, int sx, int sy, bool multi)
+{
+  uint32_t replace_tile = grid.at(sx, sy);
+  if (replace_tile == pattern(0, 0, multi))
+    return Rect();
+
+  return flood_fill(grid.width, grid.height, sx, sy,
+    [&](int x, int y) {
+      return check(replace_tile, grid.at(x, y), pattern(x - sx, y - sy, multi));
+    },
+    [&](int y, int left, int right) {
+      for (int x = left; x < right; ++x) {
+        grid.at(x, y) = pattern(x - sx, y - sy, multi);
+      }
+    });
+}
+
+} // namespace
+
+TEST(FloodFillBenchmark, fill)
+{
+  const int width = 1000;
+  const int height = 200;
+
+  Grid grid{ width, height, std::vector<uint32_t>(width * height, 0) };
+  // Some obstacles, so that the region isn't a plain rectangle
+  for (int x = 10; x < width; x += 20) {
+    for (int y = (x / 20) % 2 == 0 ? 0 : 20; y < height - ((x / 20) % 2 == 0 ? 20 : 0); ++y) {
+      grid.at(x, y) = 1;
+    }
+  }
+  Grid reference = grid;
+
+  auto start = std::chrono::steady_clock::now();
+  scanline_fill(grid, 0, 0, false);
+  auto scanline_time = std::chrono::duration_cast<std::chrono::microseconds>(
+    std::chrono::steady_clock::now() - start);
+
+  start = std::chrono::steady_clock::now();
+  reference_fill(reference, 0, 0, false);
+  auto reference_time = std::chrono::duration_cast<std::chrono::microseconds>(
+    std::chrono::steady_clock::now() - start);
+
+  std::cout << width << "x" << height << " fill: scanline " << scanline_time.count()
+            << "us, depth first " << reference_time.count() << "us" << std::endl;
+
+  ASSERT_EQ(grid.tiles, reference.tiles);
+}
+
+/* EOF */
@@ -0,0 +1,56 @@
+//  SuperTux
+//  Copyright (C) 2024 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "object/custom_particle_store.hpp"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+
+TEST(CustomParticleStoreBenchmark, integrate)
+{
+  const size_t count = 50000;
+  const int frames = 600;
+  const float dt_sec = 1.0f / 60.0f;
+
+  CustomParticleStore store;
+  store.reserve(count);
+  for (size_t i = 0; i < count; ++i) {
+    size_t idx = store.add();
+    store.speed_x[idx] = static_cast<float>(i % 100);
+    store.acc_y[idx] = 9.81f;
+    store.friction_x[idx] = 0.01f;
+    store.lifetime[idx] = static_cast<float>(frames) * dt_sec;
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  for (int frame = 0; frame < frames; ++frame) {
+    store.integrate_lifetime(dt_sec);
+    store.integrate_speed(dt_sec);
+    store.integrate_position(dt_sec);
+    store.remove_dead();
+  }
+  auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+    std::chrono::steady_clock::now() - start);
+
+  std::cout << count << " particles, " << frames << " frames: "
+            << static_cast<double>(elapsed.count()) / frames << " us/frame" << std::endl;
+
+  ASSERT_EQ(store.size(), count);
+}
+
+/* EOF */
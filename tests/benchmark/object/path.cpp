@@ -0,0 +1,120 @@
+//  SuperTux
+//  Copyright (C) 2024 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "object/path.hpp"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "math/bezier.hpp"
+
+namespace {
+
+/** 200 paths of four curved nodes, like the platforms of
+    data/levels/test/paths.stl */
+std::vector<std::unique_ptr<Path> > make_paths()
+{
+  std::vector<std::unique_ptr<Path> > paths;
+  std::mt19937 rng(1234);
+  std::uniform_real_distribution<float> offset(-96.0f, 96.0f);
+
+  for (int i = 0; i < 200; ++i)
+  {
+    const Vector base(static_cast<float>(i % 50) * 192.0f, static_cast<float>(i / 50) * 224.0f);
+    paths.emplace_back(new Path(base));
+
+    const Vector corners[] = { Vector(128.0f, 0.0f), Vector(128.0f, 128.0f), Vector(0.0f, 128.0f) };
+    for (const auto& corner : corners)
+    {
+      Path::Node node;
+      node.position = base + corner;
+      node.bezier_before = node.position + Vector(offset(rng), offset(rng));
+      node.bezier_after = node.position + Vector(offset(rng), offset(rng));
+      node.time = 1.0f;
+      paths.back()->m_nodes.push_back(node);
+    }
+
+    auto& first = paths.back()->m_nodes.front();
+    first.bezier_before = first.position + Vector(offset(rng), offset(rng));
+    first.bezier_after = first.position + Vector(offset(rng), offset(rng));
+  }
+  return paths;
+}
+
+void get_curve(const Path& path, size_t node, Vector* p)
+{
+  const auto& nodes = path.get_nodes();
+  const auto& current = nodes[node];
+  const auto& next = nodes[(node + 1) % nodes.size()];
+  p[0] = current.position;
+  p[1] = current.bezier_after;
+  p[2] = next.bezier_before;
+  p[3] = next.position;
+}
+
+} // namespace
+
+TEST(PathBenchmark, get_point_by_length)
+{
+  const auto paths = make_paths();
+
+  // every platform asks for its position once per frame
+  const int frames = 600;
+
+  Vector sum_sampled(0.0f, 0.0f);
+  auto start = std::chrono::steady_clock::now();
+  for (int frame = 0; frame < frames; ++frame)
+  {
+    const float t = static_cast<float>(frame % 60) / 60.0f;
+    for (const auto& path : paths)
+    {
+      Vector p[4];
+      get_curve(*path, static_cast<size_t>(frame / 60) % 4, p);
+      sum_sampled += Bezier::get_point_by_length(p[0], p[1], p[2], p[3], t);
+    }
+  }
+  auto time_sampled = std::chrono::duration_cast<std::chrono::microseconds>(
+    std::chrono::steady_clock::now() - start);
+
+  Vector sum_table(0.0f, 0.0f);
+  start = std::chrono::steady_clock::now();
+  for (int frame = 0; frame < frames; ++frame)
+  {
+    const float t = static_cast<float>(frame % 60) / 60.0f;
+    for (const auto& path : paths)
+    {
+      Vector p[4];
+      const size_t node = static_cast<size_t>(frame / 60) % 4;
+      get_curve(*path, node, p);
+      sum_table += path->get_point_by_length(node, p[0], p[1], p[2], p[3], t);
+    }
+  }
+  auto time_table = std::chrono::duration_cast<std::chrono::microseconds>(
+    std::chrono::steady_clock::now() - start);
+
+  ASSERT_NEAR(sum_table.x, sum_sampled.x, sum_sampled.x * 1e-4f);
+  ASSERT_NEAR(sum_table.y, sum_sampled.y, sum_sampled.y * 1e-4f);
+  std::cout << paths.size() << " platforms on curved paths: sampled "
+            << static_cast<double>(time_sampled.count()) / frames << " us/frame, length table "
+            << static_cast<double>(time_table.count()) / frames << " us/frame" << std::endl;
+}
+
+/* EOF */
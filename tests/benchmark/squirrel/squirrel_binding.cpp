@@ -0,0 +1,202 @@
+//  SuperTux
+//  Copyright (C) 2024 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "squirrel/squirrel_binding.hpp"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#include <squirrel.h>
+
+#include "squirrel/squirrel_util.hpp"
+
+namespace {
+
+class DummyObject final
+{
+public:
+  DummyObject() : m_x(0.0f), m_y(0.0f) {}
+
+  float get_pos_x() const { return m_x; }
+  void set_velocity(float x, float y) { m_x += x; m_y += y; }
+  int get_count(int a, bool b) const { return b ? a * 2 : a; }
+
+private:
+  float m_x;
+  float m_y;
+};
+
+/** The glue miniswig used to generate, for comparing against the
+    templates */
+SQInteger DummyObject_get_pos_x_wrapper(HSQUIRRELVM vm)
+{
+  SQUserPointer data;
+  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
+    sq_throwerror(vm, _SC("'get_pos_x' called without instance"));
+    return SQ_ERROR;
+  }
+  DummyObject* _this = reinterpret_cast<DummyObject*> (data);
+
+  try {
+    float return_value = _this->get_pos_x();
+
+    sq_pushfloat(vm, return_value);
+    return 1;
+
+  } catch(std::exception& e) {
+    sq_throwerror(vm, e.what());
+    return SQ_ERROR;
+  } catch(...) {
+    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_pos_x'"));
+    return SQ_ERROR;
+  }
+}
+
+SQInteger DummyObject_set_velocity_wrapper(HSQUIRRELVM vm)
+{
+  SQUserPointer data;
+  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
+    sq_throwerror(vm, _SC("'set_velocity' called without instance"));
+    return SQ_ERROR;
+  }
+  DummyObject* _this = reinterpret_cast<DummyObject*> (data);
+
+  SQFloat arg0;
+  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
+    sq_throwerror(vm, _SC("Argument 1 not a float"));
+    return SQ_ERROR;
+  }
+  SQFloat arg1;
+  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
+    sq_throwerror(vm, _SC("Argument 2 not a float"));
+    return SQ_ERROR;
+  }
+
+  try {
+    _this->set_velocity(arg0, arg1);
+
+    return 0;
+
+  } catch(std::exception& e) {
+    sq_throwerror(vm, e.what());
+    return SQ_ERROR;
+  } catch(...) {
+    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_velocity'"));
+    return SQ_ERROR;
+  }
+}
+
+SQInteger DummyObject_get_count_wrapper(HSQUIRRELVM vm)
+{
+  SQUserPointer data;
+  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
+    sq_throwerror(vm, _SC("'get_count' called without instance"));
+    return SQ_ERROR;
+  }
+  DummyObject* _this = reinterpret_cast<DummyObject*> (data);
+
+  SQInteger arg0;
+  if(SQ_FAILED(sq_getinteger(vm, 2, &arg0))) {
+    sq_throwerror(vm, _SC("Argument 1 not an integer"));
+    return SQ_ERROR;
+  }
+  SQBool arg1;
+  if(SQ_FAILED(sq_getbool(vm, 3, &arg1))) {
+    sq_throwerror(vm, _SC("Argument 2 not a bool"));
+    return SQ_ERROR;
+  }
+
+  try {
+    int return_value = _this->get_count(static_cast<int> (arg0), arg1 == SQTrue);
+
+    sq_pushinteger(vm, return_value);
+    return 1;
+
+  } catch(std::exception& e) {
+    sq_throwerror(vm, e.what());
+    return SQ_ERROR;
+  } catch(...) {
+    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_count'"));
+    return SQ_ERROR;
+  }
+}
+
+/** Runs a loop of \a calls bound calls on \a object and returns the
+    calls per second */
+double measure(HSQUIRRELVM vm, const std::string& object, int calls)
+{
+  std::ostringstream script;
+  script << "local x = 0.0;"
+         << "for (local i = 0; i < " << calls / 3 << "; i++) {"
+         << "  " << object << ".set_velocity(1.0, -1.0);"
+         << "  x += " << object << ".get_pos_x();"
+         << "  x += " << object << ".get_count(i, false);"
+         << "}"
+         << "result <- x;";
+
+  std::istringstream in(script.str());
+  auto start = std::chrono::steady_clock::now();
+  compile_and_run(vm, in, "benchmark");
+  auto time = std::chrono::duration_cast<std::chrono::microseconds>(
+    std::chrono::steady_clock::now() - start);
+  return static_cast<double>(calls) / static_cast<double>(time.count()) * 1e6;
+}
+
+} // namespace
+
+TEST(SquirrelBindingBenchmark, calls)
+{
+  using namespace squirrel;
+
+  DummyObject object;
+  HSQUIRRELVM vm = sq_open(1024);
+  sq_pushroottable(vm);
+
+  begin_class(vm, "Dummy");
+  register_function(vm, "get_pos_x", SQ_METHOD(DummyObject, get_pos_x));
+  register_function(vm, "set_velocity", SQ_METHOD(DummyObject, set_velocity));
+  register_function(vm, "get_count", SQ_METHOD(DummyObject, get_count));
+  end_class(vm, "Dummy");
+
+  begin_class(vm, "GeneratedDummy");
+  register_function(vm, "get_pos_x", &DummyObject_get_pos_x_wrapper, ".");
+  register_function(vm, "set_velocity", &DummyObject_set_velocity_wrapper, ".b|nb|n");
+  register_function(vm, "get_count", &DummyObject_get_count_wrapper, ".b|nb|n");
+  end_class(vm, "GeneratedDummy");
+
+  sq_pushstring(vm, "obj", -1);
+  create_instance(vm, &object, "Dummy", false);
+  sq_createslot(vm, -3);
+
+  sq_pushstring(vm, "generated", -1);
+  create_instance(vm, &object, "GeneratedDummy", false);
+  sq_createslot(vm, -3);
+
+  sq_pop(vm, 1);
+
+  const int calls = 3000000;
+  std::cout << "generated: " << measure(vm, "generated", calls) << " calls/s" << std::endl;
+  std::cout << "templates: " << measure(vm, "obj", calls) << " calls/s" << std::endl;
+
+  sq_close(vm);
+}
+
+/* EOF */
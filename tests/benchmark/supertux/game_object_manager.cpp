@@ -0,0 +1,114 @@
+//  SuperTux
+//  Copyright (C) 2024 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "supertux/game_object_manager.hpp"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+#include <unordered_map>
+#include <vector>
+
+#include "supertux/game_object.hpp"
+
+namespace {
+
+class DummyObject final : public GameObject
+{
+public:
+  DummyObject() : m_value(1) {}
+
+  void update(float) override {}
+  void draw(DrawingContext&) override {}
+
+  int m_value;
+};
+
+class DummyManager final : public GameObjectManager
+{
+public:
+  ~DummyManager() override
+  {
+    clear_objects();
+  }
+
+  bool before_object_add(GameObject&) override { return true; }
+  void before_object_remove(GameObject&) override {}
+};
+
+} // namespace
+
+TEST(GameObjectManagerBenchmark, get_object_by_uid)
+{
+  // scripts resolving the UID of their object on every call, with
+  // objects coming and going in between
+  const int objects = 2000;
+  const int frames = 500;
+
+  DummyManager manager;
+  std::vector<UID> uids;
+  std::unordered_map<UID, GameObject*> objects_by_uid;
+  for (int i = 0; i < objects; ++i)
+  {
+    auto& object = manager.add<DummyObject>();
+    uids.push_back(object.get_uid());
+    objects_by_uid[object.get_uid()] = &object;
+  }
+  manager.flush_game_objects();
+
+  long sum_map = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (int frame = 0; frame < frames; ++frame)
+  {
+    for (const auto& uid : uids)
+    {
+      // the lookup get_object_by_uid() used to do
+      auto it = objects_by_uid.find(uid);
+      if (it != objects_by_uid.end())
+      {
+#ifdef NDEBUG
+        sum_map += static_cast<DummyObject*>(it->second)->m_value;
+#else
+        sum_map += dynamic_cast<DummyObject*>(it->second)->m_value;
+#endif
+      }
+    }
+  }
+  auto time_map = std::chrono::duration_cast<std::chrono::microseconds>(
+    std::chrono::steady_clock::now() - start);
+
+  long sum_slots = 0;
+  start = std::chrono::steady_clock::now();
+  for (int frame = 0; frame < frames; ++frame)
+  {
+    for (const auto& uid : uids)
+    {
+      auto object = manager.get_object_by_uid<DummyObject>(uid);
+      if (object)
+        sum_slots += object->m_value;
+    }
+  }
+  auto time_slots = std::chrono::duration_cast<std::chrono::microseconds>(
+    std::chrono::steady_clock::now() - start);
+
+  ASSERT_EQ(sum_slots, sum_map);
+  std::cout << objects << " objects, " << frames << " frames: unordered_map "
+            << static_cast<double>(time_map.count()) / frames << " us/frame, slots "
+            << static_cast<double>(time_slots.count()) / frames << " us/frame" << std::endl;
+}
+
+/* EOF */
@@ -0,0 +1,118 @@
+//  SuperTux
+//  Copyright (C) 2024 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "supertux/level_parser.hpp"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <string>
+
+#include <physfs.h>
+
+#include "audio/sound_manager.hpp"
+#include "control/input_manager.hpp"
+#include "sprite/sprite_manager.hpp"
+#include "squirrel/squirrel_virtual_machine.hpp"
+#include "supertux/gameconfig.hpp"
+#include "supertux/globals.hpp"
+#include "supertux/level.hpp"
+#include "supertux/main.hpp"
+#include "supertux/resources.hpp"
+#include "supertux/tile_manager.hpp"
+#include "util/log.hpp"
+#include "util/string_util.hpp"
+#include "video/null/null_video_system.hpp"
+#include "video/ttf_surface_manager.hpp"
+
+namespace {
+
+double milliseconds_since(const std::chrono::steady_clock::time_point& start)
+{
+  return static_cast<double>(std::chrono::duration_cast<std::chrono::microseconds>(
+                               std::chrono::steady_clock::now() - start).count()) / 1000.0;
+}
+
+} // namespace
+
+TEST(LevelParserBenchmark, level_start)
+{
+  PHYSFS_init("level_parser_benchmark");
+  if (PHYSFS_mount("../data", nullptr, 1) == 0 || !PHYSFS_exists("levels/world1"))
+  {
+    PHYSFS_deinit();
+    GTEST_SKIP() << "game data not found";
+  }
+
+  const LogLevel log_level = g_log_level;
+  g_log_level = LOG_WARNING;
+
+  Config* old_config = g_config;
+  Config config;
+  g_config = &config;
+
+  {
+    // the same subsystems as --validate-levels
+    SDLSubsystem sdl_subsystem;
+    InputManager input_manager(config.keyboard_config, config.joystick_config);
+    NullVideoSystem video_system;
+    TTFSurfaceManager ttf_surface_manager;
+    SoundManager sound_manager;
+    sound_manager.enable_sound(false);
+    sound_manager.enable_music(false);
+    SquirrelVirtualMachine squirrel_virtual_machine(false);
+    TileManager tile_manager;
+    SpriteManager sprite_manager;
+    Resources resources;
+
+    double start_time = 0.0;
+    double rest_time = 0.0;
+    int levels = 0;
+
+    char** files = PHYSFS_enumerateFiles("levels/world1");
+    for (char** i = files; *i != nullptr; ++i)
+    {
+      const std::string filename = std::string("levels/world1/") + *i;
+      if (!StringUtil::has_suffix(filename, ".stl"))
+        continue;
+
+      // what GameSession waits for before the level is shown
+      auto start = std::chrono::steady_clock::now();
+      auto level = LevelParser::from_file(filename, false, false);
+      level->get_sector("main");
+      start_time += milliseconds_since(start);
+
+      // the sectors that used to be constructed up front as well
+      start = std::chrono::steady_clock::now();
+      level->construct_deferred_sectors();
+      rest_time += milliseconds_since(start);
+
+      levels += 1;
+    }
+    PHYSFS_freeList(files);
+
+    std::cout << levels << " levels of world1, level start: " << start_time / levels << " ms, "
+              << "other sectors: " << rest_time / levels << " ms per level" << std::endl;
+  }
+
+  g_config = old_config;
+  g_log_level = log_level;
+  PHYSFS_deinit();
+}
+
+/* EOF */
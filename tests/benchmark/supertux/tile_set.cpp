@@ -0,0 +1,131 @@
+//  SuperTux
+//  Copyright (C) 2024 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "supertux/tile_set.hpp"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <physfs.h>
+#include <sexp/value.hpp>
+
+#include "supertux/gameconfig.hpp"
+#include "supertux/globals.hpp"
+#include "supertux/tile.hpp"
+#include "util/reader_document.hpp"
+#include "video/null/null_video_system.hpp"
+#include "video/texture_manager.hpp"
+
+namespace {
+
+void collect_tile_references(const sexp::Value& sx, std::vector<uint32_t>& ids)
+{
+  if (!sx.is_array())
+    return;
+
+  const auto& arr = sx.as_array();
+  if (!arr.empty() && arr[0].is_symbol() && arr[0].as_string() == "tiles")
+  {
+    for (size_t i = 1; i < arr.size(); ++i)
+    {
+      if (arr[i].is_integer() && arr[i].as_int() > 0)
+        ids.push_back(static_cast<uint32_t>(arr[i].as_int()));
+    }
+  }
+  else
+  {
+    for (const auto& item : arr)
+      collect_tile_references(item, ids);
+  }
+}
+
+/** Returns the value of a "name:value" line of TextureManager::debug_print() */
+std::string get_texture_stat(const std::string& name)
+{
+  std::ostringstream out;
+  TextureManager::current()->debug_print(out);
+
+  std::istringstream in(out.str());
+  std::string line;
+  while (std::getline(in, line))
+  {
+    if (line.compare(0, name.size() + 1, name + ":") == 0)
+      return line.substr(name.size() + 1);
+  }
+  return "?";
+}
+
+double milliseconds_since(const std::chrono::steady_clock::time_point& start)
+{
+  return static_cast<double>(std::chrono::duration_cast<std::chrono::microseconds>(
+                               std::chrono::steady_clock::now() - start).count()) / 1000.0;
+}
+
+} // namespace
+
+TEST(TileSetBenchmark, level_load)
+{
+  PHYSFS_init("tile_set_benchmark");
+  if (PHYSFS_mount("../data", nullptr, 1) == 0 || !PHYSFS_exists("images/tiles.strf"))
+  {
+    PHYSFS_deinit();
+    GTEST_SKIP() << "game data not found";
+  }
+
+  Config* old_config = g_config;
+  Config config;
+  g_config = &config;
+
+  {
+    NullVideoSystem video_system;
+
+    auto start = std::chrono::steady_clock::now();
+    auto tileset = TileSet::from_file("images/tiles.strf");
+    std::cout << "startup, parse tiles.strf: " << milliseconds_since(start) << "ms, "
+              << get_texture_stat("live texture count") << " textures" << std::endl;
+
+    std::vector<uint32_t> ids;
+    collect_tile_references(ReaderDocument::from_file("levels/world1/welcome_antarctica.stl").get_sexp(), ids);
+
+    // an upper bound, TileMap only resolves the tiles it draws
+    start = std::chrono::steady_clock::now();
+    for (const auto id : ids)
+      tileset->resolve(id);
+    std::cout << "first level, resolve its tiles: " << milliseconds_since(start) << "ms, "
+              << tileset->get_resolved_count() << " of " << tileset->get_max_tileid() << " tiles, "
+              << get_texture_stat("live texture count") << " textures, "
+              << get_texture_stat("total texture pixels") << " texture pixels" << std::endl;
+
+    // what every startup used to pay for
+    start = std::chrono::steady_clock::now();
+    for (uint32_t id = 0; id < tileset->get_max_tileid(); ++id)
+      tileset->resolve(id);
+    std::cout << "all remaining tiles: " << milliseconds_since(start) << "ms, "
+              << tileset->get_resolved_count() << " tiles, "
+              << get_texture_stat("live texture count") << " textures, "
+              << get_texture_stat("total texture pixels") << " texture pixels" << std::endl;
+  }
+
+  g_config = old_config;
+  PHYSFS_deinit();
+}
+
+/* EOF */
@@ -0,0 +1,88 @@
+//  SuperTux
+//  Copyright (C) 2024 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "util/gettext.hpp"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <string>
+
+#include "physfs/physfs_file_system.hpp"
+
+namespace {
+
+/** The strings Statistics::draw_endseq_panel() and Sector::draw()
+    translate every frame */
+const char* const s_hud_messages[] = {
+  "You", "Best", "Coins", "Badguys", "Secrets", "Time",
+  "Press escape to skip", "Best Level Statistics"
+};
+
+size_t translate_uncached()
+{
+  size_t length = 0;
+  for (const char* message : s_hud_messages)
+  {
+    length += _(message).size();
+  }
+  return length;
+}
+
+size_t translate_registered()
+{
+  return _s("You").size() + _s("Best").size() + _s("Coins").size() + _s("Badguys").size() +
+    _s("Secrets").size() + _s("Time").size() + _s("Press escape to skip").size() +
+    _s("Best Level Statistics").size();
+}
+
+template<typename F>
+void benchmark(const char* name, F func)
+{
+  const int frames = 100000;
+
+  size_t length = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (int frame = 0; frame < frames; ++frame)
+  {
+    length += func();
+  }
+  auto time = std::chrono::duration_cast<std::chrono::nanoseconds>(
+    std::chrono::steady_clock::now() - start);
+
+  ASSERT_EQ(length, static_cast<size_t>(frames) * translate_uncached());
+  std::cout << name << ": " << static_cast<double>(time.count()) / frames << " ns/frame" << std::endl;
+}
+
+} // namespace
+
+TEST(GettextBenchmark, hud_strings)
+{
+  // without any directories the filesystem is never touched, every
+  // message is looked up in an empty dictionary
+  g_dictionary_manager.reset(new tinygettext::DictionaryManager(std::make_unique<PhysFSFileSystem>(), "UTF-8"));
+  invalidate_translations();
+
+  benchmark("_()", translate_uncached);
+  benchmark("_s()", translate_registered);
+
+  g_dictionary_manager.reset();
+  invalidate_translations();
+}
+
+/* EOF */
@@ -0,0 +1,102 @@
+//  SuperTux
+//  Copyright (C) 2024 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "util/save_queue.hpp"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <physfs.h>
+
+#include "util/log.hpp"
+#include "util/writer.hpp"
+
+namespace {
+
+/** Something the size of a big level */
+void write_level(Writer& writer)
+{
+  std::vector<unsigned int> tiles(400 * 60, 42);
+  writer.start_list("supertux-level");
+  writer.write("name", "Save queue test");
+  for (int i = 0; i < 8; ++i)
+  {
+    writer.start_list("tilemap");
+    writer.write("width", 400);
+    writer.write("height", 60);
+    writer.write("tiles", tiles, 400);
+    writer.end_list("tilemap");
+  }
+  writer.end_list("supertux-level");
+}
+
+class SaveQueueBenchmark : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    PHYSFS_init("save_queue_benchmark");
+    PHYSFS_setWriteDir(".");
+    PHYSFS_mount(".", nullptr, 1);
+  }
+
+  void TearDown() override
+  {
+    PHYSFS_delete("save_queue_test.stl");
+    PHYSFS_deinit();
+  }
+};
+
+} // namespace
+
+TEST_F(SaveQueueBenchmark, save_file)
+{
+  const LogLevel log_level = g_log_level;
+  g_log_level = LOG_WARNING;
+
+  const int saves = 10;
+
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < saves; ++i)
+  {
+    SaveQueue::save_file("save_queue_test.stl", write_level);
+  }
+  auto time_sync = std::chrono::duration_cast<std::chrono::microseconds>(
+    std::chrono::steady_clock::now() - start);
+
+  SaveQueue queue;
+  start = std::chrono::steady_clock::now();
+  for (int i = 0; i < saves; ++i)
+  {
+    SaveQueue::save_file("save_queue_test.stl", write_level);
+  }
+  auto time_queued = std::chrono::duration_cast<std::chrono::microseconds>(
+    std::chrono::steady_clock::now() - start);
+  queue.flush();
+
+  std::cout << "Main thread time per save: synchronous "
+            << static_cast<double>(time_sync.count()) / saves / 1000.0 << " ms, queued "
+            << static_cast<double>(time_queued.count()) / saves / 1000.0 << " ms (serializing "
+            << queue.get_main_thread_time() * 1000.0f / saves << " ms)" << std::endl;
+
+  g_log_level = log_level;
+}
+
+/* EOF */
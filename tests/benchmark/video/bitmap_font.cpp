@@ -0,0 +1,98 @@
+//  SuperTux
+//  Copyright (C) 2024 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "video/bitmap_font.hpp"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+#include <memory>
+
+#include <physfs.h>
+
+#include "control/input_manager.hpp"
+#include "object/textscroller.hpp"
+#include "supertux/gameconfig.hpp"
+#include "supertux/globals.hpp"
+#include "supertux/resources.hpp"
+#include "util/log.hpp"
+#include "util/reader_document.hpp"
+#include "video/compositor.hpp"
+#include "video/drawing_context.hpp"
+#include "video/null/null_video_system.hpp"
+
+TEST(BitmapFontBenchmark, credits)
+{
+  PHYSFS_init("bitmap_font_benchmark");
+  if (PHYSFS_mount("../data", nullptr, 1) == 0 || !PHYSFS_exists("credits.stxt"))
+  {
+    PHYSFS_deinit();
+    GTEST_SKIP() << "game data not found";
+  }
+
+  const LogLevel log_level = g_log_level;
+  g_log_level = LOG_WARNING;
+
+  Config* old_config = g_config;
+  Config config;
+  g_config = &config;
+
+  {
+    NullVideoSystem video_system;
+    InputManager input_manager(config.keyboard_config, config.joystick_config);
+    Compositor compositor(video_system);
+
+    {
+      auto doc = ReaderDocument::from_file("credits.stxt");
+      TextScroller scroller(doc.get_root());
+
+      for (bool cached : { false, true })
+      {
+        Resources::normal_font = std::make_shared<BitmapFont>(BitmapFont::VARIABLE, "fonts/white.stf", 2, cached);
+        Resources::small_font = std::make_shared<BitmapFont>(BitmapFont::VARIABLE, "fonts/white-small.stf", 1, cached);
+        Resources::big_font = std::make_shared<BitmapFont>(BitmapFont::VARIABLE, "fonts/white-big.stf", 3, cached);
+
+        const int frames = 1200;
+        scroller.scroll(-1000000.0f);
+
+        auto start = std::chrono::steady_clock::now();
+        for (int frame = 0; frame < frames; ++frame)
+        {
+          // about two scroller speeds, so that lines come and go
+          scroller.scroll(2.0f);
+          scroller.draw(compositor.make_context(true));
+          compositor.render();
+        }
+        auto time = std::chrono::duration_cast<std::chrono::microseconds>(
+          std::chrono::steady_clock::now() - start);
+
+        std::cout << "Credits, " << (cached ? "cached" : "uncached") << " layout: "
+                  << static_cast<double>(time.count()) / frames << " us/frame" << std::endl;
+      }
+    }
+
+    Resources::normal_font.reset();
+    Resources::small_font.reset();
+    Resources::big_font.reset();
+  }
+
+  g_config = old_config;
+  g_log_level = log_level;
+  PHYSFS_deinit();
+}
+
+/* EOF */
@@ -0,0 +1,197 @@
+//  SuperTux
+//  Copyright (C) 2024 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "video/compositor.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <vector>
+
+#include "math/rectf.hpp"
+#include "supertux/gameconfig.hpp"
+#include "supertux/globals.hpp"
+#include "util/log.hpp"
+#include "video/drawing_context.hpp"
+#include "video/layer.hpp"
+#include "video/null/null_texture.hpp"
+#include "video/null/null_video_system.hpp"
+#include "video/surface.hpp"
+
+namespace {
+
+std::atomic<size_t> g_allocation_count(0);
+
+} // namespace
+
+// Count all heap allocations of the benchmark binary
+void* operator new(size_t size)
+{
+  g_allocation_count += 1;
+  void* ptr = std::malloc(size ? size : 1);
+  if (!ptr)
+    throw std::bad_alloc();
+  return ptr;
+}
+
+void operator delete(void* ptr) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept
+{
+  std::free(ptr);
+}
+
+namespace {
+
+void draw_frame(Compositor& compositor, const SurfacePtr& surface,
+                const std::vector<Rectf>& srcrects, const std::vector<Rectf>& dstrects)
+{
+  auto& context = compositor.make_context();
+  context.push_transform();
+  context.set_translation(Vector(16.0f, 16.0f));
+  for (int i = 0; i < 300; ++i)
+  {
+    context.color().draw_surface(surface, Vector(static_cast<float>(i % 40) * 32.0f,
+                                                 static_cast<float>(i / 40) * 32.0f),
+                                 LAYER_OBJECTS);
+  }
+  context.color().draw_surface_batch(surface, srcrects, dstrects, Color::WHITE, LAYER_TILES);
+  context.pop_transform();
+
+  auto& hud = compositor.make_context(true);
+  hud.color().draw_filled_rect(Rectf(0.0f, 0.0f, 200.0f, 40.0f), Color(0.0f, 0.0f, 0.0f, 0.5f), LAYER_GUI);
+  hud.color().draw_surface_part(surface, Rectf(0.0f, 0.0f, 16.0f, 16.0f),
+                                Rectf(8.0f, 8.0f, 24.0f, 24.0f), LAYER_GUI);
+
+  compositor.render();
+}
+
+/** A level with a lot of objects, each drawing to the color and the
+    light canvas in a random looking layer order */
+void draw_crowded_frame(Compositor& compositor, const SurfacePtr& surface, int objects)
+{
+  auto& context = compositor.make_context();
+  context.set_ambient_color(Color(0.2f, 0.2f, 0.2f));
+  for (int i = 0; i < objects; ++i)
+  {
+    const Vector pos(static_cast<float>((i * 37) % 1280), static_cast<float>((i * 91) % 800));
+    const int layer = LAYER_BACKGROUNDTILES + (i * 7919) % 600;
+    context.color().draw_surface(surface, pos, layer);
+    context.color().draw_filled_rect(Rectf(pos, Sizef(4.0f, 4.0f)), Color::WHITE, layer + 1);
+    if (i % 4 == 0)
+      context.light().draw_surface(surface, pos, 0);
+  }
+
+  auto& hud = compositor.make_context(true);
+  hud.color().draw_filled_rect(Rectf(0.0f, 0.0f, 200.0f, 40.0f), Color(0.0f, 0.0f, 0.0f, 0.5f), LAYER_GUI);
+
+  compositor.render();
+}
+
+} // namespace
+
+
+TEST(CompositorBenchmark, frame)
+{
+  const int frames = 200;
+
+  const LogLevel log_level = g_log_level;
+  g_log_level = LOG_WARNING;
+
+  Config* old_config = g_config;
+  Config config;
+  g_config = &config;
+
+  {
+    NullVideoSystem video_system;
+    Compositor compositor(video_system);
+    SurfacePtr surface = Surface::from_texture(TexturePtr(new NullTexture(Size(256, 256))));
+
+    std::vector<Rectf> srcrects;
+    std::vector<Rectf> dstrects;
+    for (int y = 0; y < 25; ++y) {
+      for (int x = 0; x < 40; ++x) {
+        srcrects.emplace_back(0.0f, 0.0f, 32.0f, 32.0f);
+        dstrects.emplace_back(Vector(static_cast<float>(x) * 32.0f, static_cast<float>(y) * 32.0f),
+                              Sizef(32.0f, 32.0f));
+      }
+    }
+
+    // let the arena and the request lists grow to their working size
+    for (int frame = 0; frame < 4; ++frame) {
+      draw_frame(compositor, surface, srcrects, dstrects);
+    }
+
+    const size_t count = g_allocation_count;
+    auto start = std::chrono::steady_clock::now();
+    for (int frame = 0; frame < frames; ++frame) {
+      draw_frame(compositor, surface, srcrects, dstrects);
+    }
+    auto time = std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::steady_clock::now() - start);
+    const size_t allocations = g_allocation_count - count;
+
+    std::cout << "Compositor: " << static_cast<double>(allocations) / frames << " allocations/frame, "
+              << static_cast<double>(time.count()) / frames << " us/frame" << std::endl;
+
+    EXPECT_EQ(allocations, 0u);
+  }
+
+  g_config = old_config;
+  g_log_level = log_level;
+}
+
+TEST(CompositorBenchmark, crowded)
+{
+  const int frames = 50;
+  const int objects = 3000;
+
+  const LogLevel log_level = g_log_level;
+  g_log_level = LOG_WARNING;
+
+  Config* old_config = g_config;
+  Config config;
+  g_config = &config;
+
+  {
+    NullVideoSystem video_system;
+    Compositor compositor(video_system);
+    SurfacePtr surface = Surface::from_texture(TexturePtr(new NullTexture(Size(32, 32))));
+
+    draw_crowded_frame(compositor, surface, objects);
+
+    auto start = std::chrono::steady_clock::now();
+    for (int frame = 0; frame < frames; ++frame) {
+      draw_crowded_frame(compositor, surface, objects);
+    }
+    auto time = std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::steady_clock::now() - start);
+
+    std::cout << objects << " objects: " << static_cast<double>(time.count()) / frames << " us/frame" << std::endl;
+  }
+
+  g_config = old_config;
+  g_log_level = log_level;
+}
+
+/* EOF */
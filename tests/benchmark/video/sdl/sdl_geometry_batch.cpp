@@ -0,0 +1,98 @@
+//  SuperTux
+//  Copyright (C) 2024 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "video/sdl/sdl_geometry_batch.hpp"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+
+TEST(SDLGeometryBatchBenchmark, tiles)
+{
+  // A 1280x800 screen covered by two layers of 32x32 tiles
+  const int columns = 40;
+  const int rows = 25;
+  const int layers = 2;
+  const int frames = 60;
+
+  SDL_Surface* target = SDL_CreateRGBSurfaceWithFormat(0, columns * 32, rows * 32, 32, SDL_PIXELFORMAT_ARGB8888);
+  ASSERT_TRUE(target != nullptr);
+  SDL_Renderer* renderer = SDL_CreateSoftwareRenderer(target);
+  ASSERT_TRUE(renderer != nullptr);
+
+  SDL_Surface* tileset = SDL_CreateRGBSurfaceWithFormat(0, 256, 256, 32, SDL_PIXELFORMAT_ARGB8888);
+  SDL_FillRect(tileset, nullptr, 0xff808080);
+  SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, tileset);
+  SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+
+  std::vector<SDL_Rect> srcrects;
+  std::vector<SDL_Rect> dstrects;
+  for (int layer = 0; layer < layers; ++layer) {
+    for (int y = 0; y < rows; ++y) {
+      for (int x = 0; x < columns; ++x) {
+        const int tile = (x + y * 3 + layer) % 64;
+        srcrects.push_back(SDL_Rect{(tile % 8) * 32, (tile / 8) * 32, 32, 32});
+        dstrects.push_back(SDL_Rect{x * 32, y * 32, 32, 32});
+      }
+    }
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  for (int frame = 0; frame < frames; ++frame) {
+    for (size_t i = 0; i < srcrects.size(); ++i) {
+      SDL_SetTextureColorMod(texture, 255, 255, 255);
+      SDL_SetTextureAlphaMod(texture, 255);
+      SDL_RenderCopyEx(renderer, texture, &srcrects[i], &dstrects[i], 0.0, nullptr, SDL_FLIP_NONE);
+    }
+  }
+  auto copy_time = std::chrono::duration_cast<std::chrono::microseconds>(
+    std::chrono::steady_clock::now() - start);
+
+  SDLGeometryBatch batch;
+  bool supported = true;
+  start = std::chrono::steady_clock::now();
+  for (int frame = 0; frame < frames && supported; ++frame) {
+    batch.clear(256, 256);
+    for (size_t i = 0; i < srcrects.size(); ++i) {
+      batch.add_quad(srcrects[i], dstrects[i], 0.0f, SDL_FLIP_NONE, SDL_Color{255, 255, 255, 255});
+    }
+    supported = batch.render(renderer, texture);
+  }
+  auto geometry_time = std::chrono::duration_cast<std::chrono::microseconds>(
+    std::chrono::steady_clock::now() - start);
+
+  std::cout << srcrects.size() << " tiles, SDL_RenderCopyEx: "
+            << static_cast<double>(copy_time.count()) / frames << " us/frame" << std::endl;
+  if (supported) {
+    std::cout << srcrects.size() << " tiles, SDL_RenderGeometry: "
+              << static_cast<double>(geometry_time.count()) / frames << " us/frame" << std::endl;
+  } else {
+    std::cout << "SDL_RenderGeometry() not supported: " << SDL_GetError() << std::endl;
+  }
+
+  SDL_DestroyTexture(texture);
+  SDL_FreeSurface(tileset);
+  SDL_DestroyRenderer(renderer);
+  SDL_FreeSurface(target);
+}
+
+#endif
+
+/* EOF */
@@ -0,0 +1,137 @@
+//  SuperTux
+//  Copyright (C) 2024 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "video/texture_manager.hpp"
+
+#include <gtest/gtest.h>
+
+#include <iostream>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <physfs.h>
+#include <sexp/value.hpp>
+
+#include "supertux/gameconfig.hpp"
+#include "supertux/globals.hpp"
+#include "supertux/tile.hpp"
+#include "supertux/tile_set.hpp"
+#include "util/reader_document.hpp"
+#include "video/null/null_video_system.hpp"
+#include "video/surface.hpp"
+
+namespace {
+
+void collect_tile_references(const sexp::Value& sx, std::set<uint32_t>& ids)
+{
+  if (!sx.is_array())
+    return;
+
+  const auto& arr = sx.as_array();
+  if (!arr.empty() && arr[0].is_symbol() && arr[0].as_string() == "tiles")
+  {
+    for (size_t i = 1; i < arr.size(); ++i)
+    {
+      if (arr[i].is_integer() && arr[i].as_int() > 0)
+        ids.insert(static_cast<uint32_t>(arr[i].as_int()));
+    }
+  }
+  else
+  {
+    for (const auto& item : arr)
+      collect_tile_references(item, ids);
+  }
+}
+
+/** Returns the value of a "name:value" line of TextureManager::debug_print() */
+std::string get_texture_stat(const std::string& name)
+{
+  std::ostringstream out;
+  TextureManager::current()->debug_print(out);
+
+  std::istringstream in(out.str());
+  std::string line;
+  while (std::getline(in, line))
+  {
+    if (line.compare(0, name.size() + 1, name + ":") == 0)
+      return line.substr(name.size() + 1);
+  }
+  return "?";
+}
+
+/** Before regions shared their parent's texture, every tile surface
+    had a texture of its own, so the surface count is the texture count
+    and the texture switches of the old code */
+void print_surfaces(const std::string& what, TileSet& tileset, const std::set<uint32_t>& ids)
+{
+  std::set<const Surface*> surfaces;
+  std::set<const Texture*> textures;
+  for (const auto id : ids)
+  {
+    const SurfacePtr& surface = tileset.resolve(id).get_current_surface();
+    if (surface)
+    {
+      surfaces.insert(surface.get());
+      textures.insert(surface->get_texture().get());
+    }
+  }
+
+  std::cout << what << ": " << surfaces.size() << " tile surfaces drawn from "
+            << textures.size() << " textures" << std::endl;
+}
+
+} // namespace
+
+TEST(TextureManagerBenchmark, shared_regions)
+{
+  PHYSFS_init("texture_manager_benchmark");
+  if (PHYSFS_mount("../data", nullptr, 1) == 0 || !PHYSFS_exists("images/tiles.strf"))
+  {
+    PHYSFS_deinit();
+    GTEST_SKIP() << "game data not found";
+  }
+
+  Config* old_config = g_config;
+  Config config;
+  g_config = &config;
+
+  {
+    NullVideoSystem video_system;
+    auto tileset = TileSet::from_file("images/tiles.strf");
+
+    // the tiles a tilemap of this level batches together per frame
+    std::set<uint32_t> level_ids;
+    collect_tile_references(ReaderDocument::from_file("levels/world1/welcome_antarctica.stl").get_sexp(), level_ids);
+    print_surfaces("welcome_antarctica", *tileset, level_ids);
+
+    std::set<uint32_t> all_ids;
+    for (uint32_t id = 1; id < tileset->get_max_tileid(); ++id)
+      all_ids.insert(id);
+    print_surfaces("whole tileset", *tileset, all_ids);
+
+    std::cout << "live textures: " << get_texture_stat("live texture count")
+              << ", of which atlases: " << get_texture_stat("live atlas count")
+              << ", texture pixels: " << get_texture_stat("total texture pixels")
+              << ", decoded surface bytes: " << get_texture_stat("total surface bytes") << std::endl;
+  }
+
+  g_config = old_config;
+  PHYSFS_deinit();
+}
+
+/* EOF */
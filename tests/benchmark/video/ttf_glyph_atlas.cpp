@@ -0,0 +1,99 @@
+//  SuperTux
+//  Copyright (C) 2024 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "video/ttf_glyph_atlas.hpp"
+
+#include <gtest/gtest.h>
+
+#include <iostream>
+#include <sstream>
+
+#include <physfs.h>
+#include <SDL_ttf.h>
+
+#include "supertux/gameconfig.hpp"
+#include "supertux/globals.hpp"
+#include "video/compositor.hpp"
+#include "video/drawing_context.hpp"
+#include "video/null/null_video_system.hpp"
+#include "video/ttf_font.hpp"
+#include "video/ttf_surface_manager.hpp"
+
+TEST(TTFGlyphAtlasBenchmark, hud_uploads)
+{
+  PHYSFS_init("ttf_glyph_atlas_benchmark");
+  if (PHYSFS_mount("../data", nullptr, 1) == 0 || !PHYSFS_exists("fonts/SuperTux-Medium.ttf"))
+  {
+    PHYSFS_deinit();
+    GTEST_SKIP() << "game data not found";
+  }
+  ASSERT_EQ(TTF_Init(), 0);
+
+  Config* old_config = g_config;
+  Config config;
+  g_config = &config;
+  const float old_real_time = g_real_time;
+
+  {
+    NullVideoSystem video_system;
+    Compositor compositor(video_system);
+    TTFSurfaceManager ttf_surface_manager;
+    TTFFont font("fonts/SuperTux-Medium.ttf", 18, 1.25f, 2, 1);
+
+    for (bool atlas : { false, true })
+    {
+      ttf_surface_manager.set_glyph_atlas_enabled(atlas);
+
+      // ten seconds of a level with timer, coins, FPS and a few console lines
+      const int frames = 600;
+      g_real_time = 0.0f;
+      ttf_surface_manager.get_texture_upload_rate();
+      for (int frame = 0; frame <= frames; ++frame)
+      {
+        g_real_time = static_cast<float>(frame) / 60.0f;
+        DrawingContext& context = compositor.make_context(true);
+
+        std::ostringstream timer, coins, fps;
+        timer << "TIME " << 300 - frame / 60 << "." << (100 - frame % 60 * 100 / 60) % 100;
+        coins << 100 + frame / 15;
+        fps << "FPS: " << 58 + frame / 60 % 3;
+        font.draw_text(context.color(), timer.str(), Vector(100.0f, 10.0f), ALIGN_LEFT, LAYER_HUD, Color::WHITE);
+        font.draw_text(context.color(), coins.str(), Vector(1200.0f, 10.0f), ALIGN_RIGHT, LAYER_HUD, Color::WHITE);
+        font.draw_text(context.color(), fps.str(), Vector(1200.0f, 780.0f), ALIGN_RIGHT, LAYER_HUD, Color::WHITE);
+        for (int line = 0; line < 5; ++line)
+        {
+          std::ostringstream console;
+          console << "[DEBUG] frame " << frame - line;
+          font.draw_text(context.color(), console.str(), Vector(10.0f, 400.0f + 20.0f * static_cast<float>(line)),
+                         ALIGN_LEFT, LAYER_HUD, Color::WHITE);
+        }
+
+        compositor.render();
+      }
+
+      std::cout << "HUD text, " << (atlas ? "glyph atlas" : "texture per string") << ": "
+                << ttf_surface_manager.get_texture_upload_rate() << " texture uploads/s, "
+                << ttf_surface_manager.get_texture_upload_pixel_rate() * 4.0f / 1024.0f << " KiB/s" << std::endl;
+    }
+  }
+
+  g_real_time = old_real_time;
+  g_config = old_config;
+  TTF_Quit();
+  PHYSFS_deinit();
+}
+
+/* EOF */
@@ -0,0 +1,80 @@
+//  SuperTux
+//  Copyright (C) 2016 Tapesh Mandal <tapesh.mandal@gmail.com>
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "collision/collision.hpp"
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include "math/aatriangle.hpp"
+#include "math/rectf.hpp"
+
+namespace {
+
+void expect_same_constraints(const collision::Constraints& lhs, const collision::Constraints& rhs)
+{
+  EXPECT_EQ(lhs.hit.left, rhs.hit.left);
+  EXPECT_EQ(lhs.hit.right, rhs.hit.right);
+  EXPECT_EQ(lhs.hit.top, rhs.hit.top);
+  EXPECT_EQ(lhs.hit.bottom, rhs.hit.bottom);
+  EXPECT_NEAR(lhs.hit.slope_normal.x, rhs.hit.slope_normal.x, 1e-5f);
+  EXPECT_NEAR(lhs.hit.slope_normal.y, rhs.hit.slope_normal.y, 1e-5f);
+  if (lhs.has_constraints())
+  {
+    EXPECT_NEAR(lhs.get_position_left(), rhs.get_position_left(), 1e-2f);
+    EXPECT_NEAR(lhs.get_position_right(), rhs.get_position_right(), 1e-2f);
+    EXPECT_NEAR(lhs.get_position_top(), rhs.get_position_top(), 1e-2f);
+    EXPECT_NEAR(lhs.get_position_bottom(), rhs.get_position_bottom(), 1e-2f);
+  }
+}
+
+} // namespace
+
+TEST(CollisionTest, rectangle_slope)
+{
+  std::mt19937 rng(4321);
+  std::uniform_real_distribution<float> position(-40.0f, 40.0f);
+  std::uniform_real_distribution<float> size(8.0f, 64.0f);
+
+  const Rectf tile_bbox(Vector(320.0f, 64.0f), Vector(352.0f, 96.0f));
+  for (int deform = 0; deform < 5; ++deform)
+  {
+    for (int direction = 0; direction < 4; ++direction)
+    {
+      const int dir = (deform << 4) | direction;
+      for (int i = 0; i < 500; ++i)
+      {
+        const Vector p1 = tile_bbox.p1() + Vector(position(rng), position(rng));
+        const Rectf rect(p1, p1 + Vector(size(rng), size(rng)));
+
+        collision::Constraints expected;
+        bool expected_bottom = false;
+        const bool expected_hit = collision::rectangle_aatriangle(&expected, rect, AATriangle(tile_bbox, dir), expected_bottom);
+
+        collision::Constraints result;
+        bool result_bottom = false;
+        const bool result_hit = collision::rectangle_slope(&result, rect, tile_bbox, dir, result_bottom);
+
+        ASSERT_EQ(result_hit, expected_hit);
+        ASSERT_EQ(result_bottom, expected_bottom);
+        expect_same_constraints(result, expected);
+      }
+    }
+  }
+}
+
+/* EOF */
@@ -0,0 +1,149 @@
+//  SuperTux
+//  Copyright (C) 2024 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "collision/spatial_hash.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "collision/collision_hit.hpp"
+#include "collision/collision_listener.hpp"
+#include "collision/collision_object.hpp"
+#include "math/rectf.hpp"
+
+namespace {
+
+class DummyListener final : public CollisionListener
+{
+public:
+  void collision_solid(const CollisionHit&) override {}
+  bool collides(GameObject&, const CollisionHit&) const override { return false; }
+  HitResponse collision(GameObject&, const CollisionHit&) override { return ABORT_MOVE; }
+  void collision_tile(uint32_t) override {}
+  bool listener_is_valid() const override { return true; }
+};
+
+/** A sector of 3000 objects in a 600x30 tile level */
+class SpatialHashTest : public ::testing::Test
+{
+protected:
+  SpatialHashTest() :
+    m_rng(1234),
+    m_listener(),
+    m_objects(),
+    m_hash()
+  {
+  }
+
+  void SetUp() override
+  {
+    for (int i = 0; i < 3000; ++i)
+    {
+      m_objects.emplace_back(new CollisionObject(COLGROUP_MOVING, m_listener));
+      m_objects.back()->set_size(32.0f, 32.0f);
+      m_objects.back()->set_pos(random_pos());
+      m_hash.insert(*m_objects.back());
+    }
+
+    // a few objects larger than the screen
+    for (int i = 0; i < 3; ++i)
+    {
+      m_objects.emplace_back(new CollisionObject(COLGROUP_STATIC, m_listener));
+      m_objects.back()->set_size(4000.0f, 600.0f);
+      m_objects.back()->set_pos(random_pos());
+      m_hash.insert(*m_objects.back());
+    }
+  }
+
+  Vector random_pos()
+  {
+    std::uniform_real_distribution<float> x(0.0f, 600.0f * 32.0f);
+    std::uniform_real_distribution<float> y(0.0f, 30.0f * 32.0f);
+    return Vector(x(m_rng), y(m_rng));
+  }
+
+  std::vector<CollisionObject*> query_linear(const Rectf& rect) const
+  {
+    std::vector<CollisionObject*> result;
+    for (const auto& object : m_objects)
+    {
+      if (rect.contains(object->get_bbox()))
+        result.push_back(object.get());
+    }
+    return result;
+  }
+
+protected:
+  std::mt19937 m_rng;
+  DummyListener m_listener;
+  std::vector<std::unique_ptr<CollisionObject> > m_objects;
+  SpatialHash m_hash;
+};
+
+} // namespace
+
+TEST_F(SpatialHashTest, matches_linear_scan)
+{
+  for (int frame = 0; frame < 20; ++frame)
+  {
+    // move every object a bit, some of them far
+    for (size_t i = 0; i < m_objects.size(); ++i)
+    {
+      auto& object = *m_objects[i];
+      object.set_pos(i % 10 == 0 ? random_pos() : object.get_pos() + Vector(5.0f, -3.0f));
+      m_hash.update(object);
+    }
+
+    for (int i = 0; i < 50; ++i)
+    {
+      const Rectf rect(random_pos(), Sizef(static_cast<float>(i * 16), 96.0f));
+
+      std::vector<CollisionObject*> result;
+      m_hash.query(rect, result);
+      auto expected = query_linear(rect);
+
+      std::sort(result.begin(), result.end());
+      std::sort(expected.begin(), expected.end());
+      ASSERT_EQ(result, expected);
+    }
+  }
+
+  // a query spanning the whole level walks the occupied cells instead
+  std::vector<CollisionObject*> result;
+  m_hash.query(Rectf(-100000.0f, -100000.0f, 100000.0f, 100000.0f), result);
+  ASSERT_EQ(result.size(), m_objects.size());
+}
+
+TEST_F(SpatialHashTest, remove)
+{
+  auto& object = *m_objects.front();
+  m_hash.remove(object);
+
+  std::vector<CollisionObject*> result;
+  m_hash.query(object.get_bbox(), result);
+  ASSERT_EQ(std::find(result.begin(), result.end(), &object), result.end());
+
+  m_hash.insert(object);
+  result.clear();
+  m_hash.query(object.get_bbox(), result);
+  ASSERT_NE(std::find(result.begin(), result.end(), &object), result.end());
+}
+
+/* EOF */
@@ -0,0 +1,159 @@
+//  SuperTux
+//  Copyright (C) 2024 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "editor/flood_fill.hpp"
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <stdint.h>
+#include <vector>
+
+namespace {
+
+struct Grid
+{
+  int width;
+  int height;
+  std::vector<uint32_t> tiles;
+
+  uint32_t& at(int x, int y) { return tiles[y * width + x]; }
+};
+
+/** A 2x2 pattern of tiles, like a TileSelection */
+uint32_t pattern(int x, int y, bool multi)
+{
+  if (!multi)
+    return 7;
+  return 7 + static_cast<uint32_t>(((x % 2) + 2) % 2 + (((y % 2) + 2) % 2) * 2);
+}
+
+bool check(uint32_t replace_tile, uint32_t target_tile, uint32_t third_tile)
+{
+  return replace_tile == target_tile && replace_tile != third_tile;
+}
+
+/** The depth first fill that EditorOverlayWidget::fill() used before */
+void reference_fill(Grid& grid, int sx, int sy, bool multi)
+{
+  uint32_t replace_tile = grid.at(sx, sy);
+  if (replace_tile == pattern(0, 0, multi))
+    return;
+
+  std::vector<std::pair<int, int> > stack;
+  stack.push_back({ sx, sy });
+  while (!stack.empty()) {
+    const int x = stack.back().first;
+    const int y = stack.back().second;
+    const int tx = x - sx;
+    const int ty = y - sy;
+
+    grid.at(x, y) = pattern(tx, ty, multi);
+
+    if (x > 0 && check(replace_tile, grid.at(x - 1, y), pattern(tx - 1, ty, multi))) {
+      stack.push_back({ x - 1, y });
+      continue;
+    }
+    if (x < grid.width - 1 && check(replace_tile, grid.at(x + 1, y), pattern(tx + 1, ty, multi))) {
+      stack.push_back({ x + 1, y });
+      continue;
+    }
+    if (y > 0 && check(replace_tile, grid.at(x, y - 1), pattern(tx, ty - 1, multi))) {
+      stack.push_back({ x, y - 1 });
+      continue;
+    }
+    if (y < grid.height - 1 && check(replace_tile, grid.at(x, y + 1), pattern(tx, ty + 1, multi))) {
+      stack.push_back({ x, y + 1 });
+      continue;
+    }
+    stack.pop_back();
+  }
+}
+
+Rect scanline_fill(Grid& grid, int sx, int sy, bool multi)
+{
+  uint32_t replace_tile = grid.at(sx, sy);
+  if (replace_tile == pattern(0, 0, multi))
+    return Rect();
+
+  return flood_fill(grid.width, grid.height, sx, sy,
+    [&](int x, int y) {
+      return check(replace_tile, grid.at(x, y), pattern(x - sx, y - sy, multi));
+    },
+    [&](int y, int left, int right) {
+      for (int x = left; x < right; ++x) {
+        grid.at(x, y) = pattern(x - sx, y - sy, multi);
+      }
+    });
+}
+
+Grid random_grid(std::mt19937& rng, int width, int height, int tile_count)
+{
+  Grid grid{ width, height, std::vector<uint32_t>(width * height) };
+  std::uniform_int_distribution<int> dist(0, tile_count - 1);
+  for (auto& tile : grid.tiles) {
+    tile = static_cast<uint32_t>(dist(rng)) * 3;
+  }
+  return grid;
+}
+
+} // namespace
+
+TEST(FloodFillTest, outside)
+{
+  int calls = 0;
+  Rect rect = flood_fill(10, 10, 10, 0,
+                         [](int, int) { return true; },
+                         [&calls](int, int, int) { calls += 1; });
+  ASSERT_TRUE(rect.empty());
+  ASSERT_EQ(calls, 0);
+}
+
+TEST(FloodFillTest, bounding_box)
+{
+  Grid grid{ 5, 3, {
+      1, 0, 0, 1, 1,
+      1, 1, 0, 1, 1,
+      1, 1, 1, 0, 0 } };
+
+  Rect rect = scanline_fill(grid, 0, 0, false);
+  ASSERT_EQ(rect, Rect(0, 0, 3, 3));
+
+  const std::vector<uint32_t> expected = {
+      7, 0, 0, 1, 1,
+      7, 7, 0, 1, 1,
+      7, 7, 7, 0, 0 };
+  ASSERT_EQ(grid.tiles, expected);
+}
+
+TEST(FloodFillTest, matches_reference)
+{
+  std::mt19937 rng(1234);
+  for (int round = 0; round < 200; ++round) {
+    const bool multi = (round % 2) == 1;
+    Grid grid = random_grid(rng, 40, 30, 2 + round % 3);
+    Grid expected = grid;
+
+    const int x = static_cast<int>(rng() % 40);
+    const int y = static_cast<int>(rng() % 30);
+    reference_fill(expected, x, y, multi);
+    scanline_fill(grid, x, y, multi);
+
+    ASSERT_EQ(grid.tiles, expected.tiles) << "round " << round;
+  }
+}
+
+/* EOF */
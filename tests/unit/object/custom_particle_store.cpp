@@ -0,0 +1,89 @@
+//  SuperTux
+//  Copyright (C) 2024 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "object/custom_particle_store.hpp"
+
+#include <gtest/gtest.h>
+
+TEST(CustomParticleStoreTest, add)
+{
+  CustomParticleStore store;
+  ASSERT_TRUE(store.empty());
+
+  size_t i = store.add();
+  ASSERT_EQ(i, 0u);
+  ASSERT_EQ(store.size(), 1u);
+  ASSERT_EQ(store.pos_x[i], 0.0f);
+  ASSERT_EQ(store.scale[i], 1.0f);
+  ASSERT_EQ(store.alpha[i], 1.0f);
+  ASSERT_FALSE(store.is_stuck(i));
+  ASSERT_EQ(store.flags[i], 0);
+}
+
+TEST(CustomParticleStoreTest, remove_dead)
+{
+  CustomParticleStore store;
+  for (int i = 0; i < 5; ++i) {
+    store.pos_x[store.add()] = static_cast<float>(i);
+  }
+
+  store.set_flag(1, CustomParticleStore::READY_FOR_DELETION);
+  store.set_flag(3, CustomParticleStore::READY_FOR_DELETION);
+  store.remove_dead();
+
+  ASSERT_EQ(store.size(), 3u);
+  ASSERT_EQ(store.pos_x[0], 0.0f);
+  ASSERT_EQ(store.pos_x[1], 2.0f);
+  ASSERT_EQ(store.pos_x[2], 4.0f);
+  ASSERT_EQ(store.flags.size(), 3u);
+}
+
+TEST(CustomParticleStoreTest, integrate)
+{
+  CustomParticleStore store;
+  size_t free = store.add();
+  size_t stuck = store.add();
+  size_t held = store.add();
+  for (size_t i = 0; i < store.size(); ++i) {
+    store.speed_x[i] = 10.0f;
+    store.acc_y[i] = 20.0f;
+    store.friction_x[i] = 0.5f;
+    store.lifetime[i] = 0.25f;
+  }
+  store.set_stuck(stuck);
+  store.move[held] = 0.0f;
+
+  store.integrate_lifetime(0.5f);
+  store.integrate_speed(0.5f);
+  store.integrate_position(0.5f);
+
+  ASSERT_EQ(store.lifetime[free], 0.0f);
+
+  ASSERT_FLOAT_EQ(store.speed_x[free], 7.5f);
+  ASSERT_FLOAT_EQ(store.speed_y[free], 10.0f);
+  ASSERT_FLOAT_EQ(store.pos_x[free], 3.75f);
+  ASSERT_FLOAT_EQ(store.pos_y[free], 5.0f);
+
+  ASSERT_EQ(store.speed_x[stuck], 10.0f);
+  ASSERT_EQ(store.pos_x[stuck], 0.0f);
+  ASSERT_TRUE(store.is_stuck(stuck));
+
+  ASSERT_FLOAT_EQ(store.speed_x[held], 7.5f);
+  ASSERT_EQ(store.pos_x[held], 0.0f);
+  ASSERT_EQ(store.move[held], 1.0f);
+}
+
+/* EOF */
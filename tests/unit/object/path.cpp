@@ -0,0 +1,142 @@
+//  SuperTux
+//  Copyright (C) 2024 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "object/path.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "math/bezier.hpp"
+
+namespace {
+
+/** 200 paths of four curved nodes, like the platforms of
+    data/levels/test/paths.stl */
+class PathTest : public ::testing::Test
+{
+protected:
+  PathTest() :
+    m_paths()
+  {
+  }
+
+  void SetUp() override
+  {
+    std::mt19937 rng(1234);
+    std::uniform_real_distribution<float> offset(-96.0f, 96.0f);
+
+    for (int i = 0; i < 200; ++i)
+    {
+      const Vector base(static_cast<float>(i % 50) * 192.0f, static_cast<float>(i / 50) * 224.0f);
+      m_paths.emplace_back(new Path(base));
+
+      const Vector corners[] = { Vector(128.0f, 0.0f), Vector(128.0f, 128.0f), Vector(0.0f, 128.0f) };
+      for (const auto& corner : corners)
+      {
+        Path::Node node;
+        node.position = base + corner;
+        node.bezier_before = node.position + Vector(offset(rng), offset(rng));
+        node.bezier_after = node.position + Vector(offset(rng), offset(rng));
+        node.time = 1.0f;
+        m_paths.back()->m_nodes.push_back(node);
+      }
+
+      auto& first = m_paths.back()->m_nodes.front();
+      first.bezier_before = first.position + Vector(offset(rng), offset(rng));
+      first.bezier_after = first.position + Vector(offset(rng), offset(rng));
+    }
+  }
+
+  static void get_curve(const Path& path, size_t node, bool reverse, Vector* p)
+  {
+    const auto& nodes = path.get_nodes();
+    const auto& current = nodes[node];
+    const auto& next = nodes[(node + 1) % nodes.size()];
+    if (reverse)
+    {
+      p[0] = next.position;
+      p[1] = next.bezier_before;
+      p[2] = current.bezier_after;
+      p[3] = current.position;
+    }
+    else
+    {
+      p[0] = current.position;
+      p[1] = current.bezier_after;
+      p[2] = next.bezier_before;
+      p[3] = next.position;
+    }
+  }
+
+protected:
+  std::vector<std::unique_ptr<Path> > m_paths;
+};
+
+} // namespace
+
+TEST_F(PathTest, matches_sampling)
+{
+  for (const auto& path : m_paths)
+  {
+    for (size_t node = 0; node < path->get_nodes().size(); ++node)
+    {
+      for (bool reverse : { false, true })
+      {
+        Vector p[4];
+        get_curve(*path, node, reverse, p);
+
+        for (int i = 0; i <= 50; ++i)
+        {
+          const float t = static_cast<float>(i) / 50.0f;
+          const Vector expected = Bezier::get_point_by_length(p[0], p[1], p[2], p[3], t);
+          const Vector result = path->get_point_by_length(node, p[0], p[1], p[2], p[3], t);
+          ASSERT_NEAR(result.x, expected.x, 0.05f);
+          ASSERT_NEAR(result.y, expected.y, 0.05f);
+        }
+      }
+    }
+  }
+}
+
+TEST_F(PathTest, edited_nodes)
+{
+  Path& path = *m_paths.front();
+
+  Vector p[4];
+  get_curve(path, 0, false, p);
+  path.get_point_by_length(0, p[0], p[1], p[2], p[3], 0.5f);
+
+  // moving a handle in the editor changes the curve
+  path.m_nodes[1].bezier_before += Vector(200.0f, -50.0f);
+  get_curve(path, 0, false, p);
+  const Vector expected = Bezier::get_point_by_length(p[0], p[1], p[2], p[3], 0.5f);
+  const Vector result = path.get_point_by_length(0, p[0], p[1], p[2], p[3], 0.5f);
+  ASSERT_NEAR(result.x, expected.x, 0.05f);
+  ASSERT_NEAR(result.y, expected.y, 0.05f);
+
+  // so does adding a node
+  Path::Node node = path.m_nodes.back();
+  node.position += Vector(-64.0f, 32.0f);
+  path.m_nodes.push_back(node);
+  get_curve(path, path.m_nodes.size() - 1, false, p);
+  ASSERT_EQ(path.get_point_by_length(path.m_nodes.size() - 1, p[0], p[1], p[2], p[3], 1.0f),
+            path.m_nodes.front().position);
+}
+
+/* EOF */
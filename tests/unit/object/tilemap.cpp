@@ -0,0 +1,98 @@
+//  SuperTux
+//  Copyright (C) 2016 Tapesh Mandal <tapesh.mandal@gmail.com>
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "object/tilemap.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+#include "math/aatriangle.hpp"
+#include "supertux/tile.hpp"
+#include "supertux/tile_set.hpp"
+
+namespace {
+
+/** A tileset with a solid tile, a unisolid tile and every slope */
+std::unique_ptr<TileSet> make_tileset()
+{
+  auto tileset = std::make_unique<TileSet>();
+  tileset->add_tile(1, std::make_unique<Tile>(std::vector<Tile::ImageSpec>(), std::vector<Tile::ImageSpec>(),
+                                              Tile::SOLID, 0, 0.0f));
+  tileset->add_tile(2, std::make_unique<Tile>(std::vector<Tile::ImageSpec>(), std::vector<Tile::ImageSpec>(),
+                                              Tile::SOLID | Tile::UNISOLID, 0, 0.0f));
+  for (int deform = 0; deform < 5; ++deform)
+  {
+    for (int direction = 0; direction < 4; ++direction)
+    {
+      tileset->add_tile(10 + deform * 4 + direction,
+                        std::make_unique<Tile>(std::vector<Tile::ImageSpec>(), std::vector<Tile::ImageSpec>(),
+                                               Tile::SOLID | Tile::SLOPE, (deform << 4) | direction, 0.0f));
+    }
+  }
+  return tileset;
+}
+
+} // namespace
+
+TEST(TileMapTest, collision_flags)
+{
+  auto tileset = make_tileset();
+  ASSERT_EQ(tileset->get_collision_flags(0), 0);
+  ASSERT_EQ(tileset->get_collision_flags(1), Tile::SOLID);
+  ASSERT_EQ(tileset->get_collision_flags(2), Tile::SOLID | Tile::UNISOLID);
+  ASSERT_EQ(tileset->get_collision_flags(10 + 4 + AATriangle::NORTHEAST),
+            Tile::SOLID | Tile::SLOPE | ((AATriangle::DEFORM_BOTTOM | AATriangle::NORTHEAST) << 8));
+  ASSERT_EQ(tileset->get_collision_flags(1000), 0);
+
+  TileMap tilemap(tileset.get());
+  tilemap.set(3, 2, { 0, 1, 2,
+                      11, 0, 0 }, 0, true);
+  ASSERT_EQ(tilemap.get_collision_column(0)[1], tileset->get_collision_flags(11));
+  ASSERT_EQ(tilemap.get_collision_column(1)[0], Tile::SOLID);
+  ASSERT_EQ(tilemap.get_collision_column(2)[0], Tile::SOLID | Tile::UNISOLID);
+
+  tilemap.change(1, 1, 1);
+  tilemap.change_span(0, 0, { 2, 0 });
+  ASSERT_EQ(tilemap.get_collision_column(1)[1], Tile::SOLID);
+  ASSERT_EQ(tilemap.get_collision_column(0)[0], Tile::SOLID | Tile::UNISOLID);
+  ASSERT_EQ(tilemap.get_collision_column(1)[0], 0);
+
+  tilemap.resize(4, 3);
+  for (int x = 0; x < tilemap.get_width(); ++x)
+    for (int y = 0; y < tilemap.get_height(); ++y)
+      ASSERT_EQ(tilemap.get_collision_column(x)[y], tileset->get_collision_flags(tilemap.get_tile_id(x, y)));
+}
+
+TEST(TileMapTest, take_changed_tiles)
+{
+  auto tileset = make_tileset();
+  TileMap tilemap(tileset.get());
+  tilemap.set(4, 3, std::vector<unsigned int>(12, 0), 0, true);
+  ASSERT_EQ(tilemap.take_changed_tiles(), Rect(0, 0, 4, 3));
+  ASSERT_TRUE(tilemap.take_changed_tiles().empty());
+
+  tilemap.change(1, 2, 1);
+  tilemap.change(3, 0, 2);
+  ASSERT_EQ(tilemap.take_changed_tiles(), Rect(1, 0, 4, 3));
+
+  tilemap.change_span(0, 1, { 1, 1 });
+  ASSERT_EQ(tilemap.take_changed_tiles(), Rect(0, 1, 2, 2));
+  ASSERT_TRUE(tilemap.take_changed_tiles().empty());
+}
+
+/* EOF */
@@ -0,0 +1,252 @@
+//  SuperTux
+//  Copyright (C) 2024 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "squirrel/squirrel_binding.hpp"
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#include <squirrel.h>
+
+#include "squirrel/squirrel_error.hpp"
+#include "squirrel/squirrel_util.hpp"
+
+namespace {
+
+class DummyObject final
+{
+public:
+  DummyObject() : m_x(0.0f), m_y(0.0f), m_name() {}
+  DummyObject(const std::string& name) : m_x(0.0f), m_y(0.0f), m_name(name)
+  {
+    if (name.empty())
+      throw 0;
+  }
+
+  float get_pos_x() const { return m_x; }
+  void set_velocity(float x, float y) { m_x += x; m_y += y; }
+  void set_name(const std::string& name) { m_name = name; }
+  std::string get_name() const { return m_name; }
+  int get_count(int a, bool b) const { return b ? a * 2 : a; }
+  void fail() { throw std::runtime_error("failed on purpose"); }
+
+private:
+  float m_x;
+  float m_y;
+  std::string m_name;
+};
+
+/** The glue miniswig used to generate for a getter and a setter, for
+    comparing against the templates */
+SQInteger DummyObject_get_pos_x_wrapper(HSQUIRRELVM vm)
+{
+  SQUserPointer data;
+  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
+    sq_throwerror(vm, _SC("'get_pos_x' called without instance"));
+    return SQ_ERROR;
+  }
+  DummyObject* _this = reinterpret_cast<DummyObject*> (data);
+
+  try {
+    float return_value = _this->get_pos_x();
+
+    sq_pushfloat(vm, return_value);
+    return 1;
+
+  } catch(std::exception& e) {
+    sq_throwerror(vm, e.what());
+    return SQ_ERROR;
+  } catch(...) {
+    sq_throwerror(vm, _SC("Unexpected exception while executing function 'get_pos_x'"));
+    return SQ_ERROR;
+  }
+}
+
+SQInteger DummyObject_set_velocity_wrapper(HSQUIRRELVM vm)
+{
+  SQUserPointer data;
+  if(SQ_FAILED(sq_getinstanceup(vm, 1, &data, nullptr, SQTrue)) || !data) {
+    sq_throwerror(vm, _SC("'set_velocity' called without instance"));
+    return SQ_ERROR;
+  }
+  DummyObject* _this = reinterpret_cast<DummyObject*> (data);
+
+  SQFloat arg0;
+  if(SQ_FAILED(sq_getfloat(vm, 2, &arg0))) {
+    sq_throwerror(vm, _SC("Argument 1 not a float"));
+    return SQ_ERROR;
+  }
+  SQFloat arg1;
+  if(SQ_FAILED(sq_getfloat(vm, 3, &arg1))) {
+    sq_throwerror(vm, _SC("Argument 2 not a float"));
+    return SQ_ERROR;
+  }
+
+  try {
+    _this->set_velocity(arg0, arg1);
+
+    return 0;
+
+  } catch(std::exception& e) {
+    sq_throwerror(vm, e.what());
+    return SQ_ERROR;
+  } catch(...) {
+    sq_throwerror(vm, _SC("Unexpected exception while executing function 'set_velocity'"));
+    return SQ_ERROR;
+  }
+}
+
+class SquirrelBindingTest : public ::testing::Test
+{
+protected:
+  SquirrelBindingTest() :
+    m_vm(),
+    m_object()
+  {
+  }
+
+  void SetUp() override
+  {
+    using namespace squirrel;
+
+    m_vm = sq_open(1024);
+    sq_pushroottable(m_vm);
+
+    begin_class(m_vm, "Dummy");
+    register_constructor<DummyObject, const std::string&>(m_vm, "Dummy");
+    register_function(m_vm, "get_pos_x", SQ_METHOD(DummyObject, get_pos_x));
+    register_function(m_vm, "set_velocity", SQ_METHOD(DummyObject, set_velocity));
+    register_function(m_vm, "set_name", SQ_METHOD(DummyObject, set_name));
+    register_function(m_vm, "get_name", SQ_METHOD(DummyObject, get_name));
+    register_function(m_vm, "get_count", SQ_METHOD(DummyObject, get_count));
+    register_function(m_vm, "fail", SQ_METHOD(DummyObject, fail));
+    end_class(m_vm, "Dummy");
+
+    begin_class(m_vm, "GeneratedDummy");
+    register_function(m_vm, "get_pos_x", &DummyObject_get_pos_x_wrapper, ".");
+    register_function(m_vm, "set_velocity", &DummyObject_set_velocity_wrapper, ".b|nb|n");
+    end_class(m_vm, "GeneratedDummy");
+
+    sq_pushstring(m_vm, "obj", -1);
+    create_instance(m_vm, &m_object, "Dummy", false);
+    sq_createslot(m_vm, -3);
+
+    sq_pushstring(m_vm, "generated", -1);
+    create_instance(m_vm, &m_object, "GeneratedDummy", false);
+    sq_createslot(m_vm, -3);
+
+    sq_pop(m_vm, 1);
+  }
+
+  void TearDown() override
+  {
+    sq_close(m_vm);
+  }
+
+  void run(const std::string& script)
+  {
+    std::istringstream in(script);
+    compile_and_run(m_vm, in, "test");
+  }
+
+  /** Runs \a script and returns the error it raised */
+  std::string run_error(const std::string& script)
+  {
+    try
+    {
+      run(script);
+    }
+    catch (const SquirrelError& err)
+    {
+      return err.what();
+    }
+    return "";
+  }
+
+  SQObjectType get_result(SQInteger* integer, SQFloat* number, std::string* string)
+  {
+    sq_pushroottable(m_vm);
+    sq_pushstring(m_vm, "result", -1);
+    sq_get(m_vm, -2);
+    const SQObjectType type = sq_gettype(m_vm, -1);
+    if (integer)
+      sq_getinteger(m_vm, -1, integer);
+    if (number)
+      sq_getfloat(m_vm, -1, number);
+    if (string)
+    {
+      const SQChar* value = nullptr;
+      if (SQ_SUCCEEDED(sq_getstring(m_vm, -1, &value)))
+        *string = value;
+    }
+    sq_pop(m_vm, 2);
+    return type;
+  }
+
+protected:
+  HSQUIRRELVM m_vm;
+  DummyObject m_object;
+};
+
+} // namespace
+
+TEST_F(SquirrelBindingTest, calls)
+{
+  run("obj.set_velocity(2, 0.5); result <- obj.get_pos_x();");
+  SQFloat x = 0.0f;
+  ASSERT_EQ(get_result(nullptr, &x, nullptr), OT_FLOAT);
+  ASSERT_FLOAT_EQ(x, 2.0f);
+
+  run("obj.set_name(\"tux\"); result <- obj.get_name();");
+  std::string name;
+  ASSERT_EQ(get_result(nullptr, nullptr, &name), OT_STRING);
+  ASSERT_EQ(name, "tux");
+
+  run("result <- obj.get_count(21, true);");
+  SQInteger count = 0;
+  ASSERT_EQ(get_result(&count, nullptr, nullptr), OT_INTEGER);
+  ASSERT_EQ(count, 42);
+
+  // the type mask lets bools through for integers, they read as 0 and 1
+  run("result <- obj.get_count(true, true);");
+  ASSERT_EQ(get_result(&count, nullptr, nullptr), OT_INTEGER);
+  ASSERT_EQ(count, 2);
+
+  run("result <- Dummy(\"penny\").get_name();");
+  ASSERT_EQ(get_result(nullptr, nullptr, &name), OT_STRING);
+  ASSERT_EQ(name, "penny");
+}
+
+TEST_F(SquirrelBindingTest, errors)
+{
+  // strings are rejected by the typemask, bools only by the wrapper
+  ASSERT_NE(run_error("obj.set_velocity(\"fast\", 1);").find("parameter 1 has an invalid type"), std::string::npos);
+  ASSERT_NE(run_error("obj.set_velocity(1, true);").find("Argument 2 not a float"), std::string::npos);
+
+  ASSERT_NE(run_error("obj.get_pos_x.call({});").find("'get_pos_x' called without instance"), std::string::npos);
+  ASSERT_NE(run_error("obj.fail();").find("failed on purpose"), std::string::npos);
+  ASSERT_NE(run_error("Dummy(\"\");").find("Unexpected exception while executing function 'constructor'"),
+            std::string::npos);
+
+  // same messages as the generated wrappers
+  ASSERT_EQ(run_error("obj.set_velocity(1, true);"), run_error("generated.set_velocity(1, true);"));
+  ASSERT_EQ(run_error("obj.get_pos_x.call({});"), run_error("generated.get_pos_x.call({});"));
+}
+
+/* EOF */
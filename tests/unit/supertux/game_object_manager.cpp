@@ -0,0 +1,79 @@
+//  SuperTux
+//  Copyright (C) 2024 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "supertux/game_object_manager.hpp"
+
+#include <gtest/gtest.h>
+
+#include "supertux/game_object.hpp"
+
+namespace {
+
+class DummyObject final : public GameObject
+{
+public:
+  DummyObject() : m_value(1) {}
+
+  void update(float) override {}
+  void draw(DrawingContext&) override {}
+
+  int m_value;
+};
+
+class DummyManager final : public GameObjectManager
+{
+public:
+  ~DummyManager() override
+  {
+    clear_objects();
+  }
+
+  bool before_object_add(GameObject&) override { return true; }
+  void before_object_remove(GameObject&) override {}
+};
+
+} // namespace
+
+TEST(GameObjectManagerTest, get_object_by_uid)
+{
+  DummyManager manager;
+  auto& object = manager.add<DummyObject>();
+  const UID uid = object.get_uid();
+
+  // queued up objects are accessible right away
+  ASSERT_EQ(manager.get_object_by_uid<DummyObject>(uid), &object);
+  manager.flush_game_objects();
+  ASSERT_EQ(manager.get_object_by_uid<DummyObject>(uid), &object);
+  ASSERT_EQ(manager.get_object_by_uid<DummyObject>(UID()), nullptr);
+
+  object.remove_me();
+  manager.flush_game_objects();
+  ASSERT_EQ(manager.get_object_by_uid<DummyObject>(uid), nullptr);
+
+  // the new object reuses the slot, but the old UID stays stale
+  auto& other = manager.add<DummyObject>();
+  ASSERT_EQ(other.get_uid().get_index(), uid.get_index());
+  ASSERT_NE(other.get_uid(), uid);
+  ASSERT_EQ(manager.get_object_by_uid<DummyObject>(uid), nullptr);
+  ASSERT_EQ(manager.get_object_by_uid<DummyObject>(other.get_uid()), &other);
+
+  // UIDs of other managers never resolve
+  DummyManager manager2;
+  auto& foreign = manager2.add<DummyObject>();
+  ASSERT_EQ(manager.get_object_by_uid<DummyObject>(foreign.get_uid()), nullptr);
+}
+
+/* EOF */
@@ -0,0 +1,217 @@
+//  SuperTux
+//  Copyright (C) 2024 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "supertux/level_batch.hpp"
+
+#include <gtest/gtest.h>
+
+#include <boost/filesystem.hpp>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+
+#include <physfs.h>
+
+#include "audio/sound_manager.hpp"
+#include "control/input_manager.hpp"
+#include "sprite/sprite_manager.hpp"
+#include "squirrel/squirrel_virtual_machine.hpp"
+#include "supertux/gameconfig.hpp"
+#include "supertux/globals.hpp"
+#include "supertux/level.hpp"
+#include "supertux/level_parser.hpp"
+#include "supertux/main.hpp"
+#include "supertux/resources.hpp"
+#include "supertux/tile_manager.hpp"
+#include "util/log.hpp"
+#include "util/reader_document.hpp"
+#include "video/null/null_video_system.hpp"
+#include "video/ttf_surface_manager.hpp"
+
+namespace {
+
+/** Two sectors with 15 coins, 2 badguys and 1 secret area */
+const char* const s_level =
+  "(supertux-level"
+  "  (version 3)"
+  "  (name \"Level batch test\")"
+  "  (license \"GPL 2+ / CC-by-sa 3.0\")"
+  "  (sector"
+  "    (name \"main\")"
+  "    (tilemap (solid #t) (width 2) (height 2) (tiles 0 0 0 0))"
+  "    (spawnpoint (name \"main\") (x 32) (y 32))"
+  "    (coin (x 64) (y 64))"
+  "    (coin (x 96) (y 64) (path (node (x 96) (y 64)) (node (x 160) (y 64))))"
+  "    (bonusblock (x 128) (y 32) (contents \"coin\") (count 3))"
+  "    (snowball (x 192) (y 64)))"
+  "  (sector"
+  "    (name \"secret\")"
+  "    (tilemap (solid #t) (width 2) (height 2) (tiles 0 0 0 0))"
+  "    (secretarea (x 0) (y 0) (width 64) (height 64) (message \"Secret\"))"
+  "    (goldbomb (x 64) (y 64))"
+  "    (stalactite (x 128) (y 0))))";
+
+std::string read_file(const std::string& filename)
+{
+  std::ifstream in(filename);
+  std::ostringstream out;
+  out << in.rdbuf();
+  return out.str();
+}
+
+} // namespace
+
+/** Sets up the subsystems that constructing sectors needs, the same
+    way --resave-levels does, and writes a level to a temporary
+    directory */
+class LevelBatchTest : public ::testing::Test
+{
+protected:
+  LevelBatchTest() :
+    m_log_level(),
+    m_old_config(),
+    m_config(),
+    m_sdl_subsystem(),
+    m_input_manager(),
+    m_video_system(),
+    m_ttf_surface_manager(),
+    m_sound_manager(),
+    m_squirrel_virtual_machine(),
+    m_tile_manager(),
+    m_sprite_manager(),
+    m_resources(),
+    m_directory(),
+    m_filename()
+  {}
+
+  void SetUp() override
+  {
+    PHYSFS_init("level_batch_test");
+    if (PHYSFS_mount("../data", nullptr, 1) == 0 || !PHYSFS_exists("images/tiles.strf"))
+    {
+      PHYSFS_deinit();
+      GTEST_SKIP() << "game data not found";
+    }
+
+    m_log_level = g_log_level;
+    g_log_level = LOG_WARNING;
+
+    m_old_config = g_config;
+    m_config.reset(new Config);
+    g_config = m_config.get();
+
+    try
+    {
+      m_sdl_subsystem.reset(new SDLSubsystem());
+    }
+    catch (const std::exception& err)
+    {
+      TearDown();
+      GTEST_SKIP() << err.what();
+    }
+
+    m_input_manager.reset(new InputManager(m_config->keyboard_config, m_config->joystick_config));
+    m_video_system.reset(new NullVideoSystem);
+    m_ttf_surface_manager.reset(new TTFSurfaceManager);
+    m_sound_manager.reset(new SoundManager);
+    m_sound_manager->enable_sound(false);
+    m_sound_manager->enable_music(false);
+    m_squirrel_virtual_machine.reset(new SquirrelVirtualMachine(false));
+    m_tile_manager.reset(new TileManager);
+    m_sprite_manager.reset(new SpriteManager);
+    m_resources.reset(new Resources);
+
+    m_directory = (boost::filesystem::temp_directory_path() /
+                   boost::filesystem::unique_path("level_batch_test_%%%%%%%%")).string();
+    boost::filesystem::create_directories(m_directory);
+    m_filename = (boost::filesystem::path(m_directory) / "level_batch_test.stl").string();
+    std::ofstream(m_filename) << s_level;
+  }
+
+  void TearDown() override
+  {
+    if (!m_config)
+      return;
+
+    if (!m_directory.empty())
+    {
+      boost::system::error_code ec;
+      boost::filesystem::remove_all(m_directory, ec);
+    }
+
+    m_resources.reset();
+    m_sprite_manager.reset();
+    m_tile_manager.reset();
+    m_squirrel_virtual_machine.reset();
+    m_sound_manager.reset();
+    m_ttf_surface_manager.reset();
+    m_video_system.reset();
+    m_input_manager.reset();
+    m_sdl_subsystem.reset();
+
+    g_config = m_old_config;
+    m_config.reset();
+    g_log_level = m_log_level;
+    PHYSFS_deinit();
+  }
+
+protected:
+  LogLevel m_log_level;
+  Config* m_old_config;
+  std::unique_ptr<Config> m_config;
+  std::unique_ptr<SDLSubsystem> m_sdl_subsystem;
+  std::unique_ptr<InputManager> m_input_manager;
+  std::unique_ptr<NullVideoSystem> m_video_system;
+  std::unique_ptr<TTFSurfaceManager> m_ttf_surface_manager;
+  std::unique_ptr<SoundManager> m_sound_manager;
+  std::unique_ptr<SquirrelVirtualMachine> m_squirrel_virtual_machine;
+  std::unique_ptr<TileManager> m_tile_manager;
+  std::unique_ptr<SpriteManager> m_sprite_manager;
+  std::unique_ptr<Resources> m_resources;
+  std::string m_directory;
+  std::string m_filename;
+};
+
+TEST_F(LevelBatchTest, validate)
+{
+  std::ostringstream report;
+  ASSERT_EQ(LevelBatch(m_directory, false).run(report), 0);
+  ASSERT_NE(report.str().find("(status \"ok\")"), std::string::npos);
+
+  // validating leaves the level alone
+  ASSERT_EQ(read_file(m_filename), s_level);
+}
+
+TEST_F(LevelBatchTest, resave)
+{
+  std::ostringstream report;
+  ASSERT_EQ(LevelBatch(m_directory, true).run(report), 0);
+  ASSERT_NE(report.str().find("(status \"ok\")"), std::string::npos);
+  ASSERT_FALSE(boost::filesystem::exists(m_filename + ".tmp"));
+
+  // the resaved level loads to the same level again
+  std::ifstream in(m_filename);
+  auto level = LevelParser::from_document(std::make_unique<ReaderDocument>(ReaderDocument::from_stream(in, m_filename)),
+                                          false, false);
+  ASSERT_EQ(level->get_name(), "Level batch test");
+  ASSERT_EQ(level->get_total_coins(), 15);
+  ASSERT_EQ(level->get_total_badguys(), 2);
+  ASSERT_EQ(level->get_total_secrets(), 1);
+  ASSERT_EQ(level->get_sector_count(), 2u);
+}
+
+/* EOF */
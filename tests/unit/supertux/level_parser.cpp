@@ -0,0 +1,201 @@
+//  SuperTux
+//  Copyright (C) 2024 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "supertux/level_parser.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+
+#include <physfs.h>
+
+#include "audio/sound_manager.hpp"
+#include "control/input_manager.hpp"
+#include "sprite/sprite_manager.hpp"
+#include "squirrel/squirrel_virtual_machine.hpp"
+#include "supertux/gameconfig.hpp"
+#include "supertux/globals.hpp"
+#include "supertux/level.hpp"
+#include "supertux/main.hpp"
+#include "supertux/resources.hpp"
+#include "supertux/sector.hpp"
+#include "supertux/tile_manager.hpp"
+#include "util/log.hpp"
+#include "video/null/null_video_system.hpp"
+#include "video/ttf_surface_manager.hpp"
+
+namespace {
+
+/** Two sectors, "main" with 6 coins and 1 badguy, "secret" with 13
+    coins, 1 badguy and 1 secret area. Tile 44 is a coin and tile 83 a
+    bonus block with a coin in tiles.strf, they become objects in solid
+    tilemaps only. */
+const char* const s_level =
+  "(supertux-level"
+  "  (version 3)"
+  "  (name \"Level parser test\")"
+  "  (license \"GPL 2+ / CC-by-sa 3.0\")"
+  "  (sector"
+  "    (name \"main\")"
+  "    (tilemap (solid #t) (width 2) (height 2) (tiles 44 0 0 0))"
+  "    (spawnpoint (name \"main\") (x 32) (y 32))"
+  "    (coin (x 64) (y 64))"
+  "    (coin (x 96) (y 64) (path (node (x 96) (y 64)) (node (x 160) (y 64))))"
+  "    (bonusblock (x 128) (y 32) (contents \"coin\") (count 3))"
+  "    (snowball (x 192) (y 64)))"
+  "  (sector"
+  "    (name \"secret\")"
+  "    (tilemap (solid #t) (width 2) (height 2) (tiles 44 83 0 44))"
+  "    (tilemap (solid #f) (width 2) (height 2) (tiles 44 83 44 83))"
+  "    (secretarea (x 0) (y 0) (width 64) (height 64) (message \"Secret\"))"
+  "    (goldbomb (x 64) (y 64))"
+  "    (stalactite (x 128) (y 0))))";
+
+} // namespace
+
+/** Sets up the subsystems that constructing sectors needs, the same
+    way --validate-levels does */
+class LevelParserTest : public ::testing::Test
+{
+protected:
+  LevelParserTest() :
+    m_log_level(),
+    m_old_config(),
+    m_config(),
+    m_sdl_subsystem(),
+    m_input_manager(),
+    m_video_system(),
+    m_ttf_surface_manager(),
+    m_sound_manager(),
+    m_squirrel_virtual_machine(),
+    m_tile_manager(),
+    m_sprite_manager(),
+    m_resources()
+  {}
+
+  void SetUp() override
+  {
+    PHYSFS_init("level_parser_test");
+    if (PHYSFS_mount("../data", nullptr, 1) == 0 || !PHYSFS_exists("images/tiles.strf"))
+    {
+      PHYSFS_deinit();
+      GTEST_SKIP() << "game data not found";
+    }
+
+    m_log_level = g_log_level;
+    g_log_level = LOG_WARNING;
+
+    m_old_config = g_config;
+    m_config.reset(new Config);
+    g_config = m_config.get();
+
+    try
+    {
+      m_sdl_subsystem.reset(new SDLSubsystem());
+    }
+    catch (const std::exception& err)
+    {
+      TearDown();
+      GTEST_SKIP() << err.what();
+    }
+
+    m_input_manager.reset(new InputManager(m_config->keyboard_config, m_config->joystick_config));
+    m_video_system.reset(new NullVideoSystem);
+    m_ttf_surface_manager.reset(new TTFSurfaceManager);
+    m_sound_manager.reset(new SoundManager);
+    m_sound_manager->enable_sound(false);
+    m_sound_manager->enable_music(false);
+    m_squirrel_virtual_machine.reset(new SquirrelVirtualMachine(false));
+    m_tile_manager.reset(new TileManager);
+    m_sprite_manager.reset(new SpriteManager);
+    m_resources.reset(new Resources);
+  }
+
+  void TearDown() override
+  {
+    if (!m_config)
+      return;
+
+    m_resources.reset();
+    m_sprite_manager.reset();
+    m_tile_manager.reset();
+    m_squirrel_virtual_machine.reset();
+    m_sound_manager.reset();
+    m_ttf_surface_manager.reset();
+    m_video_system.reset();
+    m_input_manager.reset();
+    m_sdl_subsystem.reset();
+
+    g_config = m_old_config;
+    m_config.reset();
+    g_log_level = m_log_level;
+    PHYSFS_deinit();
+  }
+
+protected:
+  LogLevel m_log_level;
+  Config* m_old_config;
+  std::unique_ptr<Config> m_config;
+  std::unique_ptr<SDLSubsystem> m_sdl_subsystem;
+  std::unique_ptr<InputManager> m_input_manager;
+  std::unique_ptr<NullVideoSystem> m_video_system;
+  std::unique_ptr<TTFSurfaceManager> m_ttf_surface_manager;
+  std::unique_ptr<SoundManager> m_sound_manager;
+  std::unique_ptr<SquirrelVirtualMachine> m_squirrel_virtual_machine;
+  std::unique_ptr<TileManager> m_tile_manager;
+  std::unique_ptr<SpriteManager> m_sprite_manager;
+  std::unique_ptr<Resources> m_resources;
+};
+
+TEST_F(LevelParserTest, deferred_sectors)
+{
+  auto level = LevelParser::from_string(s_level, "levels/test/level_parser_test.stl", false, false);
+
+  // only the start sector is constructed until another one is needed
+  ASSERT_EQ(level->m_sectors.size(), 1u);
+  ASSERT_EQ(level->m_sectors.front()->get_name(), "main");
+
+  Sector* secret = level->get_sector("secret");
+  ASSERT_NE(secret, nullptr);
+  ASSERT_EQ(secret->get_name(), "secret");
+  ASSERT_EQ(level->m_sectors.size(), 2u);
+
+  // constructed only once
+  ASSERT_EQ(level->get_sector("secret"), secret);
+  ASSERT_EQ(level->m_sectors.size(), 2u);
+  ASSERT_EQ(level->get_sector("missing"), nullptr);
+
+  ASSERT_EQ(level->get_sector_count(), 2u);
+  ASSERT_EQ(level->get_sector("main")->get_name(), "main");
+}
+
+TEST_F(LevelParserTest, deferred_totals)
+{
+  auto deferred = LevelParser::from_string(s_level, "levels/test/level_parser_test.stl", false, false);
+  ASSERT_EQ(deferred->m_sectors.size(), 1u);
+  ASSERT_EQ(deferred->m_stats.m_total_coins, 19);
+  ASSERT_EQ(deferred->m_stats.m_total_badguys, 2);
+  ASSERT_EQ(deferred->m_stats.m_total_secrets, 1);
+
+  // the totals counted from the constructed sectors
+  deferred->construct_deferred_sectors();
+  ASSERT_EQ(deferred->get_total_coins(), deferred->m_stats.m_total_coins);
+  ASSERT_EQ(deferred->get_total_badguys(), deferred->m_stats.m_total_badguys);
+  ASSERT_EQ(deferred->get_total_secrets(), deferred->m_stats.m_total_secrets);
+}
+
+/* EOF */
@@ -0,0 +1,85 @@
+//  SuperTux
+//  Copyright (C) 2024 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "util/frame_arena.hpp"
+
+#include <gtest/gtest.h>
+
+#include <stdint.h>
+#include <vector>
+
+#include "math/rectf.hpp"
+
+TEST(FrameArenaTest, alignment)
+{
+  FrameArena arena(64);
+  arena.allocate(1, 1);
+  void* ptr = arena.allocate(8, 8);
+  ASSERT_EQ(reinterpret_cast<uintptr_t>(ptr) % 8, 0u);
+  ASSERT_EQ(arena.get_bytes_used(), 16u);
+}
+
+TEST(FrameArenaTest, spans)
+{
+  FrameArena arena;
+  auto angles = arena.make_span<float>(3, 90.0f);
+  ASSERT_EQ(angles.size(), 3u);
+  ASSERT_FLOAT_EQ(angles[2], 90.0f);
+
+  std::vector<Rectf> rects = { Rectf(0.0f, 0.0f, 32.0f, 32.0f), Rectf(32.0f, 0.0f, 64.0f, 32.0f) };
+  auto copy = arena.copy_span(rects);
+  rects.clear();
+  ASSERT_EQ(copy.size(), 2u);
+  ASSERT_FLOAT_EQ(copy[1].get_left(), 32.0f);
+}
+
+TEST(FrameArenaTest, double_buffering)
+{
+  FrameArena arena(64);
+
+  auto first = arena.make_span<int>(4, 1);
+  arena.next_frame();
+  auto second = arena.make_span<int>(4, 2);
+
+  // the previous frame stays intact while the next one is recorded
+  ASSERT_NE(first.data(), second.data());
+  ASSERT_EQ(first[3], 1);
+
+  arena.next_frame();
+  auto third = arena.make_span<int>(4, 3);
+  ASSERT_EQ(first.data(), third.data());
+  ASSERT_EQ(second[3], 2);
+}
+
+TEST(FrameArenaTest, overflow)
+{
+  FrameArena arena(64);
+  arena.allocate(48);
+  arena.allocate(48);
+  ASSERT_EQ(arena.get_bytes_used(), 96u);
+
+  // overflowing chunks are merged, so the next use of this buffer
+  // fits without growing it
+  arena.next_frame();
+  arena.next_frame();
+  const size_t capacity = arena.get_capacity();
+  arena.allocate(48);
+  arena.allocate(48);
+  ASSERT_EQ(arena.get_bytes_used(), 96u);
+  ASSERT_EQ(arena.get_capacity(), capacity);
+}
+
+/* EOF */
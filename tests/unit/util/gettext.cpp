@@ -0,0 +1,92 @@
+//  SuperTux
+//  Copyright (C) 2024 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "util/gettext.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+/** Provides a single German dictionary in every directory */
+class GermanFileSystem final : public tinygettext::FileSystem
+{
+public:
+  GermanFileSystem() {}
+
+  std::vector<std::string> open_directory(const std::string&) override
+  {
+    return { "de.po" };
+  }
+
+  std::unique_ptr<std::istream> open_file(const std::string&) override
+  {
+    return std::make_unique<std::istringstream>(
+      "msgid \"\"\n"
+      "msgstr \"\"\n"
+      "\"Content-Type: text/plain; charset=UTF-8\\n\"\n"
+      "\"Plural-Forms: nplurals=2; plural=(n != 1);\\n\"\n"
+      "\n"
+      "msgid \"Coins\"\n"
+      "msgstr \"Münzen\"\n");
+  }
+
+private:
+  GermanFileSystem(const GermanFileSystem&) = delete;
+  GermanFileSystem& operator=(const GermanFileSystem&) = delete;
+};
+
+const std::string& translate_coins()
+{
+  return _s("Coins");
+}
+
+} // namespace
+
+TEST(GettextTest, registered_messages)
+{
+  const std::string& coins = translate_coins();
+  ASSERT_EQ(coins, "Coins");
+
+  // the same call site hands out the same string
+  ASSERT_EQ(&coins, &translate_coins());
+}
+
+TEST(GettextTest, invalidate_translations)
+{
+  g_dictionary_manager.reset(new tinygettext::DictionaryManager(std::make_unique<GermanFileSystem>(), "UTF-8"));
+  g_dictionary_manager->add_directory("locale");
+  g_dictionary_manager->set_language(tinygettext::Language::from_name("de"));
+  invalidate_translations();
+
+  ASSERT_EQ(translate_coins(), "Münzen");
+  ASSERT_EQ(_("Coins"), "Münzen");
+
+  g_dictionary_manager->set_language(tinygettext::Language::from_name("en"));
+  invalidate_translations();
+
+  // registered messages look up their translation again
+  ASSERT_EQ(translate_coins(), "Coins");
+
+  g_dictionary_manager.reset();
+  invalidate_translations();
+}
+
+/* EOF */
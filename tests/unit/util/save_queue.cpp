@@ -0,0 +1,112 @@
+//  SuperTux
+//  Copyright (C) 2024 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "util/save_queue.hpp"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include <physfs.h>
+
+#include "util/file_system.hpp"
+#include "util/reader_document.hpp"
+#include "util/reader_mapping.hpp"
+#include "util/writer.hpp"
+
+namespace {
+
+/** Something the size of a big level */
+void write_level(Writer& writer)
+{
+  std::vector<unsigned int> tiles(400 * 60, 42);
+  writer.start_list("supertux-level");
+  writer.write("name", "Save queue test");
+  for (int i = 0; i < 8; ++i)
+  {
+    writer.start_list("tilemap");
+    writer.write("width", 400);
+    writer.write("height", 60);
+    writer.write("tiles", tiles, 400);
+    writer.end_list("tilemap");
+  }
+  writer.end_list("supertux-level");
+}
+
+class SaveQueueTest : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    PHYSFS_init("save_queue_test");
+    PHYSFS_setWriteDir(".");
+    PHYSFS_mount(".", nullptr, 1);
+  }
+
+  void TearDown() override
+  {
+    PHYSFS_delete("save_queue_test.stl");
+    PHYSFS_deinit();
+  }
+};
+
+} // namespace
+
+TEST_F(SaveQueueTest, save_file)
+{
+  std::vector<std::string> errors;
+  {
+    SaveQueue queue;
+    for (int i = 0; i < 3; ++i)
+    {
+      SaveQueue::save_file("save_queue_test.stl", write_level,
+                           [&errors](const std::string& error) { errors.push_back(error); });
+    }
+    SaveQueue::save_file("missing/directory/save_queue_test.stl", write_level,
+                         [&errors](const std::string& error) { errors.push_back(error); });
+    queue.flush();
+  }
+
+  ASSERT_EQ(errors.size(), 4u);
+  ASSERT_TRUE(errors[0].empty());
+  ASSERT_TRUE(errors[2].empty());
+  ASSERT_FALSE(errors[3].empty());
+
+  ASSERT_FALSE(PHYSFS_exists("save_queue_test.stl.tmp"));
+  auto doc = ReaderDocument::from_file("save_queue_test.stl");
+  std::string name;
+  ASSERT_TRUE(doc.get_root().get_mapping().get("name", name));
+  ASSERT_EQ(name, "Save queue test");
+}
+
+TEST_F(SaveQueueTest, save_file_without_queue)
+{
+  // without a SaveQueue the file is written right away
+  ASSERT_EQ(SaveQueue::current(), nullptr);
+  std::string error = "not called";
+  SaveQueue::save_file("save_queue_test.stl", write_level,
+                       [&error](const std::string& err) { error = err; });
+  ASSERT_TRUE(error.empty());
+
+  ASSERT_FALSE(PHYSFS_exists("save_queue_test.stl.tmp"));
+  auto doc = ReaderDocument::from_file("save_queue_test.stl");
+  std::string name;
+  ASSERT_TRUE(doc.get_root().get_mapping().get("name", name));
+  ASSERT_EQ(name, "Save queue test");
+}
+
+/* EOF */
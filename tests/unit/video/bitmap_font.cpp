@@ -0,0 +1,163 @@
+//  SuperTux
+//  Copyright (C) 2024 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "video/bitmap_font.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+
+#include <physfs.h>
+
+#include "supertux/gameconfig.hpp"
+#include "supertux/globals.hpp"
+#include "util/frame_arena.hpp"
+#include "util/log.hpp"
+#include "video/canvas.hpp"
+#include "video/drawing_context.hpp"
+#include "video/drawing_request.hpp"
+#include "video/null/null_video_system.hpp"
+
+class BitmapFontTest : public ::testing::Test
+{
+protected:
+  BitmapFontTest() :
+    m_log_level(),
+    m_old_config(),
+    m_config(),
+    m_video_system()
+  {}
+
+  void SetUp() override
+  {
+    PHYSFS_init("bitmap_font_test");
+    if (PHYSFS_mount("../data", nullptr, 1) == 0 || !PHYSFS_exists("fonts/white.stf"))
+    {
+      PHYSFS_deinit();
+      GTEST_SKIP() << "game data not found";
+    }
+
+    m_log_level = g_log_level;
+    g_log_level = LOG_WARNING;
+
+    m_old_config = g_config;
+    m_config.reset(new Config);
+    g_config = m_config.get();
+
+    m_video_system.reset(new NullVideoSystem);
+  }
+
+  void TearDown() override
+  {
+    if (!m_video_system)
+      return;
+
+    m_video_system.reset();
+    g_config = m_old_config;
+    m_config.reset();
+    g_log_level = m_log_level;
+    PHYSFS_deinit();
+  }
+
+protected:
+  LogLevel m_log_level;
+  Config* m_old_config;
+  std::unique_ptr<Config> m_config;
+  std::unique_ptr<NullVideoSystem> m_video_system;
+};
+
+TEST_F(BitmapFontTest, cached_layout_matches_uncached)
+{
+  BitmapFont cached_font(BitmapFont::VARIABLE, "fonts/white.stf");
+  BitmapFont uncached_font(BitmapFont::VARIABLE, "fonts/white.stf", 2, false);
+  FrameArena arena;
+  DrawingContext cached(*m_video_system, arena, false);
+  DrawingContext uncached(*m_video_system, arena, false);
+
+  const std::string texts[] = {
+    "Coins", "Press escape to skip", "two\nlines", "trailing newline\n",
+    "\n\nempty lines\n\n", "   spaces   ", "Ünïcödé", ""
+  };
+  const FontAlignment alignments[] = { ALIGN_LEFT, ALIGN_CENTER, ALIGN_RIGHT };
+
+  for (const auto& text : texts)
+  {
+    for (const auto alignment : alignments)
+    {
+      // drawn twice, so that the second draw comes from the cache
+      cached_font.draw_text(cached.color(), text, Vector(320.5f, 16.0f), alignment, 0, Color::WHITE);
+      cached.color().clear();
+      cached_font.draw_text(cached.color(), text, Vector(320.5f, 16.0f), alignment, 0, Color::WHITE);
+
+      uncached_font.draw_text(uncached.color(), text, Vector(320.5f, 16.0f), alignment, 0, Color::WHITE);
+
+      const auto& cached_requests = cached.color().get_requests();
+      const auto& uncached_requests = uncached.color().get_requests();
+      ASSERT_EQ(cached_requests.size(), uncached_requests.size()) << text;
+      for (size_t i = 0; i < cached_requests.size(); ++i)
+      {
+        const auto& lhs = static_cast<const TextureRequest&>(*cached_requests[i]);
+        const auto& rhs = static_cast<const TextureRequest&>(*uncached_requests[i]);
+        ASSERT_EQ(lhs.texture, rhs.texture) << text;
+        ASSERT_EQ(lhs.srcrects.size(), rhs.srcrects.size()) << text;
+        ASSERT_EQ(lhs.dstrects.size(), rhs.dstrects.size()) << text;
+        for (size_t j = 0; j < lhs.dstrects.size(); ++j)
+        {
+          ASSERT_EQ(lhs.srcrects[j], rhs.srcrects[j]) << text;
+          ASSERT_EQ(lhs.dstrects[j], rhs.dstrects[j]) << text;
+        }
+      }
+
+      cached.color().clear();
+      uncached.color().clear();
+    }
+  }
+}
+
+TEST_F(BitmapFontTest, cleanup_layouts)
+{
+  const float old_game_time = g_game_time;
+
+  BitmapFont font(BitmapFont::VARIABLE, "fonts/white.stf");
+  FrameArena arena;
+  DrawingContext context(*m_video_system, arena, false);
+
+  // fill the cache up to its cleanup size
+  g_game_time = 0.0f;
+  for (int i = 0; i < 255; ++i)
+  {
+    font.draw_text(context.color(), std::to_string(i), Vector(0.0f, 0.0f), ALIGN_LEFT, 0, Color::WHITE);
+  }
+  g_game_time = 5.0f;
+  font.draw_text(context.color(), "recent", Vector(0.0f, 0.0f), ALIGN_LEFT, 0, Color::WHITE);
+  ASSERT_EQ(font.get_layout_count(), 256u);
+
+  // drawing a cached text doesn't clean up
+  g_game_time = 11.0f;
+  font.draw_text(context.color(), "recent", Vector(0.0f, 0.0f), ALIGN_LEFT, 0, Color::WHITE);
+  ASSERT_EQ(font.get_layout_count(), 256u);
+
+  // a new text evicts everything not drawn in the last ten seconds
+  g_game_time = 15.5f;
+  font.draw_text(context.color(), "new", Vector(0.0f, 0.0f), ALIGN_LEFT, 0, Color::WHITE);
+  ASSERT_EQ(font.get_layout_count(), 2u);
+
+  context.color().clear();
+  g_game_time = old_game_time;
+}
+
+/* EOF */
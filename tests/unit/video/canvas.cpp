@@ -0,0 +1,125 @@
+//  SuperTux
+//  Copyright (C) 2024 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "video/canvas.hpp"
+
+#include <gtest/gtest.h>
+
+#include "supertux/gameconfig.hpp"
+#include "supertux/globals.hpp"
+#include "util/frame_arena.hpp"
+#include "util/log.hpp"
+#include "video/drawing_context.hpp"
+#include "video/drawing_request.hpp"
+#include "video/layer.hpp"
+#include "video/null/null_texture.hpp"
+#include "video/null/null_video_system.hpp"
+#include "video/surface.hpp"
+
+TEST(CanvasTest, sort_keeps_drawing_order)
+{
+  const LogLevel log_level = g_log_level;
+  g_log_level = LOG_WARNING;
+
+  Config* old_config = g_config;
+  Config config;
+  g_config = &config;
+
+  {
+    NullVideoSystem video_system;
+    FrameArena arena;
+    DrawingContext context(video_system, arena, false);
+    SurfacePtr surface = Surface::from_texture(TexturePtr(new NullTexture(Size(32, 32))));
+
+    // the x position records the drawing order
+    const int layers[] = { 5, 1, 5, 3, 1, 5, 3 };
+    for (int i = 0; i < 7; ++i)
+    {
+      context.color().draw_surface(surface, Vector(static_cast<float>(i), 0.0f), layers[i]);
+    }
+    context.color().sort();
+
+    const auto& requests = context.color().get_requests();
+    ASSERT_EQ(requests.size(), 7u);
+    const int expected[] = { 1, 4, 3, 6, 0, 2, 5 };
+    for (int i = 0; i < 7; ++i)
+    {
+      const auto& request = static_cast<const TextureRequest&>(*requests[i]);
+      ASSERT_FLOAT_EQ(request.dstrects[0].get_left(), static_cast<float>(expected[i]));
+    }
+  }
+
+  g_config = old_config;
+  g_log_level = log_level;
+}
+
+TEST(CanvasTest, batch_lights)
+{
+  const LogLevel log_level = g_log_level;
+  g_log_level = LOG_WARNING;
+
+  Config* old_config = g_config;
+  Config config;
+  g_config = &config;
+
+  {
+    NullVideoSystem video_system;
+    FrameArena arena;
+    DrawingContext context(video_system, arena, false);
+    SurfacePtr light = Surface::from_texture(TexturePtr(new NullTexture(Size(64, 64))));
+    SurfacePtr other = Surface::from_texture(TexturePtr(new NullTexture(Size(64, 64))));
+
+    // two runs of identical lights, split by a light of another color
+    // and one of another texture
+    for (int i = 0; i < 10; ++i)
+    {
+      const Color color = i == 4 ? Color(1.0f, 0.0f, 1.0f) : Color::WHITE;
+      context.light().draw_surface(i == 7 ? other : light, Vector(static_cast<float>(i) * 32.0f, 0.0f),
+                                   0.0f, color, Blend::ADD, 0);
+    }
+
+    // off screen, both with and without rotation
+    context.light().draw_surface(light, Vector(-1000.0f, 0.0f), 0.0f, Color::WHITE, Blend::ADD, 0);
+    context.light().draw_surface(light, Vector(-70.0f, -70.0f), 0.0f, Color::WHITE, Blend::ADD, 0);
+    ASSERT_EQ(context.light().get_requests().size(), 11u);
+
+    // touches the screen only when rotated
+    context.light().draw_surface(light, Vector(-70.0f, -70.0f), 45.0f, Color::WHITE, Blend::ADD, 0);
+    ASSERT_EQ(context.light().get_requests().size(), 12u);
+
+    context.light().render(video_system.get_lightmap(), Canvas::ALL);
+
+    const auto& requests = context.light().get_requests();
+    ASSERT_EQ(requests.size(), 5u);
+    const size_t sizes[] = { 4, 1, 2, 1, 3 };
+    for (size_t i = 0; i < requests.size(); ++i)
+    {
+      ASSERT_EQ(static_cast<const TextureRequest&>(*requests[i]).dstrects.size(), sizes[i]);
+    }
+
+    // the batched rects keep their drawing order
+    const auto& first = static_cast<const TextureRequest&>(*requests[0]);
+    for (size_t i = 0; i < first.dstrects.size(); ++i)
+    {
+      ASSERT_FLOAT_EQ(first.dstrects[i].get_left(), static_cast<float>(i) * 32.0f);
+    }
+  }
+
+  g_config = old_config;
+  g_log_level = log_level;
+}
+
+/* EOF */
@@ -0,0 +1,145 @@
+//  SuperTux
+//  Copyright (C) 2024 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "video/gl/gl_stream_buffer.hpp"
+
+#include <gtest/gtest.h>
+
+#ifdef HAVE_OPENGL
+
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include <SDL.h>
+
+#include "supertux/gameconfig.hpp"
+#include "supertux/globals.hpp"
+#include "video/gl/gl_video_system.hpp"
+
+namespace {
+
+/** Creates a GL context to upload into, the tests are skipped where
+    no display is available */
+class GLStreamBufferTest : public ::testing::Test
+{
+protected:
+  GLStreamBufferTest() :
+    m_old_config(),
+    m_config(),
+    m_video_system()
+  {
+  }
+
+  void SetUp() override
+  {
+    m_old_config = g_config;
+    m_config.reset(new Config);
+    g_config = m_config.get();
+
+    if (SDL_Init(SDL_INIT_VIDEO) != 0)
+      GTEST_SKIP() << "no video: " << SDL_GetError();
+
+    try
+    {
+      m_video_system.reset(new GLVideoSystem(false, true));
+    }
+    catch (const std::exception& err)
+    {
+      GTEST_SKIP() << "no OpenGL context: " << err.what();
+    }
+  }
+
+  void TearDown() override
+  {
+    m_video_system.reset();
+    SDL_Quit();
+    g_config = m_old_config;
+  }
+
+protected:
+  Config* m_old_config;
+  std::unique_ptr<Config> m_config;
+  std::unique_ptr<GLVideoSystem> m_video_system;
+};
+
+} // namespace
+
+TEST_F(GLStreamBufferTest, upload)
+{
+  GLStreamBuffer buffer(256);
+  const std::vector<char> data(40);
+  const std::vector<char> large_data(200);
+
+  ASSERT_EQ(buffer.upload(data.data(), data.size()), 0u);
+
+  // uploads are aligned
+  ASSERT_EQ(buffer.upload(data.data(), data.size()), 48u);
+
+  // the end of the buffer is reached, the storage gets orphaned
+  const int generation = buffer.get_generation();
+  ASSERT_EQ(buffer.upload(large_data.data(), large_data.size()), 0u);
+  ASSERT_EQ(buffer.get_generation(), generation + 1);
+}
+
+TEST_F(GLStreamBufferTest, reserve_wraps_before_the_first_attribute)
+{
+  GLStreamBuffer buffer(256);
+  const std::vector<char> filler(100);
+  const std::vector<float> positions(16);
+  const std::vector<float> colors(32);
+  buffer.upload(filler.data(), filler.size());
+
+  // positions would still fit at 112, but the colors would wrap
+  // around and orphan the storage the positions went into
+  const int generation = buffer.get_generation();
+  buffer.reserve(sizeof(float) * (positions.size() + colors.size()), 2);
+  ASSERT_EQ(buffer.get_generation(), generation + 1);
+
+  ASSERT_EQ(buffer.upload(positions.data(), sizeof(float) * positions.size()), 0u);
+  ASSERT_EQ(buffer.upload(colors.data(), sizeof(float) * colors.size()), 64u);
+  ASSERT_EQ(buffer.get_generation(), generation + 1);
+}
+
+TEST_F(GLStreamBufferTest, reserve_keeps_storage_with_room)
+{
+  GLStreamBuffer buffer(256);
+  const std::vector<char> data(20);
+  buffer.upload(data.data(), data.size());
+
+  const int generation = buffer.get_generation();
+  buffer.reserve(2 * data.size(), 2);
+  ASSERT_EQ(buffer.upload(data.data(), data.size()), 32u);
+  ASSERT_EQ(buffer.upload(data.data(), data.size()), 64u);
+  ASSERT_EQ(buffer.get_generation(), generation);
+}
+
+TEST_F(GLStreamBufferTest, reserve_grows)
+{
+  GLStreamBuffer buffer(256);
+  const std::vector<char> data(300);
+
+  const int generation = buffer.get_generation();
+  buffer.reserve(2 * data.size(), 2);
+  ASSERT_EQ(buffer.get_generation(), generation + 1);
+  ASSERT_EQ(buffer.upload(data.data(), data.size()), 0u);
+  ASSERT_EQ(buffer.upload(data.data(), data.size()), 304u);
+  ASSERT_EQ(buffer.get_generation(), generation + 1);
+}
+
+#endif
+
+/* EOF */
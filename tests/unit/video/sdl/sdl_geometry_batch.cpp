@@ -0,0 +1,80 @@
+//  SuperTux
+//  Copyright (C) 2024 SuperTux Devs
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "video/sdl/sdl_geometry_batch.hpp"
+
+#include <gtest/gtest.h>
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+
+TEST(SDLGeometryBatchTest, add_quad)
+{
+  SDLGeometryBatch batch;
+  batch.clear(64, 32);
+  batch.add_quad(SDL_Rect{32, 0, 32, 32}, SDL_Rect{100, 200, 32, 32},
+                 0.0f, SDL_FLIP_NONE, SDL_Color{255, 128, 0, 255});
+
+  const auto& vertices = batch.get_vertices();
+  ASSERT_EQ(vertices.size(), 4u);
+  ASSERT_EQ(batch.get_indices().size(), 6u);
+
+  ASSERT_FLOAT_EQ(vertices[0].position.x, 100.0f);
+  ASSERT_FLOAT_EQ(vertices[0].position.y, 200.0f);
+  ASSERT_FLOAT_EQ(vertices[2].position.x, 132.0f);
+  ASSERT_FLOAT_EQ(vertices[2].position.y, 232.0f);
+
+  ASSERT_FLOAT_EQ(vertices[0].tex_coord.x, 0.5f);
+  ASSERT_FLOAT_EQ(vertices[0].tex_coord.y, 0.0f);
+  ASSERT_FLOAT_EQ(vertices[2].tex_coord.x, 1.0f);
+  ASSERT_FLOAT_EQ(vertices[2].tex_coord.y, 1.0f);
+
+  ASSERT_EQ(vertices[1].color.g, 128);
+}
+
+TEST(SDLGeometryBatchTest, flip)
+{
+  SDLGeometryBatch batch;
+  batch.clear(32, 32);
+  batch.add_quad(SDL_Rect{0, 0, 32, 32}, SDL_Rect{0, 0, 32, 32},
+                 0.0f, static_cast<SDL_RendererFlip>(SDL_FLIP_HORIZONTAL | SDL_FLIP_VERTICAL),
+                 SDL_Color{255, 255, 255, 255});
+
+  const auto& vertices = batch.get_vertices();
+  ASSERT_FLOAT_EQ(vertices[0].tex_coord.x, 1.0f);
+  ASSERT_FLOAT_EQ(vertices[0].tex_coord.y, 1.0f);
+  ASSERT_FLOAT_EQ(vertices[2].tex_coord.x, 0.0f);
+  ASSERT_FLOAT_EQ(vertices[2].tex_coord.y, 0.0f);
+}
+
+TEST(SDLGeometryBatchTest, rotation)
+{
+  SDLGeometryBatch batch;
+  batch.clear(32, 32);
+  batch.add_quad(SDL_Rect{0, 0, 32, 16}, SDL_Rect{0, 0, 32, 16},
+                 90.0f, SDL_FLIP_NONE, SDL_Color{255, 255, 255, 255});
+
+  // Rotated clockwise around the center (16, 8), the top left
+  // corner ends up at the top right
+  const auto& vertices = batch.get_vertices();
+  ASSERT_NEAR(vertices[0].position.x, 24.0f, 0.001f);
+  ASSERT_NEAR(vertices[0].position.y, -8.0f, 0.001f);
+  ASSERT_NEAR(vertices[2].position.x, 8.0f, 0.001f);
+  ASSERT_NEAR(vertices[2].position.y, 24.0f, 0.001f);
+}
+
+#endif
+
+/* EOF */